@@ -32,6 +32,7 @@
 #include "Molten/Ecs/EcsSystem.hpp"
 #include "Molten/Ecs/EcsEntity.hpp"
 #include "Molten/Ecs/EcsComponent.hpp"
+#include "Molten/Ecs/EcsHierarchy.hpp"
 #include <map>
 #include <queue>
 #include <set>
@@ -40,6 +41,8 @@
 namespace Molten
 {
 
+    class ThreadPool;
+
     namespace Ecs
     {
 
@@ -139,6 +142,45 @@ namespace Molten
             const Comp* GetComponent(const Entity<Context>& entity) const;
             /**@}*/
 
+            /**
+            * @brief Attach entity as child of provided parent entity.
+            *        Any previous parent of the child entity is replaced.
+            *        Children of destroyed entities are detached and become roots of their own trees.
+            *
+            * @throw Exception if the relation would create a cycle.
+            */
+            void SetParent(Entity<Context>& child, Entity<Context>& parent);
+
+            /**
+            * @brief Detach entity from its parent. Children of the entity are kept.
+            */
+            void RemoveParent(Entity<Context>& child);
+
+            /**
+            * @brief Get parent of entity.
+            *
+            * @return Parent entity, an empty entity if provided entity has no parent.
+            */
+            Entity<Context> GetParent(const Entity<Context>& entity) const;
+
+            /**
+            * @brief Get number of children attached to entity.
+            */
+            size_t GetChildCount(const Entity<Context>& entity) const;
+
+            /**
+            * @brief Propagate component data from parents to children, for example local to world transforms.
+            *        The callback, with signature void(const Comp& parent, Comp& child), is called for each parent/child relation.
+            *        Relations are visited breadth first, guaranteeing that the parent is processed before its children.
+            *        Relations where parent or child is missing the component are skipped.
+            *
+            * @param threadPool Thread pool used for parallel propagation, propagation is done by the calling thread if nullptr.
+            *                   Independent trees are distributed over the workers and the calling thread,
+            *                   so the callback must only access the provided components.
+            */
+            template<typename Comp, typename Callback>
+            void PropagateHierarchy(Callback&& callback, ThreadPool* threadPool = nullptr);
+
         protected:
 
             /**
@@ -198,6 +240,14 @@ namespace Molten
 
             void InternalRemoveAllComponents(Entity<Context<DerivedContext>>& entity);
 
+            /**
+            * @brief Propagate component data of nodes in range [begin, end) of the flattened hierarchy.
+            *        Scratch is resized to the range and filled with component pointers of its nodes.
+            */
+            template<typename Comp, typename Callback>
+            void PropagateHierarchyRange(Callback& callback, const typename Private::EntityHierarchy<Context>::Nodes& nodes,
+                                         const size_t begin, const size_t end, std::vector<Byte*>& scratch);
+
 
             ContextDescriptor m_descriptor;         ///< Context descriptor, containing configurations. 
             Allocator m_allocator;                  ///< Memory allocator, taking care of memory allocations.
@@ -207,6 +257,8 @@ namespace Molten
             EntityId m_nextEntityId;                ///< The next availalbe entity ID.
             std::queue<EntityId> m_freeEntityIds;   ///< Queue of deleted entity ID's, ready for reuse.
             Systems m_systems;                      ///< Set of registered systems.
+            Private::EntityHierarchy<Context> m_hierarchy; ///< Parent/child relations of entities.
+            std::vector<std::vector<Byte*>> m_hierarchyScratch; ///< Component pointers of each propagated node range, reused between calls.
 
         };
 
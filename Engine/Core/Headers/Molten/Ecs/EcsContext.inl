@@ -23,11 +23,14 @@
 *
 */
 
+#include "Molten/System/Profiler.hpp"
+#include "Molten/System/ThreadPool.hpp"
 #include "Molten/Utility/SmartFunction.hpp"
 #include <algorithm>
 #include <vector>
 #include <cstring>
 #include <memory>
+#include <future>
 
 namespace Molten
 {
@@ -98,6 +101,7 @@ namespace Molten
         template<typename ... Components>
         inline Entity<Context<DerivedContext> > Context<DerivedContext>::CreateEntity()
         {
+            MOLTEN_PROFILE_ZONE("Ecs::Context::CreateEntity");
             static_assert(Private::AreExplicitContextComponentTypes<Context, Components...>(), "Implicit component type.");
 
             // Make sure the size of each component is larger than 0 bytes.
@@ -112,7 +116,7 @@ namespace Molten
 
             // Create the entity.
             EntityId entityId = GetNextEntityId();
-            auto metaData = std::make_unique< Private::EntityMetaData<Context> >(this, signature);
+            auto metaData = std::make_unique< Private::EntityMetaData<Context> >(this, signature, entityId);
             
             Entity<Context> entity(metaData.get(), entityId);
 
@@ -188,6 +192,7 @@ namespace Molten
         template<typename DerivedContext>
         inline void Context<DerivedContext>::DestroyEntity(Entity<Context<DerivedContext> >& entity)
         {
+            MOLTEN_PROFILE_ZONE("Ecs::Context::DestroyEntity");
             auto* metaData = entity.m_metaData;
             if (!metaData)
             {
@@ -204,6 +209,8 @@ namespace Molten
                 return;
             }
 
+            m_hierarchy.Remove(metaData);
+
             auto& componentGroups = metaData->componentGroups;
             for (auto& componentGroup : componentGroups)
             {
@@ -231,6 +238,7 @@ namespace Molten
         template<typename ... Components>
         inline void Context<DerivedContext>::AddComponents(Entity<Context<DerivedContext>>& entity)
         {
+            MOLTEN_PROFILE_ZONE("Ecs::Context::AddComponents");
             static_assert(Private::AreExplicitContextComponentTypes<Context, Components...>(), "Implicit component type.");
 
             // Ignore if template parameter list is empty.
@@ -387,6 +395,7 @@ namespace Molten
         template<typename DerivedContext>
         inline void Context<DerivedContext>::RemoveAllComponents(Entity<Context>& entity)
         {
+            MOLTEN_PROFILE_ZONE("Ecs::Context::RemoveAllComponents");
             // Make sure the meta data is set, or else the entity is probably destroyed.
             // Also check if entity is part of this context.
             auto* metaData = entity.m_metaData;
@@ -409,6 +418,7 @@ namespace Molten
         template<typename ... Components>
         inline void Context<DerivedContext>::RemoveComponents(Entity<Context>& entity)
         {
+            MOLTEN_PROFILE_ZONE("Ecs::Context::RemoveComponents");
             static_assert(Private::AreExplicitContextComponentTypes<Context, Components...>(), "Implicit component type.");
 
             // Ignore if template parameter list is empty.
@@ -583,6 +593,128 @@ namespace Molten
             return reinterpret_cast<Comp*>(metaData->dataPointer + offset);
         }
 
+        template<typename DerivedContext>
+        inline void Context<DerivedContext>::SetParent(Entity<Context>& child, Entity<Context>& parent)
+        {
+            auto* childMetaData = child.m_metaData;
+            auto* parentMetaData = parent.m_metaData;
+            if (!childMetaData || !parentMetaData || childMetaData->context != this || parentMetaData->context != this)
+            {
+                return;
+            }
+
+            if (!m_hierarchy.Attach(childMetaData, parentMetaData))
+            {
+                throw Exception("Cannot set parent of entity, the relation would create a cycle.");
+            }
+        }
+
+        template<typename DerivedContext>
+        inline void Context<DerivedContext>::RemoveParent(Entity<Context>& child)
+        {
+            auto* metaData = child.m_metaData;
+            if (!metaData || metaData->context != this)
+            {
+                return;
+            }
+
+            m_hierarchy.Detach(metaData);
+        }
+
+        template<typename DerivedContext>
+        inline Entity<Context<DerivedContext> > Context<DerivedContext>::GetParent(const Entity<Context>& entity) const
+        {
+            auto* metaData = entity.m_metaData;
+            if (!metaData || !metaData->parent)
+            {
+                return {};
+            }
+
+            return Entity<Context>(metaData->parent, metaData->parent->entityId);
+        }
+
+        template<typename DerivedContext>
+        inline size_t Context<DerivedContext>::GetChildCount(const Entity<Context>& entity) const
+        {
+            auto* metaData = entity.m_metaData;
+            if (!metaData)
+            {
+                return 0;
+            }
+
+            return metaData->children.size();
+        }
+
+        template<typename DerivedContext>
+        template<typename Comp, typename Callback>
+        inline void Context<DerivedContext>::PropagateHierarchy(Callback&& callback, ThreadPool* threadPool)
+        {
+            MOLTEN_PROFILE_ZONE("Ecs::Context::PropagateHierarchy");
+            static_assert(Private::AreExplicitContextComponentTypes<Context, Comp>(), "Implicit component type.");
+
+            const auto& nodes = m_hierarchy.GetNodes();
+            const auto& trees = m_hierarchy.GetTrees();
+            if (trees.empty())
+            {
+                return;
+            }
+
+            // Worker threads of the pool and the calling thread process one range each.
+            size_t rangeCount = 1;
+            if (threadPool && !threadPool->IsWorkerThread())
+            {
+                rangeCount = std::min(threadPool->GetThreadCount() + 1, trees.size());
+            }
+            if (m_hierarchyScratch.size() < rangeCount)
+            {
+                m_hierarchyScratch.resize(rangeCount);
+            }
+
+            if (rangeCount == 1)
+            {
+                PropagateHierarchyRange<Comp>(callback, nodes, 0, nodes.size(), m_hierarchyScratch.front());
+                return;
+            }
+
+            // Split the trees into contiguous ranges of roughly the same node count.
+            // The last range is processed by the calling thread.
+            const size_t nodesPerRange = (nodes.size() + rangeCount - 1) / rangeCount;
+            std::vector<std::future<void>> futures;
+            futures.reserve(rangeCount - 1);
+
+            size_t rangeBegin = 0;
+            size_t rangeIndex = 0;
+            auto treeIt = trees.begin();
+            while (treeIt != trees.end())
+            {
+                size_t rangeEnd = (treeIt++)->end;
+                while (treeIt != trees.end() && rangeEnd - rangeBegin < nodesPerRange)
+                {
+                    rangeEnd = (treeIt++)->end;
+                }
+
+                auto& scratch = m_hierarchyScratch[rangeIndex++];
+                if (treeIt != trees.end())
+                {
+                    futures.push_back(threadPool->Execute([&, rangeBegin, rangeEnd]()
+                    {
+                        PropagateHierarchyRange<Comp>(callback, nodes, rangeBegin, rangeEnd, scratch);
+                    }));
+                }
+                else
+                {
+                    PropagateHierarchyRange<Comp>(callback, nodes, rangeBegin, rangeEnd, scratch);
+                }
+
+                rangeBegin = rangeEnd;
+            }
+
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+        }
+
         template<typename DerivedContext>
         inline Context<DerivedContext>::Context(const ContextDescriptor& descriptor) :
             m_descriptor(descriptor),
@@ -747,6 +879,58 @@ namespace Molten
             metaData->componentGroups.clear();
             metaData->dataPointer = nullptr;
         }
+
+        template<typename DerivedContext>
+        template<typename Comp, typename Callback>
+        inline void Context<DerivedContext>::PropagateHierarchyRange(Callback& callback, const typename Private::EntityHierarchy<Context>::Nodes& nodes,
+                                                                     const size_t begin, const size_t end, std::vector<Byte*>& scratch)
+        {
+            // Nodes of the same tree tend to share entity templates, so the component offset of the last template is cached.
+            const Private::EntityTemplate<Context>* lastEntityTemplate = nullptr;
+            const size_t missingOffset = static_cast<size_t>(-1);
+            size_t lastOffset = missingOffset;
+
+            // Component pointers of the range are looked up once and stored contiguously, parents are read back by node index.
+            // The scratch buffer is kept between calls, so it only allocates when the hierarchy grows.
+            scratch.resize(end - begin);
+            auto** components = scratch.data();
+            for (size_t i = begin; i < end; i++)
+            {
+                const auto& node = nodes[i];
+                auto* metaData = node.metaData;
+                components[i - begin] = nullptr;
+                if (!metaData->collection)
+                {
+                    continue;
+                }
+
+                const auto* entityTemplate = metaData->collection->GetEntityTemplate();
+                if (entityTemplate != lastEntityTemplate)
+                {
+                    lastEntityTemplate = entityTemplate;
+                    auto it = entityTemplate->componentOffsetMap.find(Comp::componentTypeId);
+                    lastOffset = it != entityTemplate->componentOffsetMap.end() ? it->second : missingOffset;
+                }
+                if (lastOffset == missingOffset)
+                {
+                    continue;
+                }
+
+                Byte* componentData = metaData->dataPointer + lastOffset;
+                components[i - begin] = componentData;
+
+                if (node.parentIndex == Private::HierarchyRootIndex)
+                {
+                    continue;
+                }
+
+                const Byte* parentComponentData = components[node.parentIndex - begin];
+                if (parentComponentData)
+                {
+                    callback(*reinterpret_cast<const Comp*>(parentComponentData), *reinterpret_cast<Comp*>(componentData));
+                }
+            }
+        }
        
 
     }
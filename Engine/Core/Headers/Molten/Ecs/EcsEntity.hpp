@@ -109,6 +109,25 @@ namespace Molten
             const Comp* GetComponent() const;
             /**@}*/
 
+            /**
+            * @brief Attach this entity as child of provided parent entity.
+            *
+            * @throw Exception if the relation would create a cycle.
+            */
+            void SetParent(Entity& parent);
+
+            /**
+            * @brief Detach this entity from its parent.
+            */
+            void RemoveParent();
+
+            /**
+            * @brief Get parent of this entity.
+            *
+            * @return Parent entity, an empty entity if this entity has no parent.
+            */
+            Entity GetParent() const;
+
             /**
             * @brief Self-destroy entity.
             */
@@ -142,9 +161,10 @@ namespace Molten
             template<typename ContextType>
             struct EntityMetaData
             {
-                EntityMetaData(ContextType* context, const Signature& signature);
+                EntityMetaData(ContextType* context, const Signature& signature, const EntityId entityId);
                      
                 using ComponentGroups = std::vector<ComponentGroup<ContextType>*>;
+                using Children = std::vector<EntityMetaData*>;
 
                 ContextType* context;
                 Signature signature;
@@ -152,6 +172,9 @@ namespace Molten
                 CollectionEntryId collectionEntry;
                 ComponentGroups componentGroups;
                 Byte* dataPointer;
+                EntityId entityId;
+                EntityMetaData* parent;
+                Children children;
             };
 
         }
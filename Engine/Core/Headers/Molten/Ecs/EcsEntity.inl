@@ -100,6 +100,35 @@ namespace Molten
             return m_metaData->context->template GetComponent<Comp>(*this);
         }
 
+        template<typename ContextType>
+        inline void Entity<ContextType>::SetParent(Entity& parent)
+        {
+            if (m_metaData)
+            {
+                m_metaData->context->SetParent(*this, parent);
+            }
+        }
+
+        template<typename ContextType>
+        inline void Entity<ContextType>::RemoveParent()
+        {
+            if (m_metaData)
+            {
+                m_metaData->context->RemoveParent(*this);
+            }
+        }
+
+        template<typename ContextType>
+        inline Entity<ContextType> Entity<ContextType>::GetParent() const
+        {
+            if (!m_metaData)
+            {
+                throw Exception("Cannot get parent of destroyed entity.");
+            }
+
+            return m_metaData->context->GetParent(*this);
+        }
+
         template<typename ContextType>
         inline void Entity<ContextType>::Destroy()
         {
@@ -121,13 +150,16 @@ namespace Molten
         {
 
             template<typename ContextType>
-            inline EntityMetaData<ContextType>::EntityMetaData(ContextType* context, const Signature& signature) :
+            inline EntityMetaData<ContextType>::EntityMetaData(ContextType* context, const Signature& signature, const EntityId entityId) :
                 context(context),
                 signature(signature),
                 collection(nullptr),
                 collectionEntry(0),
                 componentGroups{},
-                dataPointer(nullptr)
+                dataPointer(nullptr),
+                entityId(entityId),
+                parent(nullptr),
+                children{}
             { }
 
         }
@@ -0,0 +1,134 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_ECS_ECSHIERARCHY_HPP
+#define MOLTEN_CORE_ECS_ECSHIERARCHY_HPP
+
+#include "Molten/Ecs/Ecs.hpp"
+#include "Molten/Ecs/EcsEntity.hpp"
+#include <map>
+#include <vector>
+
+namespace Molten
+{
+
+    namespace Ecs
+    {
+
+        namespace Private
+        {
+
+            constexpr size_t HierarchyRootIndex = static_cast<size_t>(-1); ///< Parent index of root nodes.
+
+
+            /**
+            * @brief Node of a flattened entity hierarchy.
+            *        Nodes are stored breadth first, the parent of a node is always located before the node itself.
+            */
+            template<typename ContextType>
+            struct HierarchyNode
+            {
+                HierarchyNode(EntityMetaData<ContextType>* metaData, const size_t parentIndex);
+
+                EntityMetaData<ContextType>* metaData;  ///< Meta data of node entity.
+                size_t parentIndex;                     ///< Index of parent node, or HierarchyRootIndex for roots.
+            };
+
+            /**
+            * @brief Index range of all nodes of a single tree, starting with the root node.
+            */
+            struct HierarchyTree
+            {
+                size_t begin;
+                size_t end;
+            };
+
+
+            /**
+            * @brief Parent/child relations of entities in a context.
+            *        Relations are stored in the entity meta data, while this class keeps track of all roots and
+            *        lazily flattens every tree into contiguous, breadth first sorted memory before traversal.
+            *        Trees are independent of each other, making it possible to process them in parallel.
+            */
+            template<typename ContextType>
+            class EntityHierarchy
+            {
+
+            public:
+
+                using MetaData = EntityMetaData<ContextType>;
+                using Nodes = std::vector<HierarchyNode<ContextType>>;
+                using Trees = std::vector<HierarchyTree>;
+
+                EntityHierarchy();
+
+                /**
+                * @brief Attach child to parent. Any previous parent of child is replaced.
+                *
+                * @return False if the relation would create a cycle, else true.
+                */
+                bool Attach(MetaData* child, MetaData* parent);
+
+                /**
+                * @brief Detach child from its parent. Children of child are kept.
+                */
+                void Detach(MetaData* child);
+
+                /**
+                * @brief Remove entity from hierarchy.
+                *        The entity is detached from its parent and all its children are turned into roots.
+                */
+                void Remove(MetaData* entity);
+
+                /**
+                * @brief Get flattened nodes of all trees, rebuilt if any relation has changed since last call.
+                */
+                const Nodes& GetNodes();
+
+                /**
+                * @brief Get index ranges of all trees. Call GetNodes() first to make sure the ranges are up to date.
+                */
+                const Trees& GetTrees() const;
+
+            private:
+
+                void Rebuild();
+
+                std::map<EntityId, MetaData*> m_roots;  ///< Entities without parent, having at least one child.
+                Nodes m_nodes;                          ///< Breadth first sorted nodes of all trees.
+                Trees m_trees;                          ///< Node ranges of each tree.
+                bool m_dirty;                           ///< True if nodes must be rebuilt.
+
+            };
+
+        }
+
+    }
+
+}
+
+#include "Molten/Ecs/EcsHierarchy.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,182 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include <algorithm>
+
+namespace Molten
+{
+
+    namespace Ecs
+    {
+
+        namespace Private
+        {
+
+            // Implementations of hierarchy node.
+            template<typename ContextType>
+            inline HierarchyNode<ContextType>::HierarchyNode(EntityMetaData<ContextType>* metaData, const size_t parentIndex) :
+                metaData(metaData),
+                parentIndex(parentIndex)
+            { }
+
+
+            // Implementations of entity hierarchy.
+            template<typename ContextType>
+            inline EntityHierarchy<ContextType>::EntityHierarchy() :
+                m_dirty(false)
+            { }
+
+            template<typename ContextType>
+            inline bool EntityHierarchy<ContextType>::Attach(MetaData* child, MetaData* parent)
+            {
+                // Make sure that child is not an ancestor of parent.
+                for (auto* ancestor = parent; ancestor != nullptr; ancestor = ancestor->parent)
+                {
+                    if (ancestor == child)
+                    {
+                        return false;
+                    }
+                }
+
+                if (child->parent == parent)
+                {
+                    return true;
+                }
+
+                if (child->parent)
+                {
+                    Detach(child);
+                }
+                m_roots.erase(child->entityId);
+
+                parent->children.push_back(child);
+                child->parent = parent;
+                if (!parent->parent)
+                {
+                    m_roots.insert({ parent->entityId, parent });
+                }
+
+                m_dirty = true;
+                return true;
+            }
+
+            template<typename ContextType>
+            inline void EntityHierarchy<ContextType>::Detach(MetaData* child)
+            {
+                auto* parent = child->parent;
+                if (!parent)
+                {
+                    return;
+                }
+
+                auto& siblings = parent->children;
+                siblings.erase(std::find(siblings.begin(), siblings.end(), child));
+                if (siblings.empty() && !parent->parent)
+                {
+                    m_roots.erase(parent->entityId);
+                }
+
+                child->parent = nullptr;
+                if (!child->children.empty())
+                {
+                    m_roots.insert({ child->entityId, child });
+                }
+
+                m_dirty = true;
+            }
+
+            template<typename ContextType>
+            inline void EntityHierarchy<ContextType>::Remove(MetaData* entity)
+            {
+                if (!entity->parent && entity->children.empty())
+                {
+                    return;
+                }
+
+                Detach(entity);
+                m_roots.erase(entity->entityId);
+
+                for (auto* child : entity->children)
+                {
+                    child->parent = nullptr;
+                    if (!child->children.empty())
+                    {
+                        m_roots.insert({ child->entityId, child });
+                    }
+                }
+                entity->children.clear();
+
+                m_dirty = true;
+            }
+
+            template<typename ContextType>
+            inline const typename EntityHierarchy<ContextType>::Nodes& EntityHierarchy<ContextType>::GetNodes()
+            {
+                if (m_dirty)
+                {
+                    Rebuild();
+                }
+                return m_nodes;
+            }
+
+            template<typename ContextType>
+            inline const typename EntityHierarchy<ContextType>::Trees& EntityHierarchy<ContextType>::GetTrees() const
+            {
+                return m_trees;
+            }
+
+            template<typename ContextType>
+            inline void EntityHierarchy<ContextType>::Rebuild()
+            {
+                m_nodes.clear();
+                m_trees.clear();
+                m_trees.reserve(m_roots.size());
+
+                for (auto& pair : m_roots)
+                {
+                    const size_t begin = m_nodes.size();
+                    m_nodes.emplace_back(pair.second, HierarchyRootIndex);
+
+                    // The node vector is growing while being iterated, appending the children of each visited node.
+                    for (size_t i = begin; i < m_nodes.size(); i++)
+                    {
+                        auto* metaData = m_nodes[i].metaData;
+                        for (auto* child : metaData->children)
+                        {
+                            m_nodes.emplace_back(child, i);
+                        }
+                    }
+
+                    m_trees.push_back({ begin, m_nodes.size() });
+                }
+
+                m_dirty = false;
+            }
+
+        }
+
+    }
+
+}
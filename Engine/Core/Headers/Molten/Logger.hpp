@@ -30,11 +30,17 @@
 #include <functional>
 #include <string>
 #include <fstream>
+#include <memory>
+#include <mutex>
 
 namespace Molten
 {
 
-    /** Logger class. */
+    /**
+    * Logger class.
+    * Writing is thread safe, calls to the callback are serialized.
+    * Child loggers share the lock of their parent, since they share its callback.
+    */
     class MOLTEN_API Logger
     {
 
@@ -109,6 +115,7 @@ namespace Molten
 
         uint32_t m_severityFlags;
         Callback m_callback;
+        std::shared_ptr<std::mutex> m_writeMutex;
 
     };
 
@@ -713,7 +713,7 @@ namespace Molten
     {
         x /= static_cast<T>(scalar);
         y /= static_cast<T>(scalar);
-        y /= static_cast<T>(scalar);
+        z /= static_cast<T>(scalar);
         w /= static_cast<T>(scalar);
         return *this;
     }
@@ -0,0 +1,108 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_MEMORY_BUDDYALLOCATOR_HPP
+#define MOLTEN_CORE_MEMORY_BUDDYALLOCATOR_HPP
+
+#include "Molten/Types.hpp"
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace Molten
+{
+
+    /**
+    * @brief Buddy allocator, managing offsets of a memory range.
+    *        The range is split into blocks of power of two sizes, one free list per block size.
+    *        Freed blocks are merged with their buddy, if the buddy is free as well.
+    *        No memory is owned by the allocator itself, making it usable for device memory.
+    */
+    class MOLTEN_API BuddyAllocator
+    {
+
+    public:
+
+        /**
+        * @brief Constructor.
+        *        Size of memory range is rounded down to minBlockSize times a power of two.
+        *
+        * @param size Size of managed memory range, in bytes.
+        * @param minBlockSize Smallest size of allocated blocks, in bytes. Must be a power of two.
+        *
+        * @throw Exception if minBlockSize is not a power of two or larger than size.
+        */
+        BuddyAllocator(const size_t size, const size_t minBlockSize);
+
+        /** Deleted copy constructor. */
+        BuddyAllocator(const BuddyAllocator&) = delete;
+
+        /**
+        * @brief Allocate block of at least size bytes.
+        *
+        * @param offset[out] Offset of allocated block, relative to the start of memory range.
+        * @param alignment Alignment of offset. Must be a power of two.
+        *
+        * @return False if there is no free block large enough.
+        */
+        bool Allocate(const size_t size, const size_t alignment, size_t& offset);
+
+        /**
+        * @brief Free previously allocated block.
+        *
+        * @return False if no block is allocated at offset.
+        */
+        bool Free(const size_t offset);
+
+        /** Get size of managed memory range, in bytes. */
+        size_t GetSize() const;
+
+        /** Get total size of allocated blocks, in bytes. */
+        size_t GetUsedSize() const;
+
+        /** Get number of allocated blocks. */
+        size_t GetAllocationCount() const;
+
+        /** Get size of largest free block, in bytes. */
+        size_t GetLargestFreeBlockSize() const;
+
+        /** Checks if there are no allocated blocks. */
+        bool IsEmpty() const;
+
+    private:
+
+        size_t GetBlockSize(const size_t order) const;
+
+        size_t m_size;
+        size_t m_minBlockSize;
+        std::vector<std::set<size_t> > m_freeBlocks; ///< Offsets of free blocks, per order.
+        std::unordered_map<size_t, size_t> m_allocations; ///< Order of allocated blocks, by offset.
+        size_t m_usedSize;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,110 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_BINDSTATECACHE_HPP
+#define MOLTEN_CORE_RENDERER_BINDSTATECACHE_HPP
+
+#include "Molten/Types.hpp"
+#include <vector>
+
+namespace Molten
+{
+
+    /** Counters of issued and skipped resource binds. */
+    struct MOLTEN_API BindStatistics
+    {
+        BindStatistics();
+
+        /** Set all counters to 0. */
+        void Clear();
+
+        BindStatistics& operator +=(const BindStatistics& rhs);
+
+        uint32_t pipelineBinds;
+        uint32_t pipelineBindsSkipped;
+        uint32_t uniformBlockBinds;
+        uint32_t uniformBlockBindsSkipped;
+        uint32_t vertexBufferBinds;
+        uint32_t vertexBufferBindsSkipped;
+        uint32_t indexBufferBinds;
+        uint32_t indexBufferBindsSkipped;
+    };
+
+
+    /**
+    * @brief Shadow of bound resources of a single command buffer, used for filtering redundant binds.
+    *        Resources are identified by address. Every bind function returns true if the bind must be issued,
+    *        or false if the resource is already bound.
+    */
+    class MOLTEN_API BindStateCache
+    {
+
+    public:
+
+        BindStateCache();
+
+        /** Forget all bound resources, statistics are kept. Call when command buffer recording begins. */
+        void Reset();
+
+        /** Bind pipeline. Binding a new pipeline invalidates all bound uniform blocks. */
+        bool BindPipeline(const void* pipeline);
+
+        /** Bind uniform block to set, with dynamic offset. */
+        bool BindUniformBlock(const uint32_t set, const void* uniformBlock, const uint32_t offset);
+
+        /** Forget uniform block of set, for sets bound without going through the cache. */
+        void InvalidateUniformBlock(const uint32_t set);
+
+        /** Bind vertex buffer to vertex input binding. */
+        bool BindVertexBuffer(const uint32_t binding, const void* vertexBuffer);
+
+        /** Bind index buffer. */
+        bool BindIndexBuffer(const void* indexBuffer);
+
+        /** Get statistics of binds since creation or last call to ClearStatistics. */
+        const BindStatistics& GetStatistics() const;
+
+        /** Set all counters of statistics to 0. */
+        void ClearStatistics();
+
+    private:
+
+        struct UniformBlockBinding
+        {
+            const void* uniformBlock;
+            uint32_t offset;
+        };
+
+        const void* m_pipeline;
+        std::vector<UniformBlockBinding> m_uniformBlocks;
+        std::vector<const void*> m_vertexBuffers;
+        const void* m_indexBuffer;
+        BindStatistics m_statistics;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,128 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_COMMANDBUFFER_HPP
+#define MOLTEN_CORE_RENDERER_COMMANDBUFFER_HPP
+
+#include "Molten/Math/Vector.hpp"
+#include "Molten/Math/Matrix.hpp"
+
+namespace Molten
+{
+
+    class Framebuffer;
+    class IndexBuffer;
+    class IndirectBuffer;
+    class Pipeline;
+    class UniformBlock;
+    class VertexBuffer;
+
+    /**
+     * Command buffer resource object.
+     * Command buffers are recorded in parallel by worker threads between Renderer::BeginDraw and Renderer::EndDraw,
+     * and executed in the current render pass via Renderer::ExecuteCommandBuffer.
+     * A single command buffer must only be recorded by one thread at a time, and at most once per frame.
+     */
+    class MOLTEN_API CommandBuffer
+    {
+
+    public:
+
+        /**
+         * Begin recording of commands for the current frame. Returns false if recording failed to begin.
+         *
+         * @param framebuffer Framebuffer the commands are drawn into, nullptr for the backbuffer.
+         *                    The command buffer must be executed while the same framebuffer is bound, see Renderer::BindFramebuffer.
+         */
+        virtual bool Begin(Framebuffer* framebuffer = nullptr) = 0;
+
+        /** Finish recording of commands. The command buffer is ready to be executed after this call. */
+        virtual void End() = 0;
+
+        /** Bind pipeline to command buffer. */
+        virtual void BindPipeline(Pipeline* pipeline) = 0;
+
+        /** Bind uniform block to command buffer, using the current bound pipeline. */
+        virtual void BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset = 0) = 0;
+
+        /** Draw vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBuffer(VertexBuffer* vertexBuffer) = 0;
+
+        /** Draw indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer) = 0;
+
+        /**
+         * Draw instances of vertex buffer, using the current bound pipeline.
+         * Vertex data is stepped per vertex and instance buffer data per instance,
+         * matching the input interface and instance input interface of the vertex script.
+         */
+        virtual void DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) = 0;
+
+        /** Draw instances of indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) = 0;
+
+        /**
+         * Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline.
+         * Parameters of each draw are read from the first drawCount commands of indirect buffer.
+         *
+         * @param instanceBuffer Per instance vertex stream, indexed by firstInstance of each command. May be nullptr.
+         */
+        virtual void DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount) = 0;
+
+        /**
+         * Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline.
+         * The draw count is read from indirect buffer, written by the device. Devices without support of
+         * device side draw counts process all commands, culled commands are then expected to have an instance count of 0.
+         *
+         * @param instanceBuffer Per instance vertex stream, indexed by firstInstance of each command. May be nullptr.
+         */
+        virtual void DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer) = 0;
+
+        /** Push constant values to shader stage, using the current bound pipeline. */
+        /**@{*/
+        virtual void PushConstant(const uint32_t location, const bool& value) = 0;
+        virtual void PushConstant(const uint32_t location, const int32_t& value) = 0;
+        virtual void PushConstant(const uint32_t location, const float& value) = 0;
+        virtual void PushConstant(const uint32_t location, const Vector2f32& value) = 0;
+        virtual void PushConstant(const uint32_t location, const Vector3f32& value) = 0;
+        virtual void PushConstant(const uint32_t location, const Vector4f32& value) = 0;
+        virtual void PushConstant(const uint32_t location, const Matrix4x4f32& value) = 0;
+        /**@}*/
+
+    protected:
+
+        CommandBuffer() = default;
+        virtual ~CommandBuffer() = default;
+
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer(CommandBuffer&&) = delete;
+        CommandBuffer& operator =(const CommandBuffer&) = delete;
+        CommandBuffer& operator =(CommandBuffer&&) = delete;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,119 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_COMMANDSTREAM_HPP
+#define MOLTEN_CORE_RENDERER_COMMANDSTREAM_HPP
+
+#include "Molten/Types.hpp"
+#include <vector>
+
+namespace Molten
+{
+
+    /**
+    * @brief Compact in-memory stream of renderer commands, recorded by command buffers of renderers without native command buffers.
+    *        Commands are packed as an opcode and a header byte, followed by the used resources, values and data.
+    *        Trailing nullptr resources and zero values are not stored, they are restored when the stream is read.
+    */
+    class MOLTEN_API CommandStream
+    {
+
+    public:
+
+        /** Enumerator of recorded commands. */
+        enum class Opcode : uint8_t
+        {
+            BindPipeline,       ///< Resources: pipeline.
+            BindUniformBlock,   ///< Resources: uniform block. Values: set, offset.
+            BindUniformBuffer,  ///< Resources: pipeline, uniform buffer. Values: set, offset, size.
+            BindVertexBuffer,   ///< Resources: vertex buffer. Values: binding.
+            BindIndexBuffer,    ///< Resources: index buffer.
+            Draw,               ///< Values: vertex count, instance count.
+            DrawIndexed,        ///< Values: index count, instance count.
+            DrawIndirect,       ///< Resources: indirect buffer. Values: draw count.
+            DrawIndirectCount,  ///< Resources: indirect buffer. Values: max draw count, draw count at recording.
+            PushConstant,       ///< Values: location. Data: constant value.
+            BeginMarker,        ///< Data: marker name.
+            EndMarker,
+            UpdateIndirectBuffer, ///< Resources: indirect buffer. Values: first command, command count. Data: commands.
+            UpdateUniformBuffer,  ///< Resources: uniform buffer. Values: offset. Data: uniform data.
+            CullIndirectBuffer,   ///< Resources: indirect buffer. Data: frustum planes.
+            UpdateIndirectBufferDrawCount, ///< Resources: indirect buffer. Values: draw count.
+            BindFramebuffer     ///< Resources: framebuffer, nullptr for the backbuffer.
+        };
+
+        static constexpr size_t MaxResources = 2;
+        static constexpr size_t MaxValues = 3;
+
+        /** Single command of stream. Data of read commands points into the stream, valid until the stream is modified. */
+        struct Command
+        {
+            Command();
+            explicit Command(const Opcode opcode);
+
+            Opcode opcode;
+            const void* resources[MaxResources];
+            uint32_t values[MaxValues];
+            const void* data;
+            uint32_t dataSize;
+        };
+
+        CommandStream() = default;
+
+        /** Remove all commands. Allocated memory is kept. */
+        void Clear();
+
+        /** Append command to end of stream. */
+        void Write(const Command& command);
+
+        /** Append all commands of another stream. */
+        void Append(const CommandStream& stream);
+
+        /**
+        * @brief Read command at position and advance position to the next command.
+        *
+        * @return False if position is at the end of the stream.
+        */
+        bool Read(size_t& position, Command& command) const;
+
+        /** Get number of commands in stream. */
+        size_t GetCommandCount() const;
+
+        /** Get size of stream, in bytes. */
+        size_t GetSize() const;
+
+        /** Get packed commands of stream. */
+        const std::vector<uint8_t>& GetData() const;
+
+    private:
+
+        std::vector<uint8_t> m_data;
+        size_t m_commandCount = 0;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
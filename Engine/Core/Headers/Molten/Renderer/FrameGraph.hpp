@@ -0,0 +1,248 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_FRAMEGRAPH_HPP
+#define MOLTEN_CORE_RENDERER_FRAMEGRAPH_HPP
+
+#include "Molten/Math/Vector.hpp"
+#include <vector>
+#include <string>
+#include <functional>
+#include <limits>
+
+namespace Molten
+{
+
+    /**
+    * @brief Declarative graph of render passes and the attachments they read and write.
+    *        Compiling the graph culls passes not contributing to imported resources, derives the barriers
+    *        and state transitions required before each pass and aliases memory of transient textures
+    *        with non-overlapping lifetimes. Passes are executed in declaration order, barriers follow the order,
+    *        so passes may be reordered freely by the application.
+    */
+    class MOLTEN_API FrameGraph
+    {
+
+    public:
+
+        using ResourceId = uint32_t;
+        using PassId = uint32_t;
+
+        /** Id returned for invalid resources or passes. */
+        static constexpr uint32_t InvalidId = std::numeric_limits<uint32_t>::max();
+
+        /** Alignment of transient texture allocations, matching the largest image alignment of common devices. */
+        static constexpr size_t AllocationAlignment = 65536;
+
+        /** Enumerator of texture formats. */
+        enum class Format : uint8_t
+        {
+            Rgba8,
+            Bgra8,
+            Rgba16Float,
+            Rgba32Float,
+            Depth32Float,
+            Depth24Stencil8
+        };
+
+        /** Enumerator of resource states, each state maps to an image layout and access mask of the backend. */
+        enum class ResourceState : uint8_t
+        {
+            Undefined,          ///< Content is undefined, initial state of transient textures.
+            ColorAttachment,    ///< Written as color attachment.
+            DepthAttachment,    ///< Written as depth stencil attachment.
+            DepthRead,          ///< Read only depth stencil attachment.
+            ShaderRead,         ///< Sampled by shaders.
+            TransferSource,     ///< Source of copy commands.
+            TransferDestination,///< Destination of copy commands.
+            Present             ///< Presented to the window.
+        };
+
+        /** Descriptor of textures. */
+        struct TextureDescriptor
+        {
+            Vector2ui32 size;
+            Format format;
+        };
+
+        /** Transition of resource, issued before a pass is executed. */
+        struct Barrier
+        {
+            ResourceId resource;
+            ResourceState before;
+            ResourceState after;
+        };
+
+        /** Pass of compiled graph, in execution order. */
+        struct CompiledPass
+        {
+            PassId pass;
+            std::vector<Barrier> barriers; ///< Barriers to issue before executing the pass.
+        };
+
+        /** Memory range of transient texture, in transient memory shared by all transient textures. */
+        struct Allocation
+        {
+            size_t offset;
+            size_t size;
+        };
+
+        /** Function executing a compiled pass, responsible for issuing the barriers of the pass. */
+        using ExecuteFunction = std::function<void(const CompiledPass&)>;
+
+        /** Get size in bytes of a single texel of format. */
+        static size_t GetFormatSize(const Format format);
+
+        /** Checks if state is a write access. */
+        static bool IsWriteState(const ResourceState state);
+
+        FrameGraph();
+
+        /** Remove all passes and resources. */
+        void Clear();
+
+        /** Create transient texture, owned by the graph and only valid during its execution. */
+        ResourceId CreateTexture(const std::string& name, const TextureDescriptor& descriptor);
+
+        /**
+        * @brief Import external texture, such as a swap chain image. Imported textures are never aliased
+        *        and passes writing them are never culled.
+        *
+        * @param initialState State of texture before the graph is executed.
+        * @param finalState State texture is transitioned to after the last pass.
+        */
+        ResourceId ImportTexture(const std::string& name, const TextureDescriptor& descriptor, const ResourceState initialState, const ResourceState finalState);
+
+        /** Add pass to graph. Passes are executed in declaration order. */
+        PassId AddPass(const std::string& name, ExecuteFunction execute = {});
+
+        /**
+        * @brief Declare read of resource by pass.
+        *
+        * @throw Exception If pass or resource is invalid, or if state is a write state.
+        */
+        void Read(const PassId pass, const ResourceId resource, const ResourceState state = ResourceState::ShaderRead);
+
+        /**
+        * @brief Declare write of resource by pass. Writes keep the previous content of resource,
+        *        so the previous writer of resource is never culled if this pass is executed.
+        *
+        * @throw Exception If pass or resource is invalid, or if state is a read state.
+        */
+        void Write(const PassId pass, const ResourceId resource, const ResourceState state = ResourceState::ColorAttachment);
+
+        /**
+        * @brief Mark pass to never be culled, for passes with side effects outside of the graph.
+        *
+        * @throw Exception If pass is invalid.
+        */
+        void KeepPass(const PassId pass);
+
+        /** Compile graph, must be called after the last modification and before execution or queries of compiled data. */
+        void Compile();
+
+        /** Execute compiled passes in order. */
+        void Execute() const;
+
+        /** Get number of declared passes. */
+        size_t GetPassCount() const;
+
+        /** Get number of declared resources. */
+        size_t GetResourceCount() const;
+
+        /** Get name of pass. */
+        const std::string& GetPassName(const PassId pass) const;
+
+        /** Get name of resource. */
+        const std::string& GetResourceName(const ResourceId resource) const;
+
+        /** Get descriptor of resource. */
+        const TextureDescriptor& GetResourceDescriptor(const ResourceId resource) const;
+
+        /** Get compiled passes, in execution order. */
+        const std::vector<CompiledPass>& GetCompiledPasses() const;
+
+        /** Get barriers transitioning imported textures to their final states, issued after the last pass. */
+        const std::vector<Barrier>& GetFinalBarriers() const;
+
+        /** Checks if pass was culled by the last compilation. */
+        bool IsPassCulled(const PassId pass) const;
+
+        /** Checks if resource is a transient texture, allocated by the last compilation. */
+        bool IsAllocated(const ResourceId resource) const;
+
+        /** Get allocation of transient texture. Only valid if IsAllocated returns true. */
+        const Allocation& GetAllocation(const ResourceId resource) const;
+
+        /** Get required size of transient memory, with aliasing. */
+        size_t GetTransientMemorySize() const;
+
+        /** Get size of transient memory required without aliasing. */
+        size_t GetUnaliasedMemorySize() const;
+
+    private:
+
+        struct Access
+        {
+            ResourceId resource;
+            ResourceState state;
+        };
+
+        struct Pass
+        {
+            std::string name;
+            ExecuteFunction execute;
+            std::vector<Access> accesses;
+            bool keep;
+            bool culled;
+        };
+
+        struct Resource
+        {
+            std::string name;
+            TextureDescriptor descriptor;
+            bool imported;
+            ResourceState initialState;
+            ResourceState finalState;
+            bool allocated;
+            Allocation allocation;
+        };
+
+        void CullPasses();
+        void CreateBarriers();
+        void AllocateTransientResources();
+
+        std::vector<Pass> m_passes;
+        std::vector<Resource> m_resources;
+        std::vector<CompiledPass> m_compiledPasses;
+        std::vector<Barrier> m_finalBarriers;
+        size_t m_transientMemorySize;
+        size_t m_unaliasedMemorySize;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_FRAMEPROFILER_HPP
+#define MOLTEN_CORE_RENDERER_FRAMEPROFILER_HPP
+
+#include "Molten/System/Time.hpp"
+#include <vector>
+#include <string>
+#include <map>
+#include <ostream>
+
+namespace Molten
+{
+
+    /**
+    * @brief Per frame timings of named CPU scopes and GPU markers.
+    *        Samples of the same series within a frame are summed, the sums of the last frames are kept
+    *        in a ring, from which minimum, average and 99th percentile statistics are computed.
+    */
+    class MOLTEN_API FrameProfiler
+    {
+
+    public:
+
+        /** Enumerator of timing domains. */
+        enum class Domain : uint8_t
+        {
+            Cpu,
+            Gpu
+        };
+
+        /** Statistics of series, over frames in the history with samples of the series. */
+        struct Statistics
+        {
+            Time minimum;
+            Time average;
+            Time percentile99;
+            Time last; ///< Time of the last frame with samples of the series.
+            size_t frameCount; ///< Number of frames with samples of the series.
+        };
+
+        /** Scope adding a CPU sample of its lifetime to profiler. */
+        class MOLTEN_API CpuScope
+        {
+
+        public:
+
+            CpuScope(FrameProfiler& profiler, const std::string& name);
+            ~CpuScope();
+
+            CpuScope(const CpuScope&) = delete;
+            CpuScope& operator =(const CpuScope&) = delete;
+
+        private:
+
+            FrameProfiler& m_profiler;
+            std::string m_name;
+            Time m_startTime;
+
+        };
+
+        /**
+        * @brief Constructor.
+        *
+        * @param frameHistorySize Number of frames kept in history.
+        */
+        explicit FrameProfiler(const size_t frameHistorySize = 240);
+
+        /** Remove all series and frames. */
+        void Clear();
+
+        /** Add sample to series of the current frame. The series is created by its first sample. */
+        void AddSample(const Domain domain, const std::string& name, const Time duration);
+
+        /** End the current frame, moving its samples into the history. */
+        void EndFrame();
+
+        /** Get number of frames in history. */
+        size_t GetFrameCount() const;
+
+        /** Get names of all series of domain, in order of creation. */
+        std::vector<std::string> GetSeriesNames(const Domain domain) const;
+
+        /**
+        * @brief Get statistics of series.
+        *
+        * @return False if series does not exist or has no samples in history.
+        */
+        bool GetStatistics(const Domain domain, const std::string& name, Statistics& statistics) const;
+
+        /**
+        * @brief Write history as comma separated values, oldest frame first.
+        *        One column per series, in milliseconds. Frames without samples of a series leave the column empty.
+        */
+        void WriteCsv(std::ostream& stream) const;
+
+    private:
+
+        using SeriesKey = std::pair<Domain, std::string>;
+
+        struct Series
+        {
+            Domain domain;
+            std::string name;
+            std::vector<Time> history;
+            std::vector<bool> historyValid;
+            Time current;
+            bool currentValid;
+        };
+
+        size_t m_frameHistorySize;
+        size_t m_frameCount;
+        std::vector<Series> m_series;
+        std::map<SeriesKey, size_t> m_seriesIndices;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -31,7 +31,10 @@
 namespace Molten
 {
 
-    /** Framebuffer base class. */
+    /**
+     * Framebuffer base class.
+     * Framebuffers are transient color textures of the frame graph, each drawn by its own pass before the present pass.
+     */
     class MOLTEN_API Framebuffer
     {
 
@@ -54,7 +57,7 @@ namespace Molten
 
         FramebufferDescriptor() = default;
 
-        Vector2ui32 size;
+        Vector2ui32 size; ///< Size in pixels, independent of the render target size.
 
     };
 
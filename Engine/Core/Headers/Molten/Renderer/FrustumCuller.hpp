@@ -0,0 +1,140 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#ifndef MOLTEN_CORE_RENDERER_FRUSTUMCULLER_HPP
+#define MOLTEN_CORE_RENDERER_FRUSTUMCULLER_HPP
+
+#include "Molten/Math/Matrix.hpp"
+#include <array>
+
+namespace Molten
+{
+
+    struct DrawIndexedIndirectCommand;
+
+    /**
+    * @brief World space bounding sphere or axis aligned bounding box of a draw command.
+    *        Layout matches the std430 layout read by culling shaders.
+    */
+    struct MOLTEN_API BoundingVolume
+    {
+        /** Create bounding sphere. */
+        static BoundingVolume FromSphere(const Vector3f32& center, const float radius);
+
+        /** Create axis aligned bounding box, by its minimum and maximum corners. */
+        static BoundingVolume FromAabb(const Vector3f32& min, const Vector3f32& max);
+
+        Vector3f32 center;
+        float radius; ///< Radius of sphere, 0 for boxes.
+        Vector3f32 extents; ///< Half extents of box, 0 for spheres.
+        float padding;
+    };
+
+    static_assert(sizeof(BoundingVolume) == 32, "Bounding volume must be tightly packed.");
+
+
+    /**
+    * @brief View frustum of six normalized planes, with normals pointing inwards.
+    *        A point p is inside of plane (n, d) if dot(n, p) + d >= 0.
+    */
+    class MOLTEN_API Frustum
+    {
+
+    public:
+
+        /** Enumerator of frustum planes. */
+        enum class Plane : uint8_t
+        {
+            Left,
+            Right,
+            Bottom,
+            Top,
+            Near,
+            Far
+        };
+
+        static constexpr size_t PlaneCount = 6;
+
+        /**
+        * @brief Extract frustum planes of a combined projection and view matrix, projection * view.
+        *        The near plane is extracted for clip space depths of [-w, w], as produced by Matrix4x4::Perspective,
+        *        which is conservative for renderers clipping depths at [0, w].
+        */
+        static Frustum FromViewProjection(const Matrix4x4f32& viewProjection);
+
+        /** Constructor. Default frustum contains every bounding volume. */
+        Frustum();
+
+        /** Check if bounding volume is inside of or intersects the frustum. */
+        bool Intersects(const BoundingVolume& bounds) const;
+
+        /** Get plane of frustum, as (normal, distance). */
+        const Vector4f32& GetPlane(const Plane plane) const;
+
+        /** Get all planes of frustum, ordered as Plane. */
+        const std::array<Vector4f32, PlaneCount>& GetPlanes() const;
+
+    private:
+
+        std::array<Vector4f32, PlaneCount> m_planes;
+
+    };
+
+
+    /**
+    * @brief Frustum culling of indirect draw commands on the CPU.
+    *        Used by renderers without device side culling, and by applications culling before UpdateIndirectBuffer.
+    *        Results are identical to the culling shaders of renderers: visible commands are compacted to the front
+    *        of the output in their input order, and remaining commands are cleared to an instance count of 0.
+    */
+    class MOLTEN_API FrustumCuller
+    {
+
+    public:
+
+        /**
+        * @brief Cull commands against frustum. Four bounding volumes are tested at once if SIMD is supported.
+        *
+        * @param bounds Bounding volume of each command.
+        * @param output Output of commandCount commands, may be equal to commands.
+        *
+        * @return Number of visible commands.
+        */
+        static uint32_t Cull(const Frustum& frustum, const BoundingVolume* bounds, const DrawIndexedIndirectCommand* commands,
+                             const uint32_t commandCount, DrawIndexedIndirectCommand* output);
+
+        /** Cull commands against frustum, one bounding volume at a time. See Cull. */
+        static uint32_t CullScalar(const Frustum& frustum, const BoundingVolume* bounds, const DrawIndexedIndirectCommand* commands,
+                                   const uint32_t commandCount, DrawIndexedIndirectCommand* output);
+
+        /** Check if Cull is using SIMD instructions on this platform. */
+        static bool IsSimdSupported();
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -44,6 +44,13 @@ namespace Molten
             Uint32  ///< 32 bit unsigned integer data type.
         };
 
+        /** Enumerator of buffer usages. */
+        enum class Usage : uint8_t
+        {
+            Static, ///< Written once at creation, stored in device local memory.
+            Dynamic ///< Rewritten every frame by the host, one region per frame in flight.
+        };
+
     protected:
 
         IndexBuffer() = default;
@@ -64,9 +71,10 @@ namespace Molten
 
         IndexBufferDescriptor() = default;
 
-        uint32_t indexCount;
-        const void* data;   
+        uint32_t indexCount; ///< Number of indices, maximum number of indices per frame of dynamic buffers.
+        const void* data; ///< Initial indices, may be nullptr for dynamic buffers.
         IndexBuffer::DataType dataType;
+        IndexBuffer::Usage usage = IndexBuffer::Usage::Static;
 
     };
 
@@ -0,0 +1,87 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_INDIRECTBUFFER_HPP
+#define MOLTEN_CORE_RENDERER_INDIRECTBUFFER_HPP
+
+#include "Molten/Types.hpp"
+
+namespace Molten
+{
+
+    struct BoundingVolume;
+
+    /**
+    * @brief Parameters of a single indexed draw, read by the device from an indirect buffer.
+    *        Layout matches the indirect draw commands of the backend APIs.
+    */
+    struct DrawIndexedIndirectCommand
+    {
+        uint32_t indexCount;    ///< Number of indices to draw.
+        uint32_t instanceCount; ///< Number of instances to draw, 0 skips the draw.
+        uint32_t firstIndex;    ///< First index of draw in the shared index buffer.
+        int32_t vertexOffset;   ///< Value added to each index before fetching from the shared vertex buffer.
+        uint32_t firstInstance; ///< First instance of draw in the instance buffer.
+    };
+
+    static_assert(sizeof(DrawIndexedIndirectCommand) == 20, "Indirect draw command must be tightly packed.");
+
+    /**
+    * @brief Indirect buffer resource object.
+    *        Holds draw commands of meshes packed into shared vertex and index buffers,
+    *        followed by a draw count which may be written by the device.
+    */
+    class MOLTEN_API IndirectBuffer
+    {
+
+    protected:
+
+        IndirectBuffer() = default;
+        virtual ~IndirectBuffer() = default;
+
+        IndirectBuffer(const IndirectBuffer&) = delete;
+        IndirectBuffer(IndirectBuffer&&) = delete;
+        IndirectBuffer& operator =(const IndirectBuffer&) = delete;
+        IndirectBuffer& operator =(IndirectBuffer&&) = delete;
+
+    };
+
+    /** Descriptor class of indirect buffer class. */
+    class MOLTEN_API IndirectBufferDescriptor
+    {
+
+    public:
+
+        IndirectBufferDescriptor() = default;
+
+        uint32_t commandCount; ///< Maximum number of draw commands, initial draw count of buffer.
+        const DrawIndexedIndirectCommand* commands; ///< Initial commands, may be nullptr.
+        const BoundingVolume* bounds = nullptr; ///< Bounding volume of each command, required by Renderer::CullIndirectBuffer together with commands.
+
+    };
+
+}
+
+#endif
\ No newline at end of file
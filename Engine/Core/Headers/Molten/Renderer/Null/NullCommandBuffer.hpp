@@ -0,0 +1,116 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_NULL_NULLCOMMANDBUFFER_HPP
+#define MOLTEN_CORE_RENDERER_NULL_NULLCOMMANDBUFFER_HPP
+
+#include "Molten/Renderer/CommandBuffer.hpp"
+#include "Molten/Renderer/BindStateCache.hpp"
+#include "Molten/Renderer/CommandStream.hpp"
+
+namespace Molten
+{
+
+    class NullRenderer;
+    class NullIndexBuffer;
+    class NullVertexBuffer;
+
+    /**
+    * @brief Null command buffer class.
+    *        Records commands into a command stream, appended to the frame stream of the renderer when executed.
+    *        Binds of already bound resources are skipped, bound state is reset when recording begins.
+    */
+    class MOLTEN_API NullCommandBuffer : public CommandBuffer
+    {
+
+    public:
+
+        /** Begin recording of commands drawn into framebuffer in the current frame. Returns false if recording failed to begin. */
+        virtual bool Begin(Framebuffer* framebuffer = nullptr) override;
+
+        /** Finish recording of commands. The command buffer is ready to be executed after this call. */
+        virtual void End() override;
+
+        /** Bind pipeline to command buffer. */
+        virtual void BindPipeline(Pipeline* pipeline) override;
+
+        /** Bind uniform block to command buffer, using the current bound pipeline. */
+        virtual void BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset = 0) override;
+
+        /** Draw vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBuffer(VertexBuffer* vertexBuffer) override;
+
+        /** Draw indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer) override;
+
+        /** Draw instances of vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) override;
+
+        /** Draw instances of indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) override;
+
+        /** Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline. */
+        virtual void DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount) override;
+
+        /** Draw indexed meshes packed into shared vertex and index buffers, with the draw count read from indirect buffer. */
+        virtual void DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer) override;
+
+        /** Push constant values to shader stage, using the current bound pipeline. */
+        /**@{*/
+        virtual void PushConstant(const uint32_t location, const bool& value) override;
+        virtual void PushConstant(const uint32_t location, const int32_t& value) override;
+        virtual void PushConstant(const uint32_t location, const float& value) override;
+        virtual void PushConstant(const uint32_t location, const Vector2f32& value) override;
+        virtual void PushConstant(const uint32_t location, const Vector3f32& value) override;
+        virtual void PushConstant(const uint32_t location, const Vector4f32& value) override;
+        virtual void PushConstant(const uint32_t location, const Matrix4x4f32& value) override;
+        /**@}*/
+
+    private:
+
+        explicit NullCommandBuffer(NullRenderer* renderer);
+        ~NullCommandBuffer() = default;
+
+        void InternalBegin();
+        void InternalBindVertexBuffers(NullVertexBuffer* vertexBuffer, NullVertexBuffer* instanceBuffer);
+        void InternalBindIndexBuffer(NullIndexBuffer* indexBuffer);
+        void InternalWriteDraw(const CommandStream::Opcode opcode, const uint32_t count, const uint32_t instanceCount);
+
+        template<typename T>
+        void InternalPushConstant(const uint32_t location, const T& value);
+
+        NullRenderer* renderer;
+        CommandStream stream;
+        BindStateCache bindStateCache;
+        bool recording;
+        Framebuffer* currentFramebuffer; ///< Framebuffer the commands are drawn into, nullptr for the backbuffer.
+
+        friend class NullRenderer;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,315 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_NULL_NULLRENDERER_HPP
+#define MOLTEN_CORE_RENDERER_NULL_NULLRENDERER_HPP
+
+#include "Molten/Renderer/Renderer.hpp"
+#include "Molten/Renderer/Null/NullCommandBuffer.hpp"
+#include "Molten/Renderer/CommandStream.hpp"
+#include "Molten/Renderer/FrameGraph.hpp"
+
+namespace Molten
+{
+
+    class NullFramebuffer;
+
+    /**
+    * @brief Null renderer class, without any device or window.
+    *        All commands of a frame are recorded into a compact command stream, available after the call to EndDraw.
+    *        Used for measuring and testing the CPU cost of command submission, and for validating recorded streams.
+    */
+    class MOLTEN_API NullRenderer : public Renderer
+    {
+
+    public:
+
+        /** Alignment of offsets returned by AllocateUniformBufferData, matching common device limits. */
+        static constexpr size_t UniformBufferAlignment = 256;
+
+        NullRenderer();
+
+        ~NullRenderer();
+
+        /** Opens renderer. The window is only used for its size. */
+        virtual bool Open(const Window& window, const Version& version = Version::None, Logger* logger = nullptr) override;
+
+        /** Opens renderer of given size. */
+        virtual bool OpenOffscreen(const Vector2ui32& size, const Version& version = Version::None, Logger* logger = nullptr) override;
+
+        /**  Closing renderer. */
+        virtual void Close() override;
+
+        /** Resize the framebuffers. */
+        virtual void Resize(const Vector2ui32& size) override;
+
+        /** Get backend API type. */
+        virtual BackendApi GetBackendApi() const override;
+
+        /** Get renderer API version, as passed to Open. */
+        virtual Version GetVersion() const override;
+
+        /** Get statistics of issued and skipped resource binds of the last drawn frame. */
+        virtual BindStatistics GetBindStatistics() const override;
+
+        /** Get CPU frame timings of the renderer. There are no GPU timings. */
+        virtual const FrameProfiler* GetFrameProfiler() const override;
+
+        /** Set requested present mode. All present modes are supported. */
+        virtual void SetPresentMode(const PresentMode presentMode) override;
+
+        /** Get present mode. */
+        virtual PresentMode GetPresentMode() const override;
+
+        /** Set maximum number of frames in flight. Frames are never in flight, the value is only stored. */
+        virtual void SetMaxFramesInFlight(const size_t maxFramesInFlight) override;
+
+        /** Get maximum number of frames in flight. */
+        virtual size_t GetMaxFramesInFlight() const override;
+
+        /** Set system time of the input sampled by the current frame. */
+        virtual void SetFrameInputTime(const Time& inputTime) override;
+
+        /** Get location of pipeline push constant by id. Locations are equal to ids. */
+        virtual uint32_t GetPushConstantLocation(Pipeline* pipeline, const uint32_t id) override;
+
+        /** Set directory of persistent shader and pipeline caches. Nothing is cached by the null renderer. */
+        virtual void SetCacheDirectory(const std::string& directory) override;
+
+
+        /** Create command buffer object. */
+        virtual CommandBuffer* CreateCommandBuffer() override;
+
+        /** Create framebuffer object, declaring its pass in the frame graph. */
+        virtual Framebuffer* CreateFramebuffer(const FramebufferDescriptor& descriptor) override;
+
+        /**  Create index buffer object. */
+        virtual IndexBuffer* CreateIndexBuffer(const IndexBufferDescriptor& descriptor) override;
+
+        /** Create indirect buffer object. */
+        virtual IndirectBuffer* CreateIndirectBuffer(const IndirectBufferDescriptor& descriptor) override;
+
+        /** Create pipeline object. */
+        virtual Pipeline* CreatePipeline(const PipelineDescriptor& descriptor) override;
+
+        /** Create pipeline object asynchronously. The returned future is always ready. */
+        virtual std::future<Pipeline*> CreatePipelineAsync(const PipelineDescriptor& descriptor) override;
+
+        /** Create texture object. Texel data is not kept. */
+        virtual Texture* CreateTexture(const TextureDescriptor& descriptor) override;
+
+        /** Create uniform buffer object. */
+        virtual UniformBlock* CreateUniformBlock(const UniformBlockDescriptor& descriptor) override;
+
+        /** Create uniform buffer object. */
+        virtual UniformBuffer* CreateUniformBuffer(const UniformBufferDescriptor& descriptor) override;
+
+        /** Create vertex buffer object. Vertex data is not kept. */
+        virtual VertexBuffer* CreateVertexBuffer(const VertexBufferDescriptor& descriptor) override;
+
+
+        /** Destroy command buffer object. */
+        virtual void DestroyCommandBuffer(CommandBuffer* commandBuffer) override;
+
+        /** Destroy framebuffer object. */
+        virtual void DestroyFramebuffer(Framebuffer* framebuffer) override;
+
+        /** Destroy index buffer object. */
+        virtual void DestroyIndexBuffer(IndexBuffer* indexBuffer) override;
+
+        /** Destroy indirect buffer object. */
+        virtual void DestroyIndirectBuffer(IndirectBuffer* indirectBuffer) override;
+
+        /** Destroy pipeline object. */
+        virtual void DestroyPipeline(Pipeline* pipeline) override;
+
+        /** Destroy texture object. */
+        virtual void DestroyTexture(Texture* texture) override;
+
+        /** Destroy uniform block object. */
+        virtual void DestroyUniformBlock(UniformBlock* uniformBlock) override;
+
+        /** Destroy uniform buffer object. */
+        virtual void DestroyUniformBuffer(UniformBuffer* uniformBuffer) override;
+
+        /** Destroy vertex buffer object. */
+        virtual void DestroyVertexBuffer(VertexBuffer* vertexBuffer) override;
+
+
+        /** Bind pipeline to draw queue. */
+        virtual void BindPipeline(Pipeline* pipeline) override;
+
+        /** Bind pipeline to draw queue. */
+        virtual void BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset = 0) override;
+
+        /** Bind range of uniform buffer to set of the current bound pipeline, without any uniform block object. */
+        virtual void BindUniformBuffer(Pipeline* pipeline, const uint32_t set, UniformBuffer* uniformBuffer, const uint32_t offset, const uint32_t size) override;
+
+
+        /** Begin recording of a new frame stream. */
+        virtual void BeginDraw() override;
+
+        /** Bind framebuffer drawn by the following commands, recorded as command in the frame stream. */
+        virtual void BindFramebuffer(Framebuffer* framebuffer) override;
+
+        /**
+         * Execute recorded command buffer in the current render pass, by appending its stream to the frame stream.
+         * Bound pipeline and uniform blocks of the renderer are reset after this call.
+         */
+        virtual void ExecuteCommandBuffer(CommandBuffer* commandBuffer) override;
+
+        /** Draw vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBuffer(VertexBuffer* vertexBuffer) override;
+
+        /** Draw indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer) override;
+
+        /** Draw instances of vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) override;
+
+        /** Draw instances of indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) override;
+
+        /** Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline. */
+        virtual void DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount) override;
+
+        /** Draw indexed meshes packed into shared vertex and index buffers, with the draw count read from indirect buffer. */
+        virtual void DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer) override;
+
+        /** Push constant values to shader stage. */
+        /**@{*/
+        virtual void PushConstant(const uint32_t location, const bool& value) override;
+        virtual void PushConstant(const uint32_t location, const int32_t& value) override;
+        virtual void PushConstant(const uint32_t location, const float& value) override;
+        virtual void PushConstant(const uint32_t location, const Vector2f32& value) override;
+        virtual void PushConstant(const uint32_t location, const Vector3f32& value) override;
+        virtual void PushConstant(const uint32_t location, const Vector4f32& value) override;
+        virtual void PushConstant(const uint32_t location, const Matrix4x4f32& value) override;
+        /**@}*/
+
+        /** Finish recording of the frame stream. */
+        virtual void EndDraw() override;
+
+
+        /** Sleep until the graphical device is ready. Returns immediately. */
+        virtual void WaitForDevice() override;
+
+        /** Read pixels of the last rendered frame. Not supported, nothing is rendered. */
+        virtual bool ReadRenderTarget(std::vector<uint8_t>& pixels) override;
+
+        /** Cull draw commands of indirect buffer against frustum, by FrustumCuller. */
+        virtual void CullIndirectBuffer(IndirectBuffer* indirectBuffer, const Frustum& frustum) override;
+
+        /** Update draw commands of indirect buffer for the current frame. */
+        virtual void UpdateIndirectBuffer(IndirectBuffer* indirectBuffer, const uint32_t firstCommand, const uint32_t commandCount, const DrawIndexedIndirectCommand* commands) override;
+
+        /** Update draw count of indirect buffer for the current frame. */
+        virtual void UpdateIndirectBufferDrawCount(IndirectBuffer* indirectBuffer, const uint32_t drawCount) override;
+
+        /** Update uniform buffer data. */
+        virtual void UpdateUniformBuffer(UniformBuffer* uniformBuffer, const size_t offset, const size_t size, const void* data) override;
+
+        /** Allocate and write uniform buffer data for the current frame. */
+        virtual bool AllocateUniformBufferData(UniformBuffer* uniformBuffer, const size_t size, const void* data, uint32_t& offset) override;
+
+        /**
+         * Map the region of a dynamic index buffer read by the current frame, call between BeginDraw and EndDraw.
+         * The region is not in use by any other frame in flight, writing to it never waits for the device.
+         *
+         * @return Pointer to write indices to, nullptr if the buffer is static or indexCount exceeds its capacity.
+         */
+        virtual void* MapIndexBufferForWrite(IndexBuffer* indexBuffer, const uint32_t indexCount) override;
+
+        /** Map the region of a dynamic vertex buffer read by the current frame, see MapIndexBufferForWrite. */
+        virtual void* MapVertexBufferForWrite(VertexBuffer* vertexBuffer, const uint32_t vertexCount) override;
+
+        /** Write indices of dynamic index buffer for the current frame. */
+        virtual bool UpdateIndexBuffer(IndexBuffer* indexBuffer, const uint32_t indexCount, const void* data) override;
+
+        /** Write vertices of dynamic vertex buffer for the current frame. */
+        virtual bool UpdateVertexBuffer(VertexBuffer* vertexBuffer, const uint32_t vertexCount, const void* data) override;
+
+        /** Set budgets of texture streaming. Textures are always resident. */
+        virtual void SetTextureStreamingBudget(const size_t memoryBudget, const size_t frameUploadBudget) override;
+
+        /** Begin named marker of commands recorded on the renderer. */
+        virtual void BeginGpuMarker(const std::string& name) override;
+
+        /** End last begun marker. */
+        virtual void EndGpuMarker() override;
+
+
+        /** Get command stream of the last drawn frame, including executed command buffers. */
+        const CommandStream& GetFrameStream() const;
+
+        /** Get number of drawn frames since the renderer was opened. */
+        uint64_t GetFrameCount() const;
+
+        /**
+         * Get frame graph, with one pass per framebuffer followed by the blit and present passes.
+         * Compiled when the renderer is opened and at the end of frames after framebuffers have changed.
+         */
+        const FrameGraph& GetFrameGraph() const;
+
+    private:
+
+        void FlushInlineCommands();
+
+        void LoadFrameGraph();
+
+        /** Allocate one region of frameSize per frame in flight, each initialized by initialData if provided. */
+        void InitializeDynamicBuffer(std::vector<uint8_t>& data, const size_t frameSize, const void* initialData);
+
+        /** Get region of dynamic buffer written by the current frame, nullptr if not drawing or count exceeds capacity. */
+        uint8_t* GetDynamicBufferFrameData(std::vector<uint8_t>& data, const size_t frameSize, const uint32_t count, const uint32_t capacity);
+
+        Logger* m_logger;
+        Version m_version;
+        Vector2ui32 m_size;
+        PresentMode m_presentMode;
+        size_t m_maxFramesInFlight;
+        NullCommandBuffer m_inlineCommandBuffer;
+        CommandStream m_frameStream;
+        CommandStream m_lastFrameStream;
+        size_t m_markerDepth;
+        bool m_beginDraw;
+        uint64_t m_frameCount;
+        BindStatistics m_frameBindStatistics;
+        BindStatistics m_bindStatistics;
+        FrameProfiler m_frameProfiler;
+        Time m_frameBeginTime;
+        Time m_frameInputTime;
+        std::vector<NullFramebuffer*> m_framebuffers;
+        NullFramebuffer* m_boundFramebuffer;
+        FrameGraph m_frameGraph;
+        bool m_frameGraphChanged;
+
+        friend class NullCommandBuffer;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,185 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_NULL_NULLRESOURCES_HPP
+#define MOLTEN_CORE_RENDERER_NULL_NULLRESOURCES_HPP
+
+#include "Molten/Renderer/Framebuffer.hpp"
+#include "Molten/Renderer/FrameGraph.hpp"
+#include "Molten/Renderer/FrustumCuller.hpp"
+#include "Molten/Renderer/IndexBuffer.hpp"
+#include "Molten/Renderer/IndirectBuffer.hpp"
+#include "Molten/Renderer/Pipeline.hpp"
+#include "Molten/Renderer/Texture.hpp"
+#include "Molten/Renderer/UniformBlock.hpp"
+#include "Molten/Renderer/UniformBuffer.hpp"
+#include "Molten/Renderer/VertexBuffer.hpp"
+#include <vector>
+
+namespace Molten
+{
+
+    class NullCommandBuffer;
+    class NullRenderer;
+
+    /** Resource objects of the null renderer, holding host copies of their descriptions and data. */
+    /**@{*/
+    class MOLTEN_API NullFramebuffer : public Framebuffer
+    {
+
+    private:
+
+        NullFramebuffer() = default;
+        ~NullFramebuffer() = default;
+
+        Vector2ui32 size;
+        FrameGraph::ResourceId resource; ///< Transient texture of the frame graph.
+
+        friend class NullRenderer;
+
+    };
+
+    class MOLTEN_API NullIndexBuffer : public IndexBuffer
+    {
+
+    private:
+
+        NullIndexBuffer() = default;
+        ~NullIndexBuffer() = default;
+
+        uint32_t indexCount; ///< Number of drawn indices, written by the current frame of dynamic buffers.
+        uint32_t capacity;
+        DataType dataType;
+        Usage usage;
+        std::vector<uint8_t> data; ///< Regions of dynamic buffer, one per frame in flight at creation.
+
+        friend class NullCommandBuffer;
+        friend class NullRenderer;
+
+    };
+
+    class MOLTEN_API NullIndirectBuffer : public IndirectBuffer
+    {
+
+    private:
+
+        NullIndirectBuffer() = default;
+        ~NullIndirectBuffer() = default;
+
+        std::vector<DrawIndexedIndirectCommand> commands;
+        uint32_t drawCount;
+        std::vector<DrawIndexedIndirectCommand> sourceCommands; ///< Commands of descriptor, culled into commands.
+        std::vector<BoundingVolume> bounds;
+
+        friend class NullCommandBuffer;
+        friend class NullRenderer;
+
+    };
+
+    class MOLTEN_API NullPipeline : public Pipeline
+    {
+
+    private:
+
+        NullPipeline() = default;
+        ~NullPipeline() = default;
+
+        Topology topology;
+
+        friend class NullCommandBuffer;
+        friend class NullRenderer;
+
+    };
+
+    class MOLTEN_API NullTexture : public Texture
+    {
+
+    private:
+
+        NullTexture() = default;
+        ~NullTexture() = default;
+
+        Vector2ui32 dimensions;
+        Format format;
+        uint32_t mipLevelCount;
+
+        friend class NullRenderer;
+
+    };
+
+    class MOLTEN_API NullUniformBlock : public UniformBlock
+    {
+
+    private:
+
+        NullUniformBlock() = default;
+        ~NullUniformBlock() = default;
+
+        uint32_t set;
+
+        friend class NullCommandBuffer;
+        friend class NullRenderer;
+
+    };
+
+    class MOLTEN_API NullUniformBuffer : public UniformBuffer
+    {
+
+    private:
+
+        NullUniformBuffer() = default;
+        ~NullUniformBuffer() = default;
+
+        std::vector<uint8_t> data;
+        size_t allocationOffset;
+        uint64_t allocationFrame;
+
+        friend class NullRenderer;
+
+    };
+
+    class MOLTEN_API NullVertexBuffer : public VertexBuffer
+    {
+
+    private:
+
+        NullVertexBuffer() = default;
+        ~NullVertexBuffer() = default;
+
+        uint32_t vertexCount; ///< Number of drawn vertices, written by the current frame of dynamic buffers.
+        uint32_t capacity;
+        uint32_t vertexSize;
+        Usage usage;
+        std::vector<uint8_t> data; ///< Regions of dynamic buffer, one per frame in flight at creation.
+
+        friend class NullCommandBuffer;
+        friend class NullRenderer;
+
+    };
+    /**@}*/
+
+}
+
+#endif
\ No newline at end of file
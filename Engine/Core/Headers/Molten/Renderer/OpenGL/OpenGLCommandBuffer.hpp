@@ -0,0 +1,128 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_OPENGL_OPENGLCOMMANDBUFFER_HPP
+#define MOLTEN_CORE_RENDERER_OPENGL_OPENGLCOMMANDBUFFER_HPP
+
+#include "Molten/Core.hpp"
+
+#if defined(MOLTEN_ENABLE_OPENGL)
+#if MOLTEN_PLATFORM == MOLTEN_PLATFORM_LINUX
+
+#include "Molten/Renderer/CommandBuffer.hpp"
+#include "Molten/Renderer/BindStateCache.hpp"
+#include "Molten/Renderer/CommandStream.hpp"
+
+namespace Molten
+{
+
+    class OpenGLX11Renderer;
+    class OpenGLIndexBuffer;
+    class OpenGLVertexBuffer;
+
+    /**
+    * @brief OpenGL command buffer class.
+    *        OpenGL contexts are current on a single thread, commands are therefore recorded into a command stream
+    *        and issued by the renderer when executed. Binds of already bound resources are skipped,
+    *        bound state is reset when recording begins.
+    */
+    class MOLTEN_API OpenGLCommandBuffer : public CommandBuffer
+    {
+
+    public:
+
+        /**
+         * Begin recording of commands for the current frame. Returns false if recording failed to begin.
+         * Framebuffers are not supported, recording fails to begin if framebuffer is not nullptr.
+         */
+        virtual bool Begin(Framebuffer* framebuffer = nullptr) override;
+
+        /** Finish recording of commands. The command buffer is ready to be executed after this call. */
+        virtual void End() override;
+
+        /** Bind pipeline to command buffer. */
+        virtual void BindPipeline(Pipeline* pipeline) override;
+
+        /** Bind uniform block to command buffer, using the current bound pipeline. */
+        virtual void BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset = 0) override;
+
+        /** Draw vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBuffer(VertexBuffer* vertexBuffer) override;
+
+        /** Draw indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer) override;
+
+        /** Draw instances of vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) override;
+
+        /** Draw instances of indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) override;
+
+        /** Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline. */
+        virtual void DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount) override;
+
+        /** Draw indexed meshes packed into shared vertex and index buffers, with the draw count read from indirect buffer. */
+        virtual void DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer) override;
+
+        /** Push constant values to shader stage, using the current bound pipeline. */
+        /**@{*/
+        virtual void PushConstant(const uint32_t location, const bool& value) override;
+        virtual void PushConstant(const uint32_t location, const int32_t& value) override;
+        virtual void PushConstant(const uint32_t location, const float& value) override;
+        virtual void PushConstant(const uint32_t location, const Vector2f32& value) override;
+        virtual void PushConstant(const uint32_t location, const Vector3f32& value) override;
+        virtual void PushConstant(const uint32_t location, const Vector4f32& value) override;
+        virtual void PushConstant(const uint32_t location, const Matrix4x4f32& value) override;
+        /**@}*/
+
+    private:
+
+        explicit OpenGLCommandBuffer(OpenGLX11Renderer* renderer);
+        ~OpenGLCommandBuffer() = default;
+
+        void InternalBegin();
+        void InternalBindVertexBuffers(OpenGLVertexBuffer* vertexBuffer, OpenGLVertexBuffer* instanceBuffer);
+        void InternalBindIndexBuffer(OpenGLIndexBuffer* indexBuffer);
+        void InternalWriteDraw(const CommandStream::Opcode opcode, const uint32_t count, const uint32_t instanceCount);
+
+        template<typename T>
+        void InternalPushConstant(const uint32_t location, const T& value);
+
+        OpenGLX11Renderer* renderer;
+        CommandStream stream;
+        BindStateCache bindStateCache;
+        bool recording;
+
+        friend class OpenGLX11Renderer;
+
+    };
+
+}
+
+#endif
+
+#endif
+
+#endif
\ No newline at end of file
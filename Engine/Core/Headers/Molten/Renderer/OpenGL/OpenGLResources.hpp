@@ -0,0 +1,214 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#ifndef MOLTEN_CORE_RENDERER_OPENGL_OPENGLRESOURCES_HPP
+#define MOLTEN_CORE_RENDERER_OPENGL_OPENGLRESOURCES_HPP
+
+#include "Molten/Renderer/OpenGL/OpengGLHeaders.hpp"
+
+#if defined(MOLTEN_ENABLE_OPENGL)
+
+#include "Molten/Renderer/Framebuffer.hpp"
+#include "Molten/Renderer/IndexBuffer.hpp"
+#include "Molten/Renderer/IndirectBuffer.hpp"
+#include "Molten/Renderer/Pipeline.hpp"
+#include "Molten/Renderer/PushConstant.hpp"
+#include "Molten/Renderer/Texture.hpp"
+#include "Molten/Renderer/UniformBlock.hpp"
+#include "Molten/Renderer/UniformBuffer.hpp"
+#include "Molten/Renderer/VertexBuffer.hpp"
+#include <vector>
+
+namespace Molten
+{
+
+    class OpenGLCommandBuffer;
+    class OpenGLX11Renderer;
+
+    /**
+    * Resource objects of the OpenGL renderer, created by direct state access.
+    * Static data is stored in immutable buffers. Data written by the host is stored in persistently mapped and coherent buffers,
+    * holding one region per frame in flight. A region is not written before the fence of its previous frame is signaled.
+    */
+    /**@{*/
+    class MOLTEN_API OpenGLIndexBuffer : public IndexBuffer
+    {
+
+    private:
+
+        OpenGLIndexBuffer() = default;
+        ~OpenGLIndexBuffer() = default;
+
+        /** Persistently mapped buffer of dynamic index buffer, written by a single frame in flight. */
+        struct Frame
+        {
+            GLuint buffer;
+            uint8_t* mappedData;
+        };
+
+        GLuint buffer; ///< Immutable buffer of static index buffer, 0 if dynamic.
+        std::vector<Frame> frames; ///< Buffers of dynamic index buffer, one per frame in flight.
+        uint32_t indexCount; ///< Number of drawn indices, written by the current frame of dynamic buffers.
+        uint32_t capacity;
+        GLenum dataType;
+
+        friend class OpenGLCommandBuffer;
+        friend class OpenGLX11Renderer;
+
+    };
+
+    class MOLTEN_API OpenGLIndirectBuffer : public IndirectBuffer
+    {
+
+    private:
+
+        OpenGLIndirectBuffer() = default;
+        ~OpenGLIndirectBuffer() = default;
+
+        GLuint buffer;
+        uint8_t* mappedData;
+        size_t frameSize; ///< Size of frame region. Commands are followed by the draw count.
+        uint32_t commandCount;
+        size_t countOffset;
+        GLuint sourceBuffer; ///< Commands of descriptor, culled into buffer. 0 if created without bounding volumes.
+        GLuint boundsBuffer;
+
+        friend class OpenGLCommandBuffer;
+        friend class OpenGLX11Renderer;
+
+    };
+
+    class MOLTEN_API OpenGLPipeline : public Pipeline
+    {
+
+    private:
+
+        OpenGLPipeline() = default;
+        ~OpenGLPipeline() = default;
+
+        GLuint program;
+        GLuint vertexArray; ///< Vertex formats of binding 0, stepped per vertex, and binding 1, stepped per instance.
+        GLsizei vertexStrides[2];
+        GLenum topology;
+        GLenum polygonMode;
+        GLenum frontFace;
+        GLenum cullMode;
+        uint32_t uniformSetCount;
+        PushConstantLocations pushConstantLocations;
+        PushConstantOffsets pushConstantOffsets;
+        uint32_t pushConstantBlockSize;
+
+        friend class OpenGLCommandBuffer;
+        friend class OpenGLX11Renderer;
+
+    };
+
+    class MOLTEN_API OpenGLTexture : public Texture
+    {
+
+    private:
+
+        OpenGLTexture() = default;
+        ~OpenGLTexture() = default;
+
+        GLuint texture;
+        GLuint sampler;
+        Vector2ui32 dimensions;
+        Format format;
+
+        friend class OpenGLX11Renderer;
+
+    };
+
+    class MOLTEN_API OpenGLUniformBuffer : public UniformBuffer
+    {
+
+    private:
+
+        OpenGLUniformBuffer() = default;
+        ~OpenGLUniformBuffer() = default;
+
+        GLuint buffer;
+        uint8_t* mappedData;
+        size_t size;
+        size_t frameSize; ///< Size of frame region, aligned to the uniform buffer offset alignment.
+        size_t allocationOffset;
+        uint64_t allocationFrame;
+
+        friend class OpenGLCommandBuffer;
+        friend class OpenGLX11Renderer;
+
+    };
+
+    class MOLTEN_API OpenGLUniformBlock : public UniformBlock
+    {
+
+    private:
+
+        OpenGLUniformBlock() = default;
+        ~OpenGLUniformBlock() = default;
+
+        OpenGLUniformBuffer* buffer;
+        uint32_t set;
+        uint32_t size;
+
+        friend class OpenGLCommandBuffer;
+        friend class OpenGLX11Renderer;
+
+    };
+
+    class MOLTEN_API OpenGLVertexBuffer : public VertexBuffer
+    {
+
+    private:
+
+        OpenGLVertexBuffer() = default;
+        ~OpenGLVertexBuffer() = default;
+
+        /** Persistently mapped buffer of dynamic vertex buffer, written by a single frame in flight. */
+        struct Frame
+        {
+            GLuint buffer;
+            uint8_t* mappedData;
+        };
+
+        GLuint buffer; ///< Immutable buffer of static vertex buffer, 0 if dynamic.
+        std::vector<Frame> frames; ///< Buffers of dynamic vertex buffer, one per frame in flight.
+        uint32_t vertexCount; ///< Number of drawn vertices, written by the current frame of dynamic buffers.
+        uint32_t capacity;
+        uint32_t vertexSize;
+
+        friend class OpenGLCommandBuffer;
+        friend class OpenGLX11Renderer;
+
+    };
+    /**@}*/
+
+}
+
+#endif
+
+#endif
\ No newline at end of file
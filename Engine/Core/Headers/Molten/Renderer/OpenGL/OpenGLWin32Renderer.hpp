@@ -63,6 +63,9 @@ namespace Molten
          */
         virtual bool Open(const Window& window, const Version& version = Version::None, Logger* logger = nullptr) override;
 
+        /** Opens renderer without any window. Not supported by OpenGL renderer. */
+        virtual bool OpenOffscreen(const Vector2ui32& size, const Version& version = Version::None, Logger* logger = nullptr) override;
+
         /**  Closing renderer. */
         virtual void Close() override;
 
@@ -78,9 +81,39 @@ namespace Molten
         /** Get renderer API version. */
         virtual Version GetVersion() const override;
 
+        /** Get statistics of issued and skipped resource binds of the last drawn frame. */
+        virtual BindStatistics GetBindStatistics() const override;
+
+        /** Get CPU and GPU frame timings of the renderer. Profiling is not supported, nullptr is returned. */
+        virtual const FrameProfiler* GetFrameProfiler() const override;
+
+        /** Set requested present mode. Not supported, the swap interval of the context is used. */
+        virtual void SetPresentMode(const PresentMode presentMode) override;
+
+        /** Get present mode of the current swap chain. */
+        virtual PresentMode GetPresentMode() const override;
+
+        /** Set maximum number of frames in flight. Not supported, the driver decides the number of queued frames. */
+        virtual void SetMaxFramesInFlight(const size_t maxFramesInFlight) override;
+
+        /** Get maximum number of frames in flight of the current swap chain. */
+        virtual size_t GetMaxFramesInFlight() const override;
+
+        /** Set system time of the input sampled by the current frame. Not supported, profiling is unavailable. */
+        virtual void SetFrameInputTime(const Time& inputTime) override;
+
         /** Get location of pipeline push constant by id. Id is set in shader script. */
         virtual uint32_t GetPushConstantLocation(Pipeline* pipeline, const uint32_t id) override;
 
+        /** Set directory of persistent shader and pipeline caches. Not supported by OpenGL renderer. */
+        virtual void SetCacheDirectory(const std::string& directory) override;
+
+
+        /**
+         * Create command buffer object.
+         * Command buffers are recorded by worker threads and executed by the renderer in the current render pass.
+         */
+        virtual CommandBuffer* CreateCommandBuffer() override;
 
         /** Create framebuffer object. */
         virtual Framebuffer* CreateFramebuffer(const FramebufferDescriptor& descriptor) override;
@@ -88,11 +121,17 @@ namespace Molten
         /**  Create index buffer object. */
         virtual IndexBuffer* CreateIndexBuffer(const IndexBufferDescriptor& descriptor) override;
 
+        /** Create indirect buffer object. */
+        virtual IndirectBuffer* CreateIndirectBuffer(const IndirectBufferDescriptor& descriptor) override;
+
         /** Create pipeline object. */
         virtual Pipeline* CreatePipeline(const PipelineDescriptor& descriptor) override;
 
+        /** Create pipeline object asynchronously. */
+        virtual std::future<Pipeline*> CreatePipelineAsync(const PipelineDescriptor& descriptor) override;
+
         /** Create texture object. */
-        virtual Texture* CreateTexture() override;
+        virtual Texture* CreateTexture(const TextureDescriptor& descriptor) override;
 
         /** Create uniform buffer object. */
         virtual UniformBlock* CreateUniformBlock(const UniformBlockDescriptor& descriptor) override;
@@ -104,12 +143,18 @@ namespace Molten
         virtual VertexBuffer* CreateVertexBuffer(const VertexBufferDescriptor& descriptor) override;
 
 
+        /** Destroy command buffer object. */
+        virtual void DestroyCommandBuffer(CommandBuffer* commandBuffer) override;
+
         /** Destroy framebuffer object. */
         virtual void DestroyFramebuffer(Framebuffer* framebuffer) override;
 
         /** Destroy index buffer object. */
         virtual void DestroyIndexBuffer(IndexBuffer* indexBuffer) override;
 
+        /** Destroy indirect buffer object. */
+        virtual void DestroyIndirectBuffer(IndirectBuffer* indirectBuffer) override;
+
         /** Destroy pipeline object. */
         virtual void DestroyPipeline(Pipeline* pipeline) override;
 
@@ -132,16 +177,56 @@ namespace Molten
         /** Bind pipeline to draw queue. */
         virtual void BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset = 0) override;
 
+        /** Bind range of uniform buffer to set of the current bound pipeline, without any uniform block object. */
+        virtual void BindUniformBuffer(Pipeline* pipeline, const uint32_t set, UniformBuffer* uniformBuffer, const uint32_t offset, const uint32_t size) override;
+
 
         /** Begin and initialize rendering to framebuffers. */
         virtual void BeginDraw() override;
 
+        /** Bind framebuffer drawn by the following commands. Framebuffers are not supported, only nullptr is accepted. */
+        virtual void BindFramebuffer(Framebuffer* framebuffer) override;
+
+        /**
+         * Execute recorded command buffer in the current render pass.
+         * Command buffers are executed in call order, interleaved with commands recorded directly on the renderer.
+         * Bound pipeline and uniform blocks of the renderer are reset after this call.
+         */
+        virtual void ExecuteCommandBuffer(CommandBuffer* commandBuffer) override;
+
         /** Draw vertex buffer, using the current bound pipeline. */
         virtual void DrawVertexBuffer(VertexBuffer* vertexBuffer) override;
 
         /** Draw indexed vertex buffer, using the current bound pipeline. */
         virtual void DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer) override;
 
+        /**
+         * Draw instances of vertex buffer, using the current bound pipeline.
+         * Vertex data is stepped per vertex and instance buffer data per instance,
+         * matching the input interface and instance input interface of the vertex script.
+         */
+        virtual void DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) override;
+
+        /** Draw instances of indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) override;
+
+        /**
+         * Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline.
+         * Parameters of each draw are read from the first drawCount commands of indirect buffer.
+         *
+         * @param instanceBuffer Per instance vertex stream, indexed by firstInstance of each command. May be nullptr.
+         */
+        virtual void DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount) override;
+
+        /**
+         * Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline.
+         * The draw count is read from indirect buffer, written by the device. Devices without support of
+         * device side draw counts process all commands, culled commands are then expected to have an instance count of 0.
+         *
+         * @param instanceBuffer Per instance vertex stream, indexed by firstInstance of each command. May be nullptr.
+         */
+        virtual void DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer) override;
+
         /**
          * Push constant values to shader stage.
          * This function call has no effect if provided id argument is greater than the number of push constants in pipeline.
@@ -165,9 +250,60 @@ namespace Molten
         /** Sleep until the graphical device is ready. */
         virtual void WaitForDevice() override;
 
+        /** Read pixels of the last rendered frame. Not supported by OpenGL renderer. */
+        virtual bool ReadRenderTarget(std::vector<uint8_t>& pixels) override;
+
+        /** Cull draw commands of indirect buffer against frustum. Not implemented. */
+        virtual void CullIndirectBuffer(IndirectBuffer* indirectBuffer, const Frustum& frustum) override;
+
+        /**
+         * Update draw commands of indirect buffer for the current frame.
+         * The draw count of indirect buffer is left unchanged.
+         */
+        virtual void UpdateIndirectBuffer(IndirectBuffer* indirectBuffer, const uint32_t firstCommand, const uint32_t commandCount, const DrawIndexedIndirectCommand* commands) override;
+
+        /** Update draw count of indirect buffer for the current frame. Not implemented. */
+        virtual void UpdateIndirectBufferDrawCount(IndirectBuffer* indirectBuffer, const uint32_t drawCount) override;
+
         /** Update uniform buffer data. */
         virtual void UpdateUniformBuffer(UniformBuffer* uniformBuffer, const size_t offset, const size_t size, const void* data) override;
 
+        /**
+         * Allocate and write uniform buffer data for the current frame.
+         * Allocations are linear and released at the next frame, pass the returned offset to BindUniformBlock.
+         *
+         * @param offset[out] Dynamic offset of allocated data.
+         *
+         * @return False if uniform buffer is out of memory for the current frame.
+         */
+        virtual bool AllocateUniformBufferData(UniformBuffer* uniformBuffer, const size_t size, const void* data, uint32_t& offset) override;
+
+        /**
+         * Map the region of a dynamic index buffer read by the current frame, call between BeginDraw and EndDraw.
+         * The region is not in use by any other frame in flight, writing to it never waits for the device.
+         *
+         * @return Pointer to write indices to, nullptr if the buffer is static or indexCount exceeds its capacity.
+         */
+        virtual void* MapIndexBufferForWrite(IndexBuffer* indexBuffer, const uint32_t indexCount) override;
+
+        /** Map the region of a dynamic vertex buffer read by the current frame, see MapIndexBufferForWrite. */
+        virtual void* MapVertexBufferForWrite(VertexBuffer* vertexBuffer, const uint32_t vertexCount) override;
+
+        /** Write indices of dynamic index buffer for the current frame. */
+        virtual bool UpdateIndexBuffer(IndexBuffer* indexBuffer, const uint32_t indexCount, const void* data) override;
+
+        /** Write vertices of dynamic vertex buffer for the current frame. */
+        virtual bool UpdateVertexBuffer(VertexBuffer* vertexBuffer, const uint32_t vertexCount, const void* data) override;
+
+        /** Set budgets of texture streaming. */
+        virtual void SetTextureStreamingBudget(const size_t memoryBudget, const size_t frameUploadBudget) override;
+
+        /** Begin named GPU timestamp marker of commands recorded on the renderer. */
+        virtual void BeginGpuMarker(const std::string& name) override;
+
+        /** End last begun GPU timestamp marker. */
+        virtual void EndGpuMarker() override;
+
     private:
 
         /**
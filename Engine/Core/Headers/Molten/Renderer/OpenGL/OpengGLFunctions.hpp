@@ -36,15 +36,91 @@ namespace Molten
     namespace OpenGL
     {
 
+        /**
+         * Bind function pointers of the current OpenGL context.
+         * Functions of GL_ARB_gl_spirv and GL_ARB_indirect_parameters are optional,
+         * check the version and extensions of the context before use.
+         *
+         * @return False if any required function is missing.
+         */
         MOLTEN_API bool BindOpenGLExtensions();
 
-        extern PFNGLGETSTRINGIPROC GetStrigi;
+        extern PFNGLGETSTRINGIPROC GetStringi;
 
         extern PFNGLBINDVERTEXARRAYPROC BindVertexArray;
         extern PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
         extern PFNGLGENVERTEXARRAYSPROC GenVertexArrays;
         extern PFNGLISVERTEXARRAYPROC IsVertexArray;
 
+        extern PFNGLCREATEVERTEXARRAYSPROC CreateVertexArrays;
+        extern PFNGLENABLEVERTEXARRAYATTRIBPROC EnableVertexArrayAttrib;
+        extern PFNGLVERTEXARRAYATTRIBFORMATPROC VertexArrayAttribFormat;
+        extern PFNGLVERTEXARRAYATTRIBIFORMATPROC VertexArrayAttribIFormat;
+        extern PFNGLVERTEXARRAYATTRIBBINDINGPROC VertexArrayAttribBinding;
+        extern PFNGLVERTEXARRAYBINDINGDIVISORPROC VertexArrayBindingDivisor;
+        extern PFNGLVERTEXARRAYVERTEXBUFFERPROC VertexArrayVertexBuffer;
+        extern PFNGLVERTEXARRAYELEMENTBUFFERPROC VertexArrayElementBuffer;
+
+        extern PFNGLCREATEBUFFERSPROC CreateBuffers;
+        extern PFNGLDELETEBUFFERSPROC DeleteBuffers;
+        extern PFNGLBINDBUFFERPROC BindBuffer;
+        extern PFNGLBINDBUFFERRANGEPROC BindBufferRange;
+        extern PFNGLNAMEDBUFFERSTORAGEPROC NamedBufferStorage;
+        extern PFNGLMAPNAMEDBUFFERRANGEPROC MapNamedBufferRange;
+        extern PFNGLUNMAPNAMEDBUFFERPROC UnmapNamedBuffer;
+        extern PFNGLCLEARNAMEDBUFFERSUBDATAPROC ClearNamedBufferSubData;
+
+        extern PFNGLCREATETEXTURESPROC CreateTextures;
+        extern PFNGLTEXTURESTORAGE2DPROC TextureStorage2D;
+        extern PFNGLTEXTURESUBIMAGE2DPROC TextureSubImage2D;
+        extern PFNGLCREATESAMPLERSPROC CreateSamplers;
+        extern PFNGLDELETESAMPLERSPROC DeleteSamplers;
+        extern PFNGLSAMPLERPARAMETERIPROC SamplerParameteri;
+        extern PFNGLSAMPLERPARAMETERFPROC SamplerParameterf;
+
+        extern PFNGLCREATEFRAMEBUFFERSPROC CreateFramebuffers;
+        extern PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+        extern PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+        extern PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC NamedFramebufferRenderbuffer;
+        extern PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC CheckNamedFramebufferStatus;
+        extern PFNGLCREATERENDERBUFFERSPROC CreateRenderbuffers;
+        extern PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers;
+        extern PFNGLNAMEDRENDERBUFFERSTORAGEPROC NamedRenderbufferStorage;
+
+        extern PFNGLCREATESHADERPROC CreateShader;
+        extern PFNGLDELETESHADERPROC DeleteShader;
+        extern PFNGLSHADERBINARYPROC ShaderBinary;
+        extern PFNGLSHADERSOURCEPROC ShaderSource;
+        extern PFNGLCOMPILESHADERPROC CompileShader;
+        extern PFNGLGETSHADERIVPROC GetShaderiv;
+        extern PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+        extern PFNGLCREATEPROGRAMPROC CreateProgram;
+        extern PFNGLDELETEPROGRAMPROC DeleteProgram;
+        extern PFNGLATTACHSHADERPROC AttachShader;
+        extern PFNGLDETACHSHADERPROC DetachShader;
+        extern PFNGLLINKPROGRAMPROC LinkProgram;
+        extern PFNGLGETPROGRAMIVPROC GetProgramiv;
+        extern PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog;
+        extern PFNGLUSEPROGRAMPROC UseProgram;
+        extern PFNGLPROGRAMUNIFORM4FVPROC ProgramUniform4fv;
+        extern PFNGLPROGRAMUNIFORM1UIPROC ProgramUniform1ui;
+        extern PFNGLSPECIALIZESHADERPROC SpecializeShader; ///< Optional, OpenGL 4.6 or GL_ARB_gl_spirv.
+
+        extern PFNGLDRAWARRAYSINSTANCEDPROC DrawArraysInstanced;
+        extern PFNGLDRAWELEMENTSINSTANCEDPROC DrawElementsInstanced;
+        extern PFNGLMULTIDRAWELEMENTSINDIRECTPROC MultiDrawElementsIndirect;
+        extern PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC MultiDrawElementsIndirectCount; ///< Optional, OpenGL 4.6 or GL_ARB_indirect_parameters.
+        extern PFNGLDISPATCHCOMPUTEPROC DispatchCompute;
+        extern PFNGLMEMORYBARRIERPROC MemoryBarriers; ///< glMemoryBarrier, named to not collide with the MemoryBarrier macro of Windows.
+
+        extern PFNGLFENCESYNCPROC FenceSync;
+        extern PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+        extern PFNGLDELETESYNCPROC DeleteSync;
+
+        extern PFNGLCLIPCONTROLPROC ClipControl;
+        extern PFNGLPUSHDEBUGGROUPPROC PushDebugGroup;
+        extern PFNGLPOPDEBUGGROUPPROC PopDebugGroup;
+
     }
 
 }
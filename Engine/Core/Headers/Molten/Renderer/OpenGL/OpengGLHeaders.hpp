@@ -41,6 +41,7 @@
 #define Bool bool
 	#include <GL/glx.h>
     #include "Molten/Renderer/OpenGL/glext.h"
+    #undef Bool
 #endif
 
 #endif
@@ -44,6 +44,61 @@ namespace Molten
     using PushConstantOffsets = std::vector<PushConstantOffset>;
     using PushConstantLocations = std::map<uint32_t, uint32_t>;
 
+
+    /**
+    * @brief CPU shadow of a push constant block.
+    *        Writes are staged into the shadow and merged into a single dirty byte range,
+    *        which is flushed to the device by one push constant command before the next draw.
+    */
+    class MOLTEN_API PushConstantBuffer
+    {
+
+    public:
+
+        PushConstantBuffer();
+
+        /**
+        * @brief Set size of block, in bytes. Data within the new size is kept.
+        *        The dirty range is clamped to the new size.
+        */
+        void Resize(const uint32_t size);
+
+        /** Forget all data and mark buffer as clean. Call when command buffer recording begins. */
+        void Reset();
+
+        /**
+        * @brief Write data at byte offset of block.
+        *
+        * @return False if data is out of bounds of block.
+        */
+        bool Write(const uint32_t offset, const void* data, const uint32_t size);
+
+        /** Checks if any data has been written since the last call to ClearDirty. */
+        bool IsDirty() const;
+
+        /** Get byte offset of the dirty range. */
+        uint32_t GetDirtyOffset() const;
+
+        /** Get byte size of the dirty range. */
+        uint32_t GetDirtySize() const;
+
+        /** Get data of block. */
+        const uint8_t* GetData() const;
+
+        /** Get size of block, in bytes. */
+        uint32_t GetSize() const;
+
+        /** Mark buffer as clean, after flushing the dirty range. */
+        void ClearDirty();
+
+    private:
+
+        std::vector<uint8_t> m_data;
+        uint32_t m_dirtyBegin;
+        uint32_t m_dirtyEnd;
+
+    };
+
 }
 
 #endif
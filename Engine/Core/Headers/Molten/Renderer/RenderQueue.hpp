@@ -0,0 +1,140 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_RENDERQUEUE_HPP
+#define MOLTEN_CORE_RENDERER_RENDERQUEUE_HPP
+
+#include "Molten/Types.hpp"
+#include <vector>
+
+namespace Molten
+{
+
+    class Renderer;
+    class Pipeline;
+    class UniformBlock;
+    class IndexBuffer;
+    class VertexBuffer;
+    class ThreadPool;
+
+    /**
+    * @brief Draw call of render queue, with a sort key deciding the submission order.
+    *        Packets without an index buffer are drawn non-indexed, and packets with an instance buffer are drawn instanced.
+    */
+    struct MOLTEN_API DrawPacket
+    {
+        DrawPacket();
+
+        uint64_t sortKey; ///< Key created by RenderQueue::CreateSortKey, packets are submitted in ascending order.
+        Pipeline* pipeline;
+        UniformBlock* uniformBlock; ///< Uniform block to bind, may be nullptr.
+        uint32_t uniformOffset; ///< Dynamic offset of uniform block.
+        IndexBuffer* indexBuffer; ///< Index buffer of draw, may be nullptr.
+        VertexBuffer* vertexBuffer;
+        VertexBuffer* instanceBuffer; ///< Instance buffer of draw, may be nullptr.
+        uint32_t instanceCount; ///< Number of instances to draw, only used if instanceBuffer is not nullptr.
+    };
+
+
+    /**
+    * @brief Queue of draw packets, sorted by their 64 bit sort keys before submission to a renderer.
+    *        Sorting is a stable LSD radix sort, run in parallel by a thread pool for large queues.
+    *        Packets sharing pipeline and uniform block bindings are submitted with minimal state changes.
+    */
+    class MOLTEN_API RenderQueue
+    {
+
+    public:
+
+        /** Number of packets required before sorting is split between threads of the thread pool. */
+        static constexpr size_t ParallelSortThreshold = 8192;
+
+        /**
+        * @brief Create sort key of packet. Keys are ordered by pass, pipeline, material and depth, in that priority.
+        *
+        * @param pass Render pass or layer of packet.
+        * @param pipeline Id of pipeline, decided by the application.
+        * @param material Id of material or uniform block, decided by the application.
+        * @param depth Quantized depth, only the lower 24 bits are used. See QuantizeDepth.
+        */
+        static uint64_t CreateSortKey(const uint8_t pass, const uint16_t pipeline, const uint16_t material, const uint32_t depth);
+
+        /**
+        * @brief Quantize depth to 24 bits, for sort keys.
+        *
+        * @param depth Normalized depth, clamped to [0, 1].
+        * @param reverse Sort back to front if true, used for translucent geometry.
+        */
+        static uint32_t QuantizeDepth(const float depth, const bool reverse = false);
+
+        /**
+        * @brief Constructor.
+        *
+        * @param threadPool Thread pool used for parallel sorting, sorting is done by the calling thread if nullptr.
+        */
+        explicit RenderQueue(ThreadPool* threadPool = nullptr);
+
+        /** Remove all packets of queue. Allocated memory is kept for the next frame. */
+        void Clear();
+
+        /** Add packet to queue. */
+        void Push(const DrawPacket& packet);
+
+        /** Sort packets by ascending sort key. Packets of equal keys keep their push order. */
+        void Sort();
+
+        /**
+        * @brief Submit packets to renderer, in queue order. Call Sort first to submit in sort key order.
+        *        Must be called between Renderer::BeginDraw and Renderer::EndDraw.
+        */
+        void Submit(Renderer& renderer) const;
+
+        /** Get number of packets in queue. */
+        size_t GetPacketCount() const;
+
+        /** Get packet by queue order, which is sort key order after a call to Sort. */
+        const DrawPacket& GetPacket(const size_t index) const;
+
+    private:
+
+        struct SortEntry
+        {
+            uint64_t key;
+            uint32_t index;
+        };
+
+        void SortEntries();
+
+        ThreadPool* m_threadPool;
+        std::vector<DrawPacket> m_packets;
+        std::vector<SortEntry> m_entries;
+        std::vector<SortEntry> m_scratchEntries;
+        bool m_sorted;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
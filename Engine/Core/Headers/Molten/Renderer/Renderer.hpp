@@ -27,8 +27,13 @@
 #define MOLTEN_CORE_RENDERER_RENDERER_HPP
 
 #include "Molten/Memory/Reference.hpp"
+#include "Molten/Renderer/BindStateCache.hpp"
+#include "Molten/Renderer/CommandBuffer.hpp"
 #include "Molten/Renderer/Framebuffer.hpp"
+#include "Molten/Renderer/FrameProfiler.hpp"
+#include "Molten/Renderer/FrustumCuller.hpp"
 #include "Molten/Renderer/IndexBuffer.hpp"
+#include "Molten/Renderer/IndirectBuffer.hpp"
 #include "Molten/Renderer/Pipeline.hpp"
 #include "Molten/Renderer/Texture.hpp"
 #include "Molten/Renderer/UniformBlock.hpp"
@@ -36,6 +41,8 @@
 #include "Molten/Renderer/VertexBuffer.hpp"
 #include "Molten/System/Version.hpp"
 #include <functional>
+#include <future>
+#include <string>
 
 namespace Molten::Shader::Visual
 {
@@ -60,7 +67,19 @@ namespace Molten
         enum class BackendApi
         {
             OpenGL,
-            Vulkan
+            Vulkan,
+            Null ///< Records commands into memory, without any device. See NullRenderer.
+        };
+
+        /**
+         * Present modes of the swap chain.
+         * Unsupported modes fall back to Mailbox, then Fifo, which is always supported.
+         */
+        enum class PresentMode
+        {
+            Fifo, ///< Vertical synchronized queue of frames, lowest power usage.
+            Mailbox, ///< Vertical synchronized, the latest frame replaces queued frames. Low latency without tearing.
+            Immediate ///< Frames are presented without waiting for vertical blank. Lowest latency, may tear.
         };
 
         /**
@@ -81,6 +100,12 @@ namespace Molten
          */
         virtual bool Open(const Window& window, const Version& version = Version::None, Logger * logger = nullptr) = 0;
 
+        /**
+         * Opens renderer without any window, by rendering to offscreen images of given size.
+         * Rendered frames are read back to host memory by ReadRenderTarget.
+         */
+        virtual bool OpenOffscreen(const Vector2ui32& size, const Version& version = Version::None, Logger* logger = nullptr) = 0;
+
         /**  Closing renderer. */
         virtual void Close() = 0;
 
@@ -96,21 +121,93 @@ namespace Molten
         /** Get renderer API version. */
         virtual Version GetVersion() const = 0;
 
+        /** Get statistics of issued and skipped resource binds of the last drawn frame. */
+        virtual BindStatistics GetBindStatistics() const = 0;
+
+        /**
+         * Get CPU and GPU frame timings of the renderer.
+         * GPU timings are delayed by the number of frames in flight.
+         *
+         * @return Nullptr if profiling is not supported by the backend.
+         */
+        virtual const FrameProfiler* GetFrameProfiler() const = 0;
+
+        /**
+         * Set requested present mode. The swap chain is recreated at the next call to BeginDraw.
+         * May be called before opening the renderer.
+         */
+        virtual void SetPresentMode(const PresentMode presentMode) = 0;
+
+        /** Get present mode of the current swap chain, which differs from the requested mode if unsupported. */
+        virtual PresentMode GetPresentMode() const = 0;
+
+        /**
+         * Set maximum number of frames recorded by the CPU, before waiting for the device to finish the oldest frame.
+         * Lower values reduce latency, higher values reduce stalls. Clamped to the number of swap chain images.
+         * 0 chooses one frame less than the number of swap chain images, which is the default.
+         * The swap chain is recreated at the next call to BeginDraw. May be called before opening the renderer.
+         */
+        virtual void SetMaxFramesInFlight(const size_t maxFramesInFlight) = 0;
+
+        /** Get maximum number of frames in flight of the current swap chain. */
+        virtual size_t GetMaxFramesInFlight() const = 0;
+
+        /**
+         * Set system time of the input sampled by the current frame, call between BeginDraw and EndDraw.
+         * The time from input to present is added to the frame profiler as CPU series "InputToPresent".
+         */
+        virtual void SetFrameInputTime(const Time& inputTime) = 0;
+
         /** Get location of pipeline push constant by id. Id is set in shader script. */
         virtual uint32_t GetPushConstantLocation(Pipeline* pipeline, const uint32_t id) = 0;
 
+        /**
+         * Set directory of persistent shader and pipeline caches, call before opening the renderer.
+         * Caches are not persisted if directory is empty.
+         */
+        virtual void SetCacheDirectory(const std::string& directory) = 0;
 
-        /** Create framebuffer object. */
+
+        /**
+         * Create command buffer object.
+         * Command buffers are recorded by worker threads and executed by the renderer in the current render pass.
+         */
+        virtual CommandBuffer* CreateCommandBuffer() = 0;
+
+        /**
+         * Create framebuffer object, declaring a transient color texture and a pass drawing it in the frame graph.
+         * Passes of framebuffers are executed before the present pass, in order of creation, and cleared when they begin.
+         * Framebuffers are then blitted into the backbuffer, scaled to its size, before the commands of the present pass are drawn.
+         * The frame graph is recompiled at the next call to EndDraw.
+         *
+         * @return Created framebuffer, nullptr if creation failed or framebuffers are not supported by the backend.
+         */
         virtual Framebuffer* CreateFramebuffer(const FramebufferDescriptor& descriptor) = 0;
 
         /**  Create index buffer object. */
         virtual IndexBuffer* CreateIndexBuffer(const IndexBufferDescriptor& descriptor) = 0;
 
+        /** Create indirect buffer object. */
+        virtual IndirectBuffer* CreateIndirectBuffer(const IndirectBufferDescriptor& descriptor) = 0;
+
         /** Create pipeline object. */
         virtual Pipeline* CreatePipeline(const PipelineDescriptor& descriptor) = 0;
 
-        /** Create texture object. */
-        virtual Texture* CreateTexture() = 0;
+        /**
+         * Create pipeline object asynchronously.
+         * Scripts of descriptor must be kept alive and unmodified until the returned future is ready.
+         *
+         * @return Future of created pipeline, nullptr if creation failed.
+         */
+        virtual std::future<Pipeline*> CreatePipelineAsync(const PipelineDescriptor& descriptor) = 0;
+
+        /**
+         * Create texture object. Non-streamed textures are complete when the current or next frame is drawn.
+         * Streamed textures get their mip levels over the next frames, coarse levels first, within the texture streaming budget.
+         *
+         * @return Created texture, nullptr if creation failed.
+         */
+        virtual Texture* CreateTexture(const TextureDescriptor& descriptor) = 0;
 
         /** Create uniform buffer object. */
         virtual UniformBlock* CreateUniformBlock(const UniformBlockDescriptor& descriptor) = 0;
@@ -122,12 +219,18 @@ namespace Molten
         virtual VertexBuffer* CreateVertexBuffer(const VertexBufferDescriptor& descriptor) = 0;
 
 
+        /** Destroy command buffer object. */
+        virtual void DestroyCommandBuffer(CommandBuffer* commandBuffer) = 0;
+
         /** Destroy framebuffer object. */
         virtual void DestroyFramebuffer(Framebuffer* framebuffer) = 0;
 
         /** Destroy index buffer object. */
         virtual void DestroyIndexBuffer(IndexBuffer* indexBuffer) = 0;
 
+        /** Destroy indirect buffer object. */
+        virtual void DestroyIndirectBuffer(IndirectBuffer* indirectBuffer) = 0;
+
         /** Destroy pipeline object. */
         virtual void DestroyPipeline(Pipeline* pipeline) = 0;
 
@@ -150,16 +253,66 @@ namespace Molten
         /** Bind pipeline to draw queue. */
         virtual void BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset = 0) = 0;
 
+        /**
+         * Bind range of uniform buffer to set of the current bound pipeline, without any uniform block object.
+         * Intended for short lived bindings, the binding is only valid for the current frame.
+         *
+         * @param offset Dynamic offset of data in uniform buffer.
+         * @param size Size of bound range, in bytes. 0 binds the entire buffer.
+         */
+        virtual void BindUniformBuffer(Pipeline* pipeline, const uint32_t set, UniformBuffer* uniformBuffer, const uint32_t offset, const uint32_t size) = 0;
+
 
         /** Begin and initialize rendering to framebuffers. */
         virtual void BeginDraw() = 0;
 
+        /**
+         * Bind framebuffer drawn by the following commands of the current frame, nullptr binds the backbuffer.
+         * Commands recorded on the renderer and executed command buffers are drawn in the pass of the bound framebuffer.
+         * The backbuffer is bound by BeginDraw. Bound pipeline and uniform blocks of the renderer are reset after this call.
+         */
+        virtual void BindFramebuffer(Framebuffer* framebuffer) = 0;
+
+        /**
+         * Execute recorded command buffer in the current render pass.
+         * Command buffers are executed in call order, interleaved with commands recorded directly on the renderer.
+         * Bound pipeline and uniform blocks of the renderer are reset after this call.
+         */
+        virtual void ExecuteCommandBuffer(CommandBuffer* commandBuffer) = 0;
+
         /** Draw vertex buffer, using the current bound pipeline. */
         virtual void DrawVertexBuffer(VertexBuffer* vertexBuffer) = 0;
 
         /** Draw indexed vertex buffer, using the current bound pipeline. */
         virtual void DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer) = 0;
 
+        /**
+         * Draw instances of vertex buffer, using the current bound pipeline.
+         * Vertex data is stepped per vertex and instance buffer data per instance,
+         * matching the input interface and instance input interface of the vertex script.
+         */
+        virtual void DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) = 0;
+
+        /** Draw instances of indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) = 0;
+
+        /**
+         * Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline.
+         * Parameters of each draw are read from the first drawCount commands of indirect buffer.
+         *
+         * @param instanceBuffer Per instance vertex stream, indexed by firstInstance of each command. May be nullptr.
+         */
+        virtual void DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount) = 0;
+
+        /**
+         * Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline.
+         * The draw count is read from indirect buffer, written by the device. Devices without support of
+         * device side draw counts process all commands, culled commands are then expected to have an instance count of 0.
+         *
+         * @param instanceBuffer Per instance vertex stream, indexed by firstInstance of each command. May be nullptr.
+         */
+        virtual void DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer) = 0;
+
         /** 
          * Push constant values to shader stage.
          * This function call has no effect if provided id argument is greater than the number of push constants in pipeline.
@@ -184,9 +337,92 @@ namespace Molten
         /** Sleep until the graphical device is ready. */
         virtual void WaitForDevice() = 0;
 
+        /**
+         * Read pixels of the last rendered frame, as tightly packed rows of RGBA8 pixels.
+         * Only supported by renderers opened by OpenOffscreen, blocks until the frame is finished.
+         *
+         * @return False if reading is not supported or if no frame has been rendered.
+         */
+        virtual bool ReadRenderTarget(std::vector<uint8_t>& pixels) = 0;
+
+        /**
+         * Cull draw commands of indirect buffer against frustum, for the current frame.
+         * Commands and bounding volumes of the indirect buffer descriptor are culled on the device if supported,
+         * otherwise by FrustumCuller. Visible commands are compacted to the front of the buffer and the draw count
+         * is set to the number of visible commands, culled commands are left with an instance count of 0.
+         * The order of visible commands is unspecified, device culling appends them in order of completion.
+         * Call before recording any draws of indirect buffer in the current frame, see DrawVertexBufferIndirectCount.
+         */
+        virtual void CullIndirectBuffer(IndirectBuffer* indirectBuffer, const Frustum& frustum) = 0;
+
+        /**
+         * Update draw commands of indirect buffer for the current frame.
+         * The draw count of indirect buffer is left unchanged.
+         * Rejected for buffers created with bounding volumes, culling overwrites the commands of every frame.
+         */
+        virtual void UpdateIndirectBuffer(IndirectBuffer* indirectBuffer, const uint32_t firstCommand, const uint32_t commandCount, const DrawIndexedIndirectCommand* commands) = 0;
+
+        /**
+         * Update draw count of indirect buffer for the current frame, read by DrawVertexBufferIndirectCount.
+         * Rejected for buffers created with bounding volumes, culling writes the draw count as well.
+         */
+        virtual void UpdateIndirectBufferDrawCount(IndirectBuffer* indirectBuffer, const uint32_t drawCount) = 0;
+
         /** Update uniform buffer data. */
         virtual void UpdateUniformBuffer(UniformBuffer* uniformBuffer, const size_t offset, const size_t size, const void* data) = 0;
 
+        /**
+         * Allocate and write uniform buffer data for the current frame.
+         * Allocations are linear and released at the next frame, pass the returned offset to BindUniformBlock.
+         *
+         * @param offset[out] Dynamic offset of allocated data.
+         *
+         * @return False if uniform buffer is out of memory for the current frame.
+         */
+        virtual bool AllocateUniformBufferData(UniformBuffer* uniformBuffer, const size_t size, const void* data, uint32_t& offset) = 0;
+
+        /**
+         * Map the region of a dynamic index buffer read by the current frame, call between BeginDraw and EndDraw.
+         * The region is not in use by any other frame in flight, writing to it never waits for the device.
+         * Contents are only drawn by the current frame, write them before recording any draw of the buffer.
+         *
+         * @param indexCount Number of indices to draw this frame, the returned region holds at least this many indices.
+         *
+         * @return Pointer to write indices to, nullptr if the buffer is static or indexCount exceeds its capacity.
+         */
+        virtual void* MapIndexBufferForWrite(IndexBuffer* indexBuffer, const uint32_t indexCount) = 0;
+
+        /** Map the region of a dynamic vertex buffer read by the current frame, see MapIndexBufferForWrite. */
+        virtual void* MapVertexBufferForWrite(VertexBuffer* vertexBuffer, const uint32_t vertexCount) = 0;
+
+        /**
+         * Write indices of dynamic index buffer for the current frame, same as copying to the region of MapIndexBufferForWrite.
+         *
+         * @return False if the buffer is static or indexCount exceeds its capacity.
+         */
+        virtual bool UpdateIndexBuffer(IndexBuffer* indexBuffer, const uint32_t indexCount, const void* data) = 0;
+
+        /** Write vertices of dynamic vertex buffer for the current frame, see UpdateIndexBuffer. */
+        virtual bool UpdateVertexBuffer(VertexBuffer* vertexBuffer, const uint32_t vertexCount, const void* data) = 0;
+
+        /**
+         * Set budgets of texture streaming.
+         *
+         * @param memoryBudget Maximum size of resident mip levels of all streamed textures, in bytes.
+         * @param frameUploadBudget Maximum size of mip level uploads per frame, in bytes.
+         */
+        virtual void SetTextureStreamingBudget(const size_t memoryBudget, const size_t frameUploadBudget) = 0;
+
+        /**
+         * Begin named GPU timestamp marker of commands recorded on the renderer.
+         * Markers may be nested and are closed by EndGpuMarker, before the call to EndDraw.
+         * Timings of markers are added to the GPU series of the frame profiler, by marker name.
+         */
+        virtual void BeginGpuMarker(const std::string& name) = 0;
+
+        /** End last begun GPU timestamp marker. */
+        virtual void EndGpuMarker() = 0;
+
     };
 
 }
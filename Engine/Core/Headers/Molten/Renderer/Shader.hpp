@@ -37,7 +37,8 @@ namespace Molten::Shader
     enum class Type : uint8_t
     {
         Vertex,
-        Fragment
+        Fragment,
+        Compute ///< Not supported by visual shader scripts.
     };
 
 
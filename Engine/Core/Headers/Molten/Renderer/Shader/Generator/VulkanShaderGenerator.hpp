@@ -50,12 +50,28 @@ namespace Molten::Shader
     * Generation is performed in two steps:
     *   1. Generate GLSL code, compatible with Spri-V.
     *   2. Converting the GLSL code into SPIR-V.
+    *
+    * SPIR-V may also be generated for OpenGL, consumed through GL_ARB_gl_spirv.
+    * Uniform blocks are then bound to the binding of their set and push constants are emulated by a uniform block.
     */
     class MOLTEN_API VulkanGenerator
     {
 
     public:
 
+        /** Version of generated code. Increment when changes of the generator affect generated code. */
+        static constexpr uint32_t GeneratorVersion = 2;
+
+        /** Enumerator of client APIs of generated code. */
+        enum class TargetApi : uint8_t
+        {
+            Vulkan,
+            OpenGL
+        };
+
+        /** Uniform block binding of emulated push constants, when targeting OpenGL. */
+        static constexpr uint32_t OpenGLPushConstantBinding = 32;
+
         /** Common push constant block data. */
         struct PushConstantTemplate
         {
@@ -93,10 +109,10 @@ namespace Molten::Shader
         static bool GenerateGlslTemplate(VulkanGenerator::GlslTemplates& glslTemplates, const std::vector<Visual::Script*>& scripts, Logger* logger);
 
         /** Generate GLSL code, compatible with Spri-V, from a visual shader script. */
-        static std::vector<uint8_t> GenerateGlsl(const Visual::Script& script, const GlslStageTemplates* templateData, Logger* logger = nullptr);
+        static std::vector<uint8_t> GenerateGlsl(const Visual::Script& script, const GlslStageTemplates* templateData, Logger* logger = nullptr, const TargetApi targetApi = TargetApi::Vulkan);
 
         /** Converting GLSL code into SPIR-V code. */
-        static std::vector<uint8_t> ConvertGlslToSpriV(const std::vector<uint8_t>& code, Type shaderType, Logger* logger = nullptr);
+        static std::vector<uint8_t> ConvertGlslToSpriV(const std::vector<uint8_t>& code, Type shaderType, Logger* logger = nullptr, const TargetApi targetApi = TargetApi::Vulkan);
 
     };
 
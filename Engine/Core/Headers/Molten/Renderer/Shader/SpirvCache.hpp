@@ -0,0 +1,104 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_SHADER_SPIRVCACHE_HPP
+#define MOLTEN_CORE_RENDERER_SHADER_SPIRVCACHE_HPP
+
+#include "Molten/Renderer/Shader.hpp"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <mutex>
+
+namespace Molten::Shader
+{
+
+    /**
+    * @brief Content hashed cache of compiled SPIR-V code.
+    *
+    * Entries are keyed by the hash of generated GLSL code, shader type and generator version.
+    * Compiled code is kept in memory and persisted as one file per entry if a directory is set.
+    * All member functions are thread safe.
+    */
+    class MOLTEN_API SpirvCache
+    {
+
+    public:
+
+        SpirvCache();
+        explicit SpirvCache(const std::string& directory);
+
+        /** Deleted copy constructor. */
+        SpirvCache(const SpirvCache&) = delete;
+
+        /** Deleted copy assignment operator. */
+        SpirvCache& operator =(const SpirvCache&) = delete;
+
+        /** Set directory of persistent cache files. Entries are only kept in memory if directory is empty. */
+        void SetDirectory(const std::string& directory);
+
+        /** Get directory of persistent cache files. */
+        std::string GetDirectory() const;
+
+        /** Create key of source code. Keys of equal source code are guaranteed to be equal between runs. */
+        static uint64_t CreateKey(const std::vector<uint8_t>& sourceCode, const Type shaderType);
+
+        /**
+        * @brief Find SPIR-V code of key, in memory or on disk.
+        *
+        * @return False if key is not cached or if cached file is not valid SPIR-V code.
+        */
+        bool Load(const uint64_t key, std::vector<uint8_t>& spirvCode);
+
+        /**
+        * @brief Store SPIR-V code of key in memory and on disk.
+        *
+        * @return False if code is not valid SPIR-V code or if unable to write cache file.
+        */
+        bool Store(const uint64_t key, const std::vector<uint8_t>& spirvCode);
+
+        /** Clear cached entries in memory. Cache files are kept. */
+        void Clear();
+
+        /** Get number of entries in memory. */
+        size_t GetEntryCount() const;
+
+    private:
+
+        static std::string GetFilename(const std::string& directory, const uint64_t key);
+
+        static bool WriteFile(const std::string& directory, const uint64_t key, const std::vector<uint8_t>& spirvCode);
+
+        static bool IsValidSpirv(const std::vector<uint8_t>& spirvCode);
+
+        mutable std::mutex m_mutex;
+        std::string m_directory;
+        std::unordered_map<uint64_t, std::vector<uint8_t>> m_entries;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -115,6 +115,15 @@ namespace Molten::Shader::Visual
         virtual const VertexOutputVariable* GetVertexOutputVariable() const;
         /**@}*/
 
+        /**
+         * Get interface block for per instance input variables, or nullptr if not supported by this shader stage.
+         * Members of this block is sent from the instance buffer of instanced draw calls.
+         */
+        /**@{*/
+        virtual InputInterface* GetInstanceInputInterface();
+        virtual const InputInterface* GetInstanceInputInterface() const;
+        /**@}*/
+
     };
 
 
@@ -212,10 +221,21 @@ namespace Molten::Shader::Visual
         virtual const VertexOutputVariable* GetVertexOutputVariable() const override;
         /**@}*/
 
+        /**
+         * Get interface block for per instance input variables.
+         * Members of this block is sent from the instance buffer of instanced draw calls,
+         * and are stepped once per instance instead of once per vertex.
+         */
+        /**@{*/
+        virtual InputInterface* GetInstanceInputInterface() override;
+        virtual const InputInterface* GetInstanceInputInterface() const override;
+        /**@}*/
+
     private:
 
         std::set<Node*> m_allNodes;
         InputInterface m_inputInterface;
+        InputInterface m_instanceInputInterface;
         OutputInterface m_outputInterface;
         UniformInterfaces m_uniformInterfaces;
         PushConstantInterface m_pushConstantInterface;
@@ -316,6 +336,7 @@ namespace Molten::Shader::Visual
     private:
 
         using Script::GetVertexOutputVariable;
+        using Script::GetInstanceInputInterface;
 
         std::set<Node*> m_allNodes;
         InputInterface m_inputInterface;
@@ -26,16 +26,55 @@
 #ifndef MOLTEN_CORE_RENDERER_TEXTURE_HPP
 #define MOLTEN_CORE_RENDERER_TEXTURE_HPP
 
-#include "Molten/Types.hpp"
+#include "Molten/Math/Vector.hpp"
 
 namespace Molten
 {
 
+    /** Texture resource object. */
     class MOLTEN_API Texture
     {
 
     public:
 
+        /** Enumerator of texel formats. */
+        enum class Format : uint8_t
+        {
+            Red8,
+            RedGreen8,
+            Rgba8,
+            Rgba8Srgb,
+            Rgba16Float,
+            Rgba32Float
+        };
+
+        /** Enumerator of sampler filters. */
+        enum class Filter : uint8_t
+        {
+            Nearest,
+            Linear
+        };
+
+        /** Enumerator of sampler address modes. */
+        enum class AddressMode : uint8_t
+        {
+            Repeat,
+            MirroredRepeat,
+            ClampToEdge
+        };
+
+        /** Get size in bytes of a single texel of format. */
+        static size_t GetFormatSize(const Format format);
+
+        /** Get number of mip levels of a complete mip chain, down to 1x1. */
+        static uint32_t GetMipLevelCount(const Vector2ui32& dimensions);
+
+        /** Get dimensions of mip level. */
+        static Vector2ui32 GetMipLevelDimensions(const Vector2ui32& dimensions, const uint32_t mipLevel);
+
+        /** Get size in bytes of a range of tightly packed mip levels. */
+        static size_t GetMipChainSize(const Vector2ui32& dimensions, const Format format, const uint32_t firstMipLevel, const uint32_t mipLevelCount);
+
     protected:
 
         Texture() = default;
@@ -45,13 +84,43 @@ namespace Molten
         Texture(Texture&&) = delete;
         Texture& operator =(const Texture&) = delete;
         Texture& operator =(Texture&&) = delete;
-        
 
-        //uint64_t id;
+    };
+
+    /** Descriptor class of texture samplers. */
+    class MOLTEN_API SamplerDescriptor
+    {
+
+    public:
+
+        SamplerDescriptor() = default;
+
+        Texture::Filter magFilter = Texture::Filter::Linear;
+        Texture::Filter minFilter = Texture::Filter::Linear;
+        Texture::Filter mipmapFilter = Texture::Filter::Linear;
+        Texture::AddressMode addressModeU = Texture::AddressMode::Repeat;
+        Texture::AddressMode addressModeV = Texture::AddressMode::Repeat;
+        float maxAnisotropy = 1.0f; ///< Anisotropic filtering is enabled for values above 1, if supported by the device.
+
+    };
+
+    /** Descriptor class of texture class. */
+    class MOLTEN_API TextureDescriptor
+    {
+
+    public:
+
+        TextureDescriptor() = default;
 
+        Vector2ui32 dimensions = { 0, 0 };
+        Texture::Format format = Texture::Format::Rgba8;
+        uint32_t mipLevelCount = 1; ///< Number of mip levels in data. 0 is a complete mip chain.
+        const void* data = nullptr; ///< Tightly packed mip levels, finest level first.
+        bool streaming = false; ///< Stream mip levels over several frames, coarse levels first. Data is copied by the renderer.
+        SamplerDescriptor sampler;
 
     };
 
 }
 
-#endif
+#endif
\ No newline at end of file
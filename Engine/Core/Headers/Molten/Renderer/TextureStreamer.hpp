@@ -0,0 +1,138 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_TEXTURESTREAMER_HPP
+#define MOLTEN_CORE_RENDERER_TEXTURESTREAMER_HPP
+
+#include "Molten/Renderer/Texture.hpp"
+#include <vector>
+#include <unordered_map>
+
+namespace Molten
+{
+
+    /**
+    * @brief Scheduler of streamed texture mip levels, shared by all renderer backends.
+    *        A texture is made resident as a chain of mip levels, from its finest resident level down to 1x1.
+    *        Each update refines textures by one level, coarsest chains first, until the memory budget is reached.
+    *        Refining a texture replaces its resident chain, so the upload size of a request is the size of the entire new chain.
+    */
+    class MOLTEN_API TextureStreamer
+    {
+
+    public:
+
+        /** The first request of a texture makes the chain of levels up to this size resident, regardless of budgets. */
+        static constexpr uint32_t InitialMaxDimension = 64;
+
+        /** Request of backend to make chain of texture resident. */
+        struct Request
+        {
+            Texture* texture;
+            uint32_t mipLevel; ///< New finest resident mip level.
+            size_t uploadSize; ///< Size of chain, from mipLevel to the coarsest level, in bytes.
+        };
+
+        /**
+        * @brief Constructor.
+        *
+        * @param memoryBudget Maximum size of all resident chains, in bytes.
+        * @param frameUploadBudget Maximum size of requests per update, in bytes. At least one request is made per update.
+        */
+        explicit TextureStreamer(const size_t memoryBudget = 256 * 1024 * 1024, const size_t frameUploadBudget = 8 * 1024 * 1024);
+
+        /** Set maximum size of all resident chains, already resident chains are kept. */
+        void SetMemoryBudget(const size_t memoryBudget);
+
+        /** Set maximum size of requests per update. */
+        void SetFrameUploadBudget(const size_t frameUploadBudget);
+
+        /**
+        * @brief Add texture to streamer. No level of the texture is resident until its first request.
+        *
+        * @throw Exception If texture is already added or mip level count is 0.
+        */
+        void Add(Texture* texture, const Vector2ui32& dimensions, const Texture::Format format, const uint32_t mipLevelCount);
+
+        /** Remove texture from streamer, releasing its resident memory from the budget. */
+        void Remove(Texture* texture);
+
+        /** Schedule next mip levels to make resident. Requests are cleared and filled, in upload order. */
+        void Update(std::vector<Request>& requests);
+
+        /**
+        * @brief Reject request of texture made by the last update, after the backend failed to make the chain resident.
+        *        The previously resident chain is restored and its size is returned to the budget, the request is retried by later updates.
+        */
+        void Reject(Texture* texture);
+
+        /** Get finest resident mip level of texture. Returns the mip level count of texture if no level is resident. */
+        uint32_t GetResidentMipLevel(const Texture* texture) const;
+
+        /** Checks if all mip levels of texture are resident. */
+        bool IsFullyResident(const Texture* texture) const;
+
+        /** Get size of all resident chains, in bytes. */
+        size_t GetResidentSize() const;
+
+        /** Get number of added textures. */
+        size_t GetTextureCount() const;
+
+    private:
+
+        struct Entry
+        {
+            Texture* texture;
+            Vector2ui32 dimensions;
+            Texture::Format format;
+            uint32_t mipLevelCount;
+            uint32_t residentMipLevel;
+            size_t residentSize;
+            uint32_t previousMipLevel; ///< Resident mip level before the last request.
+            size_t previousSize; ///< Resident size before the last request.
+        };
+
+        struct Candidate
+        {
+            size_t entryIndex;
+            uint32_t mipLevel;
+            size_t uploadSize;
+        };
+
+        const Entry& GetEntry(const Texture* texture) const;
+        uint32_t GetInitialMipLevel(const Entry& entry) const;
+
+        size_t m_memoryBudget;
+        size_t m_frameUploadBudget;
+        size_t m_residentSize;
+        std::vector<Entry> m_entries;
+        std::unordered_map<const Texture*, size_t> m_entryIndices;
+        std::vector<Candidate> m_candidates;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -61,6 +61,7 @@ namespace Molten
         Pipeline* pipeline;
         UniformBuffer* buffer;
         uint32_t id;
+        uint32_t size = 0; ///< Size of block data at dynamic offset, in bytes. 0 binds the entire buffer.
 
     };
 
@@ -44,6 +44,13 @@ namespace Molten
             Float64
         };
 
+        /** Enumerator of buffer usages. */
+        enum class Usage : uint8_t
+        {
+            Static, ///< Written once at creation, stored in device local memory.
+            Dynamic ///< Rewritten every frame by the host, one region per frame in flight.
+        };
+
     protected:
 
         VertexBuffer() = default;
@@ -66,9 +73,10 @@ namespace Molten
 
         VertexBufferDescriptor() = default;
 
-        uint32_t vertexCount;
+        uint32_t vertexCount; ///< Number of vertices, maximum number of vertices per frame of dynamic buffers.
         uint32_t vertexSize;
-        const void* data;
+        const void* data; ///< Initial vertices, may be nullptr for dynamic buffers.
+        VertexBuffer::Usage usage = VertexBuffer::Usage::Static;
 
     };
 
@@ -49,6 +49,10 @@ namespace Molten
     namespace Vulkan
     {
 
+       /**
+        * Create a swap chain.
+        * The old swap chain is retired, but not destroyed, since frames in flight may still use its images.
+        */
        VkSwapchainKHR MOLTEN_API CreateSwapchain(VkPhysicalDevice physicalDevice, VkDevice logicalDevice,
                                                VkSurfaceKHR surface, VkSurfaceFormatKHR surfaceFormat, VkPresentModeKHR presentMode,
                                                const VkSurfaceCapabilitiesKHR & capabilities, uint32_t imageCount,
@@ -0,0 +1,151 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_VULKANCOMMANDBUFFER_HPP
+#define MOLTEN_CORE_RENDERER_VULKANCOMMANDBUFFER_HPP
+
+#include "Molten/Renderer/CommandBuffer.hpp"
+#include "Molten/Renderer/BindStateCache.hpp"
+#include "Molten/Renderer/PushConstant.hpp"
+
+#if defined(MOLTEN_ENABLE_VULKAN)
+#include "Molten/Renderer/Vulkan/Vulkan.hpp"
+#include <vector>
+
+namespace Molten
+{
+
+    class VulkanRenderer;
+    class VulkanFramebuffer;
+    class VulkanPipeline;
+    class VulkanIndexBuffer;
+    class VulkanVertexBuffer;
+
+    /**
+    * @brief Vulkan command buffer class.
+    *        Records into secondary command buffers, allocated from a command pool owned by this object.
+    *        One secondary command buffer is kept per frame in flight.
+    *        Binds of already bound resources are skipped, bound state is reset when recording begins.
+    *        Push constants are staged in a shadow of the block and flushed by a single push before each draw.
+    */
+    class MOLTEN_API VulkanCommandBuffer : public CommandBuffer
+    {
+
+    public:
+
+        /** Begin recording of commands for the current frame. Returns false if recording failed to begin. */
+        virtual bool Begin(Framebuffer* framebuffer = nullptr) override;
+
+        /** Finish recording of commands. The command buffer is ready to be executed after this call. */
+        virtual void End() override;
+
+        /** Bind pipeline to command buffer. */
+        virtual void BindPipeline(Pipeline* pipeline) override;
+
+        /** Bind uniform block to command buffer, using the current bound pipeline. */
+        virtual void BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset = 0) override;
+
+        /** Draw vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBuffer(VertexBuffer* vertexBuffer) override;
+
+        /** Draw indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer) override;
+
+        /**
+         * Draw instances of vertex buffer, using the current bound pipeline.
+         * Vertex data is stepped per vertex and instance buffer data per instance,
+         * matching the input interface and instance input interface of the vertex script.
+         */
+        virtual void DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) override;
+
+        /** Draw instances of indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) override;
+
+        /**
+         * Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline.
+         * Parameters of each draw are read from the first drawCount commands of indirect buffer.
+         *
+         * @param instanceBuffer Per instance vertex stream, indexed by firstInstance of each command. May be nullptr.
+         */
+        virtual void DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount) override;
+
+        /**
+         * Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline.
+         * The draw count is read from indirect buffer, written by the device. Devices without support of
+         * device side draw counts process all commands, culled commands are then expected to have an instance count of 0.
+         *
+         * @param instanceBuffer Per instance vertex stream, indexed by firstInstance of each command. May be nullptr.
+         */
+        virtual void DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer) override;
+
+        /** Push constant values to shader stage, using the current bound pipeline. */
+        /**@{*/
+        virtual void PushConstant(const uint32_t location, const bool& value) override;
+        virtual void PushConstant(const uint32_t location, const int32_t& value) override;
+        virtual void PushConstant(const uint32_t location, const float& value) override;
+        virtual void PushConstant(const uint32_t location, const Vector2f32& value) override;
+        virtual void PushConstant(const uint32_t location, const Vector3f32& value) override;
+        virtual void PushConstant(const uint32_t location, const Vector4f32& value) override;
+        virtual void PushConstant(const uint32_t location, const Matrix4x4f32& value) override;
+        /**@}*/
+
+    private:
+
+        VulkanCommandBuffer(VulkanRenderer* renderer, VkCommandPool commandPool);
+        ~VulkanCommandBuffer() = default;
+
+        void InternalBindVertexBuffers(VulkanVertexBuffer* vertexBuffer, VulkanVertexBuffer* instanceBuffer);
+        void InternalBindIndexBuffer(VulkanIndexBuffer* indexBuffer);
+
+        /** Get buffer read by the recorded frame, static buffers are read by all frames. */
+        VkBuffer GetFrameBuffer(const VulkanIndexBuffer* indexBuffer) const;
+        VkBuffer GetFrameBuffer(const VulkanVertexBuffer* vertexBuffer) const;
+
+        void InternalDrawIndirect(VkBuffer buffer, const uint32_t drawCount);
+        void InternalFlushPushConstants();
+
+        template<typename T>
+        void InternalPushConstant(const uint32_t location, const T& value);
+
+        VulkanRenderer* renderer;
+        VkCommandPool commandPool;
+        std::vector<VkCommandBuffer> commandBuffers; ///< One per frame in flight, reset once the fence of its frame is signaled.
+        VkCommandBuffer currentCommandBuffer;
+        VulkanPipeline* currentPipeline;
+        VulkanFramebuffer* currentFramebuffer; ///< Framebuffer of recorded commands, nullptr for the backbuffer.
+        size_t currentFrame; ///< Frame in flight slot of recorded frame, indexing per frame resources.
+        bool recording;
+        BindStateCache bindStateCache;
+        PushConstantBuffer pushConstantBuffer;
+
+        friend class VulkanRenderer;
+
+    };
+
+}
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,233 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_VULKANDESCRIPTORALLOCATOR_HPP
+#define MOLTEN_CORE_RENDERER_VULKANDESCRIPTORALLOCATOR_HPP
+
+#include "Molten/Types.hpp"
+
+#if defined(MOLTEN_ENABLE_VULKAN)
+#include "Molten/Renderer/Vulkan/Vulkan.hpp"
+#include <vector>
+#include <unordered_map>
+
+namespace Molten
+{
+
+    class Logger;
+
+    /**
+    * @brief Number of descriptors of each type supported by the descriptor pools of the allocators.
+    *        Used for tracking descriptors left in pools, allocations must never exceed the pool sizes.
+    */
+    struct MOLTEN_API VulkanDescriptorCounts
+    {
+        VulkanDescriptorCounts();
+
+        /** Get descriptor capacity of a single descriptor pool of maxSets sets. */
+        static VulkanDescriptorCounts CreatePoolCapacity(const uint32_t maxSets);
+
+        /**
+        * @brief Add descriptors of type.
+        *
+        * @return False if type is not supported by the descriptor pools.
+        */
+        bool Add(const VkDescriptorType type, const uint32_t count);
+
+        /** Check if every descriptor count of counts is less than or equal to this. */
+        bool Fits(const VulkanDescriptorCounts& counts) const;
+
+        VulkanDescriptorCounts& operator +=(const VulkanDescriptorCounts& rhs);
+        VulkanDescriptorCounts& operator -=(const VulkanDescriptorCounts& rhs);
+
+        uint32_t uniformBufferDynamic;
+        uint32_t uniformBuffer;
+        uint32_t storageBuffer;
+        uint32_t combinedImageSampler;
+    };
+
+    /** Buffer range written to binding of descriptor set. */
+    struct MOLTEN_API VulkanDescriptorBufferBinding
+    {
+        bool operator ==(const VulkanDescriptorBufferBinding& rhs) const;
+
+        uint32_t binding;
+        VkDescriptorType type;
+        VkBuffer buffer;
+        VkDeviceSize offset;
+        VkDeviceSize range;
+    };
+
+
+    /**
+    * @brief Linear allocator of transient descriptor sets.
+    *        Sets are allocated from a list of descriptor pools, growing by one pool when the current pool is exhausted.
+    *        Remaining sets and descriptors of each pool are tracked, exhaustion is never detected by failing allocations.
+    *        Individual sets are never freed, all pools are reset at once when the frame using the sets has finished executing.
+    */
+    class MOLTEN_API VulkanDescriptorArena
+    {
+
+    public:
+
+        VulkanDescriptorArena();
+        ~VulkanDescriptorArena();
+
+        /** Deleted copy constructor. */
+        VulkanDescriptorArena(const VulkanDescriptorArena&) = delete;
+
+        /**
+        * @brief Open arena for logical device. No pool is created until the first allocation.
+        *
+        * @param setsPerPool Maximum number of sets of each descriptor pool.
+        */
+        bool Open(VkDevice logicalDevice, Logger* logger, const uint32_t setsPerPool = 256);
+
+        /** Destroy all descriptor pools. Any set allocated from the arena is invalidated. */
+        void Close();
+
+        /** Release all sets allocated since the last reset. Pools are kept for reuse. */
+        void Reset();
+
+        /**
+        * @brief Allocate transient descriptor set of layout.
+        *        Fails if the layout requires more descriptors than a single descriptor pool provides.
+        *
+        * @param descriptorCounts Number of descriptors of each type in layout.
+        */
+        bool Allocate(VkDescriptorSetLayout layout, const VulkanDescriptorCounts& descriptorCounts, VkDescriptorSet& set);
+
+        /** Get number of created descriptor pools. */
+        size_t GetPoolCount() const;
+
+    private:
+
+        struct Pool
+        {
+            VkDescriptorPool pool;
+            uint32_t freeSetCount;
+            VulkanDescriptorCounts freeDescriptorCounts;
+        };
+
+        VkDevice m_logicalDevice;
+        Logger* m_logger;
+        uint32_t m_setsPerPool;
+        VulkanDescriptorCounts m_poolCapacity;
+        std::vector<Pool> m_pools;
+        size_t m_currentPool;
+
+    };
+
+
+    /**
+    * @brief Cache of persistent descriptor sets, shared by all users of equal layout and bound buffers.
+    *        Sets are reference counted and freed back to their pool when the last reference is released.
+    */
+    class MOLTEN_API VulkanDescriptorSetCache
+    {
+
+    public:
+
+        VulkanDescriptorSetCache();
+        ~VulkanDescriptorSetCache();
+
+        /** Deleted copy constructor. */
+        VulkanDescriptorSetCache(const VulkanDescriptorSetCache&) = delete;
+
+        /**
+        * @brief Open cache for logical device.
+        *
+        * @param setsPerPool Maximum number of sets of each descriptor pool.
+        */
+        bool Open(VkDevice logicalDevice, Logger* logger, const uint32_t setsPerPool = 1024);
+
+        /** Destroy all descriptor pools. Any set acquired from the cache is invalidated. */
+        void Close();
+
+        /**
+        * @brief Acquire reference to descriptor set of layout with bound buffers.
+        *        The set is allocated and written if no matching set is cached.
+        *        Bindings must cover every descriptor of layout, the pool usage of the set is counted from them.
+        *
+        * @param set[out] Acquired descriptor set.
+        */
+        bool Acquire(VkDescriptorSetLayout layout, const std::vector<VulkanDescriptorBufferBinding>& bindings, VkDescriptorSet& set);
+
+        /** Release reference to descriptor set, previously acquired by this cache. */
+        void Release(VkDescriptorSet set);
+
+        /** Get number of cached descriptor sets. */
+        size_t GetSetCount() const;
+
+        /** Get number of created descriptor pools. */
+        size_t GetPoolCount() const;
+
+    private:
+
+        struct Key
+        {
+            bool operator ==(const Key& rhs) const;
+
+            VkDescriptorSetLayout layout;
+            std::vector<VulkanDescriptorBufferBinding> bindings;
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const;
+        };
+
+        struct Entry
+        {
+            VkDescriptorSet set;
+            size_t poolIndex;
+            size_t referenceCount;
+            VulkanDescriptorCounts descriptorCounts;
+        };
+
+        struct Pool
+        {
+            VkDescriptorPool pool;
+            uint32_t freeSetCount;
+            VulkanDescriptorCounts freeDescriptorCounts;
+        };
+
+        bool AllocateSet(VkDescriptorSetLayout layout, const VulkanDescriptorCounts& descriptorCounts, VkDescriptorSet& set, size_t& poolIndex);
+
+        VkDevice m_logicalDevice;
+        Logger* m_logger;
+        uint32_t m_setsPerPool;
+        VulkanDescriptorCounts m_poolCapacity;
+        std::vector<Pool> m_pools;
+        std::unordered_map<Key, Entry, KeyHash> m_entries;
+        std::unordered_map<VkDescriptorSet, Key> m_setKeys;
+
+    };
+
+}
+
+#endif
+
+#endif
\ No newline at end of file
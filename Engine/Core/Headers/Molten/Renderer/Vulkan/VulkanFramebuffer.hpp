@@ -27,9 +27,11 @@
 #define MOLTEN_CORE_RENDERER_VULKANFRAMEBUFFER_HPP
 
 #include "Molten/Renderer/Framebuffer.hpp"
+#include "Molten/Renderer/FrameGraph.hpp"
 
 #if defined(MOLTEN_ENABLE_VULKAN)
 #include "Molten/Renderer/Vulkan/Vulkan.hpp"
+#include <vector>
 
 namespace Molten
 {
@@ -44,9 +46,13 @@ namespace Molten
         VulkanFramebuffer() = default;
         ~VulkanFramebuffer() = default;
 
-        VkFramebuffer framebuffer;
+        VkFramebuffer framebuffer; ///< Null until the frame graph has allocated the transient texture.
+        Vector2ui32 size;
+        FrameGraph::ResourceId resource; ///< Transient texture of the frame graph, invalid for framebuffers of the swap chain.
+        std::vector<VkCommandBuffer> executeCommandBuffers; ///< Secondary command buffers executed by the pass of the current frame.
 
         friend class VulkanRenderer;
+        friend class VulkanCommandBuffer;
 
     };
 
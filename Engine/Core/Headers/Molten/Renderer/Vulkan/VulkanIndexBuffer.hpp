@@ -30,10 +30,13 @@
 
 #if defined(MOLTEN_ENABLE_VULKAN)
 #include "Molten/Renderer/Vulkan/Vulkan.hpp"
+#include "Molten/Renderer/Vulkan/VulkanMemoryAllocator.hpp"
+#include <vector>
 
 namespace Molten
 {
 
+    class VulkanCommandBuffer;
     class VulkanRenderer;
 
     class MOLTEN_API VulkanIndexBuffer : public IndexBuffer
@@ -44,11 +47,20 @@ namespace Molten
         VulkanIndexBuffer() = default;
         ~VulkanIndexBuffer() = default;
 
-        VkBuffer buffer;
-        VkDeviceMemory memory;
-        size_t indexCount;
+        struct Frame
+        {
+            VkBuffer buffer;
+            VulkanMemory memory; ///< Host coherent memory, persistently mapped.
+        };
+
+        VkBuffer buffer; ///< Device local buffer of static index buffer, VK_NULL_HANDLE if dynamic.
+        VulkanMemory memory;
+        std::vector<Frame> frames; ///< Buffers of dynamic index buffer, one per frame in flight.
+        size_t indexCount; ///< Number of drawn indices, written by the current frame of dynamic buffers.
+        size_t capacity;
         DataType dataType;
 
+        friend class VulkanCommandBuffer;
         friend class VulkanRenderer;
 
     };
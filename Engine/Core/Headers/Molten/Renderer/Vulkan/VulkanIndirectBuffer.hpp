@@ -0,0 +1,74 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_VULKANINDIRECTBUFFER_HPP
+#define MOLTEN_CORE_RENDERER_VULKANINDIRECTBUFFER_HPP
+
+#include "Molten/Renderer/IndirectBuffer.hpp"
+#include "Molten/Renderer/FrustumCuller.hpp"
+
+#if defined(MOLTEN_ENABLE_VULKAN)
+#include "Molten/Renderer/Vulkan/Vulkan.hpp"
+#include "Molten/Renderer/Vulkan/VulkanMemoryAllocator.hpp"
+#include <vector>
+
+namespace Molten
+{
+
+    class VulkanCommandBuffer;
+    class VulkanRenderer;
+
+    class MOLTEN_API VulkanIndirectBuffer : public IndirectBuffer
+    {
+
+    private:
+
+        VulkanIndirectBuffer() = default;
+        ~VulkanIndirectBuffer() = default;
+
+        struct Frame
+        {
+            VkBuffer buffer;
+            VulkanMemory memory; ///< Host coherent memory, persistently mapped.
+        };
+
+        std::vector<Frame> frames; ///< One buffer per frame in flight, commands are followed by the draw count.
+        uint32_t commandCount;
+        VkDeviceSize countOffset;
+        Frame sourceBuffer; ///< Storage buffer of descriptor commands, read by the cull shader. Null if culled on the host.
+        Frame boundsBuffer; ///< Storage buffer of bounding volumes, read by the cull shader. Null if culled on the host.
+        std::vector<DrawIndexedIndirectCommand> sourceCommands; ///< Commands of descriptor, culled on the host without any cull pipeline.
+        std::vector<BoundingVolume> bounds;
+
+        friend class VulkanCommandBuffer;
+        friend class VulkanRenderer;
+
+    };
+
+}
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,148 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_RENDERER_VULKANMEMORYALLOCATOR_HPP
+#define MOLTEN_CORE_RENDERER_VULKANMEMORYALLOCATOR_HPP
+
+#include "Molten/Types.hpp"
+
+#if defined(MOLTEN_ENABLE_VULKAN)
+#include "Molten/Renderer/Vulkan/Vulkan.hpp"
+#include "Molten/Memory/BuddyAllocator.hpp"
+#include <memory>
+#include <vector>
+
+namespace Molten
+{
+
+    class Logger;
+
+    /** Sub-allocated range of device memory. */
+    struct MOLTEN_API VulkanMemory
+    {
+        VulkanMemory();
+
+        VkDeviceMemory memory; ///< Device memory object of block, shared with other allocations.
+        VkDeviceSize offset; ///< Offset of allocation in device memory object.
+        VkDeviceSize size; ///< Requested size of allocation.
+        void* mappedData; ///< Persistently mapped data of allocation, nullptr if memory is not host visible.
+        uint32_t memoryTypeIndex;
+        size_t blockIndex;
+    };
+
+
+    /**
+    * @brief Device memory allocator of Vulkan renderer.
+    *        Device memory is allocated in large blocks, one list of blocks per memory type.
+    *        Allocations are sub-allocated from the blocks by buddy allocators, where the block sizes act as size classes.
+    *        Allocations larger than the block size get a dedicated device memory object.
+    */
+    class MOLTEN_API VulkanMemoryAllocator
+    {
+
+    public:
+
+        /** Usage statistics of allocator. */
+        struct Statistics
+        {
+            Statistics();
+
+            size_t blockCount; ///< Number of allocated device memory blocks.
+            size_t dedicatedAllocationCount; ///< Number of allocations with dedicated device memory.
+            size_t allocationCount; ///< Number of allocations, dedicated allocations included.
+            VkDeviceSize reservedSize; ///< Total size of allocated device memory, in bytes.
+            VkDeviceSize usedSize; ///< Total size of allocations, in bytes. Including padding of size classes.
+        };
+
+        VulkanMemoryAllocator();
+        ~VulkanMemoryAllocator();
+
+        /** Deleted copy constructor. */
+        VulkanMemoryAllocator(const VulkanMemoryAllocator&) = delete;
+
+        /**
+        * @brief Open allocator for logical device.
+        *
+        * @param blockSize Size of device memory blocks, in bytes. Must be a power of two.
+        */
+        bool Open(VkPhysicalDevice physicalDevice, VkDevice logicalDevice, Logger* logger, const VkDeviceSize blockSize = 64 * 1024 * 1024);
+
+        /** Free all device memory blocks. Any allocation still in use is invalidated. */
+        void Close();
+
+        /**
+        * @brief Allocate device memory matching requirements and properties.
+        *
+        * @param memory[out] Allocated memory range.
+        */
+        bool Allocate(const VkMemoryRequirements& requirements, const VkMemoryPropertyFlags properties, VulkanMemory& memory);
+
+        /** Free previously allocated memory. The memory object is reset. */
+        void Free(VulkanMemory& memory);
+
+        /**
+        * @brief Release device memory blocks without any allocations.
+        *        Hook of defragmentation, call after resources have been destroyed or moved.
+        */
+        void ReleaseUnusedBlocks();
+
+        /** Get usage statistics of allocator. */
+        Statistics GetStatistics() const;
+
+    private:
+
+        struct Block
+        {
+            Block(VkDeviceMemory memory, void* mappedData, const size_t size, const size_t minAllocationSize);
+
+            VkDeviceMemory memory;
+            void* mappedData;
+            BuddyAllocator allocator;
+        };
+
+        using BlockPointer = std::unique_ptr<Block>;
+
+        bool FindMemoryType(uint32_t& index, const uint32_t filter, const VkMemoryPropertyFlags properties) const;
+        bool AllocateDeviceMemory(const uint32_t memoryTypeIndex, const VkDeviceSize size, VkDeviceMemory& memory, void*& mappedData);
+        void FreeDeviceMemory(VkDeviceMemory memory, void* mappedData);
+
+        static constexpr size_t DedicatedBlockIndex = static_cast<size_t>(-1);
+        static constexpr size_t MinAllocationSize = 256;
+
+        VkDevice m_logicalDevice;
+        VkPhysicalDeviceMemoryProperties m_memoryProperties;
+        Logger* m_logger;
+        VkDeviceSize m_blockSize;
+        std::vector<std::vector<BlockPointer> > m_memoryTypeBlocks; ///< Blocks per memory type. Released blocks leave null slots.
+        size_t m_dedicatedAllocationCount;
+        VkDeviceSize m_dedicatedSize;
+
+    };
+
+}
+
+#endif
+
+#endif
\ No newline at end of file
@@ -30,12 +30,14 @@
 
 #if defined(MOLTEN_ENABLE_VULKAN)
 #include "Molten/Renderer/Vulkan/Vulkan.hpp"
+#include "Molten/Renderer/Vulkan/VulkanDescriptorAllocator.hpp"
 #include "Molten/Renderer/PushConstant.hpp"
 #include <map>
 
 namespace Molten
 {
 
+    class VulkanCommandBuffer;
     class VulkanRenderer;
 
     class MOLTEN_API VulkanPipeline : public Pipeline
@@ -47,8 +49,10 @@ namespace Molten
             VkPipeline graphicsPipeline,
             VkPipelineLayout pipelineLayout,
             std::vector<VkDescriptorSetLayout> descriptionSetLayouts,
+            std::vector<VulkanDescriptorCounts> descriptorSetCounts,
             PushConstantLocations&& pushConstantLocations,
             PushConstantOffsets&& pushConstantOffsets,
+            const uint32_t pushConstantSize,
             std::vector<VkShaderModule>&& shaderModules);
 
         ~VulkanPipeline() = default;   
@@ -56,10 +60,13 @@ namespace Molten
         VkPipeline graphicsPipeline;
         VkPipelineLayout pipelineLayout;
         std::vector<VkDescriptorSetLayout> descriptionSetLayouts;
+        std::vector<VulkanDescriptorCounts> descriptorSetCounts; ///< Number of descriptors in each set layout.
         PushConstantLocations pushConstantLocations;
         PushConstantOffsets pushConstantOffsets;
+        uint32_t pushConstantSize; ///< Size of push constant block, in bytes.
         std::vector<VkShaderModule> shaderModules;
 
+        friend class VulkanCommandBuffer;
         friend class VulkanRenderer;
 
     };
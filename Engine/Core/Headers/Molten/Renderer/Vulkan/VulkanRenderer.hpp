@@ -27,11 +27,20 @@
 #define MOLTEN_CORE_RENDERER_VULKAN_VULKANRENDERER_HPP
 
 #include "Molten/Renderer/Renderer.hpp"
+#include "Molten/Renderer/FrameGraph.hpp"
 #include "Molten/Renderer/Shader/Visual/VisualShaderStructure.hpp"
+#include "Molten/Renderer/Shader/SpirvCache.hpp"
+#include "Molten/Renderer/TextureStreamer.hpp"
+#include "Molten/System/ThreadPool.hpp"
 
 #if defined(MOLTEN_ENABLE_VULKAN)
 #include "Molten/Renderer/Vulkan/Vulkan.hpp"
+#include "Molten/Renderer/Vulkan/VulkanCommandBuffer.hpp"
+#include "Molten/Renderer/Vulkan/VulkanDescriptorAllocator.hpp"
+#include "Molten/Renderer/Vulkan/VulkanMemoryAllocator.hpp"
 #include "Molten/Renderer/Vulkan/VulkanPipeline.hpp"
+#include <deque>
+#include <memory>
 
 MOLTEN_UNSCOPED_ENUM_BEGIN
 
@@ -39,6 +48,7 @@ namespace Molten
 {
 
     class VulkanFramebuffer;
+    class VulkanTexture;
 
     /**
     * @brief Vulkan renderer class.
@@ -48,6 +58,13 @@ namespace Molten
 
     public:
 
+        /**
+        * @brief Upper bound of frames in flight.
+        *        Resources written by the host every frame, like dynamic buffers, keep one copy per frame in flight up to this count,
+        *        so they stay valid when the swap chain is recreated with a different number of images.
+        */
+        static constexpr size_t MaxFramesInFlight = 3;
+
         VulkanRenderer();
 
         /**
@@ -66,6 +83,12 @@ namespace Molten
          */
         virtual bool Open(const Window& window, const Version& version = Version::None, Logger* logger = nullptr) override;
 
+        /**
+         * Opens renderer without any window, surface or swap chain.
+         * Frames are rendered to device images of given size, read back by ReadRenderTarget.
+         */
+        virtual bool OpenOffscreen(const Vector2ui32& size, const Version& version = Version::None, Logger* logger = nullptr) override;
+
         /**  Closing renderer. */
         virtual void Close() override;
 
@@ -81,21 +104,84 @@ namespace Molten
         /** Get renderer API version. */
         virtual Version GetVersion() const override;
 
+        /** Get statistics of issued and skipped resource binds of the last drawn frame. */
+        virtual BindStatistics GetBindStatistics() const override;
+
+        /**
+         * Get CPU and GPU frame timings of the renderer.
+         * GPU timings are read from timestamp queries when the swap chain image is reused,
+         * delayed by the number of frames in flight.
+         */
+        virtual const FrameProfiler* GetFrameProfiler() const override;
+
+        /**
+         * Set requested present mode. The swap chain is recreated at the next call to BeginDraw.
+         * Unsupported modes fall back to Mailbox, then Fifo.
+         */
+        virtual void SetPresentMode(const PresentMode presentMode) override;
+
+        /** Get present mode of the current swap chain. */
+        virtual PresentMode GetPresentMode() const override;
+
+        /**
+         * Set maximum number of frames recorded by the CPU, before waiting for the in flight fence of the oldest frame.
+         * The swap chain is created with at least one image more than the number of frames in flight.
+         * Clamped to MaxFramesInFlight.
+         */
+        virtual void SetMaxFramesInFlight(const size_t maxFramesInFlight) override;
+
+        /** Get maximum number of frames in flight of the current swap chain. */
+        virtual size_t GetMaxFramesInFlight() const override;
+
+        /**
+         * Set system time of the input sampled by the current frame.
+         * The time from input until the frame is queued for presentation is added to the frame profiler.
+         */
+        virtual void SetFrameInputTime(const Time& inputTime) override;
+
         /** Get location of pipeline push constant by id. Id is set in shader script. */
         virtual uint32_t GetPushConstantLocation(Pipeline * pipeline, const uint32_t id) override;
 
+        /**
+         * Set directory of persistent shader and pipeline caches, call before opening the renderer.
+         * Compiled SPIR-V code is cached per shader stage and pipeline cache data is saved when closing the renderer.
+         */
+        virtual void SetCacheDirectory(const std::string& directory) override;
+
+
+        /**
+         * Create command buffer object.
+         * Command buffers are recorded by worker threads and executed by the renderer in the current render pass.
+         */
+        virtual CommandBuffer* CreateCommandBuffer() override;
 
-        /** Create framebuffer object. */
+        /**
+         * Create framebuffer object, declaring its pass in the frame graph.
+         * Framebuffers are blitted into the swap chain images, they are not drawn if the surface does not support it.
+         */
         virtual Framebuffer* CreateFramebuffer(const FramebufferDescriptor& descriptor) override;
 
         /**  Create index buffer object. */
         virtual IndexBuffer* CreateIndexBuffer(const IndexBufferDescriptor& descriptor) override;
 
+        /** Create indirect buffer object. */
+        virtual IndirectBuffer* CreateIndirectBuffer(const IndirectBufferDescriptor& descriptor) override;
+
         /** Create pipeline object. */
         virtual Pipeline* CreatePipeline(const PipelineDescriptor& descriptor) override;
 
-        /** Create texture object. */
-        virtual Texture* CreateTexture() override;
+        /**
+         * Create pipeline object asynchronously, on the shader compilation thread pool.
+         * Scripts of descriptor must be kept alive and unmodified until the returned future is ready.
+         * Pending pipelines are finished before the renderer is closed.
+         */
+        virtual std::future<Pipeline*> CreatePipelineAsync(const PipelineDescriptor& descriptor) override;
+
+        /**
+         * Create texture object. Non-streamed textures are uploaded with the uploads of the current or next frame.
+         * Streamed textures get their mip levels over the next frames, coarse levels first, within the texture streaming budget.
+         */
+        virtual Texture* CreateTexture(const TextureDescriptor& descriptor) override;
 
         /** Create uniform buffer object. */
         virtual UniformBlock* CreateUniformBlock(const UniformBlockDescriptor& descriptor) override;
@@ -107,12 +193,18 @@ namespace Molten
         virtual VertexBuffer* CreateVertexBuffer(const VertexBufferDescriptor& descriptor) override;
 
 
+        /** Destroy command buffer object. */
+        virtual void DestroyCommandBuffer(CommandBuffer* commandBuffer) override;
+
         /** Destroy framebuffer object. */
         virtual void DestroyFramebuffer(Framebuffer* framebuffer) override;
 
         /** Destroy index buffer object. */
         virtual void DestroyIndexBuffer(IndexBuffer* indexBuffer) override;
 
+        /** Destroy indirect buffer object. */
+        virtual void DestroyIndirectBuffer(IndirectBuffer* indirectBuffer) override;
+
         /** Destroy pipeline object. */
         virtual void DestroyPipeline(Pipeline* pipeline) override;
 
@@ -135,16 +227,59 @@ namespace Molten
         /** Bind pipeline to draw queue. */
         virtual void BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset = 0) override;
 
+        /**
+         * Bind range of uniform buffer to set of the current bound pipeline, without any uniform block object.
+         * The descriptor set is allocated from a per-frame arena and is only valid for the current frame.
+         */
+        virtual void BindUniformBuffer(Pipeline* pipeline, const uint32_t set, UniformBuffer* uniformBuffer, const uint32_t offset, const uint32_t size) override;
+
 
         /** Begin and initialize rendering to framebuffers. */
         virtual void BeginDraw() override;
 
+        /** Bind framebuffer drawn by the following commands, ending the current inline command buffer. */
+        virtual void BindFramebuffer(Framebuffer* framebuffer) override;
+
+        /**
+         * Execute recorded command buffer in the current render pass.
+         * Command buffers are executed in call order, interleaved with commands recorded directly on the renderer.
+         * Bound pipeline and uniform blocks of the renderer are reset after this call.
+         */
+        virtual void ExecuteCommandBuffer(CommandBuffer* commandBuffer) override;
+
         /** Draw vertex buffer, using the current bound pipeline. */
         virtual void DrawVertexBuffer(VertexBuffer* vertexBuffer) override;
 
         /** Draw indexed vertex buffer, using the current bound pipeline. */
         virtual void DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer) override;
 
+        /**
+         * Draw instances of vertex buffer, using the current bound pipeline.
+         * Vertex data is stepped per vertex and instance buffer data per instance,
+         * matching the input interface and instance input interface of the vertex script.
+         */
+        virtual void DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) override;
+
+        /** Draw instances of indexed vertex buffer, using the current bound pipeline. */
+        virtual void DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount) override;
+
+        /**
+         * Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline.
+         * Parameters of each draw are read from the first drawCount commands of indirect buffer.
+         *
+         * @param instanceBuffer Per instance vertex stream, indexed by firstInstance of each command. May be nullptr.
+         */
+        virtual void DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount) override;
+
+        /**
+         * Draw indexed meshes packed into shared vertex and index buffers, using the current bound pipeline.
+         * The draw count is read from indirect buffer, written by the device. Devices without support of
+         * device side draw counts process all commands, culled commands are then expected to have an instance count of 0.
+         *
+         * @param instanceBuffer Per instance vertex stream, indexed by firstInstance of each command. May be nullptr.
+         */
+        virtual void DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer) override;
+
         /**
          * Push constant values to shader stage.
          * This function call has no effect if provided id argument is greater than the number of push constants in pipeline.
@@ -169,9 +304,70 @@ namespace Molten
         /** Sleep until the graphical device is ready. */
         virtual void WaitForDevice() override;
 
+        /**
+         * Read pixels of the last rendered frame, as tightly packed rows of RGBA8 pixels.
+         * Only supported by renderers opened by OpenOffscreen, blocks until the frame is finished.
+         */
+        virtual bool ReadRenderTarget(std::vector<uint8_t>& pixels) override;
+
+        /**
+         * Cull draw commands of indirect buffer against frustum, for the current frame.
+         * Commands are culled by a compute shader, dispatched ahead of the render pass of the current frame.
+         * FrustumCuller culls on the host if the cull pipeline is unavailable, e.g. without any GLSL compiler.
+         */
+        virtual void CullIndirectBuffer(IndirectBuffer* indirectBuffer, const Frustum& frustum) override;
+
+        /**
+         * Update draw commands of indirect buffer for the current frame.
+         * The draw count of indirect buffer is left unchanged.
+         */
+        virtual void UpdateIndirectBuffer(IndirectBuffer* indirectBuffer, const uint32_t firstCommand, const uint32_t commandCount, const DrawIndexedIndirectCommand* commands) override;
+
+        /** Update draw count of indirect buffer for the current frame, written to the mapped region of the current frame. */
+        virtual void UpdateIndirectBufferDrawCount(IndirectBuffer* indirectBuffer, const uint32_t drawCount) override;
+
         /** Update uniform buffer data. */
         virtual void UpdateUniformBuffer(UniformBuffer* uniformBuffer, const size_t offset, const size_t size, const void* data) override;
 
+        /**
+         * Allocate and write uniform buffer data for the current frame.
+         * Allocations are linear and released at the next frame, pass the returned offset to BindUniformBlock.
+         *
+         * @param offset[out] Dynamic offset of allocated data.
+         *
+         * @return False if uniform buffer is out of memory for the current frame.
+         */
+        virtual bool AllocateUniformBufferData(UniformBuffer* uniformBuffer, const size_t size, const void* data, uint32_t& offset) override;
+
+        /**
+         * Map the region of a dynamic index buffer read by the current frame, call between BeginDraw and EndDraw.
+         * The region is not in use by any other frame in flight, writing to it never waits for the device.
+         *
+         * @return Pointer to write indices to, nullptr if the buffer is static or indexCount exceeds its capacity.
+         */
+        virtual void* MapIndexBufferForWrite(IndexBuffer* indexBuffer, const uint32_t indexCount) override;
+
+        /** Map the region of a dynamic vertex buffer read by the current frame, see MapIndexBufferForWrite. */
+        virtual void* MapVertexBufferForWrite(VertexBuffer* vertexBuffer, const uint32_t vertexCount) override;
+
+        /** Write indices of dynamic index buffer for the current frame. */
+        virtual bool UpdateIndexBuffer(IndexBuffer* indexBuffer, const uint32_t indexCount, const void* data) override;
+
+        /** Write vertices of dynamic vertex buffer for the current frame. */
+        virtual bool UpdateVertexBuffer(VertexBuffer* vertexBuffer, const uint32_t vertexCount, const void* data) override;
+
+        /** Set budgets of texture streaming. */
+        virtual void SetTextureStreamingBudget(const size_t memoryBudget, const size_t frameUploadBudget) override;
+
+        /**
+         * Begin named GPU timestamp marker of commands recorded on the renderer.
+         * Markers may be nested and are closed by EndGpuMarker, before the call to EndDraw.
+         */
+        virtual void BeginGpuMarker(const std::string& name) override;
+
+        /** End last begun GPU timestamp marker. */
+        virtual void EndGpuMarker() override;
+
     private:
 
         struct DebugMessenger
@@ -201,7 +397,95 @@ namespace Molten
             VkPhysicalDevice device;
             uint32_t graphicsQueueIndex;
             uint32_t presentQueueIndex;
+            uint32_t transferQueueIndex;
             SwapChainSupport swapChainSupport;
+            VkPhysicalDeviceProperties properties;
+            VkPhysicalDeviceFeatures features;
+            bool drawIndirectCountSupport;
+        };
+
+        struct StagingBuffer
+        {
+            VkBuffer buffer;
+            VulkanMemory memory;
+        };
+
+        struct UploadCopy
+        {
+            VkBuffer source;
+            VkBuffer destination;
+            VkDeviceSize sourceOffset;
+            VkDeviceSize size;
+        };
+
+        struct ImageUpload
+        {
+            VkBuffer source;
+            VkImage destination;
+            uint32_t mipLevelCount;
+            std::vector<VkBufferImageCopy> regions;
+        };
+
+        struct RetiredImage
+        {
+            VkImage image;
+            VulkanMemory memory;
+            VkImageView imageView;
+            uint64_t frame;
+        };
+
+        /** Resource of destroyed renderer object, frames recorded before its destruction may still use it. */
+        struct RetiredResource
+        {
+            VkBuffer buffer;
+            VulkanMemory memory;
+            bool uploadDestination; ///< Buffer is destroyed after pending uploads, by DestroyUploadDestination.
+            VkDescriptorSet descriptorSet; ///< Released to the descriptor set cache.
+            VkCommandPool commandPool; ///< Pool of secondary command buffers, destroyed with its buffers.
+            VkFramebuffer framebuffer;
+            uint64_t frame;
+        };
+
+        /** Transient texture of frame graph, bound to the shared frame graph memory. */
+        struct FrameGraphImage
+        {
+            FrameGraph::ResourceId resource;
+            VkImage image;
+            VkImageView imageView;
+        };
+
+        struct RetiredSwapchain
+        {
+            VkSwapchainKHR swapChain;
+            std::vector<VkImage> offscreenImages;
+            std::vector<VulkanMemory> offscreenImageMemory;
+            std::vector<VkImageView> imageViews;
+            std::vector<VulkanFramebuffer*> framebuffers;
+            uint64_t frame;
+        };
+
+        struct TimestampMarker
+        {
+            std::string name;
+            uint32_t beginQuery;
+            uint32_t endQuery;
+        };
+
+        /** Timestamp queries of one swap chain image. Query 0 and 1 are the beginning and end of the frame. */
+        struct TimestampFrame
+        {
+            VkQueryPool queryPool;
+            uint32_t queryCount;
+            std::vector<TimestampMarker> markers;
+        };
+
+        struct UploadBatch
+        {
+            VkCommandBuffer commandBuffer;
+            VkFence fence;
+            uint64_t stagingEnd;
+            std::vector<StagingBuffer> temporaryBuffers;
+            std::vector<StagingBuffer> destroyedBuffers; ///< Upload destinations destroyed while this or an earlier batch was in flight.
         };
 
         PFN_vkVoidFunction GetVulkanFunction(const char* functionName) const;
@@ -215,19 +499,78 @@ namespace Molten
         bool FetchSwapChainSupport(PhysicalDevice& physicalDevice);
         bool LoadLogicalDevice();
         bool LoadSwapChain();
+        bool LoadOffscreenImages();
+        void UnloadOffscreenImages();
         bool LoadImageViews();
         bool LoadRenderPass();
         bool LoadPresentFramebuffer();
+        bool LoadFrameGraph();
+        bool LoadFrameGraphImages();
+        void RetireFrameGraphImages();
+        VkImage GetFrameGraphImage(const FrameGraph::ResourceId resource) const;
+        bool BuildFrameGraph(const bool framebufferPasses);
+        bool LoadFramebufferObjects();
+        void RecordFrameGraphBarriers(const std::vector<FrameGraph::Barrier>& barriers);
+        void BeginRenderPass(VkRenderPass renderPass, VkFramebuffer framebuffer, const VkExtent2D extent);
+        void ExecuteCommandBuffers(std::vector<VkCommandBuffer>& commandBuffers);
+        void BlitFramebuffers();
         Framebuffer* CreateFramebuffer(const VkImageView& imageView, const Vector2ui32 size);
+        void DestroyPresentFramebuffer(VulkanFramebuffer* framebuffer);
         bool LoadCommandPool();
+        bool LoadCommandBuffers();
         bool LoadSyncObjects();
+        void UnloadSyncObjects();
         bool RecreateSwapChain();
+        void RetireSwapchain();
+        void DestroyRetiredSwapchains(const bool all);
         void UnloadSwapchain();
-        bool FindPhysicalDeviceMemoryType(uint32_t& index, const uint32_t filter, const VkMemoryPropertyFlags properties);
-        bool CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& memory);
-        void CopyBuffer(VkBuffer source, VkBuffer destination, VkDeviceSize size);
-        bool CreateVertexInputAttributes(const Shader::Visual::InputStructure& inputs, std::vector<VkVertexInputAttributeDescription>& attributes, uint32_t& stride);
-        bool CreateDescriptorSetLayouts(const std::vector<Shader::Visual::Script*>& visualScripts, std::vector<VkDescriptorSetLayout>& setLayouts);      
+        bool LoadMemoryAllocator();
+        bool LoadDescriptorAllocators();
+        void UnloadDescriptorAllocators();
+        bool LoadPipelineCache();
+        void UnloadPipelineCache();
+        bool LoadCullPipeline();
+        void UnloadCullPipeline();
+        bool CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VulkanMemory& memory);
+        void DestroyBuffer(VkBuffer buffer, VulkanMemory& memory);
+        bool CreateDynamicBuffer(VkDeviceSize size, VkBufferUsageFlags usage, const void* data, VkBuffer& buffer, VulkanMemory& memory);
+        bool CheckDynamicBufferWrite(const size_t count, const size_t capacity);
+        bool LoadUploadResources();
+        void UnloadUploadResources();
+        bool AllocateUploadSource(const VkDeviceSize size, VkBuffer& source, VkDeviceSize& offset, uint8_t*& mappedData);
+        bool UploadBuffer(VkBuffer destination, const void* data, const VkDeviceSize size);
+        bool UploadImage(VkImage destination, const Vector2ui32& dimensions, const Texture::Format format, const uint32_t mipLevelCount, const uint8_t* data);
+        void CancelUploads(VkBuffer destination);
+        void DestroyUploadDestination(VkBuffer destination, VulkanMemory& memory);
+        void CancelImageUploads(VkImage destination);
+        bool CreateSampler(const SamplerDescriptor& descriptor, const uint32_t mipLevelCount, VkSampler& sampler);
+        bool LoadTextureImage(VulkanTexture& texture, const uint32_t firstMipLevel, const uint8_t* data);
+        void UnloadTextureImage(VkImage image, VulkanMemory& memory, VkImageView imageView);
+        void StreamTextures();
+        void DestroyRetiredImages(const bool all);
+        void RetireBuffer(VkBuffer buffer, VulkanMemory& memory, const bool uploadDestination);
+        void RetireDescriptorSet(VkDescriptorSet descriptorSet);
+        void RetireCommandPool(VkCommandPool commandPool);
+        void RetireFramebuffer(VkFramebuffer framebuffer);
+        void DestroyRetiredResources(const bool all);
+        bool AllocateStaging(const VkDeviceSize size, VkDeviceSize& offset);
+        bool FlushUploads();
+        void RetireUploadBatches(const bool waitForOldest);
+        void RecycleUploadSemaphores(const size_t frameIndex);
+        bool BeginTimestampFrame();
+        void ReadTimestampFrame(TimestampFrame& timestampFrame);
+        void EndTimestampFrame();
+        void UnloadTimestampFrames();
+        bool CreateVertexInputAttributes(
+            const Shader::Visual::InputStructure& inputs,
+            const uint32_t binding,
+            std::vector<VkVertexInputAttributeDescription>& attributes,
+            uint32_t& location,
+            uint32_t& stride);
+        bool CreateDescriptorSetLayouts(
+            const std::vector<Shader::Visual::Script*>& visualScripts,
+            std::vector<VkDescriptorSetLayout>& setLayouts,
+            std::vector<VulkanDescriptorCounts>& setDescriptorCounts);      
         bool LoadShaderStages(
             const std::vector<Shader::Visual::Script*>& visualScripts,
             std::vector<VkShaderModule> & shaderModules,
@@ -235,7 +578,12 @@ namespace Molten
             PushConstantLocations& pushConstantLocations,
             PushConstantOffsets& pushConstantOffsets,
             VkPushConstantRange& pushConstantRange);
+        std::vector<uint8_t> CompileShaderStage(const std::vector<uint8_t>& glslCode, const Shader::Type shaderType);
         VkShaderModule CreateShaderModule(const std::vector<uint8_t>& spirvCode);
+        VulkanCommandBuffer* GetInlineCommandBuffer();
+        void EndInlineCommandBuffer();
+        std::vector<VkCommandBuffer>& GetExecuteCommandBuffers();
+        VkCommandBuffer GetComputeCommandBuffer();
 
         template<typename T>
         void InternalPushConstant(const uint32_t location, const T& value);
@@ -252,28 +600,96 @@ namespace Molten
         VkDevice m_logicalDevice;
         VkQueue m_graphicsQueue;
         VkQueue m_presentQueue;       
+        VkQueue m_transferQueue;
+        PFN_vkCmdDrawIndexedIndirectCountKHR m_cmdDrawIndexedIndirectCount;
+        VulkanMemoryAllocator m_memoryAllocator;
+        VulkanDescriptorSetCache m_descriptorSetCache;
+        std::vector<std::unique_ptr<VulkanDescriptorArena>> m_descriptorArenas; ///< Transient descriptor sets, one arena per swap chain image.
+        std::string m_cacheDirectory;
+        Shader::SpirvCache m_spirvCache;
+        VkPipelineCache m_pipelineCache;
+        VkDescriptorSetLayout m_cullSetLayout;
+        VkPipelineLayout m_cullPipelineLayout;
+        VkPipeline m_cullPipeline; ///< Compute pipeline culling indirect buffers, null if culled on the host.
+        VulkanDescriptorCounts m_cullDescriptorCounts;
+        ThreadPool m_threadPool;
+        VkCommandPool m_uploadCommandPool;
+        VkBuffer m_stagingBuffer;
+        VulkanMemory m_stagingMemory;
+        VkDeviceSize m_stagingSize;
+        uint64_t m_stagingHead;
+        uint64_t m_stagingTail;
+        std::vector<UploadCopy> m_pendingUploads;
+        std::vector<ImageUpload> m_pendingImageUploads;
+        std::vector<StagingBuffer> m_pendingTemporaryBuffers;
+        std::deque<UploadBatch> m_submittedUploadBatches;
+        std::vector<UploadBatch> m_freeUploadBatches;
+        std::vector<VkSemaphore> m_uploadWaitSemaphores;
+        std::vector<std::vector<VkSemaphore>> m_frameUploadSemaphores;
+        std::vector<VkSemaphore> m_freeUploadSemaphores;
+        TextureStreamer m_textureStreamer;
+        std::vector<TextureStreamer::Request> m_textureStreamRequests;
+        std::vector<RetiredImage> m_retiredImages; ///< Images replaced by streaming, destroyed when no frame in flight uses them.
+        std::vector<RetiredSwapchain> m_retiredSwapchains; ///< Replaced swap chain resources, destroyed when no frame in flight uses them.
+        std::vector<RetiredResource> m_retiredResources; ///< Resources of destroyed objects, destroyed when no frame in flight uses them.
         VkSwapchainKHR m_swapChain;
         VkFormat m_swapChainImageFormat;
         VkExtent2D m_swapChainExtent;
+        VkExtent2D m_requestedExtent;
         std::vector<VkImage> m_swapChainImages;
         std::vector<VkImageView> m_swapChainImageViews;
+        bool m_offscreen;
+        std::vector<VulkanMemory> m_offscreenImageMemory;
+        bool m_readbackAvailable;
+        uint32_t m_readbackImageIndex;
+        VkExtent2D m_readbackExtent;
         VkRenderPass m_renderPass;
+        VkRenderPass m_loadRenderPass; ///< Compatible with the render pass, loading blitted framebuffers instead of clearing.
         std::vector<VulkanFramebuffer*> m_presentFramebuffers;
+        std::vector<VulkanFramebuffer*> m_framebuffers; ///< Framebuffers created by the application, in order of creation.
+        FrameGraph m_frameGraph; ///< Passes of each frame, recompiled when the swap chain is recreated or framebuffers have changed.
+        bool m_frameGraphChanged;
+        FrameGraph::ResourceId m_frameGraphBackbuffer; ///< Imported swap chain or offscreen image of the current frame.
+        std::vector<FrameGraphImage> m_frameGraphImages;
+        VulkanMemory m_frameGraphMemory; ///< Memory shared by all transient textures, aliased by the frame graph.
         VkCommandPool m_commandPool;
         std::vector<VkCommandBuffer> m_commandBuffers;
+        std::vector<VkCommandBuffer> m_computeCommandBuffers; ///< Culling dispatches, one per swap chain image, submitted ahead of the command buffers.
         std::vector<VkSemaphore> m_imageAvailableSemaphores;
         std::vector<VkSemaphore> m_renderFinishedSemaphores;
         std::vector<VkFence> m_inFlightFences;
         std::vector<VkFence> m_imagesInFlight;
         size_t m_maxFramesInFlight;
+        size_t m_requestedMaxFramesInFlight;
         size_t m_currentFrame;
+        PresentMode m_presentMode;
+        PresentMode m_requestedPresentMode;
+        Time m_frameInputTime;
 
         bool m_resized;
+        Time m_resizeTime;
         bool m_beginDraw;
+        uint64_t m_frameCount;
         uint32_t m_currentImageIndex;
         VkCommandBuffer* m_currentCommandBuffer;
         VkFramebuffer m_currentFramebuffer;
-        VulkanPipeline * m_currentPipeline;
+        VulkanFramebuffer* m_boundFramebuffer;
+        std::vector<VulkanCommandBuffer*> m_inlineCommandBuffers;
+        size_t m_inlineCommandBufferIndex;
+        VulkanCommandBuffer* m_currentInlineCommandBuffer;
+        std::vector<VkCommandBuffer> m_executeCommandBuffers;
+        VkCommandBuffer m_currentComputeCommandBuffer; ///< Compute command buffer begun by the current frame, if any.
+        BindStatistics m_frameBindStatistics;
+        BindStatistics m_bindStatistics;
+        FrameProfiler m_frameProfiler;
+        Time m_frameBeginTime;
+        Time m_recordBeginTime;
+        bool m_timestampSupport;
+        uint32_t m_maxTimestampQueries;
+        std::vector<TimestampFrame> m_timestampFrames; ///< Timestamp queries, one frame per swap chain image.
+        std::vector<size_t> m_gpuMarkerStack; ///< Indices of begun markers of the current timestamp frame.
+
+        friend class VulkanCommandBuffer;
            
     };
 
@@ -30,12 +30,19 @@
 
 #if defined(MOLTEN_ENABLE_VULKAN)
 #include "Molten/Renderer/Vulkan/Vulkan.hpp"
+#include "Molten/Renderer/Vulkan/VulkanMemoryAllocator.hpp"
+#include <vector>
 
 namespace Molten
 {
 
     class VulkanRenderer;
 
+    /**
+    * @brief Vulkan texture class.
+    *        The image holds the resident mip levels, from residentMipLevel down to 1x1.
+    *        Streamed textures get a new image each time a finer level is made resident.
+    */
     class MOLTEN_API VulkanTexture : public Texture
     {
 
@@ -44,6 +51,17 @@ namespace Molten
         VulkanTexture() = default;
         ~VulkanTexture() = default;
 
+        VkImage image;
+        VulkanMemory memory;
+        VkImageView imageView;
+        VkSampler sampler;
+        VkFormat imageFormat;
+        Texture::Format format;
+        Vector2ui32 dimensions;
+        uint32_t mipLevelCount;
+        uint32_t residentMipLevel;
+        std::vector<uint8_t> streamData; ///< Copy of all mip levels, released when every level is resident.
+
         friend class VulkanRenderer;
 
     };
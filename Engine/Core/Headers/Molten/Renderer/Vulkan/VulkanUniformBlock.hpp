@@ -35,6 +35,7 @@
 namespace Molten
 {
 
+    class VulkanCommandBuffer;
     class VulkanRenderer;
 
     class MOLTEN_API VulkanUniformBlock : public UniformBlock
@@ -46,10 +47,10 @@ namespace Molten
         ~VulkanUniformBlock() = default;
 
         VkPipelineLayout pipelineLayout;
-        VkDescriptorPool descriptorPool;
-        std::vector<VkDescriptorSet> descriptorSets;
+        std::vector<VkDescriptorSet> descriptorSets; ///< Shared sets of descriptor set cache, one per frame in flight.
         uint32_t set;
 
+        friend class VulkanCommandBuffer;
         friend class VulkanRenderer;
 
     };
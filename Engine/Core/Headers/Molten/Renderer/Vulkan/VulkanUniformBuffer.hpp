@@ -30,6 +30,7 @@
 
 #if defined(MOLTEN_ENABLE_VULKAN)
 #include "Molten/Renderer/Vulkan/Vulkan.hpp"
+#include "Molten/Renderer/Vulkan/VulkanMemoryAllocator.hpp"
 #include <vector>
 
 namespace Molten
@@ -49,14 +50,19 @@ namespace Molten
         {
             Frame() :
                 buffer(VK_NULL_HANDLE),
-                memory(VK_NULL_HANDLE)
+                memory(),
+                allocationOffset(0),
+                allocationFrame(0)
             { }
 
             VkBuffer buffer;
-            VkDeviceMemory memory;
+            VulkanMemory memory; ///< Host coherent memory, persistently mapped.
+            size_t allocationOffset; ///< Linear allocation offset of frame, reset once per drawn frame.
+            uint64_t allocationFrame; ///< Drawn frame of last allocation.
         };
 
         std::vector<Frame> frames;
+        size_t size;
 
         friend class VulkanRenderer;
 
@@ -30,10 +30,13 @@
 
 #if defined(MOLTEN_ENABLE_VULKAN)
 #include "Molten/Renderer/Vulkan/Vulkan.hpp"
+#include "Molten/Renderer/Vulkan/VulkanMemoryAllocator.hpp"
+#include <vector>
 
 namespace Molten
 {
 
+    class VulkanCommandBuffer;
     class VulkanRenderer;
 
     class MOLTEN_API VulkanVertexBuffer : public VertexBuffer
@@ -44,11 +47,20 @@ namespace Molten
         VulkanVertexBuffer() = default;
         ~VulkanVertexBuffer() = default;
 
-        VkBuffer buffer;
-        VkDeviceMemory memory;
-        uint32_t vertexCount;
+        struct Frame
+        {
+            VkBuffer buffer;
+            VulkanMemory memory; ///< Host coherent memory, persistently mapped.
+        };
+
+        VkBuffer buffer; ///< Device local buffer of static vertex buffer, VK_NULL_HANDLE if dynamic.
+        VulkanMemory memory;
+        std::vector<Frame> frames; ///< Buffers of dynamic vertex buffer, one per frame in flight.
+        uint32_t vertexCount; ///< Number of drawn vertices, written by the current frame of dynamic buffers.
+        uint32_t capacity;
         uint32_t vertexSize;
 
+        friend class VulkanCommandBuffer;
         friend class VulkanRenderer;
 
     };
@@ -28,6 +28,7 @@
 
 #include "Molten/Math/Matrix.hpp"
 #include "Molten/Math/Angle.hpp"
+#include "Molten/Renderer/FrustumCuller.hpp"
 
 namespace Molten
 {
@@ -131,6 +132,11 @@ namespace Molten
             */
             virtual const Matrix4x4f32& GetViewMatrix() const;
 
+            /**
+            * @brief Get camera's view frustum in world space, extracted from the projection and view matrices.
+            */
+            virtual const Frustum& GetFrustum() const;
+
             /**
             * @brief Set camera's position in world space.
             */
@@ -175,6 +181,7 @@ namespace Molten
             Matrix3x3f32 m_rotationMatrix;
             Matrix4x4f32 m_projectionMatrix;
             Matrix4x4f32 m_viewMatrix;
+            Frustum m_frustum;
 
         };
 
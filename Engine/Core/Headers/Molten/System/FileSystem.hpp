@@ -53,6 +53,13 @@ namespace Molten
         *         nullptr is returned if file is empty.
         */
         static std::vector<uint8_t> ReadFile(const std::string & filename);
+
+        /**
+        * @brief Write data to file of given filename, replacing any existing file.
+        *
+        * @return False if unable to open or write file.
+        */
+        static bool WriteFile(const std::string& filename, const void* data, const size_t dataSize);
         
         /**
         * @brief Make directory, from current directory.
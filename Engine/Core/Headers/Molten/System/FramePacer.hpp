@@ -0,0 +1,78 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_SYSTEM_FRAMEPACER_HPP
+#define MOLTEN_CORE_SYSTEM_FRAMEPACER_HPP
+
+#include "Molten/System/Clock.hpp"
+
+namespace Molten
+{
+
+    /**
+    * @brief Frame rate limiter, capping how far the CPU runs ahead of the display.
+    *        Wait blocks until the target frame time has passed since the previous frame.
+    *        Overshoot of a frame is subtracted from the next frame, keeping a steady cadence,
+    *        but the schedule is restarted if a frame is late by more than a whole frame time.
+    */
+    class MOLTEN_API FramePacer
+    {
+
+    public:
+
+        /**
+        * @brief Constructor.
+        *
+        * @param frameTime Target frame time. Pacing is disabled if zero.
+        */
+        explicit FramePacer(const Time frameTime = Time::Zero);
+
+        /** Set target frame time. Pacing is disabled if zero. */
+        void SetFrameTime(const Time frameTime);
+
+        /** Set target frame time from frames per second. Pacing is disabled if zero. */
+        void SetFrameRate(const double framesPerSecond);
+
+        /** Get target frame time. */
+        Time GetFrameTime() const;
+
+        /**
+        * @brief Block until the target frame time has passed since the previous frame.
+        *        Call once per frame, before sampling input of the frame.
+        *
+        * @return Blocked time.
+        */
+        Time Wait();
+
+    private:
+
+        Time m_frameTime;
+        Clock m_clock;
+
+    };
+
+}
+
+#endif
\ No newline at end of file
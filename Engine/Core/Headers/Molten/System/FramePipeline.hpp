@@ -0,0 +1,133 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_SYSTEM_FRAMEPIPELINE_HPP
+#define MOLTEN_CORE_SYSTEM_FRAMEPIPELINE_HPP
+
+#include "Molten/Types.hpp"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace Molten
+{
+
+    /**
+    * @brief Pipeline of frames, overlapping simulation of the next frames with rendering of the current frame.
+    *        The simulating thread writes the state of a frame between BeginFrame and EndFrame,
+    *        while a dedicated render thread passes submitted frame states to the render function, in submission order.
+    *        Frame states are stored in a ring of maxFramesInFlight slots, which is the maximum number of frames
+    *        the simulation runs ahead of rendering. 1 slot serializes the threads, 2 slots double buffers and 3 triple buffers.
+    *        The render function is the only user of the renderer, every renderer call must be made by the render thread.
+    *        Backends binding their context to the opening thread, like the OpenGL renderers, must have the context made
+    *        current on the render thread before use. The Vulkan renderer is not bound to any thread.
+    *
+    * @tparam FrameState Type of state passed from simulation to rendering. Slots are reused,
+    *         a slot returned by BeginFrame contains the state of the frame submitted maxFramesInFlight frames earlier.
+    */
+    template<typename FrameState>
+    class FramePipeline
+    {
+
+    public:
+
+        using RenderFunction = std::function<void(const FrameState&)>;
+
+        /**
+        * @brief Constructor, starting the render thread.
+        *
+        * @param maxFramesInFlight Number of frame state slots. Values of 0 are clamped to 1.
+        */
+        explicit FramePipeline(RenderFunction renderFunction, const size_t maxFramesInFlight = 2);
+
+        /**
+        * @brief Destructor.
+        *        Blocks until all submitted frames are rendered, before stopping the render thread.
+        */
+        ~FramePipeline();
+
+        /** Deleted copy constructor. */
+        FramePipeline(const FramePipeline&) = delete;
+
+        /** Deleted copy assignment operator. */
+        FramePipeline& operator =(const FramePipeline&) = delete;
+
+        /**
+        * @brief Begin simulation of the next frame.
+        *        Blocks until the slot of the frame is no longer read by the render thread.
+        *        Exceptions thrown by the render function are rethrown by this function.
+        *
+        * @return State of the next frame, writable until EndFrame is called.
+        */
+        FrameState& BeginFrame();
+
+        /** Submit the state of the frame begun by BeginFrame for rendering. */
+        void EndFrame();
+
+        /**
+        * @brief Block until all submitted frames are rendered.
+        *        Exceptions thrown by the render function are rethrown by this function.
+        */
+        void Wait();
+
+        /** Get number of frame state slots. */
+        size_t GetMaxFramesInFlight() const;
+
+        /** Get number of submitted frames. */
+        uint64_t GetSubmittedFrameCount() const;
+
+        /** Get number of rendered frames. */
+        uint64_t GetRenderedFrameCount() const;
+
+        /** Checks if the calling thread is the render thread. */
+        bool IsRenderThread() const;
+
+    private:
+
+        void Render();
+        void RethrowRenderException();
+
+        RenderFunction m_renderFunction;
+        std::vector<FrameState> m_frames;
+        uint64_t m_submittedFrameCount;
+        uint64_t m_renderedFrameCount;
+        bool m_beginFrame;
+        bool m_stop;
+        std::exception_ptr m_renderException;
+        mutable std::mutex m_mutex;
+        std::condition_variable m_submitCondition;
+        std::condition_variable m_renderCondition;
+        std::thread m_thread;
+
+    };
+
+}
+
+#include "Molten/System/FramePipeline.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,170 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include <algorithm>
+
+namespace Molten
+{
+
+    template<typename FrameState>
+    FramePipeline<FrameState>::FramePipeline(RenderFunction renderFunction, const size_t maxFramesInFlight) :
+        m_renderFunction(std::move(renderFunction)),
+        m_frames(std::max(maxFramesInFlight, size_t(1))),
+        m_submittedFrameCount(0),
+        m_renderedFrameCount(0),
+        m_beginFrame(false),
+        m_stop(false),
+        m_renderException(nullptr),
+        m_thread(&FramePipeline::Render, this)
+    {}
+
+    template<typename FrameState>
+    FramePipeline<FrameState>::~FramePipeline()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_submitCondition.notify_all();
+        m_thread.join();
+    }
+
+    template<typename FrameState>
+    FrameState& FramePipeline<FrameState>::BeginFrame()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_renderCondition.wait(lock, [&]()
+        {
+            return m_submittedFrameCount - m_renderedFrameCount < static_cast<uint64_t>(m_frames.size()) || m_renderException;
+        });
+        RethrowRenderException();
+
+        m_beginFrame = true;
+        return m_frames[static_cast<size_t>(m_submittedFrameCount % m_frames.size())];
+    }
+
+    template<typename FrameState>
+    void FramePipeline<FrameState>::EndFrame()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_beginFrame)
+            {
+                return;
+            }
+            m_beginFrame = false;
+            ++m_submittedFrameCount;
+        }
+        m_submitCondition.notify_one();
+    }
+
+    template<typename FrameState>
+    void FramePipeline<FrameState>::Wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_renderCondition.wait(lock, [&]()
+        {
+            return m_renderedFrameCount == m_submittedFrameCount || m_renderException;
+        });
+        RethrowRenderException();
+    }
+
+    template<typename FrameState>
+    size_t FramePipeline<FrameState>::GetMaxFramesInFlight() const
+    {
+        return m_frames.size();
+    }
+
+    template<typename FrameState>
+    uint64_t FramePipeline<FrameState>::GetSubmittedFrameCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_submittedFrameCount;
+    }
+
+    template<typename FrameState>
+    uint64_t FramePipeline<FrameState>::GetRenderedFrameCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_renderedFrameCount;
+    }
+
+    template<typename FrameState>
+    bool FramePipeline<FrameState>::IsRenderThread() const
+    {
+        return std::this_thread::get_id() == m_thread.get_id();
+    }
+
+    template<typename FrameState>
+    void FramePipeline<FrameState>::Render()
+    {
+        while (true)
+        {
+            uint64_t frameIndex = 0;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_submitCondition.wait(lock, [&]() { return m_stop || m_renderedFrameCount < m_submittedFrameCount; });
+
+                // Submitted frames are rendered before stopping.
+                if (m_renderedFrameCount == m_submittedFrameCount)
+                {
+                    return;
+                }
+                frameIndex = m_renderedFrameCount;
+            }
+
+            try
+            {
+                m_renderFunction(m_frames[static_cast<size_t>(frameIndex % m_frames.size())]);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_renderException)
+                {
+                    m_renderException = std::current_exception();
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                ++m_renderedFrameCount;
+            }
+            m_renderCondition.notify_all();
+        }
+    }
+
+    template<typename FrameState>
+    void FramePipeline<FrameState>::RethrowRenderException()
+    {
+        if (m_renderException)
+        {
+            auto exception = m_renderException;
+            m_renderException = nullptr;
+            std::rethrow_exception(exception);
+        }
+    }
+
+}
\ No newline at end of file
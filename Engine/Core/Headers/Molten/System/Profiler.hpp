@@ -0,0 +1,118 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_SYSTEM_PROFILER_HPP
+#define MOLTEN_CORE_SYSTEM_PROFILER_HPP
+
+#include "Molten/Types.hpp"
+#include <string>
+#include <ostream>
+
+/*
+* Instrumentation zones, counters and thread names, compiled out unless MOLTEN_ENABLE_PROFILER is defined, example:
+*   void Update()
+*   {
+*       MOLTEN_PROFILE_ZONE("Update");
+*       MOLTEN_PROFILE_COUNTER("Widgets", widgetCount);
+*   }
+*
+* Names of zones and counters must be string literals, or strings with static storage duration.
+*/
+#define MOLTEN_PROFILE_CONCAT_INTERNAL(a, b) a##b
+#define MOLTEN_PROFILE_CONCAT(a, b) MOLTEN_PROFILE_CONCAT_INTERNAL(a, b)
+
+#if defined(MOLTEN_ENABLE_PROFILER)
+    #define MOLTEN_PROFILE_ZONE(name) Molten::Profiler::Zone MOLTEN_PROFILE_CONCAT(moltenProfileZone, __LINE__)(name)
+    #define MOLTEN_PROFILE_FUNCTION() MOLTEN_PROFILE_ZONE(__func__)
+    #define MOLTEN_PROFILE_COUNTER(name, value) Molten::Profiler::AddCounter(name, static_cast<double>(value))
+    #define MOLTEN_PROFILE_THREAD_NAME(name) Molten::Profiler::SetThreadName(name)
+#else
+    #define MOLTEN_PROFILE_ZONE(name) ((void)0)
+    #define MOLTEN_PROFILE_FUNCTION() ((void)0)
+    #define MOLTEN_PROFILE_COUNTER(name, value) ((void)0)
+    #define MOLTEN_PROFILE_THREAD_NAME(name) ((void)0)
+#endif
+
+namespace Molten
+{
+
+    /**
+    * @brief Instrumentation profiler of the engine, writing Chrome trace event files.
+    *        Each thread records events into its own fixed size ring buffer, without locks.
+    *        Events are dropped if the ring of a thread is full, until the next write of the trace consumes them.
+    *        Zones are dropped as a whole, including their nested zones, so begin and end events are always balanced.
+    *        Trace files are viewable in chrome://tracing and the Perfetto UI.
+    */
+    class MOLTEN_API Profiler
+    {
+
+    public:
+
+        /** Maximum number of unwritten events per thread. */
+        static constexpr size_t ThreadBufferCapacity = 32768;
+
+        /** Zone of its lifetime, on the calling thread. */
+        class MOLTEN_API Zone
+        {
+
+        public:
+
+            explicit Zone(const char* name);
+            ~Zone();
+
+            Zone(const Zone&) = delete;
+            Zone& operator =(const Zone&) = delete;
+
+        };
+
+        /** Begin zone on the calling thread. Zones of a thread must be nested. */
+        static void BeginZone(const char* name);
+
+        /** End last begun zone of the calling thread. */
+        static void EndZone();
+
+        /** Add sample of counter. */
+        static void AddCounter(const char* name, const double value);
+
+        /** Set name of the calling thread, shown in trace. */
+        static void SetThreadName(const std::string& name);
+
+        /** Get number of events dropped since the last write or clear, due to full thread buffers. */
+        static size_t GetDroppedEventCount();
+
+        /**
+        * @brief Write all recorded events as Chrome trace JSON, consuming them.
+        *        Timestamps are in microseconds since the first use of the profiler.
+        */
+        static void WriteChromeTrace(std::ostream& stream);
+
+        /** Discard all recorded events. */
+        static void Clear();
+
+    };
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#ifndef MOLTEN_CORE_SYSTEM_THREADPOOL_HPP
+#define MOLTEN_CORE_SYSTEM_THREADPOOL_HPP
+
+#include "Molten/Types.hpp"
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <type_traits>
+
+namespace Molten
+{
+
+    /**
+    * @brief Thread pool class.
+    *        Executing tasks on a fixed number of worker threads, in submission order.
+    */
+    class MOLTEN_API ThreadPool
+    {
+
+    public:
+
+        /**
+        * @brief Constructor.
+        *        Worker threads are started at construction.
+        *
+        * @param threadCount Number of worker threads. Number of hardware threads is used if 0.
+        */
+        explicit ThreadPool(const size_t threadCount = 0);
+
+        /**
+        * @brief Destructor.
+        *        Blocks until all submitted tasks are finished.
+        */
+        ~ThreadPool();
+
+        /** Deleted copy constructor. */
+        ThreadPool(const ThreadPool&) = delete;
+
+        /** Deleted copy assignment operator. */
+        ThreadPool& operator =(const ThreadPool&) = delete;
+
+        /**
+        * @brief Submit task for execution by any worker thread.
+        *
+        * @return Future of task result. Exceptions thrown by task are rethrown by the future.
+        */
+        template<typename Function>
+        std::future<std::invoke_result_t<Function>> Execute(Function&& function);
+
+        /**
+        * @brief Block until all submitted tasks are finished.
+        *        Must not be called by a worker thread of this pool.
+        */
+        void Wait();
+
+        /** Get number of worker threads. */
+        size_t GetThreadCount() const;
+
+        /**
+        * @brief Checks if the calling thread is a worker thread of this pool.
+        *        Tasks should not block on futures of other tasks of the same pool, to avoid deadlocks.
+        */
+        bool IsWorkerThread() const;
+
+    private:
+
+        void Push(std::function<void()>&& task);
+
+        void Work();
+
+        std::vector<std::thread> m_threads;
+        std::deque<std::function<void()>> m_tasks;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::condition_variable m_idleCondition;
+        size_t m_activeCount;
+        bool m_stop;
+
+    };
+
+}
+
+#include "Molten/System/ThreadPool.inl"
+
+#endif
\ No newline at end of file
@@ -27,6 +27,7 @@
 #include "Molten/Gui/GuiRenderer.hpp"
 #include "Molten/Gui/Templates/Padding.hpp"
 #include "Molten/Logger.hpp"
+#include "Molten/System/Profiler.hpp"
 
 #define MOLTEN_CANVAS_LOG(severity, message) if(m_logger){ m_logger->Write(severity, message); }
 
@@ -85,6 +86,8 @@ namespace Molten::Gui
 
     void Canvas::Update()
     {
+        MOLTEN_PROFILE_ZONE("Gui::Canvas::Update");
+
         m_keyboardSystem->Process(Seconds(0.0f));
         m_mouseSystem->Process(Seconds(0.0f));
 
@@ -79,16 +79,19 @@ namespace Molten
         m_callback([](const Severity severity, const char * message)
         {
             std::cout << GetSeverityString(severity) << message << "\n";
-        })
+        }),
+        m_writeMutex(std::make_shared<std::mutex>())
     {}
 
     Logger::Logger(Callback callback, const uint32_t severityFlags) :
         m_severityFlags(severityFlags),
-        m_callback(callback)
+        m_callback(callback),
+        m_writeMutex(std::make_shared<std::mutex>())
     { }
     Logger::Logger(const uint32_t severityFlags, Logger* parent) :
         m_severityFlags(severityFlags),
-        m_callback(parent->m_callback)
+        m_callback(parent->m_callback),
+        m_writeMutex(parent->m_writeMutex)
     { }
 
     Logger::~Logger()
@@ -108,6 +111,7 @@ namespace Molten
     {
         if (m_severityFlags & static_cast<uint32_t>(severity))
         {
+            std::lock_guard<std::mutex> lock(*m_writeMutex);
             m_callback(severity, message);
         }
     }
@@ -116,6 +120,7 @@ namespace Molten
     {
         if (m_severityFlags & static_cast<uint32_t>(severity))
         {
+            std::lock_guard<std::mutex> lock(*m_writeMutex);
             m_callback(severity, message.c_str());
         }
     }
@@ -146,6 +151,8 @@ namespace Molten
             return false;
         }
 
+        std::lock_guard<std::mutex> lock(*m_writeMutex);
+
         if (m_file.is_open())
         {
             m_file.close();
@@ -165,6 +172,7 @@ namespace Molten
 
     void FileLogger::Close()
     {
+        std::lock_guard<std::mutex> lock(*m_writeMutex);
         m_file.close();
     }
 
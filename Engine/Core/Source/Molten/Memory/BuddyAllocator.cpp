@@ -0,0 +1,180 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Memory/BuddyAllocator.hpp"
+#include "Molten/System/Exception.hpp"
+#include <algorithm>
+
+namespace Molten
+{
+
+    // Static helper functions.
+    static bool IsPowerOfTwo(const size_t value)
+    {
+        return value && !(value & (value - 1));
+    }
+
+
+    // Buddy allocator implementations.
+    BuddyAllocator::BuddyAllocator(const size_t size, const size_t minBlockSize) :
+        m_size(0),
+        m_minBlockSize(minBlockSize),
+        m_freeBlocks{},
+        m_allocations{},
+        m_usedSize(0)
+    {
+        if (!IsPowerOfTwo(minBlockSize))
+        {
+            throw Exception("Minimum block size of buddy allocator must be a power of two.");
+        }
+        if (minBlockSize > size)
+        {
+            throw Exception("Minimum block size of buddy allocator is larger than the memory range.");
+        }
+
+        const size_t blockCount = size / minBlockSize;
+        size_t orderCount = 1;
+        while ((blockCount >> orderCount) != 0)
+        {
+            ++orderCount;
+        }
+
+        m_size = GetBlockSize(orderCount - 1);
+        m_freeBlocks.resize(orderCount);
+        m_freeBlocks.back().insert(0);
+    }
+
+    bool BuddyAllocator::Allocate(const size_t size, const size_t alignment, size_t& offset)
+    {
+        // Blocks are aligned by their own size, so a block at least as large as the alignment is sufficient.
+        const size_t requiredSize = std::max(std::max(size, alignment), size_t(1));
+        if (requiredSize > m_size)
+        {
+            return false;
+        }
+
+        size_t order = 0;
+        while (GetBlockSize(order) < requiredSize)
+        {
+            ++order;
+        }
+
+        size_t freeOrder = order;
+        while (freeOrder < m_freeBlocks.size() && m_freeBlocks[freeOrder].empty())
+        {
+            ++freeOrder;
+        }
+        if (freeOrder == m_freeBlocks.size())
+        {
+            return false;
+        }
+
+        auto& freeBlocks = m_freeBlocks[freeOrder];
+        const size_t blockOffset = *freeBlocks.begin();
+        freeBlocks.erase(freeBlocks.begin());
+
+        // Split block until it matches the requested order, the upper halves are kept as free buddies.
+        while (freeOrder > order)
+        {
+            --freeOrder;
+            m_freeBlocks[freeOrder].insert(blockOffset + GetBlockSize(freeOrder));
+        }
+
+        m_allocations.insert({ blockOffset, order });
+        m_usedSize += GetBlockSize(order);
+        offset = blockOffset;
+        return true;
+    }
+
+    bool BuddyAllocator::Free(const size_t offset)
+    {
+        auto it = m_allocations.find(offset);
+        if (it == m_allocations.end())
+        {
+            return false;
+        }
+
+        size_t order = it->second;
+        size_t blockOffset = offset;
+        m_allocations.erase(it);
+        m_usedSize -= GetBlockSize(order);
+
+        while (order + 1 < m_freeBlocks.size())
+        {
+            const size_t buddyOffset = blockOffset ^ GetBlockSize(order);
+            auto& freeBlocks = m_freeBlocks[order];
+            auto buddyIt = freeBlocks.find(buddyOffset);
+            if (buddyIt == freeBlocks.end())
+            {
+                break;
+            }
+
+            freeBlocks.erase(buddyIt);
+            blockOffset = std::min(blockOffset, buddyOffset);
+            ++order;
+        }
+
+        m_freeBlocks[order].insert(blockOffset);
+        return true;
+    }
+
+    size_t BuddyAllocator::GetSize() const
+    {
+        return m_size;
+    }
+
+    size_t BuddyAllocator::GetUsedSize() const
+    {
+        return m_usedSize;
+    }
+
+    size_t BuddyAllocator::GetAllocationCount() const
+    {
+        return m_allocations.size();
+    }
+
+    size_t BuddyAllocator::GetLargestFreeBlockSize() const
+    {
+        for (size_t order = m_freeBlocks.size(); order > 0; order--)
+        {
+            if (!m_freeBlocks[order - 1].empty())
+            {
+                return GetBlockSize(order - 1);
+            }
+        }
+        return 0;
+    }
+
+    bool BuddyAllocator::IsEmpty() const
+    {
+        return m_allocations.empty();
+    }
+
+    size_t BuddyAllocator::GetBlockSize(const size_t order) const
+    {
+        return m_minBlockSize << order;
+    }
+
+}
\ No newline at end of file
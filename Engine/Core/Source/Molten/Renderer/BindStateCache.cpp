@@ -0,0 +1,162 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/BindStateCache.hpp"
+
+namespace Molten
+{
+
+    // Bind statistics implementations.
+    BindStatistics::BindStatistics()
+    {
+        Clear();
+    }
+
+    void BindStatistics::Clear()
+    {
+        pipelineBinds = 0;
+        pipelineBindsSkipped = 0;
+        uniformBlockBinds = 0;
+        uniformBlockBindsSkipped = 0;
+        vertexBufferBinds = 0;
+        vertexBufferBindsSkipped = 0;
+        indexBufferBinds = 0;
+        indexBufferBindsSkipped = 0;
+    }
+
+    BindStatistics& BindStatistics::operator +=(const BindStatistics& rhs)
+    {
+        pipelineBinds += rhs.pipelineBinds;
+        pipelineBindsSkipped += rhs.pipelineBindsSkipped;
+        uniformBlockBinds += rhs.uniformBlockBinds;
+        uniformBlockBindsSkipped += rhs.uniformBlockBindsSkipped;
+        vertexBufferBinds += rhs.vertexBufferBinds;
+        vertexBufferBindsSkipped += rhs.vertexBufferBindsSkipped;
+        indexBufferBinds += rhs.indexBufferBinds;
+        indexBufferBindsSkipped += rhs.indexBufferBindsSkipped;
+        return *this;
+    }
+
+
+    // Bind state cache implementations.
+    BindStateCache::BindStateCache() :
+        m_pipeline(nullptr),
+        m_indexBuffer(nullptr)
+    {}
+
+    void BindStateCache::Reset()
+    {
+        m_pipeline = nullptr;
+        m_uniformBlocks.clear();
+        m_vertexBuffers.clear();
+        m_indexBuffer = nullptr;
+    }
+
+    bool BindStateCache::BindPipeline(const void* pipeline)
+    {
+        if (pipeline == m_pipeline)
+        {
+            ++m_statistics.pipelineBindsSkipped;
+            return false;
+        }
+
+        // Descriptor sets may be disturbed by pipelines of incompatible layouts, rebind them.
+        m_pipeline = pipeline;
+        m_uniformBlocks.clear();
+        ++m_statistics.pipelineBinds;
+        return true;
+    }
+
+    bool BindStateCache::BindUniformBlock(const uint32_t set, const void* uniformBlock, const uint32_t offset)
+    {
+        if (set >= m_uniformBlocks.size())
+        {
+            m_uniformBlocks.resize(static_cast<size_t>(set) + 1, { nullptr, 0 });
+        }
+
+        auto& binding = m_uniformBlocks[set];
+        if (binding.uniformBlock == uniformBlock && binding.offset == offset)
+        {
+            ++m_statistics.uniformBlockBindsSkipped;
+            return false;
+        }
+
+        binding.uniformBlock = uniformBlock;
+        binding.offset = offset;
+        ++m_statistics.uniformBlockBinds;
+        return true;
+    }
+
+    void BindStateCache::InvalidateUniformBlock(const uint32_t set)
+    {
+        if (set < m_uniformBlocks.size())
+        {
+            m_uniformBlocks[set] = { nullptr, 0 };
+        }
+    }
+
+    bool BindStateCache::BindVertexBuffer(const uint32_t binding, const void* vertexBuffer)
+    {
+        if (binding >= m_vertexBuffers.size())
+        {
+            m_vertexBuffers.resize(static_cast<size_t>(binding) + 1, nullptr);
+        }
+
+        auto& boundVertexBuffer = m_vertexBuffers[binding];
+        if (boundVertexBuffer == vertexBuffer)
+        {
+            ++m_statistics.vertexBufferBindsSkipped;
+            return false;
+        }
+
+        boundVertexBuffer = vertexBuffer;
+        ++m_statistics.vertexBufferBinds;
+        return true;
+    }
+
+    bool BindStateCache::BindIndexBuffer(const void* indexBuffer)
+    {
+        if (indexBuffer == m_indexBuffer)
+        {
+            ++m_statistics.indexBufferBindsSkipped;
+            return false;
+        }
+
+        m_indexBuffer = indexBuffer;
+        ++m_statistics.indexBufferBinds;
+        return true;
+    }
+
+    const BindStatistics& BindStateCache::GetStatistics() const
+    {
+        return m_statistics;
+    }
+
+    void BindStateCache::ClearStatistics()
+    {
+        m_statistics.Clear();
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/CommandStream.hpp"
+#include <cstring>
+
+namespace Molten
+{
+
+    // Null command stream command implementations.
+    CommandStream::Command::Command() :
+        Command(Opcode::EndMarker)
+    {}
+
+    CommandStream::Command::Command(const Opcode opcode) :
+        opcode(opcode),
+        resources{ nullptr, nullptr },
+        values{ 0, 0, 0 },
+        data(nullptr),
+        dataSize(0)
+    {}
+
+
+    // Null command stream implementations.
+    void CommandStream::Clear()
+    {
+        m_data.clear();
+        m_commandCount = 0;
+    }
+
+    void CommandStream::Write(const Command& command)
+    {
+        size_t resourceCount = MaxResources;
+        while (resourceCount > 0 && command.resources[resourceCount - 1] == nullptr)
+        {
+            --resourceCount;
+        }
+        size_t valueCount = MaxValues;
+        while (valueCount > 0 && command.values[valueCount - 1] == 0)
+        {
+            --valueCount;
+        }
+        const bool hasData = command.data != nullptr && command.dataSize > 0;
+
+        const size_t size = 2 + resourceCount * sizeof(const void*) + valueCount * sizeof(uint32_t) +
+            (hasData ? sizeof(uint32_t) + command.dataSize : 0);
+
+        // Packed fields are unaligned, they are copied rather than cast.
+        const size_t offset = m_data.size();
+        m_data.resize(offset + size);
+        uint8_t* ptr = m_data.data() + offset;
+
+        *ptr++ = static_cast<uint8_t>(command.opcode);
+        *ptr++ = static_cast<uint8_t>(resourceCount | (valueCount << 2) | (hasData ? 0x10 : 0));
+
+        std::memcpy(ptr, command.resources, resourceCount * sizeof(const void*));
+        ptr += resourceCount * sizeof(const void*);
+        std::memcpy(ptr, command.values, valueCount * sizeof(uint32_t));
+        ptr += valueCount * sizeof(uint32_t);
+
+        if (hasData)
+        {
+            std::memcpy(ptr, &command.dataSize, sizeof(uint32_t));
+            std::memcpy(ptr + sizeof(uint32_t), command.data, command.dataSize);
+        }
+
+        ++m_commandCount;
+    }
+
+    void CommandStream::Append(const CommandStream& stream)
+    {
+        m_data.insert(m_data.end(), stream.m_data.begin(), stream.m_data.end());
+        m_commandCount += stream.m_commandCount;
+    }
+
+    bool CommandStream::Read(size_t& position, Command& command) const
+    {
+        if (position + 2 > m_data.size())
+        {
+            return false;
+        }
+
+        const uint8_t* ptr = m_data.data() + position;
+        command = Command(static_cast<Opcode>(*ptr++));
+
+        const uint8_t header = *ptr++;
+        const size_t resourceCount = header & 0x3;
+        const size_t valueCount = (header >> 2) & 0x3;
+
+        std::memcpy(command.resources, ptr, resourceCount * sizeof(const void*));
+        ptr += resourceCount * sizeof(const void*);
+        std::memcpy(command.values, ptr, valueCount * sizeof(uint32_t));
+        ptr += valueCount * sizeof(uint32_t);
+
+        if (header & 0x10)
+        {
+            std::memcpy(&command.dataSize, ptr, sizeof(uint32_t));
+            command.data = ptr + sizeof(uint32_t);
+            ptr += sizeof(uint32_t) + command.dataSize;
+        }
+
+        position = static_cast<size_t>(ptr - m_data.data());
+        return true;
+    }
+
+    size_t CommandStream::GetCommandCount() const
+    {
+        return m_commandCount;
+    }
+
+    size_t CommandStream::GetSize() const
+    {
+        return m_data.size();
+    }
+
+    const std::vector<uint8_t>& CommandStream::GetData() const
+    {
+        return m_data;
+    }
+
+}
\ No newline at end of file
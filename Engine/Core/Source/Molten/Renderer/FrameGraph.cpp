@@ -0,0 +1,418 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/FrameGraph.hpp"
+#include "Molten/System/Exception.hpp"
+#include <algorithm>
+
+namespace Molten
+{
+
+    size_t FrameGraph::GetFormatSize(const Format format)
+    {
+        switch (format)
+        {
+            case Format::Rgba8:           return 4;
+            case Format::Bgra8:           return 4;
+            case Format::Rgba16Float:     return 8;
+            case Format::Rgba32Float:     return 16;
+            case Format::Depth32Float:    return 4;
+            case Format::Depth24Stencil8: return 4;
+        }
+        throw Exception("GetFormatSize is missing return value for format = " + std::to_string(static_cast<size_t>(format)) + ".");
+    }
+
+    bool FrameGraph::IsWriteState(const ResourceState state)
+    {
+        return
+            state == ResourceState::ColorAttachment ||
+            state == ResourceState::DepthAttachment ||
+            state == ResourceState::TransferDestination;
+    }
+
+    FrameGraph::FrameGraph() :
+        m_transientMemorySize(0),
+        m_unaliasedMemorySize(0)
+    {}
+
+    void FrameGraph::Clear()
+    {
+        m_passes.clear();
+        m_resources.clear();
+        m_compiledPasses.clear();
+        m_finalBarriers.clear();
+        m_transientMemorySize = 0;
+        m_unaliasedMemorySize = 0;
+    }
+
+    FrameGraph::ResourceId FrameGraph::CreateTexture(const std::string& name, const TextureDescriptor& descriptor)
+    {
+        m_resources.push_back({ name, descriptor, false, ResourceState::Undefined, ResourceState::Undefined, false, { 0, 0 } });
+        return static_cast<ResourceId>(m_resources.size() - 1);
+    }
+
+    FrameGraph::ResourceId FrameGraph::ImportTexture(const std::string& name, const TextureDescriptor& descriptor, const ResourceState initialState, const ResourceState finalState)
+    {
+        m_resources.push_back({ name, descriptor, true, initialState, finalState, false, { 0, 0 } });
+        return static_cast<ResourceId>(m_resources.size() - 1);
+    }
+
+    FrameGraph::PassId FrameGraph::AddPass(const std::string& name, ExecuteFunction execute)
+    {
+        m_passes.push_back({ name, std::move(execute), {}, false, false });
+        return static_cast<PassId>(m_passes.size() - 1);
+    }
+
+    void FrameGraph::Read(const PassId pass, const ResourceId resource, const ResourceState state)
+    {
+        if (pass >= m_passes.size() || resource >= m_resources.size())
+        {
+            throw Exception("Cannot declare read of invalid pass or resource.");
+        }
+        if (state == ResourceState::Undefined || IsWriteState(state))
+        {
+            throw Exception("Cannot declare read of resource \"" + m_resources[resource].name + "\" with a write state.");
+        }
+        m_passes[pass].accesses.push_back({ resource, state });
+    }
+
+    void FrameGraph::Write(const PassId pass, const ResourceId resource, const ResourceState state)
+    {
+        if (pass >= m_passes.size() || resource >= m_resources.size())
+        {
+            throw Exception("Cannot declare write of invalid pass or resource.");
+        }
+        if (!IsWriteState(state))
+        {
+            throw Exception("Cannot declare write of resource \"" + m_resources[resource].name + "\" with a read state.");
+        }
+        m_passes[pass].accesses.push_back({ resource, state });
+    }
+
+    void FrameGraph::KeepPass(const PassId pass)
+    {
+        if (pass >= m_passes.size())
+        {
+            throw Exception("Cannot keep invalid pass.");
+        }
+        m_passes[pass].keep = true;
+    }
+
+    void FrameGraph::Compile()
+    {
+        m_compiledPasses.clear();
+        m_finalBarriers.clear();
+
+        CullPasses();
+        CreateBarriers();
+        AllocateTransientResources();
+    }
+
+    void FrameGraph::Execute() const
+    {
+        for (const auto& compiledPass : m_compiledPasses)
+        {
+            const auto& execute = m_passes[compiledPass.pass].execute;
+            if (execute)
+            {
+                execute(compiledPass);
+            }
+        }
+    }
+
+    size_t FrameGraph::GetPassCount() const
+    {
+        return m_passes.size();
+    }
+
+    size_t FrameGraph::GetResourceCount() const
+    {
+        return m_resources.size();
+    }
+
+    const std::string& FrameGraph::GetPassName(const PassId pass) const
+    {
+        return m_passes[pass].name;
+    }
+
+    const std::string& FrameGraph::GetResourceName(const ResourceId resource) const
+    {
+        return m_resources[resource].name;
+    }
+
+    const FrameGraph::TextureDescriptor& FrameGraph::GetResourceDescriptor(const ResourceId resource) const
+    {
+        return m_resources[resource].descriptor;
+    }
+
+    const std::vector<FrameGraph::CompiledPass>& FrameGraph::GetCompiledPasses() const
+    {
+        return m_compiledPasses;
+    }
+
+    const std::vector<FrameGraph::Barrier>& FrameGraph::GetFinalBarriers() const
+    {
+        return m_finalBarriers;
+    }
+
+    bool FrameGraph::IsPassCulled(const PassId pass) const
+    {
+        return m_passes[pass].culled;
+    }
+
+    bool FrameGraph::IsAllocated(const ResourceId resource) const
+    {
+        return m_resources[resource].allocated;
+    }
+
+    const FrameGraph::Allocation& FrameGraph::GetAllocation(const ResourceId resource) const
+    {
+        return m_resources[resource].allocation;
+    }
+
+    size_t FrameGraph::GetTransientMemorySize() const
+    {
+        return m_transientMemorySize;
+    }
+
+    size_t FrameGraph::GetUnaliasedMemorySize() const
+    {
+        return m_unaliasedMemorySize;
+    }
+
+    void FrameGraph::CullPasses()
+    {
+        // Every access depends on the previous writer of the resource, writes included since content is kept.
+        std::vector<std::vector<PassId>> dependencies(m_passes.size());
+        std::vector<PassId> lastWriters(m_resources.size(), InvalidId);
+
+        for (PassId passId = 0; passId < static_cast<PassId>(m_passes.size()); passId++)
+        {
+            auto& pass = m_passes[passId];
+            pass.culled = true;
+
+            for (const auto& access : pass.accesses)
+            {
+                const PassId lastWriter = lastWriters[access.resource];
+                if (lastWriter != InvalidId && lastWriter != passId)
+                {
+                    dependencies[passId].push_back(lastWriter);
+                }
+            }
+            for (const auto& access : pass.accesses)
+            {
+                if (IsWriteState(access.state))
+                {
+                    lastWriters[access.resource] = passId;
+                }
+            }
+        }
+
+        // Passes contributing to the final content of imported resources and kept passes are executed.
+        std::vector<PassId> stack;
+        for (PassId passId = 0; passId < static_cast<PassId>(m_passes.size()); passId++)
+        {
+            if (m_passes[passId].keep)
+            {
+                stack.push_back(passId);
+            }
+        }
+        for (ResourceId resourceId = 0; resourceId < static_cast<ResourceId>(m_resources.size()); resourceId++)
+        {
+            if (m_resources[resourceId].imported && lastWriters[resourceId] != InvalidId)
+            {
+                stack.push_back(lastWriters[resourceId]);
+            }
+        }
+
+        while (!stack.empty())
+        {
+            const PassId passId = stack.back();
+            stack.pop_back();
+
+            auto& pass = m_passes[passId];
+            if (!pass.culled)
+            {
+                continue;
+            }
+
+            pass.culled = false;
+            stack.insert(stack.end(), dependencies[passId].begin(), dependencies[passId].end());
+        }
+    }
+
+    void FrameGraph::CreateBarriers()
+    {
+        std::vector<ResourceState> states(m_resources.size());
+        std::vector<bool> written(m_resources.size(), false);
+        for (size_t i = 0; i < m_resources.size(); i++)
+        {
+            const auto& resource = m_resources[i];
+            states[i] = resource.imported ? resource.initialState : ResourceState::Undefined;
+        }
+
+        for (PassId passId = 0; passId < static_cast<PassId>(m_passes.size()); passId++)
+        {
+            const auto& pass = m_passes[passId];
+            if (pass.culled)
+            {
+                continue;
+            }
+
+            CompiledPass compiledPass = { passId, {} };
+            for (size_t i = 0; i < pass.accesses.size(); i++)
+            {
+                const ResourceId resourceId = pass.accesses[i].resource;
+
+                // Resources accessed multiple times by the same pass are transitioned once, to the write state if written.
+                auto firstAccess = std::find_if(pass.accesses.begin(), pass.accesses.end(), [&](const Access& access)
+                {
+                    return access.resource == resourceId;
+                });
+                if (static_cast<size_t>(std::distance(pass.accesses.begin(), firstAccess)) != i)
+                {
+                    continue;
+                }
+
+                ResourceState state = pass.accesses[i].state;
+                for (size_t j = i + 1; j < pass.accesses.size(); j++)
+                {
+                    if (pass.accesses[j].resource == resourceId && IsWriteState(pass.accesses[j].state))
+                    {
+                        state = pass.accesses[j].state;
+                    }
+                }
+
+                // Reads of the same state as the previous read share its barrier, all other accesses are hazards.
+                const bool write = IsWriteState(state);
+                if (state != states[resourceId] || write || written[resourceId])
+                {
+                    compiledPass.barriers.push_back({ resourceId, states[resourceId], state });
+                }
+
+                states[resourceId] = state;
+                written[resourceId] = write;
+            }
+
+            m_compiledPasses.push_back(std::move(compiledPass));
+        }
+
+        for (ResourceId resourceId = 0; resourceId < static_cast<ResourceId>(m_resources.size()); resourceId++)
+        {
+            const auto& resource = m_resources[resourceId];
+            if (resource.imported && (states[resourceId] != resource.finalState || written[resourceId]))
+            {
+                m_finalBarriers.push_back({ resourceId, states[resourceId], resource.finalState });
+            }
+        }
+    }
+
+    void FrameGraph::AllocateTransientResources()
+    {
+        struct Lifetime
+        {
+            ResourceId resource;
+            size_t first;
+            size_t last;
+        };
+
+        std::vector<Lifetime> lifetimes(m_resources.size(), { InvalidId, 0, 0 });
+        for (size_t i = 0; i < m_compiledPasses.size(); i++)
+        {
+            for (const auto& access : m_passes[m_compiledPasses[i].pass].accesses)
+            {
+                auto& lifetime = lifetimes[access.resource];
+                if (lifetime.resource == InvalidId)
+                {
+                    lifetime = { access.resource, i, i };
+                }
+                lifetime.last = i;
+            }
+        }
+
+        std::vector<Lifetime> transientLifetimes;
+        for (ResourceId resourceId = 0; resourceId < static_cast<ResourceId>(m_resources.size()); resourceId++)
+        {
+            auto& resource = m_resources[resourceId];
+            resource.allocated = false;
+            resource.allocation = { 0, 0 };
+
+            if (!resource.imported && lifetimes[resourceId].resource != InvalidId)
+            {
+                const auto& size = resource.descriptor.size;
+                const size_t byteSize = static_cast<size_t>(size.x) * static_cast<size_t>(size.y) * GetFormatSize(resource.descriptor.format);
+                resource.allocation.size = ((byteSize + AllocationAlignment - 1) / AllocationAlignment) * AllocationAlignment;
+                transientLifetimes.push_back(lifetimes[resourceId]);
+            }
+        }
+
+        // Place largest textures first, at the lowest offset not overlapping textures alive at the same time.
+        std::stable_sort(transientLifetimes.begin(), transientLifetimes.end(), [&](const Lifetime& lhs, const Lifetime& rhs)
+        {
+            return m_resources[lhs.resource].allocation.size > m_resources[rhs.resource].allocation.size;
+        });
+
+        m_transientMemorySize = 0;
+        m_unaliasedMemorySize = 0;
+        std::vector<const Lifetime*> placed;
+        std::vector<Allocation> overlapping;
+
+        for (const auto& lifetime : transientLifetimes)
+        {
+            auto& allocation = m_resources[lifetime.resource].allocation;
+
+            overlapping.clear();
+            for (const auto* other : placed)
+            {
+                if (other->first <= lifetime.last && lifetime.first <= other->last)
+                {
+                    overlapping.push_back(m_resources[other->resource].allocation);
+                }
+            }
+            std::sort(overlapping.begin(), overlapping.end(), [](const Allocation& lhs, const Allocation& rhs)
+            {
+                return lhs.offset < rhs.offset;
+            });
+
+            size_t offset = 0;
+            for (const auto& other : overlapping)
+            {
+                if (offset + allocation.size <= other.offset)
+                {
+                    break;
+                }
+                offset = std::max(offset, other.offset + other.size);
+            }
+
+            allocation.offset = offset;
+            m_resources[lifetime.resource].allocated = true;
+            placed.push_back(&lifetime);
+
+            m_transientMemorySize = std::max(m_transientMemorySize, offset + allocation.size);
+            m_unaliasedMemorySize += allocation.size;
+        }
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/FrameProfiler.hpp"
+#include <algorithm>
+
+namespace Molten
+{
+
+    // Frame profiler CPU scope implementations.
+    FrameProfiler::CpuScope::CpuScope(FrameProfiler& profiler, const std::string& name) :
+        m_profiler(profiler),
+        m_name(name),
+        m_startTime(Time::GetSystemTime())
+    {}
+
+    FrameProfiler::CpuScope::~CpuScope()
+    {
+        m_profiler.AddSample(Domain::Cpu, m_name, Time::GetSystemTime() - m_startTime);
+    }
+
+
+    // Frame profiler implementations.
+    FrameProfiler::FrameProfiler(const size_t frameHistorySize) :
+        m_frameHistorySize(std::max(frameHistorySize, size_t(1))),
+        m_frameCount(0)
+    {}
+
+    void FrameProfiler::Clear()
+    {
+        m_frameCount = 0;
+        m_series.clear();
+        m_seriesIndices.clear();
+    }
+
+    void FrameProfiler::AddSample(const Domain domain, const std::string& name, const Time duration)
+    {
+        auto it = m_seriesIndices.find({ domain, name });
+        if (it == m_seriesIndices.end())
+        {
+            Series series;
+            series.domain = domain;
+            series.name = name;
+            series.history.resize(m_frameHistorySize, Time::Zero);
+            series.historyValid.resize(m_frameHistorySize, false);
+            series.current = Time::Zero;
+            series.currentValid = false;
+
+            it = m_seriesIndices.insert({ { domain, name }, m_series.size() }).first;
+            m_series.push_back(std::move(series));
+        }
+
+        auto& series = m_series[it->second];
+        series.current += duration;
+        series.currentValid = true;
+    }
+
+    void FrameProfiler::EndFrame()
+    {
+        const size_t historyIndex = m_frameCount % m_frameHistorySize;
+        for (auto& series : m_series)
+        {
+            series.history[historyIndex] = series.current;
+            series.historyValid[historyIndex] = series.currentValid;
+            series.current = Time::Zero;
+            series.currentValid = false;
+        }
+        ++m_frameCount;
+    }
+
+    size_t FrameProfiler::GetFrameCount() const
+    {
+        return std::min(m_frameCount, m_frameHistorySize);
+    }
+
+    std::vector<std::string> FrameProfiler::GetSeriesNames(const Domain domain) const
+    {
+        std::vector<std::string> names;
+        for (const auto& series : m_series)
+        {
+            if (series.domain == domain)
+            {
+                names.push_back(series.name);
+            }
+        }
+        return names;
+    }
+
+    bool FrameProfiler::GetStatistics(const Domain domain, const std::string& name, Statistics& statistics) const
+    {
+        auto it = m_seriesIndices.find({ domain, name });
+        if (it == m_seriesIndices.end())
+        {
+            return false;
+        }
+
+        const auto& series = m_series[it->second];
+        const size_t frameCount = GetFrameCount();
+        const size_t firstFrame = m_frameCount - frameCount;
+
+        std::vector<Time> samples;
+        samples.reserve(frameCount);
+        Time sum = Time::Zero;
+        for (size_t frame = firstFrame; frame < m_frameCount; frame++)
+        {
+            const size_t historyIndex = frame % m_frameHistorySize;
+            if (series.historyValid[historyIndex])
+            {
+                samples.push_back(series.history[historyIndex]);
+                sum += series.history[historyIndex];
+            }
+        }
+
+        if (samples.empty())
+        {
+            return false;
+        }
+
+        statistics.last = samples.back();
+        statistics.frameCount = samples.size();
+        statistics.average = sum / samples.size();
+
+        const size_t percentileIndex = (samples.size() * 99 + 99) / 100 - 1;
+        std::nth_element(samples.begin(), samples.begin() + percentileIndex, samples.end());
+        statistics.percentile99 = samples[percentileIndex];
+        statistics.minimum = *std::min_element(samples.begin(), samples.end());
+        return true;
+    }
+
+    void FrameProfiler::WriteCsv(std::ostream& stream) const
+    {
+        stream << "Frame";
+        for (const auto& series : m_series)
+        {
+            stream << "," << (series.domain == Domain::Cpu ? "Cpu " : "Gpu ") << series.name;
+        }
+        stream << "\n";
+
+        const size_t firstFrame = m_frameCount - GetFrameCount();
+        for (size_t frame = firstFrame; frame < m_frameCount; frame++)
+        {
+            const size_t historyIndex = frame % m_frameHistorySize;
+
+            stream << frame;
+            for (const auto& series : m_series)
+            {
+                stream << ",";
+                if (series.historyValid[historyIndex])
+                {
+                    stream << series.history[historyIndex].AsMilliseconds<double>();
+                }
+            }
+            stream << "\n";
+        }
+    }
+
+}
\ No newline at end of file
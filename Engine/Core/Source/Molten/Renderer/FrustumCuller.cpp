@@ -0,0 +1,243 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#include "Molten/Renderer/FrustumCuller.hpp"
+#include "Molten/Renderer/IndirectBuffer.hpp"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define MOLTEN_FRUSTUM_CULLER_SSE
+    #include <xmmintrin.h>
+#endif
+
+namespace Molten
+{
+
+    // Static frustum culling implementations.
+    // Every path evaluates planes in the same order and with the same operations,
+    // making SIMD and scalar results, as well as the results of culling shaders, identical.
+    using AbsoluteNormals = std::array<Vector3f32, Frustum::PlaneCount>;
+
+    static AbsoluteNormals GetAbsoluteNormals(const std::array<Vector4f32, Frustum::PlaneCount>& planes)
+    {
+        AbsoluteNormals absoluteNormals;
+        for (size_t i = 0; i < Frustum::PlaneCount; i++)
+        {
+            absoluteNormals[i] = { std::abs(planes[i].x), std::abs(planes[i].y), std::abs(planes[i].z) };
+        }
+        return absoluteNormals;
+    }
+
+    static bool IsVisible(const std::array<Vector4f32, Frustum::PlaneCount>& planes, const AbsoluteNormals& absoluteNormals, const BoundingVolume& bounds)
+    {
+        for (size_t i = 0; i < Frustum::PlaneCount; i++)
+        {
+            const auto& plane = planes[i];
+            const auto& absoluteNormal = absoluteNormals[i];
+
+            const float distance = plane.x * bounds.center.x + plane.y * bounds.center.y + plane.z * bounds.center.z + plane.w;
+            const float reach = bounds.radius + absoluteNormal.x * bounds.extents.x + absoluteNormal.y * bounds.extents.y + absoluteNormal.z * bounds.extents.z;
+
+            // Negated comparison, volumes of NaN coordinates are culled.
+            if (!(distance + reach >= 0.0f))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static uint32_t CullRange(const std::array<Vector4f32, Frustum::PlaneCount>& planes, const AbsoluteNormals& absoluteNormals, const BoundingVolume* bounds,
+                              const DrawIndexedIndirectCommand* commands, const uint32_t firstCommand, const uint32_t commandCount,
+                              DrawIndexedIndirectCommand* output, uint32_t visibleCount)
+    {
+        for (uint32_t i = firstCommand; i < commandCount; i++)
+        {
+            if (IsVisible(planes, absoluteNormals, bounds[i]))
+            {
+                output[visibleCount++] = commands[i];
+            }
+        }
+        return visibleCount;
+    }
+
+    static void ClearCulledCommands(DrawIndexedIndirectCommand* output, const uint32_t visibleCount, const uint32_t commandCount)
+    {
+        std::fill(output + visibleCount, output + commandCount, DrawIndexedIndirectCommand{ 0, 0, 0, 0, 0 });
+    }
+
+
+    // Bounding volume implementations.
+    BoundingVolume BoundingVolume::FromSphere(const Vector3f32& center, const float radius)
+    {
+        return { center, radius, { 0.0f, 0.0f, 0.0f }, 0.0f };
+    }
+
+    BoundingVolume BoundingVolume::FromAabb(const Vector3f32& min, const Vector3f32& max)
+    {
+        return { (min + max) * 0.5f, 0.0f, (max - min) * 0.5f, 0.0f };
+    }
+
+
+    // Frustum implementations.
+    Frustum Frustum::FromViewProjection(const Matrix4x4f32& viewProjection)
+    {
+        // Rows of matrix, as clip space coordinates are computed as row . (x, y, z, 1).
+        const auto& e = viewProjection.e;
+        const Vector4f32 row0 = { e[0], e[4], e[8], e[12] };
+        const Vector4f32 row1 = { e[1], e[5], e[9], e[13] };
+        const Vector4f32 row2 = { e[2], e[6], e[10], e[14] };
+        const Vector4f32 row3 = { e[3], e[7], e[11], e[15] };
+
+        Frustum frustum;
+        frustum.m_planes[static_cast<size_t>(Plane::Left)] = row3 + row0;
+        frustum.m_planes[static_cast<size_t>(Plane::Right)] = row3 - row0;
+        frustum.m_planes[static_cast<size_t>(Plane::Bottom)] = row3 + row1;
+        frustum.m_planes[static_cast<size_t>(Plane::Top)] = row3 - row1;
+        frustum.m_planes[static_cast<size_t>(Plane::Near)] = row3 + row2;
+        frustum.m_planes[static_cast<size_t>(Plane::Far)] = row3 - row2;
+
+        for (auto& plane : frustum.m_planes)
+        {
+            const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+            if (length > 0.0f)
+            {
+                plane /= length;
+            }
+        }
+
+        return frustum;
+    }
+
+    Frustum::Frustum()
+    {
+        m_planes.fill({ 0.0f, 0.0f, 0.0f, 0.0f });
+    }
+
+    bool Frustum::Intersects(const BoundingVolume& bounds) const
+    {
+        return IsVisible(m_planes, GetAbsoluteNormals(m_planes), bounds);
+    }
+
+    const Vector4f32& Frustum::GetPlane(const Plane plane) const
+    {
+        return m_planes[static_cast<size_t>(plane)];
+    }
+
+    const std::array<Vector4f32, Frustum::PlaneCount>& Frustum::GetPlanes() const
+    {
+        return m_planes;
+    }
+
+
+    // Frustum culler implementations.
+    uint32_t FrustumCuller::Cull(const Frustum& frustum, const BoundingVolume* bounds, const DrawIndexedIndirectCommand* commands,
+                                 const uint32_t commandCount, DrawIndexedIndirectCommand* output)
+    {
+    #if defined(MOLTEN_FRUSTUM_CULLER_SSE)
+        const auto& planes = frustum.GetPlanes();
+        const auto absoluteNormals = GetAbsoluteNormals(planes);
+
+        __m128 planeX[Frustum::PlaneCount], planeY[Frustum::PlaneCount], planeZ[Frustum::PlaneCount], planeW[Frustum::PlaneCount];
+        __m128 absoluteX[Frustum::PlaneCount], absoluteY[Frustum::PlaneCount], absoluteZ[Frustum::PlaneCount];
+        for (size_t i = 0; i < Frustum::PlaneCount; i++)
+        {
+            planeX[i] = _mm_set1_ps(planes[i].x);
+            planeY[i] = _mm_set1_ps(planes[i].y);
+            planeZ[i] = _mm_set1_ps(planes[i].z);
+            planeW[i] = _mm_set1_ps(planes[i].w);
+            absoluteX[i] = _mm_set1_ps(absoluteNormals[i].x);
+            absoluteY[i] = _mm_set1_ps(absoluteNormals[i].y);
+            absoluteZ[i] = _mm_set1_ps(absoluteNormals[i].z);
+        }
+
+        const __m128 zero = _mm_setzero_ps();
+        const uint32_t simdCommandCount = commandCount & ~static_cast<uint32_t>(3);
+        uint32_t visibleCount = 0;
+
+        for (uint32_t index = 0; index < simdCommandCount; index += 4)
+        {
+            // Load four volumes as rows, transposed into center x, y, z, radius and extents x, y, z, padding.
+            const float* data = reinterpret_cast<const float*>(bounds + index);
+            __m128 centerX = _mm_loadu_ps(data);
+            __m128 centerY = _mm_loadu_ps(data + 8);
+            __m128 centerZ = _mm_loadu_ps(data + 16);
+            __m128 radius = _mm_loadu_ps(data + 24);
+            __m128 extentsX = _mm_loadu_ps(data + 4);
+            __m128 extentsY = _mm_loadu_ps(data + 12);
+            __m128 extentsZ = _mm_loadu_ps(data + 20);
+            __m128 padding = _mm_loadu_ps(data + 28);
+            _MM_TRANSPOSE4_PS(centerX, centerY, centerZ, radius);
+            _MM_TRANSPOSE4_PS(extentsX, extentsY, extentsZ, padding);
+
+            __m128 visible = _mm_cmpeq_ps(zero, zero);
+            for (size_t i = 0; i < Frustum::PlaneCount; i++)
+            {
+                const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                    _mm_mul_ps(planeX[i], centerX), _mm_mul_ps(planeY[i], centerY)), _mm_mul_ps(planeZ[i], centerZ)), planeW[i]);
+                const __m128 reach = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                    radius, _mm_mul_ps(absoluteX[i], extentsX)), _mm_mul_ps(absoluteY[i], extentsY)), _mm_mul_ps(absoluteZ[i], extentsZ));
+                visible = _mm_and_ps(visible, _mm_cmpge_ps(_mm_add_ps(distance, reach), zero));
+            }
+
+            const int mask = _mm_movemask_ps(visible);
+            for (uint32_t i = 0; i < 4; i++)
+            {
+                if (mask & (1 << i))
+                {
+                    output[visibleCount++] = commands[index + i];
+                }
+            }
+        }
+
+        visibleCount = CullRange(planes, absoluteNormals, bounds, commands, simdCommandCount, commandCount, output, visibleCount);
+        ClearCulledCommands(output, visibleCount, commandCount);
+        return visibleCount;
+    #else
+        return CullScalar(frustum, bounds, commands, commandCount, output);
+    #endif
+    }
+
+    uint32_t FrustumCuller::CullScalar(const Frustum& frustum, const BoundingVolume* bounds, const DrawIndexedIndirectCommand* commands,
+                                       const uint32_t commandCount, DrawIndexedIndirectCommand* output)
+    {
+        const auto& planes = frustum.GetPlanes();
+        const uint32_t visibleCount = CullRange(planes, GetAbsoluteNormals(planes), bounds, commands, 0, commandCount, output, 0);
+        ClearCulledCommands(output, visibleCount, commandCount);
+        return visibleCount;
+    }
+
+    bool FrustumCuller::IsSimdSupported()
+    {
+    #if defined(MOLTEN_FRUSTUM_CULLER_SSE)
+        return true;
+    #else
+        return false;
+    #endif
+    }
+
+}
\ No newline at end of file
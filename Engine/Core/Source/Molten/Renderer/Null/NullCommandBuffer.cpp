@@ -0,0 +1,245 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/Null/NullCommandBuffer.hpp"
+#include "Molten/Renderer/Null/NullRenderer.hpp"
+#include "Molten/Renderer/Null/NullResources.hpp"
+#include "Molten/Logger.hpp"
+
+namespace Molten
+{
+
+    // Null command buffer class implementations.
+    bool NullCommandBuffer::Begin(Framebuffer* framebuffer)
+    {
+        if (recording)
+        {
+            Logger::WriteError(renderer->m_logger, "Calling Begin of command buffer twice, without any previous call to End.");
+            return false;
+        }
+        if (!renderer->m_beginDraw)
+        {
+            Logger::WriteError(renderer->m_logger, "Cannot begin recording of command buffer without any previous call to BeginDraw.");
+            return false;
+        }
+
+        InternalBegin();
+        currentFramebuffer = framebuffer;
+        return true;
+    }
+
+    void NullCommandBuffer::End()
+    {
+        if (!recording)
+        {
+            Logger::WriteError(renderer->m_logger, "Calling End of command buffer, without any previous call to Begin.");
+            return;
+        }
+
+        recording = false;
+    }
+
+    void NullCommandBuffer::BindPipeline(Pipeline* pipeline)
+    {
+        if (!bindStateCache.BindPipeline(pipeline))
+        {
+            return;
+        }
+
+        CommandStream::Command command(CommandStream::Opcode::BindPipeline);
+        command.resources[0] = pipeline;
+        stream.Write(command);
+    }
+
+    void NullCommandBuffer::BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset)
+    {
+        NullUniformBlock* nullUniformBlock = static_cast<NullUniformBlock*>(uniformBlock);
+        if (!bindStateCache.BindUniformBlock(nullUniformBlock->set, nullUniformBlock, offset))
+        {
+            return;
+        }
+
+        CommandStream::Command command(CommandStream::Opcode::BindUniformBlock);
+        command.resources[0] = uniformBlock;
+        command.values[0] = nullUniformBlock->set;
+        command.values[1] = offset;
+        stream.Write(command);
+    }
+
+    void NullCommandBuffer::DrawVertexBuffer(VertexBuffer* vertexBuffer)
+    {
+        NullVertexBuffer* nullVertexBuffer = static_cast<NullVertexBuffer*>(vertexBuffer);
+
+        InternalBindVertexBuffers(nullVertexBuffer, nullptr);
+        InternalWriteDraw(CommandStream::Opcode::Draw, nullVertexBuffer->vertexCount, 1);
+    }
+
+    void NullCommandBuffer::DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer)
+    {
+        NullIndexBuffer* nullIndexBuffer = static_cast<NullIndexBuffer*>(indexBuffer);
+
+        InternalBindVertexBuffers(static_cast<NullVertexBuffer*>(vertexBuffer), nullptr);
+        InternalBindIndexBuffer(nullIndexBuffer);
+        InternalWriteDraw(CommandStream::Opcode::DrawIndexed, nullIndexBuffer->indexCount, 1);
+    }
+
+    void NullCommandBuffer::DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount)
+    {
+        NullVertexBuffer* nullVertexBuffer = static_cast<NullVertexBuffer*>(vertexBuffer);
+
+        InternalBindVertexBuffers(nullVertexBuffer, static_cast<NullVertexBuffer*>(instanceBuffer));
+        InternalWriteDraw(CommandStream::Opcode::Draw, nullVertexBuffer->vertexCount, instanceCount);
+    }
+
+    void NullCommandBuffer::DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount)
+    {
+        NullIndexBuffer* nullIndexBuffer = static_cast<NullIndexBuffer*>(indexBuffer);
+
+        InternalBindVertexBuffers(static_cast<NullVertexBuffer*>(vertexBuffer), static_cast<NullVertexBuffer*>(instanceBuffer));
+        InternalBindIndexBuffer(nullIndexBuffer);
+        InternalWriteDraw(CommandStream::Opcode::DrawIndexed, nullIndexBuffer->indexCount, instanceCount);
+    }
+
+    void NullCommandBuffer::DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount)
+    {
+        NullIndirectBuffer* nullIndirectBuffer = static_cast<NullIndirectBuffer*>(indirectBuffer);
+        if (drawCount > static_cast<uint32_t>(nullIndirectBuffer->commands.size()))
+        {
+            Logger::WriteWarning(renderer->m_logger, "Trying to draw more commands than stored in indirect buffer.");
+            return;
+        }
+
+        InternalBindVertexBuffers(static_cast<NullVertexBuffer*>(vertexBuffer), static_cast<NullVertexBuffer*>(instanceBuffer));
+        InternalBindIndexBuffer(static_cast<NullIndexBuffer*>(indexBuffer));
+
+        CommandStream::Command command(CommandStream::Opcode::DrawIndirect);
+        command.resources[0] = indirectBuffer;
+        command.values[0] = drawCount;
+        stream.Write(command);
+    }
+
+    void NullCommandBuffer::DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer)
+    {
+        NullIndirectBuffer* nullIndirectBuffer = static_cast<NullIndirectBuffer*>(indirectBuffer);
+
+        InternalBindVertexBuffers(static_cast<NullVertexBuffer*>(vertexBuffer), static_cast<NullVertexBuffer*>(instanceBuffer));
+        InternalBindIndexBuffer(static_cast<NullIndexBuffer*>(indexBuffer));
+
+        CommandStream::Command command(CommandStream::Opcode::DrawIndirectCount);
+        command.resources[0] = indirectBuffer;
+        command.values[0] = static_cast<uint32_t>(nullIndirectBuffer->commands.size());
+        command.values[1] = nullIndirectBuffer->drawCount;
+        stream.Write(command);
+    }
+
+    void NullCommandBuffer::PushConstant(const uint32_t location, const bool& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void NullCommandBuffer::PushConstant(const uint32_t location, const int32_t& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void NullCommandBuffer::PushConstant(const uint32_t location, const float& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void NullCommandBuffer::PushConstant(const uint32_t location, const Vector2f32& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void NullCommandBuffer::PushConstant(const uint32_t location, const Vector3f32& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void NullCommandBuffer::PushConstant(const uint32_t location, const Vector4f32& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void NullCommandBuffer::PushConstant(const uint32_t location, const Matrix4x4f32& value)
+    {
+        InternalPushConstant(location, value);
+    }
+
+    NullCommandBuffer::NullCommandBuffer(NullRenderer* renderer) :
+        renderer(renderer),
+        recording(false),
+        currentFramebuffer(nullptr)
+    {}
+
+    void NullCommandBuffer::InternalBegin()
+    {
+        stream.Clear();
+        bindStateCache.Reset();
+        bindStateCache.ClearStatistics();
+        recording = true;
+    }
+
+    void NullCommandBuffer::InternalBindVertexBuffers(NullVertexBuffer* vertexBuffer, NullVertexBuffer* instanceBuffer)
+    {
+        if (bindStateCache.BindVertexBuffer(0, vertexBuffer))
+        {
+            CommandStream::Command command(CommandStream::Opcode::BindVertexBuffer);
+            command.resources[0] = vertexBuffer;
+            stream.Write(command);
+        }
+        if (instanceBuffer && bindStateCache.BindVertexBuffer(1, instanceBuffer))
+        {
+            CommandStream::Command command(CommandStream::Opcode::BindVertexBuffer);
+            command.resources[0] = instanceBuffer;
+            command.values[0] = 1;
+            stream.Write(command);
+        }
+    }
+
+    void NullCommandBuffer::InternalBindIndexBuffer(NullIndexBuffer* indexBuffer)
+    {
+        if (bindStateCache.BindIndexBuffer(indexBuffer))
+        {
+            CommandStream::Command command(CommandStream::Opcode::BindIndexBuffer);
+            command.resources[0] = indexBuffer;
+            stream.Write(command);
+        }
+    }
+
+    void NullCommandBuffer::InternalWriteDraw(const CommandStream::Opcode opcode, const uint32_t count, const uint32_t instanceCount)
+    {
+        CommandStream::Command command(opcode);
+        command.values[0] = count;
+        command.values[1] = instanceCount;
+        stream.Write(command);
+    }
+
+    template<typename T>
+    void NullCommandBuffer::InternalPushConstant(const uint32_t location, const T& value)
+    {
+        CommandStream::Command command(CommandStream::Opcode::PushConstant);
+        command.values[0] = location;
+        command.data = &value;
+        command.dataSize = static_cast<uint32_t>(sizeof(T));
+        stream.Write(command);
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,819 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/Null/NullRenderer.hpp"
+#include "Molten/Renderer/Null/NullResources.hpp"
+#include "Molten/Window/Window.hpp"
+#include "Molten/Logger.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace Molten
+{
+
+    NullRenderer::NullRenderer() :
+        m_logger(nullptr),
+        m_version(0, 0, 0),
+        m_size(0, 0),
+        m_presentMode(PresentMode::Fifo),
+        m_maxFramesInFlight(1),
+        m_inlineCommandBuffer(this),
+        m_markerDepth(0),
+        m_beginDraw(false),
+        m_frameCount(0),
+        m_frameBeginTime(Time::Zero),
+        m_frameInputTime(Time::Zero),
+        m_boundFramebuffer(nullptr),
+        m_frameGraphChanged(false)
+    {
+    }
+
+    NullRenderer::~NullRenderer()
+    {
+        Close();
+    }
+
+    bool NullRenderer::Open(const Window& window, const Version& version, Logger* logger)
+    {
+        return OpenOffscreen(window.GetSize(), version, logger);
+    }
+
+    bool NullRenderer::OpenOffscreen(const Vector2ui32& size, const Version& version, Logger* logger)
+    {
+        Close();
+
+        m_logger = logger;
+        m_version = version;
+        m_size = size;
+        LoadFrameGraph();
+        return true;
+    }
+
+    void NullRenderer::Close()
+    {
+        m_logger = nullptr;
+        m_version = { 0, 0, 0 };
+        m_size = { 0, 0 };
+        m_inlineCommandBuffer.stream.Clear();
+        m_inlineCommandBuffer.recording = false;
+        m_frameStream.Clear();
+        m_lastFrameStream.Clear();
+        m_markerDepth = 0;
+        m_beginDraw = false;
+        m_frameCount = 0;
+        m_frameBindStatistics.Clear();
+        m_bindStatistics.Clear();
+        m_frameProfiler.Clear();
+        m_frameBeginTime = Time::Zero;
+        m_frameInputTime = Time::Zero;
+        m_boundFramebuffer = nullptr;
+        m_frameGraph.Clear();
+        m_frameGraphChanged = false;
+    }
+
+    void NullRenderer::Resize(const Vector2ui32& size)
+    {
+        m_size = size;
+        m_frameGraphChanged = true;
+    }
+
+    Renderer::BackendApi NullRenderer::GetBackendApi() const
+    {
+        return Renderer::BackendApi::Null;
+    }
+
+    Version NullRenderer::GetVersion() const
+    {
+        return m_version;
+    }
+
+    BindStatistics NullRenderer::GetBindStatistics() const
+    {
+        return m_bindStatistics;
+    }
+
+    const FrameProfiler* NullRenderer::GetFrameProfiler() const
+    {
+        return &m_frameProfiler;
+    }
+
+    void NullRenderer::SetPresentMode(const PresentMode presentMode)
+    {
+        m_presentMode = presentMode;
+    }
+
+    Renderer::PresentMode NullRenderer::GetPresentMode() const
+    {
+        return m_presentMode;
+    }
+
+    void NullRenderer::SetMaxFramesInFlight(const size_t maxFramesInFlight)
+    {
+        m_maxFramesInFlight = std::max(maxFramesInFlight, size_t(1));
+    }
+
+    size_t NullRenderer::GetMaxFramesInFlight() const
+    {
+        return m_maxFramesInFlight;
+    }
+
+    void NullRenderer::SetFrameInputTime(const Time& inputTime)
+    {
+        m_frameInputTime = inputTime;
+    }
+
+    uint32_t NullRenderer::GetPushConstantLocation(Pipeline* /*pipeline*/, const uint32_t id)
+    {
+        return id;
+    }
+
+    void NullRenderer::SetCacheDirectory(const std::string& /*directory*/)
+    {
+    }
+
+    CommandBuffer* NullRenderer::CreateCommandBuffer()
+    {
+        return new NullCommandBuffer(this);
+    }
+
+    Framebuffer* NullRenderer::CreateFramebuffer(const FramebufferDescriptor& descriptor)
+    {
+        if (descriptor.size.x == 0 || descriptor.size.y == 0)
+        {
+            Logger::WriteError(m_logger, "Cannot create framebuffer of size 0.");
+            return nullptr;
+        }
+
+        NullFramebuffer* framebuffer = new NullFramebuffer;
+        framebuffer->size = descriptor.size;
+        framebuffer->resource = FrameGraph::InvalidId;
+        m_framebuffers.push_back(framebuffer);
+        m_frameGraphChanged = true;
+        return framebuffer;
+    }
+
+    IndexBuffer* NullRenderer::CreateIndexBuffer(const IndexBufferDescriptor& descriptor)
+    {
+        NullIndexBuffer* indexBuffer = new NullIndexBuffer;
+        indexBuffer->indexCount = descriptor.indexCount;
+        indexBuffer->capacity = descriptor.indexCount;
+        indexBuffer->dataType = descriptor.dataType;
+        indexBuffer->usage = descriptor.usage;
+
+        if (descriptor.usage == IndexBuffer::Usage::Dynamic)
+        {
+            const size_t indexSize = descriptor.dataType == IndexBuffer::DataType::Uint16 ? sizeof(uint16_t) : sizeof(uint32_t);
+            InitializeDynamicBuffer(indexBuffer->data, static_cast<size_t>(descriptor.indexCount) * indexSize, descriptor.data);
+            indexBuffer->indexCount = descriptor.data ? descriptor.indexCount : 0;
+        }
+        return indexBuffer;
+    }
+
+    IndirectBuffer* NullRenderer::CreateIndirectBuffer(const IndirectBufferDescriptor& descriptor)
+    {
+        NullIndirectBuffer* indirectBuffer = new NullIndirectBuffer;
+        indirectBuffer->commands.resize(descriptor.commandCount, DrawIndexedIndirectCommand{ 0, 0, 0, 0, 0 });
+        indirectBuffer->drawCount = descriptor.commandCount;
+        if (descriptor.commands)
+        {
+            std::copy(descriptor.commands, descriptor.commands + descriptor.commandCount, indirectBuffer->commands.begin());
+
+            if (descriptor.bounds)
+            {
+                indirectBuffer->sourceCommands = indirectBuffer->commands;
+                indirectBuffer->bounds.assign(descriptor.bounds, descriptor.bounds + descriptor.commandCount);
+            }
+        }
+        return indirectBuffer;
+    }
+
+    Pipeline* NullRenderer::CreatePipeline(const PipelineDescriptor& descriptor)
+    {
+        NullPipeline* pipeline = new NullPipeline;
+        pipeline->topology = descriptor.topology;
+        return pipeline;
+    }
+
+    std::future<Pipeline*> NullRenderer::CreatePipelineAsync(const PipelineDescriptor& descriptor)
+    {
+        std::promise<Pipeline*> promise;
+        promise.set_value(CreatePipeline(descriptor));
+        return promise.get_future();
+    }
+
+    Texture* NullRenderer::CreateTexture(const TextureDescriptor& descriptor)
+    {
+        NullTexture* texture = new NullTexture;
+        texture->dimensions = descriptor.dimensions;
+        texture->format = descriptor.format;
+        texture->mipLevelCount = descriptor.mipLevelCount ? descriptor.mipLevelCount : Texture::GetMipLevelCount(descriptor.dimensions);
+        return texture;
+    }
+
+    UniformBlock* NullRenderer::CreateUniformBlock(const UniformBlockDescriptor& descriptor)
+    {
+        NullUniformBlock* uniformBlock = new NullUniformBlock;
+        uniformBlock->set = descriptor.id;
+        return uniformBlock;
+    }
+
+    UniformBuffer* NullRenderer::CreateUniformBuffer(const UniformBufferDescriptor& descriptor)
+    {
+        NullUniformBuffer* uniformBuffer = new NullUniformBuffer;
+        uniformBuffer->data.resize(descriptor.size, 0);
+        uniformBuffer->allocationOffset = 0;
+        uniformBuffer->allocationFrame = 0;
+        return uniformBuffer;
+    }
+
+    VertexBuffer* NullRenderer::CreateVertexBuffer(const VertexBufferDescriptor& descriptor)
+    {
+        NullVertexBuffer* vertexBuffer = new NullVertexBuffer;
+        vertexBuffer->vertexCount = descriptor.vertexCount;
+        vertexBuffer->capacity = descriptor.vertexCount;
+        vertexBuffer->vertexSize = descriptor.vertexSize;
+        vertexBuffer->usage = descriptor.usage;
+
+        if (descriptor.usage == VertexBuffer::Usage::Dynamic)
+        {
+            InitializeDynamicBuffer(vertexBuffer->data, static_cast<size_t>(descriptor.vertexCount) * descriptor.vertexSize, descriptor.data);
+            vertexBuffer->vertexCount = descriptor.data ? descriptor.vertexCount : 0;
+        }
+        return vertexBuffer;
+    }
+
+    void NullRenderer::DestroyCommandBuffer(CommandBuffer* commandBuffer)
+    {
+        delete static_cast<NullCommandBuffer*>(commandBuffer);
+    }
+
+    void NullRenderer::DestroyFramebuffer(Framebuffer* framebuffer)
+    {
+        NullFramebuffer* nullFramebuffer = static_cast<NullFramebuffer*>(framebuffer);
+        m_framebuffers.erase(std::remove(m_framebuffers.begin(), m_framebuffers.end(), nullFramebuffer), m_framebuffers.end());
+        if (m_boundFramebuffer == nullFramebuffer)
+        {
+            m_boundFramebuffer = nullptr;
+        }
+        m_frameGraphChanged = true;
+        delete nullFramebuffer;
+    }
+
+    void NullRenderer::DestroyIndexBuffer(IndexBuffer* indexBuffer)
+    {
+        delete static_cast<NullIndexBuffer*>(indexBuffer);
+    }
+
+    void NullRenderer::DestroyIndirectBuffer(IndirectBuffer* indirectBuffer)
+    {
+        delete static_cast<NullIndirectBuffer*>(indirectBuffer);
+    }
+
+    void NullRenderer::DestroyPipeline(Pipeline* pipeline)
+    {
+        delete static_cast<NullPipeline*>(pipeline);
+    }
+
+    void NullRenderer::DestroyTexture(Texture* texture)
+    {
+        delete static_cast<NullTexture*>(texture);
+    }
+
+    void NullRenderer::DestroyUniformBlock(UniformBlock* uniformBlock)
+    {
+        delete static_cast<NullUniformBlock*>(uniformBlock);
+    }
+
+    void NullRenderer::DestroyUniformBuffer(UniformBuffer* uniformBuffer)
+    {
+        delete static_cast<NullUniformBuffer*>(uniformBuffer);
+    }
+
+    void NullRenderer::DestroyVertexBuffer(VertexBuffer* vertexBuffer)
+    {
+        delete static_cast<NullVertexBuffer*>(vertexBuffer);
+    }
+
+    void NullRenderer::BindPipeline(Pipeline* pipeline)
+    {
+        m_inlineCommandBuffer.BindPipeline(pipeline);
+    }
+
+    void NullRenderer::BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset)
+    {
+        m_inlineCommandBuffer.BindUniformBlock(uniformBlock, offset);
+    }
+
+    void NullRenderer::BindUniformBuffer(Pipeline* pipeline, const uint32_t set, UniformBuffer* uniformBuffer, const uint32_t offset, const uint32_t size)
+    {
+        // Bound without going through the cache, a following bind of a uniform block to the same set must not be skipped.
+        m_inlineCommandBuffer.bindStateCache.InvalidateUniformBlock(set);
+
+        CommandStream::Command command(CommandStream::Opcode::BindUniformBuffer);
+        command.resources[0] = pipeline;
+        command.resources[1] = uniformBuffer;
+        command.values[0] = set;
+        command.values[1] = offset;
+        command.values[2] = size;
+        m_inlineCommandBuffer.stream.Write(command);
+    }
+
+    void NullRenderer::BeginDraw()
+    {
+        if (m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Calling BeginDraw twice, without any previous call to EndDraw.");
+            return;
+        }
+
+        m_frameBeginTime = Time::GetSystemTime();
+        m_frameStream.Clear();
+        m_frameBindStatistics.Clear();
+        m_markerDepth = 0;
+        m_boundFramebuffer = nullptr;
+        m_inlineCommandBuffer.InternalBegin();
+
+        ++m_frameCount;
+        m_beginDraw = true;
+    }
+
+    void NullRenderer::BindFramebuffer(Framebuffer* framebuffer)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot bind framebuffer without any previous call to BeginDraw.");
+            return;
+        }
+
+        // Commands recorded directly on the renderer before this call are drawn into the previously bound framebuffer.
+        FlushInlineCommands();
+
+        CommandStream::Command command(CommandStream::Opcode::BindFramebuffer);
+        command.resources[0] = framebuffer;
+        m_frameStream.Write(command);
+
+        m_boundFramebuffer = static_cast<NullFramebuffer*>(framebuffer);
+        m_inlineCommandBuffer.InternalBegin();
+    }
+
+    void NullRenderer::ExecuteCommandBuffer(CommandBuffer* commandBuffer)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot execute command buffer without any previous call to BeginDraw.");
+            return;
+        }
+
+        NullCommandBuffer* nullCommandBuffer = static_cast<NullCommandBuffer*>(commandBuffer);
+        if (nullCommandBuffer->recording)
+        {
+            Logger::WriteError(m_logger, "Cannot execute command buffer which is still recording.");
+            return;
+        }
+        if (nullCommandBuffer->currentFramebuffer != m_boundFramebuffer)
+        {
+            Logger::WriteError(m_logger, "Cannot execute command buffer recorded for another framebuffer than the bound framebuffer.");
+            return;
+        }
+
+        // Commands recorded directly on the renderer before this call are executed first.
+        FlushInlineCommands();
+
+        m_frameStream.Append(nullCommandBuffer->stream);
+        m_frameBindStatistics += nullCommandBuffer->bindStateCache.GetStatistics();
+
+        m_inlineCommandBuffer.InternalBegin();
+    }
+
+    void NullRenderer::DrawVertexBuffer(VertexBuffer* vertexBuffer)
+    {
+        m_inlineCommandBuffer.DrawVertexBuffer(vertexBuffer);
+    }
+
+    void NullRenderer::DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer)
+    {
+        m_inlineCommandBuffer.DrawVertexBuffer(indexBuffer, vertexBuffer);
+    }
+
+    void NullRenderer::DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount)
+    {
+        m_inlineCommandBuffer.DrawVertexBufferInstanced(vertexBuffer, instanceBuffer, instanceCount);
+    }
+
+    void NullRenderer::DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount)
+    {
+        m_inlineCommandBuffer.DrawVertexBufferInstanced(indexBuffer, vertexBuffer, instanceBuffer, instanceCount);
+    }
+
+    void NullRenderer::DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount)
+    {
+        m_inlineCommandBuffer.DrawVertexBufferIndirect(indexBuffer, vertexBuffer, instanceBuffer, indirectBuffer, drawCount);
+    }
+
+    void NullRenderer::DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer)
+    {
+        m_inlineCommandBuffer.DrawVertexBufferIndirectCount(indexBuffer, vertexBuffer, instanceBuffer, indirectBuffer);
+    }
+
+    void NullRenderer::PushConstant(const uint32_t location, const bool& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+    void NullRenderer::PushConstant(const uint32_t location, const int32_t& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+    void NullRenderer::PushConstant(const uint32_t location, const float& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+    void NullRenderer::PushConstant(const uint32_t location, const Vector2f32& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+    void NullRenderer::PushConstant(const uint32_t location, const Vector3f32& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+    void NullRenderer::PushConstant(const uint32_t location, const Vector4f32& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+    void NullRenderer::PushConstant(const uint32_t location, const Matrix4x4f32& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+
+    void NullRenderer::EndDraw()
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Calling EndDraw, without any previous call to BeginDraw.");
+            return;
+        }
+
+        if (m_markerDepth > 0)
+        {
+            Logger::WriteWarning(m_logger, "Markers are still open at the end of frame.");
+        }
+
+        FlushInlineCommands();
+        m_inlineCommandBuffer.recording = false;
+
+        if (m_frameGraphChanged)
+        {
+            LoadFrameGraph();
+        }
+
+        // The finished stream is kept until the end of the next frame, the previous allocation is reused for recording.
+        std::swap(m_frameStream, m_lastFrameStream);
+        m_bindStatistics = m_frameBindStatistics;
+        m_beginDraw = false;
+
+        const Time endTime = Time::GetSystemTime();
+        if (m_frameInputTime != Time::Zero)
+        {
+            m_frameProfiler.AddSample(FrameProfiler::Domain::Cpu, "InputToPresent", endTime - m_frameInputTime);
+            m_frameInputTime = Time::Zero;
+        }
+        m_frameProfiler.AddSample(FrameProfiler::Domain::Cpu, "Frame", endTime - m_frameBeginTime);
+        m_frameProfiler.EndFrame();
+    }
+
+    void NullRenderer::WaitForDevice()
+    {
+    }
+
+    bool NullRenderer::ReadRenderTarget(std::vector<uint8_t>& /*pixels*/)
+    {
+        return false;
+    }
+
+    void NullRenderer::CullIndirectBuffer(IndirectBuffer* indirectBuffer, const Frustum& frustum)
+    {
+        NullIndirectBuffer* nullIndirectBuffer = static_cast<NullIndirectBuffer*>(indirectBuffer);
+        if (nullIndirectBuffer->bounds.empty())
+        {
+            Logger::WriteError(m_logger, "Cannot cull indirect buffer created without commands and bounding volumes.");
+            return;
+        }
+
+        nullIndirectBuffer->drawCount = FrustumCuller::Cull(frustum, nullIndirectBuffer->bounds.data(), nullIndirectBuffer->sourceCommands.data(),
+            static_cast<uint32_t>(nullIndirectBuffer->sourceCommands.size()), nullIndirectBuffer->commands.data());
+
+        if (m_beginDraw)
+        {
+            const auto& planes = frustum.GetPlanes();
+            CommandStream::Command command(CommandStream::Opcode::CullIndirectBuffer);
+            command.resources[0] = indirectBuffer;
+            command.data = planes.data();
+            command.dataSize = static_cast<uint32_t>(planes.size() * sizeof(Vector4f32));
+            m_inlineCommandBuffer.stream.Write(command);
+        }
+    }
+
+    void NullRenderer::UpdateIndirectBuffer(IndirectBuffer* indirectBuffer, const uint32_t firstCommand, const uint32_t commandCount, const DrawIndexedIndirectCommand* commands)
+    {
+        NullIndirectBuffer* nullIndirectBuffer = static_cast<NullIndirectBuffer*>(indirectBuffer);
+        if (!nullIndirectBuffer->bounds.empty())
+        {
+            Logger::WriteError(m_logger, "Cannot update indirect buffer created with bounding volumes, commands are written by culling.");
+            return;
+        }
+        if (static_cast<size_t>(firstCommand) + commandCount > nullIndirectBuffer->commands.size())
+        {
+            Logger::WriteError(m_logger, "Trying to update more commands than stored in indirect buffer.");
+            return;
+        }
+
+        std::copy(commands, commands + commandCount, nullIndirectBuffer->commands.begin() + firstCommand);
+
+        if (m_beginDraw)
+        {
+            CommandStream::Command command(CommandStream::Opcode::UpdateIndirectBuffer);
+            command.resources[0] = indirectBuffer;
+            command.values[0] = firstCommand;
+            command.values[1] = commandCount;
+            command.data = commands;
+            command.dataSize = static_cast<uint32_t>(commandCount * sizeof(DrawIndexedIndirectCommand));
+            m_inlineCommandBuffer.stream.Write(command);
+        }
+    }
+
+    void NullRenderer::UpdateIndirectBufferDrawCount(IndirectBuffer* indirectBuffer, const uint32_t drawCount)
+    {
+        NullIndirectBuffer* nullIndirectBuffer = static_cast<NullIndirectBuffer*>(indirectBuffer);
+        if (!nullIndirectBuffer->bounds.empty())
+        {
+            Logger::WriteError(m_logger, "Cannot update indirect buffer created with bounding volumes, commands are written by culling.");
+            return;
+        }
+        if (drawCount > static_cast<uint32_t>(nullIndirectBuffer->commands.size()))
+        {
+            Logger::WriteError(m_logger, "Trying to set draw count greater than number of commands in indirect buffer.");
+            return;
+        }
+
+        nullIndirectBuffer->drawCount = drawCount;
+
+        if (m_beginDraw)
+        {
+            CommandStream::Command command(CommandStream::Opcode::UpdateIndirectBufferDrawCount);
+            command.resources[0] = indirectBuffer;
+            command.values[0] = drawCount;
+            m_inlineCommandBuffer.stream.Write(command);
+        }
+    }
+
+    void NullRenderer::UpdateUniformBuffer(UniformBuffer* uniformBuffer, const size_t offset, const size_t size, const void* data)
+    {
+        NullUniformBuffer* nullUniformBuffer = static_cast<NullUniformBuffer*>(uniformBuffer);
+        if (offset + size > nullUniformBuffer->data.size())
+        {
+            Logger::WriteError(m_logger, "Trying to update data outside of uniform buffer.");
+            return;
+        }
+
+        std::memcpy(nullUniformBuffer->data.data() + offset, data, size);
+
+        if (m_beginDraw)
+        {
+            CommandStream::Command command(CommandStream::Opcode::UpdateUniformBuffer);
+            command.resources[0] = uniformBuffer;
+            command.values[0] = static_cast<uint32_t>(offset);
+            command.data = data;
+            command.dataSize = static_cast<uint32_t>(size);
+            m_inlineCommandBuffer.stream.Write(command);
+        }
+    }
+
+    bool NullRenderer::AllocateUniformBufferData(UniformBuffer* uniformBuffer, const size_t size, const void* data, uint32_t& offset)
+    {
+        NullUniformBuffer* nullUniformBuffer = static_cast<NullUniformBuffer*>(uniformBuffer);
+
+        if (nullUniformBuffer->allocationFrame != m_frameCount)
+        {
+            nullUniformBuffer->allocationFrame = m_frameCount;
+            nullUniformBuffer->allocationOffset = 0;
+        }
+
+        const size_t alignedOffset = ((nullUniformBuffer->allocationOffset + UniformBufferAlignment - 1) / UniformBufferAlignment) * UniformBufferAlignment;
+        if (alignedOffset + size > nullUniformBuffer->data.size())
+        {
+            Logger::WriteError(m_logger, "Uniform buffer is out of memory for the current frame.");
+            return false;
+        }
+
+        nullUniformBuffer->allocationOffset = alignedOffset + size;
+        offset = static_cast<uint32_t>(alignedOffset);
+        UpdateUniformBuffer(uniformBuffer, alignedOffset, size, data);
+        return true;
+    }
+
+    void* NullRenderer::MapIndexBufferForWrite(IndexBuffer* indexBuffer, const uint32_t indexCount)
+    {
+        NullIndexBuffer* nullIndexBuffer = static_cast<NullIndexBuffer*>(indexBuffer);
+        if (nullIndexBuffer->usage != IndexBuffer::Usage::Dynamic)
+        {
+            Logger::WriteError(m_logger, "Cannot map static index buffer for write.");
+            return nullptr;
+        }
+
+        const size_t frameSize = static_cast<size_t>(nullIndexBuffer->capacity) *
+            (nullIndexBuffer->dataType == IndexBuffer::DataType::Uint16 ? sizeof(uint16_t) : sizeof(uint32_t));
+        auto* data = GetDynamicBufferFrameData(nullIndexBuffer->data, frameSize, indexCount, nullIndexBuffer->capacity);
+        if (data)
+        {
+            nullIndexBuffer->indexCount = indexCount;
+        }
+        return data;
+    }
+
+    void* NullRenderer::MapVertexBufferForWrite(VertexBuffer* vertexBuffer, const uint32_t vertexCount)
+    {
+        NullVertexBuffer* nullVertexBuffer = static_cast<NullVertexBuffer*>(vertexBuffer);
+        if (nullVertexBuffer->usage != VertexBuffer::Usage::Dynamic)
+        {
+            Logger::WriteError(m_logger, "Cannot map static vertex buffer for write.");
+            return nullptr;
+        }
+
+        const size_t frameSize = static_cast<size_t>(nullVertexBuffer->capacity) * nullVertexBuffer->vertexSize;
+        auto* data = GetDynamicBufferFrameData(nullVertexBuffer->data, frameSize, vertexCount, nullVertexBuffer->capacity);
+        if (data)
+        {
+            nullVertexBuffer->vertexCount = vertexCount;
+        }
+        return data;
+    }
+
+    bool NullRenderer::UpdateIndexBuffer(IndexBuffer* indexBuffer, const uint32_t indexCount, const void* data)
+    {
+        auto* frameData = MapIndexBufferForWrite(indexBuffer, indexCount);
+        if (!frameData)
+        {
+            return false;
+        }
+
+        const auto dataType = static_cast<NullIndexBuffer*>(indexBuffer)->dataType;
+        std::memcpy(frameData, data, static_cast<size_t>(indexCount) * (dataType == IndexBuffer::DataType::Uint16 ? sizeof(uint16_t) : sizeof(uint32_t)));
+        return true;
+    }
+
+    bool NullRenderer::UpdateVertexBuffer(VertexBuffer* vertexBuffer, const uint32_t vertexCount, const void* data)
+    {
+        auto* frameData = MapVertexBufferForWrite(vertexBuffer, vertexCount);
+        if (!frameData)
+        {
+            return false;
+        }
+
+        std::memcpy(frameData, data, static_cast<size_t>(vertexCount) * static_cast<NullVertexBuffer*>(vertexBuffer)->vertexSize);
+        return true;
+    }
+
+    void NullRenderer::SetTextureStreamingBudget(const size_t /*memoryBudget*/, const size_t /*frameUploadBudget*/)
+    {
+    }
+
+    void NullRenderer::BeginGpuMarker(const std::string& name)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot begin GPU marker without any previous call to BeginDraw.");
+            return;
+        }
+
+        CommandStream::Command command(CommandStream::Opcode::BeginMarker);
+        command.data = name.c_str();
+        command.dataSize = static_cast<uint32_t>(name.size());
+        m_inlineCommandBuffer.stream.Write(command);
+        ++m_markerDepth;
+    }
+
+    void NullRenderer::EndGpuMarker()
+    {
+        if (!m_markerDepth)
+        {
+            Logger::WriteError(m_logger, "Calling EndGpuMarker, without any previous call to BeginGpuMarker.");
+            return;
+        }
+
+        m_inlineCommandBuffer.stream.Write(CommandStream::Command(CommandStream::Opcode::EndMarker));
+        --m_markerDepth;
+    }
+
+    const CommandStream& NullRenderer::GetFrameStream() const
+    {
+        return m_lastFrameStream;
+    }
+
+    uint64_t NullRenderer::GetFrameCount() const
+    {
+        return m_frameCount;
+    }
+
+    void NullRenderer::InitializeDynamicBuffer(std::vector<uint8_t>& data, const size_t frameSize, const void* initialData)
+    {
+        data.resize(frameSize * m_maxFramesInFlight, 0);
+        if (!initialData)
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < m_maxFramesInFlight; i++)
+        {
+            std::memcpy(data.data() + (i * frameSize), initialData, frameSize);
+        }
+    }
+
+    uint8_t* NullRenderer::GetDynamicBufferFrameData(std::vector<uint8_t>& data, const size_t frameSize, const uint32_t count, const uint32_t capacity)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot write dynamic buffer without any previous call to BeginDraw.");
+            return nullptr;
+        }
+        if (count > capacity)
+        {
+            Logger::WriteError(m_logger, "Trying to write more elements than the capacity of dynamic buffer.");
+            return nullptr;
+        }
+
+        if (!frameSize)
+        {
+            return nullptr;
+        }
+
+        // Regions are cycled per frame, in the same way as by backends with frames in flight.
+        const size_t regionCount = data.size() / frameSize;
+        return data.data() + (static_cast<size_t>((m_frameCount - 1) % regionCount) * frameSize);
+    }
+
+    const FrameGraph& NullRenderer::GetFrameGraph() const
+    {
+        return m_frameGraph;
+    }
+
+    void NullRenderer::FlushInlineCommands()
+    {
+        m_frameStream.Append(m_inlineCommandBuffer.stream);
+        m_frameBindStatistics += m_inlineCommandBuffer.bindStateCache.GetStatistics();
+        m_inlineCommandBuffer.stream.Clear();
+        m_inlineCommandBuffer.bindStateCache.ClearStatistics();
+    }
+
+    void NullRenderer::LoadFrameGraph()
+    {
+        m_frameGraph.Clear();
+        m_frameGraphChanged = false;
+
+        const auto backbuffer = m_frameGraph.ImportTexture("Backbuffer", { m_size, FrameGraph::Format::Rgba8 },
+            FrameGraph::ResourceState::Undefined, FrameGraph::ResourceState::Present);
+
+        for (auto* framebuffer : m_framebuffers)
+        {
+            framebuffer->resource = m_frameGraph.CreateTexture("Framebuffer", { framebuffer->size, FrameGraph::Format::Rgba8 });
+            const auto pass = m_frameGraph.AddPass("Framebuffer");
+            m_frameGraph.Write(pass, framebuffer->resource, FrameGraph::ResourceState::ColorAttachment);
+        }
+
+        if (!m_framebuffers.empty())
+        {
+            const auto blitPass = m_frameGraph.AddPass("Blit");
+            for (auto* framebuffer : m_framebuffers)
+            {
+                m_frameGraph.Read(blitPass, framebuffer->resource, FrameGraph::ResourceState::TransferSource);
+            }
+            m_frameGraph.Write(blitPass, backbuffer, FrameGraph::ResourceState::TransferDestination);
+        }
+
+        const auto presentPass = m_frameGraph.AddPass("Present");
+        m_frameGraph.Write(presentPass, backbuffer, FrameGraph::ResourceState::ColorAttachment);
+
+        m_frameGraph.Compile();
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,255 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/OpenGL/OpenGLCommandBuffer.hpp"
+
+#if defined(MOLTEN_ENABLE_OPENGL)
+#if MOLTEN_PLATFORM == MOLTEN_PLATFORM_LINUX
+
+#include "Molten/Renderer/OpenGL/OpenGLX11Renderer.hpp"
+#include "Molten/Renderer/OpenGL/OpenGLResources.hpp"
+#include "Molten/Logger.hpp"
+
+namespace Molten
+{
+
+    // OpenGL command buffer class implementations.
+    bool OpenGLCommandBuffer::Begin(Framebuffer* framebuffer)
+    {
+        if (recording)
+        {
+            Logger::WriteError(renderer->m_logger, "Calling Begin of command buffer twice, without any previous call to End.");
+            return false;
+        }
+        if (!renderer->m_beginDraw)
+        {
+            Logger::WriteError(renderer->m_logger, "Cannot begin recording of command buffer without any previous call to BeginDraw.");
+            return false;
+        }
+        if (framebuffer)
+        {
+            Logger::WriteError(renderer->m_logger, "Framebuffers are not supported by the OpenGL renderer.");
+            return false;
+        }
+
+        InternalBegin();
+        return true;
+    }
+
+    void OpenGLCommandBuffer::End()
+    {
+        if (!recording)
+        {
+            Logger::WriteError(renderer->m_logger, "Calling End of command buffer, without any previous call to Begin.");
+            return;
+        }
+
+        recording = false;
+    }
+
+    void OpenGLCommandBuffer::BindPipeline(Pipeline* pipeline)
+    {
+        if (!bindStateCache.BindPipeline(pipeline))
+        {
+            return;
+        }
+
+        CommandStream::Command command(CommandStream::Opcode::BindPipeline);
+        command.resources[0] = pipeline;
+        stream.Write(command);
+    }
+
+    void OpenGLCommandBuffer::BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset)
+    {
+        OpenGLUniformBlock* openGLUniformBlock = static_cast<OpenGLUniformBlock*>(uniformBlock);
+        if (!bindStateCache.BindUniformBlock(openGLUniformBlock->set, openGLUniformBlock, offset))
+        {
+            return;
+        }
+
+        CommandStream::Command command(CommandStream::Opcode::BindUniformBlock);
+        command.resources[0] = uniformBlock;
+        command.values[0] = openGLUniformBlock->set;
+        command.values[1] = offset;
+        stream.Write(command);
+    }
+
+    void OpenGLCommandBuffer::DrawVertexBuffer(VertexBuffer* vertexBuffer)
+    {
+        OpenGLVertexBuffer* openGLVertexBuffer = static_cast<OpenGLVertexBuffer*>(vertexBuffer);
+
+        InternalBindVertexBuffers(openGLVertexBuffer, nullptr);
+        InternalWriteDraw(CommandStream::Opcode::Draw, openGLVertexBuffer->vertexCount, 1);
+    }
+
+    void OpenGLCommandBuffer::DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer)
+    {
+        OpenGLIndexBuffer* openGLIndexBuffer = static_cast<OpenGLIndexBuffer*>(indexBuffer);
+
+        InternalBindVertexBuffers(static_cast<OpenGLVertexBuffer*>(vertexBuffer), nullptr);
+        InternalBindIndexBuffer(openGLIndexBuffer);
+        InternalWriteDraw(CommandStream::Opcode::DrawIndexed, openGLIndexBuffer->indexCount, 1);
+    }
+
+    void OpenGLCommandBuffer::DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount)
+    {
+        OpenGLVertexBuffer* openGLVertexBuffer = static_cast<OpenGLVertexBuffer*>(vertexBuffer);
+
+        InternalBindVertexBuffers(openGLVertexBuffer, static_cast<OpenGLVertexBuffer*>(instanceBuffer));
+        InternalWriteDraw(CommandStream::Opcode::Draw, openGLVertexBuffer->vertexCount, instanceCount);
+    }
+
+    void OpenGLCommandBuffer::DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount)
+    {
+        OpenGLIndexBuffer* openGLIndexBuffer = static_cast<OpenGLIndexBuffer*>(indexBuffer);
+
+        InternalBindVertexBuffers(static_cast<OpenGLVertexBuffer*>(vertexBuffer), static_cast<OpenGLVertexBuffer*>(instanceBuffer));
+        InternalBindIndexBuffer(openGLIndexBuffer);
+        InternalWriteDraw(CommandStream::Opcode::DrawIndexed, openGLIndexBuffer->indexCount, instanceCount);
+    }
+
+    void OpenGLCommandBuffer::DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount)
+    {
+        OpenGLIndirectBuffer* openGLIndirectBuffer = static_cast<OpenGLIndirectBuffer*>(indirectBuffer);
+        if (drawCount > openGLIndirectBuffer->commandCount)
+        {
+            Logger::WriteWarning(renderer->m_logger, "Trying to draw more commands than stored in indirect buffer.");
+            return;
+        }
+
+        InternalBindVertexBuffers(static_cast<OpenGLVertexBuffer*>(vertexBuffer), static_cast<OpenGLVertexBuffer*>(instanceBuffer));
+        InternalBindIndexBuffer(static_cast<OpenGLIndexBuffer*>(indexBuffer));
+
+        CommandStream::Command command(CommandStream::Opcode::DrawIndirect);
+        command.resources[0] = indirectBuffer;
+        command.values[0] = drawCount;
+        stream.Write(command);
+    }
+
+    void OpenGLCommandBuffer::DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer)
+    {
+        OpenGLIndirectBuffer* openGLIndirectBuffer = static_cast<OpenGLIndirectBuffer*>(indirectBuffer);
+
+        InternalBindVertexBuffers(static_cast<OpenGLVertexBuffer*>(vertexBuffer), static_cast<OpenGLVertexBuffer*>(instanceBuffer));
+        InternalBindIndexBuffer(static_cast<OpenGLIndexBuffer*>(indexBuffer));
+
+        CommandStream::Command command(CommandStream::Opcode::DrawIndirectCount);
+        command.resources[0] = indirectBuffer;
+        command.values[0] = openGLIndirectBuffer->commandCount;
+        stream.Write(command);
+    }
+
+    void OpenGLCommandBuffer::PushConstant(const uint32_t location, const bool& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void OpenGLCommandBuffer::PushConstant(const uint32_t location, const int32_t& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void OpenGLCommandBuffer::PushConstant(const uint32_t location, const float& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void OpenGLCommandBuffer::PushConstant(const uint32_t location, const Vector2f32& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void OpenGLCommandBuffer::PushConstant(const uint32_t location, const Vector3f32& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void OpenGLCommandBuffer::PushConstant(const uint32_t location, const Vector4f32& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void OpenGLCommandBuffer::PushConstant(const uint32_t location, const Matrix4x4f32& value)
+    {
+        InternalPushConstant(location, value);
+    }
+
+    OpenGLCommandBuffer::OpenGLCommandBuffer(OpenGLX11Renderer* renderer) :
+        renderer(renderer),
+        recording(false)
+    {}
+
+    void OpenGLCommandBuffer::InternalBegin()
+    {
+        stream.Clear();
+        bindStateCache.Reset();
+        bindStateCache.ClearStatistics();
+        recording = true;
+    }
+
+    void OpenGLCommandBuffer::InternalBindVertexBuffers(OpenGLVertexBuffer* vertexBuffer, OpenGLVertexBuffer* instanceBuffer)
+    {
+        if (bindStateCache.BindVertexBuffer(0, vertexBuffer))
+        {
+            CommandStream::Command command(CommandStream::Opcode::BindVertexBuffer);
+            command.resources[0] = vertexBuffer;
+            stream.Write(command);
+        }
+        if (instanceBuffer && bindStateCache.BindVertexBuffer(1, instanceBuffer))
+        {
+            CommandStream::Command command(CommandStream::Opcode::BindVertexBuffer);
+            command.resources[0] = instanceBuffer;
+            command.values[0] = 1;
+            stream.Write(command);
+        }
+    }
+
+    void OpenGLCommandBuffer::InternalBindIndexBuffer(OpenGLIndexBuffer* indexBuffer)
+    {
+        if (bindStateCache.BindIndexBuffer(indexBuffer))
+        {
+            CommandStream::Command command(CommandStream::Opcode::BindIndexBuffer);
+            command.resources[0] = indexBuffer;
+            stream.Write(command);
+        }
+    }
+
+    void OpenGLCommandBuffer::InternalWriteDraw(const CommandStream::Opcode opcode, const uint32_t count, const uint32_t instanceCount)
+    {
+        CommandStream::Command command(opcode);
+        command.values[0] = count;
+        command.values[1] = instanceCount;
+        stream.Write(command);
+    }
+
+    template<typename T>
+    void OpenGLCommandBuffer::InternalPushConstant(const uint32_t location, const T& value)
+    {
+        CommandStream::Command command(CommandStream::Opcode::PushConstant);
+        command.values[0] = location;
+        command.data = &value;
+        command.dataSize = static_cast<uint32_t>(sizeof(T));
+        stream.Write(command);
+    }
+
+}
+
+#endif
+
+#endif
\ No newline at end of file
@@ -143,6 +143,11 @@ namespace Molten
         return false;
     }
 
+    bool OpenGLWin32Renderer::OpenOffscreen(const Vector2ui32& /*size*/, const Version& /*version*/, Logger* /*logger*/)
+    {
+        return false;
+    }
+
     void OpenGLWin32Renderer::Close()
     {
         if (m_context)
@@ -177,17 +182,58 @@ namespace Molten
         return m_version;
     }
 
+    BindStatistics OpenGLWin32Renderer::GetBindStatistics() const
+    {
+        return {};
+    }
+
+    const FrameProfiler* OpenGLWin32Renderer::GetFrameProfiler() const
+    {
+        return nullptr;
+    }
+
+    void OpenGLWin32Renderer::SetPresentMode(const PresentMode /*presentMode*/)
+    {
+    }
+
+    Renderer::PresentMode OpenGLWin32Renderer::GetPresentMode() const
+    {
+        return PresentMode::Fifo;
+    }
+
+    void OpenGLWin32Renderer::SetMaxFramesInFlight(const size_t /*maxFramesInFlight*/)
+    {
+    }
+
+    size_t OpenGLWin32Renderer::GetMaxFramesInFlight() const
+    {
+        return 1;
+    }
+
+    void OpenGLWin32Renderer::SetFrameInputTime(const Time& /*inputTime*/)
+    {
+    }
+
     uint32_t OpenGLWin32Renderer::GetPushConstantLocation(Pipeline* /*pipeline*/, const uint32_t /*id*/)
     {
         return 0;
     }
 
+    void OpenGLWin32Renderer::SetCacheDirectory(const std::string& /*directory*/)
+    {
+    }
+
     //std::vector<uint8_t> OpenGLWin32Renderer::CompileShaderProgram(const ShaderFormat /*inputFormat*/, const ShaderType /*inputType*/,
     //                                                              const std::vector<uint8_t>& /*inputData*/, const ShaderFormat /*outputFormat*/)
     //{
     //    return {};
     //}
 
+    CommandBuffer* OpenGLWin32Renderer::CreateCommandBuffer()
+    {
+        return nullptr;
+    }
+
     Framebuffer* OpenGLWin32Renderer::CreateFramebuffer(const FramebufferDescriptor&)
     {
         return nullptr;
@@ -198,12 +244,24 @@ namespace Molten
         return nullptr;
     }
 
+    IndirectBuffer* OpenGLWin32Renderer::CreateIndirectBuffer(const IndirectBufferDescriptor& /*descriptor*/)
+    {
+        return nullptr;
+    }
+
     Pipeline* OpenGLWin32Renderer::CreatePipeline(const PipelineDescriptor& /*descriptor*/)
     {
         return nullptr;
     }
 
-    Texture* OpenGLWin32Renderer::CreateTexture()
+    std::future<Pipeline*> OpenGLWin32Renderer::CreatePipelineAsync(const PipelineDescriptor& /*descriptor*/)
+    {
+        std::promise<Pipeline*> promise;
+        promise.set_value(nullptr);
+        return promise.get_future();
+    }
+
+    Texture* OpenGLWin32Renderer::CreateTexture(const TextureDescriptor& /*descriptor*/)
     {
         return nullptr;
     }
@@ -223,6 +281,10 @@ namespace Molten
         return nullptr;
     }
 
+    void OpenGLWin32Renderer::DestroyCommandBuffer(CommandBuffer* /*commandBuffer*/)
+    {
+    }
+
     void OpenGLWin32Renderer::DestroyFramebuffer(Framebuffer*)
     {
     }
@@ -231,6 +293,10 @@ namespace Molten
     {
     }
 
+    void OpenGLWin32Renderer::DestroyIndirectBuffer(IndirectBuffer* /*indirectBuffer*/)
+    {
+    }
+
     void OpenGLWin32Renderer::DestroyPipeline(Pipeline* /*shader*/)
     {
     }
@@ -259,10 +325,22 @@ namespace Molten
     {
     }
 
+    void OpenGLWin32Renderer::BindUniformBuffer(Pipeline* /*pipeline*/, const uint32_t /*set*/, UniformBuffer* /*uniformBuffer*/, const uint32_t /*offset*/, const uint32_t /*size*/)
+    {
+    }
+
     void OpenGLWin32Renderer::BeginDraw()
     {
     }
 
+    void OpenGLWin32Renderer::BindFramebuffer(Framebuffer* /*framebuffer*/)
+    {
+    }
+
+    void OpenGLWin32Renderer::ExecuteCommandBuffer(CommandBuffer* /*commandBuffer*/)
+    {
+    }
+
     void OpenGLWin32Renderer::DrawVertexBuffer(VertexBuffer* /*vertexBuffer*/)
     {
     }
@@ -271,6 +349,22 @@ namespace Molten
     {
     }
 
+    void OpenGLWin32Renderer::DrawVertexBufferInstanced(VertexBuffer* /*vertexBuffer*/, VertexBuffer* /*instanceBuffer*/, const uint32_t /*instanceCount*/)
+    {
+    }
+
+    void OpenGLWin32Renderer::DrawVertexBufferInstanced(IndexBuffer* /*indexBuffer*/, VertexBuffer* /*vertexBuffer*/, VertexBuffer* /*instanceBuffer*/, const uint32_t /*instanceCount*/)
+    {
+    }
+
+    void OpenGLWin32Renderer::DrawVertexBufferIndirect(IndexBuffer* /*indexBuffer*/, VertexBuffer* /*vertexBuffer*/, VertexBuffer* /*instanceBuffer*/, IndirectBuffer* /*indirectBuffer*/, const uint32_t /*drawCount*/)
+    {
+    }
+
+    void OpenGLWin32Renderer::DrawVertexBufferIndirectCount(IndexBuffer* /*indexBuffer*/, VertexBuffer* /*vertexBuffer*/, VertexBuffer* /*instanceBuffer*/, IndirectBuffer* /*indirectBuffer*/)
+    {
+    }
+
     void OpenGLWin32Renderer::PushConstant(const uint32_t /*location*/, const bool& /*value*/)
     {
     }
@@ -301,10 +395,64 @@ namespace Molten
     {
     }
 
+    bool OpenGLWin32Renderer::ReadRenderTarget(std::vector<uint8_t>& /*pixels*/)
+    {
+        return false;
+    }
+
+    void OpenGLWin32Renderer::CullIndirectBuffer(IndirectBuffer* /*indirectBuffer*/, const Frustum& /*frustum*/)
+    {
+    }
+
+    void OpenGLWin32Renderer::UpdateIndirectBuffer(IndirectBuffer* /*indirectBuffer*/, const uint32_t /*firstCommand*/, const uint32_t /*commandCount*/, const DrawIndexedIndirectCommand* /*commands*/)
+    {
+    }
+
+    void OpenGLWin32Renderer::UpdateIndirectBufferDrawCount(IndirectBuffer* /*indirectBuffer*/, const uint32_t /*drawCount*/)
+    {
+    }
+
     void OpenGLWin32Renderer::UpdateUniformBuffer(UniformBuffer* /*uniformBuffer*/, const size_t /*offset*/, const size_t /*size*/, const void* /*data*/)
     {
     }
 
+    bool OpenGLWin32Renderer::AllocateUniformBufferData(UniformBuffer* /*uniformBuffer*/, const size_t /*size*/, const void* /*data*/, uint32_t& /*offset*/)
+    {
+        return false;
+    }
+
+    void* OpenGLWin32Renderer::MapIndexBufferForWrite(IndexBuffer* /*indexBuffer*/, const uint32_t /*indexCount*/)
+    {
+        return nullptr;
+    }
+
+    void* OpenGLWin32Renderer::MapVertexBufferForWrite(VertexBuffer* /*vertexBuffer*/, const uint32_t /*vertexCount*/)
+    {
+        return nullptr;
+    }
+
+    bool OpenGLWin32Renderer::UpdateIndexBuffer(IndexBuffer* /*indexBuffer*/, const uint32_t /*indexCount*/, const void* /*data*/)
+    {
+        return false;
+    }
+
+    bool OpenGLWin32Renderer::UpdateVertexBuffer(VertexBuffer* /*vertexBuffer*/, const uint32_t /*vertexCount*/, const void* /*data*/)
+    {
+        return false;
+    }
+
+    void OpenGLWin32Renderer::SetTextureStreamingBudget(const size_t /*memoryBudget*/, const size_t /*frameUploadBudget*/)
+    {
+    }
+
+    void OpenGLWin32Renderer::BeginGpuMarker(const std::string& /*name*/)
+    {
+    }
+
+    void OpenGLWin32Renderer::EndGpuMarker()
+    {
+    }
+
     bool OpenGLWin32Renderer::OpenVersion(HDC deviceContext, const Version& version)
     {
         PFNWGLCREATECONTEXTATTRIBSARBPROC wglCreateContextAttribsARB = NULL;
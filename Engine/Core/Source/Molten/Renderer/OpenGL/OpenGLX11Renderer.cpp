@@ -23,353 +23,2132 @@
 *
 */
 
-
 #include "Molten/Renderer/OpenGL/OpenGLX11Renderer.hpp"
 
 #if defined(MOLTEN_ENABLE_OPENGL)
 #if MOLTEN_PLATFORM == MOLTEN_PLATFORM_LINUX
 
 #include "Molten/Renderer/OpenGL/OpengGLFunctions.hpp"
+#include "Molten/Renderer/OpenGL/OpenGLResources.hpp"
+#include "Molten/Renderer/Shader/Visual/VisualShaderScript.hpp"
+#include "Molten/Renderer/Shader/Generator/VulkanShaderGenerator.hpp"
 #include "Molten/Window/Window.hpp"
+#include "Molten/Logger.hpp"
 #include "Molten/System/Exception.hpp"
+#include "Molten/Utility/SmartFunction.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <set>
 
 namespace Molten
 {
 
-    OpenGLX11Renderer::OpenGLX11Renderer()
+    // Static helper functions.
+    static GLenum GetShaderType(const Shader::Type type)
     {
-    }
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (type)
+        {
+            case Shader::Type::Vertex:   return GL_VERTEX_SHADER;
+            case Shader::Type::Fragment: return GL_FRAGMENT_SHADER;
+            case Shader::Type::Compute:  return GL_COMPUTE_SHADER;
+        }
 
-    OpenGLX11Renderer::OpenGLX11Renderer(const Window& window, const Version& version, Logger* logger) :
-        OpenGLX11Renderer()
-    {
-        Open(window, version, logger);
+        throw Exception("Provided shader type is not supported by the OpenGL renderer.");
+        MOLTEN_UNSCOPED_ENUM_END
     }
 
-    OpenGLX11Renderer::~OpenGLX11Renderer()
+    static GLenum GetPrimitiveTopology(const Pipeline::Topology topology)
     {
-        Close();
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (topology)
+        {
+            case Pipeline::Topology::PointList:     return GL_POINTS;
+            case Pipeline::Topology::LineList:      return GL_LINES;
+            case Pipeline::Topology::LineStrip:     return GL_LINE_STRIP;
+            case Pipeline::Topology::TriangleList:  return GL_TRIANGLES;
+            case Pipeline::Topology::TriangleStrip: return GL_TRIANGLE_STRIP;
+        }
+        throw Exception("Provided primitive topology is not supported by the OpenGL renderer.");
+        MOLTEN_UNSCOPED_ENUM_END
     }
 
-    bool OpenGLX11Renderer::Open(const Window& /*window*/, const Version& /*version*/, Logger* /*logger*/)
+    static GLenum GetPolygonMode(const Pipeline::PolygonMode polygonMode)
     {
-        /*HGLRC temporaryContext = NULL;
-
-        auto deviceContext = window.GetWin32DeviceContext();
-        if (deviceContext == NULL)
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (polygonMode)
         {
-            throw Exception("RendererOpenGLWin32: Device context of parameter \"window\" is null.");
+            case Pipeline::PolygonMode::Point: return GL_POINT;
+            case Pipeline::PolygonMode::Line:  return GL_LINE;
+            case Pipeline::PolygonMode::Fill:  return GL_FILL;
         }
+        throw Exception("Provided polygon mode is not supported by the OpenGL renderer.");
+        MOLTEN_UNSCOPED_ENUM_END
+    }
 
-        try
+    static GLenum GetFrontFace(const Pipeline::FrontFace frontFace)
+    {
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (frontFace)
         {
-            static PIXELFORMATDESCRIPTOR pixelFormatDescriptor =
-            {
-                sizeof(PIXELFORMATDESCRIPTOR),
-                1,
-                PFD_DRAW_TO_WINDOW |
-                PFD_SUPPORT_OPENGL |
-                PFD_DOUBLEBUFFER,
-                PFD_TYPE_RGBA,
-                24,
-                0, 0, 0, 0, 0, 0,
-                0,
-                0,
-                0,
-                0, 0, 0, 0,
-                16, //DepthBits,
-                8, //StencilBits,
-                0,
-                PFD_MAIN_PLANE,
-                0,
-                0, 0, 0
-            };
-
-            // Choose and set the pixel format
-            GLuint pixelFormat;
-
-            if ((pixelFormat = ChoosePixelFormat(deviceContext, &pixelFormatDescriptor)) == 0)
-            {
-                throw Exception("RendererOpenGLWin32: Failed to choose pixel format for Win32 device context.");
-            }
-            if ((SetPixelFormat(deviceContext, pixelFormat, &pixelFormatDescriptor)) == false)
-            {
-                throw Exception("RendererOpenGLWin32: Failed to set pixel format for Win32 device context.");
-            }
-
-            temporaryContext = ::wglCreateContext(deviceContext);
-            if (temporaryContext == NULL)
-            {
-                throw Exception("RendererOpenGLWin32: Failed to create primitive Win32 OpenGL context.");
-            }
-
-            ::wglMakeCurrent(NULL, NULL);
-            ::wglMakeCurrent(deviceContext, temporaryContext);
-      
-            if (version == Version::None)
-            {
-                Version openedVersion;
-                OpenBestVersion(deviceContext, openedVersion);
-                m_version = openedVersion;
-            }
-            else
-            {
-                OpenVersion(deviceContext, version);
-                m_version = version;
-            }
+            case Pipeline::FrontFace::Clockwise:        return GL_CW;
+            case Pipeline::FrontFace::Counterclockwise: return GL_CCW;
         }
-        catch (Exception &)
-        {
-            if (temporaryContext)
-            {
-                ::wglDeleteContext(temporaryContext);
-            }
-
-            ::wglMakeCurrent(NULL, NULL);
+        throw Exception("Provided front face is not supported by the OpenGL renderer.");
+        MOLTEN_UNSCOPED_ENUM_END
+    }
 
-            throw;
-        }
-        catch (...)
+    static GLenum GetCullMode(const Pipeline::CullMode cullMode)
+    {
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (cullMode)
         {
-
-            throw;
+            case Pipeline::CullMode::None:         return GL_NONE;
+            case Pipeline::CullMode::Front:        return GL_FRONT;
+            case Pipeline::CullMode::Back:         return GL_BACK;
+            case Pipeline::CullMode::FrontAndBack: return GL_FRONT_AND_BACK;
         }
-
-        OpenGL::BindOpenGLExtensions();*/
-
-        return false;
+        throw Exception("Provided cull mode is not supported by the OpenGL renderer.");
+        MOLTEN_UNSCOPED_ENUM_END
     }
 
-    void OpenGLX11Renderer::Close()
+    static GLenum GetIndexBufferDataType(const IndexBuffer::DataType dataType)
     {
-        /*if (m_context)
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (dataType)
         {
-            // Release the context from the current thread
-            if (!wglMakeCurrent(NULL, NULL))
-            {
-                throw Exception("RendererOpenGLWin32: Failed to set current context to null.");
-            }
-
-            // Delete the context
-            if (!wglDeleteContext(m_context))
-            {
-                throw Exception("RendererOpenGLWin32: Failed to delete context.");
-            }
-
-            m_context = NULL;
-        }*/
+            case IndexBuffer::DataType::Uint16: return GL_UNSIGNED_SHORT;
+            case IndexBuffer::DataType::Uint32: return GL_UNSIGNED_INT;
+        }
+        throw Exception("Provided data type is not supported as index buffer data type by the OpenGL renderer.");
+        MOLTEN_UNSCOPED_ENUM_END
     }
 
-    void OpenGLX11Renderer::Resize(const Vector2ui32& /*size*/)
+    static bool GetTextureFormat(const Texture::Format format, GLenum& internalFormat, GLenum& pixelFormat, GLenum& pixelType)
     {
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (format)
+        {
+            case Texture::Format::Red8:        internalFormat = GL_R8;           pixelFormat = GL_RED;  pixelType = GL_UNSIGNED_BYTE; return true;
+            case Texture::Format::RedGreen8:   internalFormat = GL_RG8;          pixelFormat = GL_RG;   pixelType = GL_UNSIGNED_BYTE; return true;
+            case Texture::Format::Rgba8:       internalFormat = GL_RGBA8;        pixelFormat = GL_RGBA; pixelType = GL_UNSIGNED_BYTE; return true;
+            case Texture::Format::Rgba8Srgb:   internalFormat = GL_SRGB8_ALPHA8; pixelFormat = GL_RGBA; pixelType = GL_UNSIGNED_BYTE; return true;
+            case Texture::Format::Rgba16Float: internalFormat = GL_RGBA16F;      pixelFormat = GL_RGBA; pixelType = GL_HALF_FLOAT;    return true;
+            case Texture::Format::Rgba32Float: internalFormat = GL_RGBA32F;      pixelFormat = GL_RGBA; pixelType = GL_FLOAT;         return true;
+        }
+        return false;
+        MOLTEN_UNSCOPED_ENUM_END
     }
 
-    Renderer::BackendApi OpenGLX11Renderer::GetBackendApi() const
+    static GLenum GetSamplerMinFilter(const Texture::Filter minFilter, const Texture::Filter mipmapFilter)
     {
-        return Renderer::BackendApi::OpenGL;
+        if (minFilter == Texture::Filter::Nearest)
+        {
+            return mipmapFilter == Texture::Filter::Nearest ? GL_NEAREST_MIPMAP_NEAREST : GL_NEAREST_MIPMAP_LINEAR;
+        }
+        return mipmapFilter == Texture::Filter::Nearest ? GL_LINEAR_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR;
     }
 
-    Version OpenGLX11Renderer::GetVersion() const
+    static GLenum GetSamplerAddressMode(const Texture::AddressMode addressMode)
     {
-        return m_version;
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (addressMode)
+        {
+            case Texture::AddressMode::Repeat:         return GL_REPEAT;
+            case Texture::AddressMode::MirroredRepeat: return GL_MIRRORED_REPEAT;
+            case Texture::AddressMode::ClampToEdge:    return GL_CLAMP_TO_EDGE;
+        }
+        throw Exception("Provided address mode is not supported by the OpenGL renderer.");
+        MOLTEN_UNSCOPED_ENUM_END
     }
 
-    uint32_t OpenGLX11Renderer::GetPushConstantLocation(Pipeline* /*pipeline*/, const uint32_t /*id*/)
+    static bool GetVertexAttributeFormat(const Shader::VariableDataType format, GLint& componentCount, GLenum& componentType, GLuint& formatSize)
     {
-        return 0;
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (format)
+        {
+            case Shader::VariableDataType::Bool:         componentCount = 1; componentType = GL_UNSIGNED_BYTE; formatSize = 1;  return true;
+            case Shader::VariableDataType::Int32:        componentCount = 1; componentType = GL_INT;           formatSize = 4;  return true;
+            case Shader::VariableDataType::Float32:      componentCount = 1; componentType = GL_FLOAT;         formatSize = 4;  return true;
+            case Shader::VariableDataType::Vector2f32:   componentCount = 2; componentType = GL_FLOAT;         formatSize = 8;  return true;
+            case Shader::VariableDataType::Vector3f32:   componentCount = 3; componentType = GL_FLOAT;         formatSize = 12; return true;
+            case Shader::VariableDataType::Vector4f32:   componentCount = 4; componentType = GL_FLOAT;         formatSize = 16; return true;
+            case Shader::VariableDataType::Matrix4x4f32: componentCount = 4; componentType = GL_FLOAT;         formatSize = 64; return true;
+        }
+        return false;
+        MOLTEN_UNSCOPED_ENUM_END
     }
 
-    //std::vector<uint8_t> OpenGLX11Renderer::CompileShader(const ShaderFormat /*inputFormat*/, const ShaderType /*inputType*/,
-    //                                                      const std::vector<uint8_t>& /*inputData*/, const ShaderFormat /*outputFormat*/)
-    //{
-    //    return {};
-    //}
-
-    Framebuffer* OpenGLX11Renderer::CreateFramebuffer(const FramebufferDescriptor&)
+    static size_t AlignSize(const size_t size, const size_t alignment)
     {
-        return nullptr;
+        return ((size + alignment - 1) / alignment) * alignment;
     }
 
-    IndexBuffer* OpenGLX11Renderer::CreateIndexBuffer(const IndexBufferDescriptor& /*descriptor*/)
+    static size_t GetIndexBufferDataTypeSize(const IndexBuffer::DataType dataType)
     {
-        return nullptr;
+        return dataType == IndexBuffer::DataType::Uint16 ? sizeof(uint16_t) : sizeof(uint32_t);
     }
 
-    Pipeline* OpenGLX11Renderer::CreatePipeline(const PipelineDescriptor& /*descriptor*/)
+    template<typename TFrame>
+    static bool CreateDynamicBufferFrames(std::vector<TFrame>& frames, const size_t frameCount, const size_t frameSize, const void* data)
     {
-        return nullptr;
-    }
+        // Every frame in flight writes to its own buffer, the buffers read by previous frames are left untouched.
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        const GLsizeiptr bufferSize = static_cast<GLsizeiptr>(std::max(frameSize, size_t(1)));
 
-    Texture* OpenGLX11Renderer::CreateTexture()
-    {
-        return nullptr;
+        frames.resize(frameCount, TFrame{ 0, nullptr });
+        for (auto& frame : frames)
+        {
+            OpenGL::CreateBuffers(1, &frame.buffer);
+            OpenGL::NamedBufferStorage(frame.buffer, bufferSize, nullptr, flags);
+            frame.mappedData = static_cast<uint8_t*>(OpenGL::MapNamedBufferRange(frame.buffer, 0, bufferSize, flags));
+            if (!frame.mappedData)
+            {
+                return false;
+            }
+            if (data)
+            {
+                std::memcpy(frame.mappedData, data, frameSize);
+            }
+        }
+        return true;
     }
 
-    UniformBlock* OpenGLX11Renderer::CreateUniformBlock(const UniformBlockDescriptor&)
+    template<typename TFrame>
+    static void DestroyDynamicBufferFrames(std::vector<TFrame>& frames)
     {
-        return nullptr;
+        for (auto& frame : frames)
+        {
+            if (frame.mappedData)
+            {
+                OpenGL::UnmapNamedBuffer(frame.buffer);
+            }
+            OpenGL::DeleteBuffers(1, &frame.buffer);
+        }
+        frames.clear();
     }
 
-    UniformBuffer* OpenGLX11Renderer::CreateUniformBuffer(const UniformBufferDescriptor&)
-    {
-        return nullptr;
-    }
+    /**
+     * Compute shader culling draw commands against frustum planes, one command per invocation.
+     * Planes are tested in the same order and with the same operations as FrustumCuller, precise prevents fused operations.
+     * Visible commands are appended to the cleared output by incrementing the draw count, following the commands, in unspecified order.
+     */
+    static constexpr GLchar s_cullShaderSource[] =
+        "#version 450\n"
+        "layout(local_size_x = 64) in;\n"
+        "layout(std430, binding = 0) readonly buffer SourceCommands { uint sourceCommands[]; };\n"
+        "layout(std430, binding = 1) readonly buffer Bounds { vec4 bounds[]; };\n"
+        "layout(std430, binding = 2) buffer VisibleCommands { uint visibleCommands[]; };\n"
+        "layout(location = 0) uniform vec4 planes[6];\n"
+        "layout(location = 6) uniform uint commandCount;\n"
+        "void main()\n"
+        "{\n"
+        "    const uint index = gl_GlobalInvocationID.x;\n"
+        "    if (index >= commandCount) { return; }\n"
+        "    const vec4 sphere = bounds[index * 2];\n"
+        "    const vec4 extents = bounds[index * 2 + 1];\n"
+        "    for (int i = 0; i < 6; i++)\n"
+        "    {\n"
+        "        const vec4 plane = planes[i];\n"
+        "        precise float distance = plane.x * sphere.x + plane.y * sphere.y + plane.z * sphere.z + plane.w;\n"
+        "        precise float reach = sphere.w + abs(plane.x) * extents.x + abs(plane.y) * extents.y + abs(plane.z) * extents.z;\n"
+        "        if (!(distance + reach >= 0.0)) { return; }\n"
+        "    }\n"
+        "    const uint slot = atomicAdd(visibleCommands[commandCount * 5], 1u);\n"
+        "    for (uint i = 0; i < 5; i++) { visibleCommands[slot * 5 + i] = sourceCommands[index * 5 + i]; }\n"
+        "}\n";
 
-    VertexBuffer* OpenGLX11Renderer::CreateVertexBuffer(const VertexBufferDescriptor&)
-    {
-        return nullptr;
-    }
+    static bool s_contextError = false;
 
-    void OpenGLX11Renderer::DestroyFramebuffer(Framebuffer*)
+    static int CatchContextError(::Display*, XErrorEvent*)
     {
+        s_contextError = true;
+        return 0;
     }
 
-    void OpenGLX11Renderer::DestroyIndexBuffer(IndexBuffer* /*indexBuffer*/)
+
+    // OpenGL X11 renderer class implementations.
+    OpenGLX11Renderer::OpenGLX11Renderer() :
+        m_logger(nullptr),
+        m_version(0, 0, 0),
+        m_display(nullptr),
+        m_ownsDisplay(false),
+        m_window(0),
+        m_pbuffer(0),
+        m_context(nullptr),
+        m_swapInterval(nullptr),
+        m_offscreen(false),
+        m_size(0, 0),
+        m_offscreenFramebuffer(0),
+        m_offscreenRenderbuffer(0),
+        m_readbackAvailable(false),
+        m_presentMode(PresentMode::Fifo),
+        m_spirvSupport(false),
+        m_drawCountSupport(false),
+        m_anisotropySupport(false),
+        m_uniformBufferAlignment(256),
+        m_storageBufferAlignment(256),
+        m_cullProgram(0),
+        m_pushConstantUniformBuffer(0),
+        m_pushConstantData(nullptr),
+        m_frames(DefaultFramesInFlight),
+        m_requestedMaxFramesInFlight(0),
+        m_currentFrame(0),
+        m_frameCount(0),
+        m_beginDraw(false),
+        m_markerDepth(0),
+        m_frameInputTimeWarned(false),
+        m_inlineCommandBuffer(this),
+        m_currentPipeline(nullptr),
+        m_currentVertexBuffers{ nullptr, nullptr },
+        m_currentIndexBuffer(nullptr),
+        m_pushConstantBoundSize(0)
     {
     }
 
-    void OpenGLX11Renderer::DestroyPipeline(Pipeline* /*shader*/)
+    OpenGLX11Renderer::OpenGLX11Renderer(const Window& window, const Version& version, Logger* logger) :
+        OpenGLX11Renderer()
     {
+        Open(window, version, logger);
     }
 
-    void OpenGLX11Renderer::DestroyTexture(Texture*)
+    OpenGLX11Renderer::~OpenGLX11Renderer()
     {
+        Close();
     }
 
-    void OpenGLX11Renderer::DestroyUniformBlock(UniformBlock* /*uniformBlock*/)
+    bool OpenGLX11Renderer::Open(const Window& window, const Version& version, Logger* logger)
     {
+        Close();
+
+        m_logger = logger;
+        m_display = window.GetX11DisplayDevice();
+        m_window = window.GetX11WindowDevice();
+        m_size = window.GetSize();
+
+        if (!m_display || !m_window)
+        {
+            Logger::WriteError(m_logger, "Cannot open OpenGL renderer, X11 display or window of window is missing.");
+            Close();
+            return false;
+        }
+
+        int glxMajor = 0;
+        int glxMinor = 0;
+        if (!glXQueryVersion(m_display, &glxMajor, &glxMinor) || (glxMajor == 1 && glxMinor < 3))
+        {
+            Logger::WriteError(m_logger, "GLX 1.3 or later is required by the OpenGL renderer.");
+            Close();
+            return false;
+        }
+
+        static const int framebufferAttributes[] =
+        {
+            GLX_X_RENDERABLE, True,
+            GLX_DRAWABLE_TYPE, GLX_WINDOW_BIT,
+            GLX_RENDER_TYPE, GLX_RGBA_BIT,
+            GLX_X_VISUAL_TYPE, GLX_TRUE_COLOR,
+            GLX_RED_SIZE, 8,
+            GLX_GREEN_SIZE, 8,
+            GLX_BLUE_SIZE, 8,
+            GLX_ALPHA_SIZE, 8,
+            GLX_DOUBLEBUFFER, True,
+            0
+        };
+
+        int framebufferConfigCount = 0;
+        GLXFBConfig* framebufferConfigs = glXChooseFBConfig(m_display, window.GetX11ScreenDevice(), framebufferAttributes, &framebufferConfigCount);
+        if (!framebufferConfigs || framebufferConfigCount == 0)
+        {
+            Logger::WriteError(m_logger, "Failed to find any GLX framebuffer configuration for the window.");
+            Close();
+            return false;
+        }
+
+        // The context must be compatible with the visual the window was created with.
+        XWindowAttributes windowAttributes;
+        XGetWindowAttributes(m_display, m_window, &windowAttributes);
+        const VisualID windowVisualId = XVisualIDFromVisual(windowAttributes.visual);
+
+        GLXFBConfig framebufferConfig = framebufferConfigs[0];
+        for (int i = 0; i < framebufferConfigCount; i++)
+        {
+            XVisualInfo* visualInfo = glXGetVisualFromFBConfig(m_display, framebufferConfigs[i]);
+            const bool matchingVisual = visualInfo && visualInfo->visualid == windowVisualId;
+            if (visualInfo)
+            {
+                XFree(visualInfo);
+            }
+            if (matchingVisual)
+            {
+                framebufferConfig = framebufferConfigs[i];
+                break;
+            }
+        }
+        XFree(framebufferConfigs);
+
+        if (!LoadContext(framebufferConfig, m_window, version))
+        {
+            Close();
+            return false;
+        }
+
+        const char* glxExtensions = glXQueryExtensionsString(m_display, window.GetX11ScreenDevice());
+        if (glxExtensions && std::strstr(glxExtensions, "GLX_EXT_swap_control"))
+        {
+            m_swapInterval = reinterpret_cast<PFNGLXSWAPINTERVALEXTPROC>(glXGetProcAddressARB(reinterpret_cast<const GLubyte*>("glXSwapIntervalEXT")));
+        }
+        ApplyPresentMode();
+
+        return true;
     }
 
-    void OpenGLX11Renderer::DestroyUniformBuffer(UniformBuffer* /*uniformBuffer*/)
+    bool OpenGLX11Renderer::OpenOffscreen(const Vector2ui32& size, const Version& version, Logger* logger)
     {
+        Close();
+
+        m_logger = logger;
+        m_offscreen = true;
+        m_size = size;
+
+        m_display = XOpenDisplay(nullptr);
+        if (!m_display)
+        {
+            Logger::WriteError(m_logger, "Failed to open X11 display. Offscreen OpenGL rendering requires an X server, such as Xvfb.");
+            Close();
+            return false;
+        }
+        m_ownsDisplay = true;
+
+        int glxMajor = 0;
+        int glxMinor = 0;
+        if (!glXQueryVersion(m_display, &glxMajor, &glxMinor) || (glxMajor == 1 && glxMinor < 3))
+        {
+            Logger::WriteError(m_logger, "GLX 1.3 or later is required by the OpenGL renderer.");
+            Close();
+            return false;
+        }
+
+        static const int framebufferAttributes[] =
+        {
+            GLX_DRAWABLE_TYPE, GLX_PBUFFER_BIT,
+            GLX_RENDER_TYPE, GLX_RGBA_BIT,
+            GLX_RED_SIZE, 8,
+            GLX_GREEN_SIZE, 8,
+            GLX_BLUE_SIZE, 8,
+            GLX_ALPHA_SIZE, 8,
+            0
+        };
+
+        int framebufferConfigCount = 0;
+        GLXFBConfig* framebufferConfigs = glXChooseFBConfig(m_display, DefaultScreen(m_display), framebufferAttributes, &framebufferConfigCount);
+        if (!framebufferConfigs || framebufferConfigCount == 0)
+        {
+            Logger::WriteError(m_logger, "Failed to find any GLX framebuffer configuration for pixel buffers.");
+            Close();
+            return false;
+        }
+        GLXFBConfig framebufferConfig = framebufferConfigs[0];
+        XFree(framebufferConfigs);
+
+        // Frames are rendered to a framebuffer object, the pixel buffer is only used for making the context current.
+        static const int pbufferAttributes[] =
+        {
+            GLX_PBUFFER_WIDTH, 1,
+            GLX_PBUFFER_HEIGHT, 1,
+            0
+        };
+
+        m_pbuffer = glXCreatePbuffer(m_display, framebufferConfig, pbufferAttributes);
+        if (!m_pbuffer)
+        {
+            Logger::WriteError(m_logger, "Failed to create GLX pixel buffer.");
+            Close();
+            return false;
+        }
+
+        if (!LoadContext(framebufferConfig, m_pbuffer, version) || !LoadOffscreenFramebuffer())
+        {
+            Close();
+            return false;
+        }
+
+        return true;
     }
 
-    void OpenGLX11Renderer::DestroyVertexBuffer(VertexBuffer* /*vertexBuffer*/)
+    void OpenGLX11Renderer::Close()
     {
+        UnloadContext();
+
+        if (m_pbuffer)
+        {
+            glXDestroyPbuffer(m_display, m_pbuffer);
+            m_pbuffer = 0;
+        }
+        if (m_ownsDisplay && m_display)
+        {
+            XCloseDisplay(m_display);
+        }
+
+        m_logger = nullptr;
+        m_version = { 0, 0, 0 };
+        m_display = nullptr;
+        m_ownsDisplay = false;
+        m_window = 0;
+        m_swapInterval = nullptr;
+        m_offscreen = false;
+        m_size = { 0, 0 };
+        m_readbackAvailable = false;
+        m_inlineCommandBuffer.stream.Clear();
+        m_inlineCommandBuffer.recording = false;
+        m_frameCount = 0;
+        m_currentFrame = 0;
+        m_beginDraw = false;
+        m_markerDepth = 0;
+        m_frameBindStatistics.Clear();
+        m_bindStatistics.Clear();
     }
 
-    void OpenGLX11Renderer::BindPipeline(Pipeline* /*pipeline*/)
+    void OpenGLX11Renderer::Resize(const Vector2ui32& size)
     {
+        if (size == m_size)
+        {
+            return;
+        }
+
+        m_size = size;
+
+        // The default framebuffer of windows follows the window size, only the viewport is set by BeginDraw.
+        if (m_offscreen && m_context)
+        {
+            UnloadOffscreenFramebuffer();
+            LoadOffscreenFramebuffer();
+        }
     }
 
-    void OpenGLX11Renderer::BindUniformBlock(UniformBlock* /*uniformBlock*/, const uint32_t /*offset*/)
+    Renderer::BackendApi OpenGLX11Renderer::GetBackendApi() const
     {
+        return Renderer::BackendApi::OpenGL;
     }
 
-    void OpenGLX11Renderer::BeginDraw()
+    Version OpenGLX11Renderer::GetVersion() const
     {
+        return m_version;
     }
 
-    void OpenGLX11Renderer::DrawVertexBuffer(VertexBuffer* /*vertexBuffer*/)
+    BindStatistics OpenGLX11Renderer::GetBindStatistics() const
     {
+        return m_bindStatistics;
     }
 
-    void OpenGLX11Renderer::DrawVertexBuffer(IndexBuffer* /*indexBuffer*/, VertexBuffer* /*vertexBuffer*/)
+    const FrameProfiler* OpenGLX11Renderer::GetFrameProfiler() const
     {
+        return nullptr;
     }
 
-    void OpenGLX11Renderer::PushConstant(const uint32_t /*location*/, const bool& /*value*/)
+    void OpenGLX11Renderer::SetPresentMode(const PresentMode presentMode)
     {
+        m_presentMode = presentMode;
+        ApplyPresentMode();
     }
-    void OpenGLX11Renderer::PushConstant(const uint32_t /*location*/, const int32_t& /*value*/)
+
+    Renderer::PresentMode OpenGLX11Renderer::GetPresentMode() const
     {
+        return m_presentMode == PresentMode::Immediate && m_swapInterval ? PresentMode::Immediate : PresentMode::Fifo;
     }
-    void OpenGLX11Renderer::PushConstant(const uint32_t /*location*/, const float& /*value*/)
+
+    void OpenGLX11Renderer::SetMaxFramesInFlight(const size_t maxFramesInFlight)
     {
+        m_requestedMaxFramesInFlight = maxFramesInFlight;
     }
-    void OpenGLX11Renderer::PushConstant(const uint32_t /*location*/, const Vector2f32& /*value*/)
+
+    size_t OpenGLX11Renderer::GetMaxFramesInFlight() const
     {
+        return m_frames.size();
     }
-    void OpenGLX11Renderer::PushConstant(const uint32_t /*location*/, const Vector3f32& /*value*/)
+
+    void OpenGLX11Renderer::SetFrameInputTime(const Time& /*inputTime*/)
     {
+        if (!m_frameInputTimeWarned)
+        {
+            Logger::WriteWarning(m_logger, "Frame input time is not supported by the OpenGL renderer, there is no frame profiler.");
+            m_frameInputTimeWarned = true;
+        }
     }
-    void OpenGLX11Renderer::PushConstant(const uint32_t /*location*/, const Vector4f32& /*value*/)
+
+    uint32_t OpenGLX11Renderer::GetPushConstantLocation(Pipeline* pipeline, const uint32_t id)
     {
+        auto& locations = static_cast<OpenGLPipeline*>(pipeline)->pushConstantLocations;
+        auto it = locations.find(id);
+        if (it == locations.end())
+        {
+            return 10000000;
+        }
+
+        return it->second;
     }
-    void OpenGLX11Renderer::PushConstant(const uint32_t /*location*/, const Matrix4x4f32& /*value*/)
+
+    void OpenGLX11Renderer::SetCacheDirectory(const std::string& /*directory*/)
     {
     }
 
-    void OpenGLX11Renderer::EndDraw()
+    CommandBuffer* OpenGLX11Renderer::CreateCommandBuffer()
     {
+        return new OpenGLCommandBuffer(this);
     }
 
-    void OpenGLX11Renderer::WaitForDevice()
+    Framebuffer* OpenGLX11Renderer::CreateFramebuffer(const FramebufferDescriptor& /*descriptor*/)
     {
+        Logger::WriteError(m_logger, "Framebuffers are not supported by the OpenGL renderer.");
+        return nullptr;
     }
 
-    void OpenGLX11Renderer::UpdateUniformBuffer(UniformBuffer* /*uniformBuffer*/, const size_t /*offset*/, const size_t /*size*/, const void* /*data*/)
+    IndexBuffer* OpenGLX11Renderer::CreateIndexBuffer(const IndexBufferDescriptor& descriptor)
     {
+        const size_t bufferSize = static_cast<size_t>(descriptor.indexCount) * GetIndexBufferDataTypeSize(descriptor.dataType);
+
+        OpenGLIndexBuffer* indexBuffer = new OpenGLIndexBuffer;
+        indexBuffer->buffer = 0;
+        indexBuffer->indexCount = descriptor.indexCount;
+        indexBuffer->capacity = descriptor.indexCount;
+        indexBuffer->dataType = GetIndexBufferDataType(descriptor.dataType);
+
+        if (descriptor.usage == IndexBuffer::Usage::Dynamic)
+        {
+            if (!CreateDynamicBufferFrames(indexBuffer->frames, MaxFramesInFlight, bufferSize, descriptor.data))
+            {
+                Logger::WriteError(m_logger, "Failed to map dynamic index buffer.");
+                DestroyIndexBuffer(indexBuffer);
+                return nullptr;
+            }
+            indexBuffer->indexCount = descriptor.data ? descriptor.indexCount : 0;
+            return indexBuffer;
+        }
+
+        OpenGL::CreateBuffers(1, &indexBuffer->buffer);
+        OpenGL::NamedBufferStorage(indexBuffer->buffer, static_cast<GLsizeiptr>(bufferSize), descriptor.data, 0);
+        return indexBuffer;
     }
 
-    /*bool RendererOpenGLWin32::OpenVersion(HDC deviceContext, const Version& version)
+    IndirectBuffer* OpenGLX11Renderer::CreateIndirectBuffer(const IndirectBufferDescriptor& descriptor)
     {
-        PFNWGLCREATECONTEXTATTRIBSARBPROC wglCreateContextAttribsARB = NULL;
-        if ((wglCreateContextAttribsARB = (PFNWGLCREATECONTEXTATTRIBSARBPROC)wglGetProcAddress("wglCreateContextAttribsARB")) == NULL)
+        if (!descriptor.commandCount)
         {
-            throw Exception("Cannot get address of wglCreateContextAttribsARB.");
+            Logger::WriteError(m_logger, "Cannot create indirect buffer without any commands.");
+            return nullptr;
         }
 
-        const int attributes[] =
+        // Commands are followed by the draw count, written by the device or at creation.
+        // Frame regions are aligned for binding as storage buffers when culled.
+        const size_t countOffset = static_cast<size_t>(descriptor.commandCount) * sizeof(DrawIndexedIndirectCommand);
+        const size_t frameSize = AlignSize(countOffset + sizeof(uint32_t), m_storageBufferAlignment);
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        GLuint buffer = 0;
+        OpenGL::CreateBuffers(1, &buffer);
+        OpenGL::NamedBufferStorage(buffer, static_cast<GLsizeiptr>(frameSize * MaxFramesInFlight), nullptr, flags);
+        auto* mappedData = static_cast<uint8_t*>(OpenGL::MapNamedBufferRange(buffer, 0, static_cast<GLsizeiptr>(frameSize * MaxFramesInFlight), flags));
+        if (!mappedData)
         {
-            WGL_CONTEXT_MAJOR_VERSION_ARB, static_cast<int>(version.Major),
-            WGL_CONTEXT_MINOR_VERSION_ARB, static_cast<int>(version.Minor),
-            0
-        };
+            OpenGL::DeleteBuffers(1, &buffer);
+            Logger::WriteError(m_logger, "Failed to map indirect buffer.");
+            return nullptr;
+        }
 
-        if ((m_context = wglCreateContextAttribsARB(deviceContext, 0, attributes)) == NULL)
+        for (size_t i = 0; i < MaxFramesInFlight; i++)
         {
-            throw Exception("Failed to create OpenGL context version " + version.AsString());
+            auto* data = mappedData + (i * frameSize);
+            if (descriptor.commands)
+            {
+                std::memcpy(data, descriptor.commands, countOffset);
+            }
+            else
+            {
+                std::memset(data, 0, countOffset);
+            }
+            std::memcpy(data + countOffset, &descriptor.commandCount, sizeof(uint32_t));
         }
 
-        return true;
-    }*/
+        OpenGLIndirectBuffer* indirectBuffer = new OpenGLIndirectBuffer;
+        indirectBuffer->buffer = buffer;
+        indirectBuffer->mappedData = mappedData;
+        indirectBuffer->frameSize = frameSize;
+        indirectBuffer->commandCount = descriptor.commandCount;
+        indirectBuffer->countOffset = countOffset;
+        indirectBuffer->sourceBuffer = 0;
+        indirectBuffer->boundsBuffer = 0;
+
+        if (descriptor.commands && descriptor.bounds)
+        {
+            OpenGL::CreateBuffers(1, &indirectBuffer->sourceBuffer);
+            OpenGL::NamedBufferStorage(indirectBuffer->sourceBuffer, static_cast<GLsizeiptr>(countOffset), descriptor.commands, 0);
+            OpenGL::CreateBuffers(1, &indirectBuffer->boundsBuffer);
+            OpenGL::NamedBufferStorage(indirectBuffer->boundsBuffer,
+                static_cast<GLsizeiptr>(descriptor.commandCount * sizeof(BoundingVolume)), descriptor.bounds, 0);
+        }
+        return indirectBuffer;
+    }
 
-    /*void RendererOpenGLWin32::OpenBestVersion(HDC deviceContext, Version& version)
+    Pipeline* OpenGLX11Renderer::CreatePipeline(const PipelineDescriptor& descriptor)
     {
+        if (!m_spirvSupport)
+        {
+            Logger::WriteError(m_logger, "SPIR-V shaders are not supported by the OpenGL device, GL_ARB_gl_spirv is required.");
+            return nullptr;
+        }
+        if (descriptor.vertexScript == nullptr)
+        {
+            Logger::WriteError(m_logger, "Vertex script is missing for pipeline. (vertexScript == nullptr).");
+            return nullptr;
+        }
+        if (descriptor.fragmentScript == nullptr)
+        {
+            Logger::WriteError(m_logger, "Fragment script is missing for pipeline. (fragmentScript == nullptr).");
+            return nullptr;
+        }
 
-        // USE VECTOR AND USE FOR EACH LOOP!
+        auto& vertexScript = *descriptor.vertexScript;
+        auto& fragmentScript = *descriptor.fragmentScript;
 
-        static const size_t versionCount = 13;
-        static const Version versions[versionCount] =
+        if (!vertexScript.GetOutputInterface().CheckCompability(fragmentScript.GetInputInterface()))
         {
-            Version(4, 9),
-            Version(4, 5),
-            Version(4, 4),
-            Version(4, 3),
-            Version(4, 2),
-            Version(4, 1),
-            Version(4, 0),
-            Version(3, 3),
-            Version(3, 2),
-            Version(3, 1),
-            Version(3, 0),
-            Version(2, 1),
-            Version(2, 0)
+            Logger::WriteError(m_logger, "Vertex output structure is not compatible with fragment input structure.");
+            return nullptr;
+        }
+
+        const std::vector<Shader::Visual::Script*> shaderScripts =
+        {
+            descriptor.vertexScript, descriptor.fragmentScript
         };
 
-        version = Version::None;
+        std::unique_ptr<OpenGLPipeline, std::function<void(OpenGLPipeline*)> > pipeline(new OpenGLPipeline,
+            [&](OpenGLPipeline* pipelineToDestroy)
+        {
+            DestroyPipeline(pipelineToDestroy);
+        });
+        pipeline->program = 0;
+        pipeline->vertexArray = 0;
+
+        if (!LoadShaderProgram(shaderScripts, *pipeline))
+        {
+            return nullptr;
+        }
+
+        // Binding 0 is stepped per vertex, binding 1 per instance and only present if the script has instance inputs.
+        OpenGL::CreateVertexArrays(1, &pipeline->vertexArray);
+        pipeline->vertexStrides[0] = 0;
+        pipeline->vertexStrides[1] = 0;
 
-        for (size_t i = 0; i < versionCount; i++)
+        GLuint location = 0;
+        if (!LoadVertexArray(vertexScript.GetInputInterface(), pipeline->vertexArray, 0, location, pipeline->vertexStrides[0]))
         {
-            try
+            return nullptr;
+        }
+
+        auto* instanceInputs = vertexScript.GetInstanceInputInterface();
+        if (instanceInputs)
+        {
+            if (!LoadVertexArray(*instanceInputs, pipeline->vertexArray, 1, location, pipeline->vertexStrides[1]))
             {
-                if (OpenVersion(deviceContext, versions[i]))
-                {
-                    version = versions[i];
-                    return;
-                }
+                return nullptr;
             }
-            catch (Exception & e)
+            OpenGL::VertexArrayBindingDivisor(pipeline->vertexArray, 1, 1);
+        }
+
+        std::set<uint32_t> uniformSetIds;
+        for (auto* script : shaderScripts)
+        {
+            for (auto* uniformInterface : script->GetUniformInterfaces())
             {
-                if (i < versionCount - 1)
-                {
-                    continue;
-                }
-                throw Exception("RendererOpenGLWin32: Failed to create best OpenGL context, last error: " + e.GetMessage());
+                uniformSetIds.insert(uniformInterface->GetId());
+            }
+        }
+
+        pipeline->topology = GetPrimitiveTopology(descriptor.topology);
+        pipeline->polygonMode = GetPolygonMode(descriptor.polygonMode);
+        pipeline->frontFace = GetFrontFace(descriptor.frontFace);
+        pipeline->cullMode = GetCullMode(descriptor.cullMode);
+        pipeline->uniformSetCount = static_cast<uint32_t>(uniformSetIds.size());
+
+        return pipeline.release();
+    }
+
+    std::future<Pipeline*> OpenGLX11Renderer::CreatePipelineAsync(const PipelineDescriptor& descriptor)
+    {
+        std::promise<Pipeline*> promise;
+        promise.set_value(CreatePipeline(descriptor));
+        return promise.get_future();
+    }
+
+    Texture* OpenGLX11Renderer::CreateTexture(const TextureDescriptor& descriptor)
+    {
+        if (descriptor.dimensions.x == 0 || descriptor.dimensions.y == 0)
+        {
+            Logger::WriteError(m_logger, "Cannot create texture without any texels.");
+            return nullptr;
+        }
+
+        GLenum internalFormat = GL_NONE;
+        GLenum pixelFormat = GL_NONE;
+        GLenum pixelType = GL_NONE;
+        if (!GetTextureFormat(descriptor.format, internalFormat, pixelFormat, pixelType))
+        {
+            Logger::WriteError(m_logger, "Provided texture format is not supported by the OpenGL renderer.");
+            return nullptr;
+        }
+
+        const uint32_t mipLevelCount = descriptor.mipLevelCount ? descriptor.mipLevelCount : Texture::GetMipLevelCount(descriptor.dimensions);
+
+        GLuint texture = 0;
+        OpenGL::CreateTextures(GL_TEXTURE_2D, 1, &texture);
+        OpenGL::TextureStorage2D(texture, static_cast<GLsizei>(mipLevelCount), internalFormat,
+            static_cast<GLsizei>(descriptor.dimensions.x), static_cast<GLsizei>(descriptor.dimensions.y));
+
+        // Mip levels are tightly packed, streamed textures are uploaded at once.
+        if (descriptor.data)
+        {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+            auto* levelData = static_cast<const uint8_t*>(descriptor.data);
+            for (uint32_t level = 0; level < mipLevelCount; level++)
+            {
+                const auto levelDimensions = Texture::GetMipLevelDimensions(descriptor.dimensions, level);
+                OpenGL::TextureSubImage2D(texture, static_cast<GLint>(level), 0, 0,
+                    static_cast<GLsizei>(levelDimensions.x), static_cast<GLsizei>(levelDimensions.y), pixelFormat, pixelType, levelData);
+                levelData += Texture::GetMipChainSize(descriptor.dimensions, descriptor.format, level, 1);
             }
         }
-    }*/
+
+        const auto& samplerDescriptor = descriptor.sampler;
+
+        GLuint sampler = 0;
+        OpenGL::CreateSamplers(1, &sampler);
+        OpenGL::SamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, samplerDescriptor.magFilter == Texture::Filter::Nearest ? GL_NEAREST : GL_LINEAR);
+        OpenGL::SamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GetSamplerMinFilter(samplerDescriptor.minFilter, samplerDescriptor.mipmapFilter));
+        OpenGL::SamplerParameteri(sampler, GL_TEXTURE_WRAP_S, GetSamplerAddressMode(samplerDescriptor.addressModeU));
+        OpenGL::SamplerParameteri(sampler, GL_TEXTURE_WRAP_T, GetSamplerAddressMode(samplerDescriptor.addressModeV));
+        if (m_anisotropySupport && samplerDescriptor.maxAnisotropy > 1.0f)
+        {
+            OpenGL::SamplerParameterf(sampler, GL_TEXTURE_MAX_ANISOTROPY, samplerDescriptor.maxAnisotropy);
+        }
+
+        OpenGLTexture* openGLTexture = new OpenGLTexture;
+        openGLTexture->texture = texture;
+        openGLTexture->sampler = sampler;
+        openGLTexture->dimensions = descriptor.dimensions;
+        openGLTexture->format = descriptor.format;
+        return openGLTexture;
+    }
+
+    UniformBlock* OpenGLX11Renderer::CreateUniformBlock(const UniformBlockDescriptor& descriptor)
+    {
+        OpenGLPipeline* openGLPipeline = static_cast<OpenGLPipeline*>(descriptor.pipeline);
+        if (descriptor.id >= openGLPipeline->uniformSetCount)
+        {
+            Logger::WriteError(m_logger, "Id of uniform descriptor block is too large.");
+            return nullptr;
+        }
+
+        OpenGLUniformBlock* uniformBlock = new OpenGLUniformBlock;
+        uniformBlock->buffer = static_cast<OpenGLUniformBuffer*>(descriptor.buffer);
+        uniformBlock->set = descriptor.id;
+        uniformBlock->size = descriptor.size;
+        return uniformBlock;
+    }
+
+    UniformBuffer* OpenGLX11Renderer::CreateUniformBuffer(const UniformBufferDescriptor& descriptor)
+    {
+        const size_t frameSize = AlignSize(std::max(static_cast<size_t>(descriptor.size), size_t(1)), m_uniformBufferAlignment);
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        GLuint buffer = 0;
+        OpenGL::CreateBuffers(1, &buffer);
+        OpenGL::NamedBufferStorage(buffer, static_cast<GLsizeiptr>(frameSize * MaxFramesInFlight), nullptr, flags);
+        auto* mappedData = static_cast<uint8_t*>(OpenGL::MapNamedBufferRange(buffer, 0, static_cast<GLsizeiptr>(frameSize * MaxFramesInFlight), flags));
+        if (!mappedData)
+        {
+            OpenGL::DeleteBuffers(1, &buffer);
+            Logger::WriteError(m_logger, "Failed to map uniform buffer.");
+            return nullptr;
+        }
+
+        OpenGLUniformBuffer* uniformBuffer = new OpenGLUniformBuffer;
+        uniformBuffer->buffer = buffer;
+        uniformBuffer->mappedData = mappedData;
+        uniformBuffer->size = static_cast<size_t>(descriptor.size);
+        uniformBuffer->frameSize = frameSize;
+        uniformBuffer->allocationOffset = 0;
+        uniformBuffer->allocationFrame = 0;
+        return uniformBuffer;
+    }
+
+    VertexBuffer* OpenGLX11Renderer::CreateVertexBuffer(const VertexBufferDescriptor& descriptor)
+    {
+        const size_t bufferSize = static_cast<size_t>(descriptor.vertexCount) * static_cast<size_t>(descriptor.vertexSize);
+
+        OpenGLVertexBuffer* vertexBuffer = new OpenGLVertexBuffer;
+        vertexBuffer->buffer = 0;
+        vertexBuffer->vertexCount = descriptor.vertexCount;
+        vertexBuffer->capacity = descriptor.vertexCount;
+        vertexBuffer->vertexSize = descriptor.vertexSize;
+
+        if (descriptor.usage == VertexBuffer::Usage::Dynamic)
+        {
+            if (!CreateDynamicBufferFrames(vertexBuffer->frames, MaxFramesInFlight, bufferSize, descriptor.data))
+            {
+                Logger::WriteError(m_logger, "Failed to map dynamic vertex buffer.");
+                DestroyVertexBuffer(vertexBuffer);
+                return nullptr;
+            }
+            vertexBuffer->vertexCount = descriptor.data ? descriptor.vertexCount : 0;
+            return vertexBuffer;
+        }
+
+        OpenGL::CreateBuffers(1, &vertexBuffer->buffer);
+        OpenGL::NamedBufferStorage(vertexBuffer->buffer, static_cast<GLsizeiptr>(bufferSize), descriptor.data, 0);
+        return vertexBuffer;
+    }
+
+    void OpenGLX11Renderer::DestroyCommandBuffer(CommandBuffer* commandBuffer)
+    {
+        delete static_cast<OpenGLCommandBuffer*>(commandBuffer);
+    }
+
+    void OpenGLX11Renderer::DestroyFramebuffer(Framebuffer* /*framebuffer*/)
+    {
+    }
+
+    void OpenGLX11Renderer::DestroyIndexBuffer(IndexBuffer* indexBuffer)
+    {
+        OpenGLIndexBuffer* openGLIndexBuffer = static_cast<OpenGLIndexBuffer*>(indexBuffer);
+        DestroyDynamicBufferFrames(openGLIndexBuffer->frames);
+        if (openGLIndexBuffer->buffer)
+        {
+            OpenGL::DeleteBuffers(1, &openGLIndexBuffer->buffer);
+        }
+        delete openGLIndexBuffer;
+    }
+
+    void OpenGLX11Renderer::DestroyIndirectBuffer(IndirectBuffer* indirectBuffer)
+    {
+        OpenGLIndirectBuffer* openGLIndirectBuffer = static_cast<OpenGLIndirectBuffer*>(indirectBuffer);
+        OpenGL::UnmapNamedBuffer(openGLIndirectBuffer->buffer);
+        OpenGL::DeleteBuffers(1, &openGLIndirectBuffer->buffer);
+        if (openGLIndirectBuffer->sourceBuffer)
+        {
+            OpenGL::DeleteBuffers(1, &openGLIndirectBuffer->sourceBuffer);
+            OpenGL::DeleteBuffers(1, &openGLIndirectBuffer->boundsBuffer);
+        }
+        delete openGLIndirectBuffer;
+    }
+
+    void OpenGLX11Renderer::DestroyPipeline(Pipeline* pipeline)
+    {
+        OpenGLPipeline* openGLPipeline = static_cast<OpenGLPipeline*>(pipeline);
+        if (openGLPipeline->vertexArray)
+        {
+            OpenGL::DeleteVertexArrays(1, &openGLPipeline->vertexArray);
+        }
+        if (openGLPipeline->program)
+        {
+            OpenGL::DeleteProgram(openGLPipeline->program);
+        }
+        delete openGLPipeline;
+    }
+
+    void OpenGLX11Renderer::DestroyTexture(Texture* texture)
+    {
+        OpenGLTexture* openGLTexture = static_cast<OpenGLTexture*>(texture);
+        OpenGL::DeleteSamplers(1, &openGLTexture->sampler);
+        glDeleteTextures(1, &openGLTexture->texture);
+        delete openGLTexture;
+    }
+
+    void OpenGLX11Renderer::DestroyUniformBlock(UniformBlock* uniformBlock)
+    {
+        delete static_cast<OpenGLUniformBlock*>(uniformBlock);
+    }
+
+    void OpenGLX11Renderer::DestroyUniformBuffer(UniformBuffer* uniformBuffer)
+    {
+        OpenGLUniformBuffer* openGLUniformBuffer = static_cast<OpenGLUniformBuffer*>(uniformBuffer);
+        OpenGL::UnmapNamedBuffer(openGLUniformBuffer->buffer);
+        OpenGL::DeleteBuffers(1, &openGLUniformBuffer->buffer);
+        delete openGLUniformBuffer;
+    }
+
+    void OpenGLX11Renderer::DestroyVertexBuffer(VertexBuffer* vertexBuffer)
+    {
+        OpenGLVertexBuffer* openGLVertexBuffer = static_cast<OpenGLVertexBuffer*>(vertexBuffer);
+        DestroyDynamicBufferFrames(openGLVertexBuffer->frames);
+        if (openGLVertexBuffer->buffer)
+        {
+            OpenGL::DeleteBuffers(1, &openGLVertexBuffer->buffer);
+        }
+        delete openGLVertexBuffer;
+    }
+
+    void OpenGLX11Renderer::BindPipeline(Pipeline* pipeline)
+    {
+        m_inlineCommandBuffer.BindPipeline(pipeline);
+    }
+
+    void OpenGLX11Renderer::BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset)
+    {
+        m_inlineCommandBuffer.BindUniformBlock(uniformBlock, offset);
+    }
+
+    void OpenGLX11Renderer::BindUniformBuffer(Pipeline* pipeline, const uint32_t set, UniformBuffer* uniformBuffer, const uint32_t offset, const uint32_t size)
+    {
+        // Bound without going through the cache, a following bind of a uniform block to the same set must not be skipped.
+        m_inlineCommandBuffer.bindStateCache.InvalidateUniformBlock(set);
+
+        CommandStream::Command command(CommandStream::Opcode::BindUniformBuffer);
+        command.resources[0] = pipeline;
+        command.resources[1] = uniformBuffer;
+        command.values[0] = set;
+        command.values[1] = offset;
+        command.values[2] = size;
+        m_inlineCommandBuffer.stream.Write(command);
+    }
+
+    void OpenGLX11Renderer::BeginDraw()
+    {
+        if (m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Calling BeginDraw twice, without any previous call to EndDraw.");
+            return;
+        }
+        if (!m_context)
+        {
+            Logger::WriteError(m_logger, "Cannot begin drawing without any opened context.");
+            return;
+        }
+
+        ApplyMaxFramesInFlight();
+
+        // Host written regions of this frame are read by the device until the fence of its previous use is signaled.
+        m_currentFrame = static_cast<size_t>(m_frameCount % m_frames.size());
+        auto& frame = m_frames[m_currentFrame];
+        if (frame.fence)
+        {
+            GLenum waitResult = GL_TIMEOUT_EXPIRED;
+            while (waitResult == GL_TIMEOUT_EXPIRED)
+            {
+                waitResult = OpenGL::ClientWaitSync(frame.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+            }
+            if (waitResult == GL_WAIT_FAILED)
+            {
+                Logger::WriteError(m_logger, "Failed to wait for frame fence.");
+            }
+
+            OpenGL::DeleteSync(frame.fence);
+            frame.fence = nullptr;
+        }
+        frame.pushConstantOffset = 0;
+
+        OpenGL::BindFramebuffer(GL_DRAW_FRAMEBUFFER, m_offscreen ? m_offscreenFramebuffer : 0);
+        glViewport(0, 0, static_cast<GLsizei>(m_size.x), static_cast<GLsizei>(m_size.y));
+        glClearColor(0.3f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        m_currentPipeline = nullptr;
+        m_currentVertexBuffers[0] = nullptr;
+        m_currentVertexBuffers[1] = nullptr;
+        m_currentIndexBuffer = nullptr;
+        m_pushConstantBoundSize = 0;
+
+        m_frameBindStatistics.Clear();
+        m_markerDepth = 0;
+        m_inlineCommandBuffer.InternalBegin();
+
+        ++m_frameCount;
+        m_beginDraw = true;
+    }
+
+    void OpenGLX11Renderer::BindFramebuffer(Framebuffer* framebuffer)
+    {
+        if (framebuffer)
+        {
+            Logger::WriteError(m_logger, "Framebuffers are not supported by the OpenGL renderer.");
+        }
+    }
+
+    void OpenGLX11Renderer::ExecuteCommandBuffer(CommandBuffer* commandBuffer)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot execute command buffer without any previous call to BeginDraw.");
+            return;
+        }
+
+        OpenGLCommandBuffer* openGLCommandBuffer = static_cast<OpenGLCommandBuffer*>(commandBuffer);
+        if (openGLCommandBuffer->recording)
+        {
+            Logger::WriteError(m_logger, "Cannot execute command buffer which is still recording.");
+            return;
+        }
+
+        // Commands recorded directly on the renderer before this call are executed first.
+        FlushInlineCommands();
+
+        ExecuteCommandStream(openGLCommandBuffer->stream);
+        m_frameBindStatistics += openGLCommandBuffer->bindStateCache.GetStatistics();
+
+        m_inlineCommandBuffer.InternalBegin();
+    }
+
+    void OpenGLX11Renderer::DrawVertexBuffer(VertexBuffer* vertexBuffer)
+    {
+        m_inlineCommandBuffer.DrawVertexBuffer(vertexBuffer);
+    }
+
+    void OpenGLX11Renderer::DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer)
+    {
+        m_inlineCommandBuffer.DrawVertexBuffer(indexBuffer, vertexBuffer);
+    }
+
+    void OpenGLX11Renderer::DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount)
+    {
+        m_inlineCommandBuffer.DrawVertexBufferInstanced(vertexBuffer, instanceBuffer, instanceCount);
+    }
+
+    void OpenGLX11Renderer::DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount)
+    {
+        m_inlineCommandBuffer.DrawVertexBufferInstanced(indexBuffer, vertexBuffer, instanceBuffer, instanceCount);
+    }
+
+    void OpenGLX11Renderer::DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount)
+    {
+        m_inlineCommandBuffer.DrawVertexBufferIndirect(indexBuffer, vertexBuffer, instanceBuffer, indirectBuffer, drawCount);
+    }
+
+    void OpenGLX11Renderer::DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer)
+    {
+        m_inlineCommandBuffer.DrawVertexBufferIndirectCount(indexBuffer, vertexBuffer, instanceBuffer, indirectBuffer);
+    }
+
+    void OpenGLX11Renderer::PushConstant(const uint32_t location, const bool& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+    void OpenGLX11Renderer::PushConstant(const uint32_t location, const int32_t& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+    void OpenGLX11Renderer::PushConstant(const uint32_t location, const float& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+    void OpenGLX11Renderer::PushConstant(const uint32_t location, const Vector2f32& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+    void OpenGLX11Renderer::PushConstant(const uint32_t location, const Vector3f32& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+    void OpenGLX11Renderer::PushConstant(const uint32_t location, const Vector4f32& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+    void OpenGLX11Renderer::PushConstant(const uint32_t location, const Matrix4x4f32& value)
+    {
+        m_inlineCommandBuffer.PushConstant(location, value);
+    }
+
+    void OpenGLX11Renderer::EndDraw()
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Calling EndDraw, without any previous call to BeginDraw.");
+            return;
+        }
+
+        FlushInlineCommands();
+        m_inlineCommandBuffer.recording = false;
+
+        if (m_markerDepth > 0)
+        {
+            Logger::WriteWarning(m_logger, "Markers are still open at the end of frame.");
+            for (; m_markerDepth > 0; m_markerDepth--)
+            {
+                OpenGL::PopDebugGroup();
+            }
+        }
+
+        m_frames[m_currentFrame].fence = OpenGL::FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        if (m_offscreen)
+        {
+            glFlush();
+            m_readbackAvailable = true;
+        }
+        else
+        {
+            glXSwapBuffers(m_display, m_window);
+        }
+
+        m_bindStatistics = m_frameBindStatistics;
+        m_beginDraw = false;
+    }
+
+    void OpenGLX11Renderer::WaitForDevice()
+    {
+        if (m_context)
+        {
+            glFinish();
+        }
+    }
+
+    bool OpenGLX11Renderer::ReadRenderTarget(std::vector<uint8_t>& pixels)
+    {
+        if (!m_offscreen)
+        {
+            Logger::WriteError(m_logger, "Reading render target is only supported by offscreen renderers.");
+            return false;
+        }
+        if (m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot read render target while drawing.");
+            return false;
+        }
+        if (!m_readbackAvailable)
+        {
+            Logger::WriteError(m_logger, "Cannot read render target before any frame is rendered.");
+            return false;
+        }
+
+        const size_t rowSize = static_cast<size_t>(m_size.x) * 4;
+        pixels.resize(rowSize * static_cast<size_t>(m_size.y));
+
+        OpenGL::BindFramebuffer(GL_READ_FRAMEBUFFER, m_offscreenFramebuffer);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, static_cast<GLsizei>(m_size.x), static_cast<GLsizei>(m_size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+        // Rows are read bottom up, flip them to the top down order of the other renderers.
+        for (size_t top = 0, bottom = static_cast<size_t>(m_size.y) - 1; top < bottom; top++, bottom--)
+        {
+            std::swap_ranges(pixels.begin() + (top * rowSize), pixels.begin() + ((top + 1) * rowSize), pixels.begin() + (bottom * rowSize));
+        }
+
+        return true;
+    }
+
+    void OpenGLX11Renderer::CullIndirectBuffer(IndirectBuffer* indirectBuffer, const Frustum& frustum)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot cull indirect buffer without any previous call to BeginDraw.");
+            return;
+        }
+
+        OpenGLIndirectBuffer* openGLIndirectBuffer = static_cast<OpenGLIndirectBuffer*>(indirectBuffer);
+        if (!openGLIndirectBuffer->sourceBuffer)
+        {
+            Logger::WriteError(m_logger, "Cannot cull indirect buffer created without commands and bounding volumes.");
+            return;
+        }
+        if (!m_cullProgram)
+        {
+            Logger::WriteError(m_logger, "Cannot cull indirect buffer, culling program is not loaded.");
+            return;
+        }
+
+        const auto& planes = frustum.GetPlanes();
+        CommandStream::Command command(CommandStream::Opcode::CullIndirectBuffer);
+        command.resources[0] = indirectBuffer;
+        command.data = planes.data();
+        command.dataSize = static_cast<uint32_t>(planes.size() * sizeof(Vector4f32));
+        m_inlineCommandBuffer.stream.Write(command);
+    }
+
+    void OpenGLX11Renderer::UpdateIndirectBuffer(IndirectBuffer* indirectBuffer, const uint32_t firstCommand, const uint32_t commandCount, const DrawIndexedIndirectCommand* commands)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot update indirect buffer without any previous call to BeginDraw.");
+            return;
+        }
+
+        OpenGLIndirectBuffer* openGLIndirectBuffer = static_cast<OpenGLIndirectBuffer*>(indirectBuffer);
+
+        if (openGLIndirectBuffer->sourceBuffer)
+        {
+            Logger::WriteError(m_logger, "Cannot update indirect buffer created with bounding volumes, commands are written by culling.");
+            return;
+        }
+        if (static_cast<uint64_t>(firstCommand) + commandCount > openGLIndirectBuffer->commandCount)
+        {
+            Logger::WriteError(m_logger, "Trying to update indirect buffer out of bounds.");
+            return;
+        }
+
+        auto* frameData = openGLIndirectBuffer->mappedData + (m_currentFrame * openGLIndirectBuffer->frameSize);
+        std::memcpy(reinterpret_cast<DrawIndexedIndirectCommand*>(frameData) + firstCommand, commands, commandCount * sizeof(DrawIndexedIndirectCommand));
+    }
+
+    void OpenGLX11Renderer::UpdateIndirectBufferDrawCount(IndirectBuffer* indirectBuffer, const uint32_t drawCount)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot update indirect buffer without any previous call to BeginDraw.");
+            return;
+        }
+
+        OpenGLIndirectBuffer* openGLIndirectBuffer = static_cast<OpenGLIndirectBuffer*>(indirectBuffer);
+
+        if (openGLIndirectBuffer->sourceBuffer)
+        {
+            Logger::WriteError(m_logger, "Cannot update indirect buffer created with bounding volumes, commands are written by culling.");
+            return;
+        }
+        if (drawCount > openGLIndirectBuffer->commandCount)
+        {
+            Logger::WriteError(m_logger, "Trying to set draw count greater than number of commands in indirect buffer.");
+            return;
+        }
+
+        auto* frameData = openGLIndirectBuffer->mappedData + (m_currentFrame * openGLIndirectBuffer->frameSize);
+        std::memcpy(frameData + openGLIndirectBuffer->countOffset, &drawCount, sizeof(uint32_t));
+    }
+
+    void OpenGLX11Renderer::UpdateUniformBuffer(UniformBuffer* uniformBuffer, const size_t offset, const size_t size, const void* data)
+    {
+        OpenGLUniformBuffer* openGLUniformBuffer = static_cast<OpenGLUniformBuffer*>(uniformBuffer);
+
+        if (offset + size > openGLUniformBuffer->size)
+        {
+            Logger::WriteError(m_logger, "Trying to update uniform buffer out of bounds.");
+            return;
+        }
+
+        std::memcpy(openGLUniformBuffer->mappedData + (m_currentFrame * openGLUniformBuffer->frameSize) + offset, data, size);
+    }
+
+    bool OpenGLX11Renderer::AllocateUniformBufferData(UniformBuffer* uniformBuffer, const size_t size, const void* data, uint32_t& offset)
+    {
+        OpenGLUniformBuffer* openGLUniformBuffer = static_cast<OpenGLUniformBuffer*>(uniformBuffer);
+
+        // The region of the current frame is no longer in use by the device, reset allocations of previous draws.
+        if (openGLUniformBuffer->allocationFrame != m_frameCount)
+        {
+            openGLUniformBuffer->allocationFrame = m_frameCount;
+            openGLUniformBuffer->allocationOffset = 0;
+        }
+
+        const size_t alignedOffset = AlignSize(openGLUniformBuffer->allocationOffset, m_uniformBufferAlignment);
+        if (alignedOffset + size > openGLUniformBuffer->size)
+        {
+            Logger::WriteError(m_logger, "Uniform buffer is out of memory for the current frame.");
+            return false;
+        }
+
+        std::memcpy(openGLUniformBuffer->mappedData + (m_currentFrame * openGLUniformBuffer->frameSize) + alignedOffset, data, size);
+        openGLUniformBuffer->allocationOffset = alignedOffset + size;
+        offset = static_cast<uint32_t>(alignedOffset);
+        return true;
+    }
+
+    void* OpenGLX11Renderer::MapIndexBufferForWrite(IndexBuffer* indexBuffer, const uint32_t indexCount)
+    {
+        OpenGLIndexBuffer* openGLIndexBuffer = static_cast<OpenGLIndexBuffer*>(indexBuffer);
+        if (openGLIndexBuffer->frames.empty())
+        {
+            Logger::WriteError(m_logger, "Cannot map static index buffer for write.");
+            return nullptr;
+        }
+        if (!CheckDynamicBufferWrite(indexCount, openGLIndexBuffer->capacity))
+        {
+            return nullptr;
+        }
+
+        openGLIndexBuffer->indexCount = indexCount;
+        return openGLIndexBuffer->frames[m_currentFrame].mappedData;
+    }
+
+    void* OpenGLX11Renderer::MapVertexBufferForWrite(VertexBuffer* vertexBuffer, const uint32_t vertexCount)
+    {
+        OpenGLVertexBuffer* openGLVertexBuffer = static_cast<OpenGLVertexBuffer*>(vertexBuffer);
+        if (openGLVertexBuffer->frames.empty())
+        {
+            Logger::WriteError(m_logger, "Cannot map static vertex buffer for write.");
+            return nullptr;
+        }
+        if (!CheckDynamicBufferWrite(vertexCount, openGLVertexBuffer->capacity))
+        {
+            return nullptr;
+        }
+
+        openGLVertexBuffer->vertexCount = vertexCount;
+        return openGLVertexBuffer->frames[m_currentFrame].mappedData;
+    }
+
+    bool OpenGLX11Renderer::UpdateIndexBuffer(IndexBuffer* indexBuffer, const uint32_t indexCount, const void* data)
+    {
+        auto* frameData = MapIndexBufferForWrite(indexBuffer, indexCount);
+        if (!frameData)
+        {
+            return false;
+        }
+
+        const size_t indexSize = static_cast<OpenGLIndexBuffer*>(indexBuffer)->dataType == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t);
+        std::memcpy(frameData, data, static_cast<size_t>(indexCount) * indexSize);
+        return true;
+    }
+
+    bool OpenGLX11Renderer::UpdateVertexBuffer(VertexBuffer* vertexBuffer, const uint32_t vertexCount, const void* data)
+    {
+        auto* frameData = MapVertexBufferForWrite(vertexBuffer, vertexCount);
+        if (!frameData)
+        {
+            return false;
+        }
+
+        std::memcpy(frameData, data, static_cast<size_t>(vertexCount) * static_cast<OpenGLVertexBuffer*>(vertexBuffer)->vertexSize);
+        return true;
+    }
+
+    void OpenGLX11Renderer::SetTextureStreamingBudget(const size_t /*memoryBudget*/, const size_t /*frameUploadBudget*/)
+    {
+    }
+
+    void OpenGLX11Renderer::BeginGpuMarker(const std::string& name)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot begin GPU marker without any previous call to BeginDraw.");
+            return;
+        }
+
+        CommandStream::Command command(CommandStream::Opcode::BeginMarker);
+        command.data = name.c_str();
+        command.dataSize = static_cast<uint32_t>(name.size());
+        m_inlineCommandBuffer.stream.Write(command);
+        ++m_markerDepth;
+    }
+
+    void OpenGLX11Renderer::EndGpuMarker()
+    {
+        if (!m_markerDepth)
+        {
+            Logger::WriteError(m_logger, "Calling EndGpuMarker, without any previous call to BeginGpuMarker.");
+            return;
+        }
+
+        m_inlineCommandBuffer.stream.Write(CommandStream::Command(CommandStream::Opcode::EndMarker));
+        --m_markerDepth;
+    }
+
+    bool OpenGLX11Renderer::LoadContext(GLXFBConfig framebufferConfig, GLXDrawable drawable, const Version& version)
+    {
+        auto createContextAttribs = reinterpret_cast<PFNGLXCREATECONTEXTATTRIBSARBPROC>(
+            glXGetProcAddressARB(reinterpret_cast<const GLubyte*>("glXCreateContextAttribsARB")));
+        if (!createContextAttribs)
+        {
+            Logger::WriteError(m_logger, "GLX_ARB_create_context is required by the OpenGL renderer.");
+            return false;
+        }
+
+        std::vector<Version> versions;
+        if (version == Version::None)
+        {
+            versions = { Version(4, 6), Version(4, 5) };
+        }
+        else if (version < Version(4, 5))
+        {
+            Logger::WriteError(m_logger, "OpenGL " + version.AsString() + " is not supported, the OpenGL renderer requires version 4.5 or later.");
+            return false;
+        }
+        else
+        {
+            versions = { version };
+        }
+
+        // Failing context creation is reported as an X error, which terminates the application by default.
+        s_contextError = false;
+        auto previousErrorHandler = XSetErrorHandler(CatchContextError);
+
+        for (auto& contextVersion : versions)
+        {
+            const int contextAttributes[] =
+            {
+                GLX_CONTEXT_MAJOR_VERSION_ARB, static_cast<int>(contextVersion.Major),
+                GLX_CONTEXT_MINOR_VERSION_ARB, static_cast<int>(contextVersion.Minor),
+                GLX_CONTEXT_PROFILE_MASK_ARB, GLX_CONTEXT_CORE_PROFILE_BIT_ARB,
+                0
+            };
+
+            m_context = createContextAttribs(m_display, framebufferConfig, nullptr, true, contextAttributes);
+            XSync(m_display, False);
+
+            if (m_context && !s_contextError)
+            {
+                break;
+            }
+            if (m_context)
+            {
+                glXDestroyContext(m_display, m_context);
+                m_context = nullptr;
+            }
+            s_contextError = false;
+        }
+
+        XSetErrorHandler(previousErrorHandler);
+
+        if (!m_context)
+        {
+            Logger::WriteError(m_logger, "Failed to create OpenGL core profile context.");
+            return false;
+        }
+
+        if (!glXMakeCurrent(m_display, drawable, m_context))
+        {
+            Logger::WriteError(m_logger, "Failed to make OpenGL context current.");
+            return false;
+        }
+
+        return LoadContextFunctions();
+    }
+
+    bool OpenGLX11Renderer::LoadContextFunctions()
+    {
+        if (!OpenGL::BindOpenGLExtensions())
+        {
+            Logger::WriteError(m_logger, "Failed to bind OpenGL functions.");
+            return false;
+        }
+
+        GLint majorVersion = 0;
+        GLint minorVersion = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+        glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+        m_version = Version(static_cast<uint32_t>(majorVersion), static_cast<uint32_t>(minorVersion));
+
+        if (m_version < Version(4, 5))
+        {
+            Logger::WriteError(m_logger, "OpenGL " + m_version.AsString() + " is not supported, the OpenGL renderer requires version 4.5 or later.");
+            return false;
+        }
+
+        bool spirvExtension = false;
+        bool indirectParametersExtension = false;
+        bool anisotropicExtension = false;
+
+        GLint extensionCount = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+        for (GLint i = 0; i < extensionCount; i++)
+        {
+            const char* extension = reinterpret_cast<const char*>(OpenGL::GetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+            if (!extension)
+            {
+                continue;
+            }
+
+            spirvExtension |= std::strcmp(extension, "GL_ARB_gl_spirv") == 0;
+            indirectParametersExtension |= std::strcmp(extension, "GL_ARB_indirect_parameters") == 0;
+            anisotropicExtension |=
+                std::strcmp(extension, "GL_ARB_texture_filter_anisotropic") == 0 ||
+                std::strcmp(extension, "GL_EXT_texture_filter_anisotropic") == 0;
+        }
+
+        // Function pointers are returned for any name by some implementations, extensions are checked as well.
+        const bool version46 = m_version >= Version(4, 6);
+        m_spirvSupport = OpenGL::SpecializeShader && (version46 || spirvExtension);
+        m_drawCountSupport = OpenGL::MultiDrawElementsIndirectCount && (version46 || indirectParametersExtension);
+        m_anisotropySupport = version46 || anisotropicExtension;
+
+        GLint uniformBufferAlignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformBufferAlignment);
+        m_uniformBufferAlignment = static_cast<size_t>(std::max(uniformBufferAlignment, GLint(1)));
+
+        GLint storageBufferAlignment = 0;
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageBufferAlignment);
+        m_storageBufferAlignment = static_cast<size_t>(std::max(storageBufferAlignment, GLint(1)));
+
+        // Shaders are generated for Vulkan, with y pointing down in clip space and a depth range of [0, 1].
+        OpenGL::ClipControl(GL_UPPER_LEFT, GL_ZERO_TO_ONE);
+
+        const GLsizeiptr pushConstantBufferSize = static_cast<GLsizeiptr>(PushConstantFrameSize * MaxFramesInFlight);
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        OpenGL::CreateBuffers(1, &m_pushConstantUniformBuffer);
+        OpenGL::NamedBufferStorage(m_pushConstantUniformBuffer, pushConstantBufferSize, nullptr, flags);
+        m_pushConstantData = static_cast<uint8_t*>(OpenGL::MapNamedBufferRange(m_pushConstantUniformBuffer, 0, pushConstantBufferSize, flags));
+        if (!m_pushConstantData)
+        {
+            Logger::WriteError(m_logger, "Failed to map push constant buffer.");
+            return false;
+        }
+
+        // Indirect buffers can still be drawn and updated by the host, only culling is unavailable.
+        if (!LoadCullProgram())
+        {
+            Logger::WriteWarning(m_logger, "Culling of indirect buffers is not available.");
+        }
+
+        return true;
+    }
+
+    void OpenGLX11Renderer::UnloadContext()
+    {
+        if (!m_context)
+        {
+            return;
+        }
+
+        for (auto& frame : m_frames)
+        {
+            if (frame.fence)
+            {
+                OpenGL::DeleteSync(frame.fence);
+                frame.fence = nullptr;
+            }
+            frame.pushConstantOffset = 0;
+        }
+
+        if (m_cullProgram)
+        {
+            OpenGL::DeleteProgram(m_cullProgram);
+            m_cullProgram = 0;
+        }
+
+        if (m_pushConstantUniformBuffer)
+        {
+            OpenGL::UnmapNamedBuffer(m_pushConstantUniformBuffer);
+            OpenGL::DeleteBuffers(1, &m_pushConstantUniformBuffer);
+            m_pushConstantUniformBuffer = 0;
+            m_pushConstantData = nullptr;
+        }
+
+        UnloadOffscreenFramebuffer();
+
+        glXMakeCurrent(m_display, 0, nullptr);
+        glXDestroyContext(m_display, m_context);
+        m_context = nullptr;
+    }
+
+    bool OpenGLX11Renderer::LoadOffscreenFramebuffer()
+    {
+        OpenGL::CreateRenderbuffers(1, &m_offscreenRenderbuffer);
+        OpenGL::NamedRenderbufferStorage(m_offscreenRenderbuffer, GL_RGBA8,
+            static_cast<GLsizei>(std::max(m_size.x, uint32_t(1))), static_cast<GLsizei>(std::max(m_size.y, uint32_t(1))));
+
+        OpenGL::CreateFramebuffers(1, &m_offscreenFramebuffer);
+        OpenGL::NamedFramebufferRenderbuffer(m_offscreenFramebuffer, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_offscreenRenderbuffer);
+
+        if (OpenGL::CheckNamedFramebufferStatus(m_offscreenFramebuffer, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            Logger::WriteError(m_logger, "Offscreen framebuffer is incomplete.");
+            UnloadOffscreenFramebuffer();
+            return false;
+        }
+
+        m_readbackAvailable = false;
+        return true;
+    }
+
+    void OpenGLX11Renderer::UnloadOffscreenFramebuffer()
+    {
+        if (m_offscreenFramebuffer)
+        {
+            OpenGL::DeleteFramebuffers(1, &m_offscreenFramebuffer);
+            m_offscreenFramebuffer = 0;
+        }
+        if (m_offscreenRenderbuffer)
+        {
+            OpenGL::DeleteRenderbuffers(1, &m_offscreenRenderbuffer);
+            m_offscreenRenderbuffer = 0;
+        }
+        m_readbackAvailable = false;
+    }
+
+    void OpenGLX11Renderer::ApplyPresentMode()
+    {
+        if (m_offscreen || !m_context || !m_swapInterval)
+        {
+            return;
+        }
+
+        // OpenGL has no mailbox presentation, it is presented as vertical synchronized Fifo.
+        m_swapInterval(m_display, m_window, m_presentMode == PresentMode::Immediate ? 0 : 1);
+    }
+
+    void OpenGLX11Renderer::ApplyMaxFramesInFlight()
+    {
+        const size_t frameCount = m_requestedMaxFramesInFlight == 0 ?
+            DefaultFramesInFlight : std::min(m_requestedMaxFramesInFlight, MaxFramesInFlight);
+        if (frameCount == m_frames.size())
+        {
+            return;
+        }
+
+        // Regions of removed frames are no longer written by the host, their fences are not waited for.
+        for (size_t i = frameCount; i < m_frames.size(); i++)
+        {
+            if (m_frames[i].fence)
+            {
+                OpenGL::DeleteSync(m_frames[i].fence);
+            }
+        }
+        m_frames.resize(frameCount);
+    }
+
+    bool OpenGLX11Renderer::LoadCullProgram()
+    {
+        const GLuint shader = OpenGL::CreateShader(GL_COMPUTE_SHADER);
+        SmartFunction shaderDestroyer([&]()
+        {
+            OpenGL::DeleteShader(shader);
+        });
+
+        const GLchar* source = s_cullShaderSource;
+        OpenGL::ShaderSource(shader, 1, &source, nullptr);
+        OpenGL::CompileShader(shader);
+
+        GLint compileStatus = GL_FALSE;
+        OpenGL::GetShaderiv(shader, GL_COMPILE_STATUS, &compileStatus);
+        if (compileStatus != GL_TRUE)
+        {
+            GLchar infoLog[1024] = {};
+            OpenGL::GetShaderInfoLog(shader, static_cast<GLsizei>(sizeof(infoLog)), nullptr, infoLog);
+            Logger::WriteError(m_logger, std::string("Failed to compile culling shader: ") + infoLog);
+            return false;
+        }
+
+        const GLuint program = OpenGL::CreateProgram();
+        OpenGL::AttachShader(program, shader);
+        OpenGL::LinkProgram(program);
+        OpenGL::DetachShader(program, shader);
+
+        GLint linkStatus = GL_FALSE;
+        OpenGL::GetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+        if (linkStatus != GL_TRUE)
+        {
+            GLchar infoLog[1024] = {};
+            OpenGL::GetProgramInfoLog(program, static_cast<GLsizei>(sizeof(infoLog)), nullptr, infoLog);
+            Logger::WriteError(m_logger, std::string("Failed to link culling program: ") + infoLog);
+            OpenGL::DeleteProgram(program);
+            return false;
+        }
+
+        m_cullProgram = program;
+        return true;
+    }
+
+    bool OpenGLX11Renderer::LoadShaderProgram(const std::vector<Shader::Visual::Script*>& visualScripts, OpenGLPipeline& pipeline)
+    {
+        Shader::VulkanGenerator::GlslTemplates glslTemplates;
+        if (!Shader::VulkanGenerator::GenerateGlslTemplate(glslTemplates, visualScripts, m_logger))
+        {
+            return false;
+        }
+
+        auto& pushConstantTemplate = glslTemplates.pushConstantTemplate;
+
+        pipeline.program = OpenGL::CreateProgram();
+
+        std::vector<GLuint> shaders;
+        SmartFunction shaderDestroyer([&]()
+        {
+            for (auto shader : shaders)
+            {
+                OpenGL::DetachShader(pipeline.program, shader);
+                OpenGL::DeleteShader(shader);
+            }
+        });
+
+        for (size_t i = 0; i < visualScripts.size(); i++)
+        {
+            Shader::VulkanGenerator::GlslStageTemplates stageTemplate;
+            stageTemplate.pushConstantTemplate.blockSource = &pushConstantTemplate.blockSource;
+            stageTemplate.pushConstantTemplate.offsets = &pushConstantTemplate.stageOffsets[i];
+
+            const auto shaderType = visualScripts[i]->GetType();
+            const auto glslCode = Shader::VulkanGenerator::GenerateGlsl(*visualScripts[i], &stageTemplate, m_logger, Shader::VulkanGenerator::TargetApi::OpenGL);
+            if (!glslCode.size())
+            {
+                Logger::WriteError(m_logger, "Failed to generate GLSL code.");
+                return false;
+            }
+
+            const auto spirvCode = Shader::VulkanGenerator::ConvertGlslToSpriV(glslCode, shaderType, m_logger, Shader::VulkanGenerator::TargetApi::OpenGL);
+            if (!spirvCode.size())
+            {
+                Logger::WriteError(m_logger, "Failed to convert GLSL to SPIR-V.");
+                return false;
+            }
+
+            const GLuint shader = OpenGL::CreateShader(GetShaderType(shaderType));
+            shaders.push_back(shader);
+
+            OpenGL::ShaderBinary(1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V, spirvCode.data(), static_cast<GLsizei>(spirvCode.size()));
+            OpenGL::SpecializeShader(shader, "main", 0, nullptr, nullptr);
+
+            GLint compileStatus = GL_FALSE;
+            OpenGL::GetShaderiv(shader, GL_COMPILE_STATUS, &compileStatus);
+            if (compileStatus != GL_TRUE)
+            {
+                GLchar infoLog[1024] = {};
+                OpenGL::GetShaderInfoLog(shader, static_cast<GLsizei>(sizeof(infoLog)), nullptr, infoLog);
+                Logger::WriteError(m_logger, std::string("Failed to specialize SPIR-V shader: ") + infoLog);
+                return false;
+            }
+
+            OpenGL::AttachShader(pipeline.program, shader);
+        }
+
+        OpenGL::LinkProgram(pipeline.program);
+
+        GLint linkStatus = GL_FALSE;
+        OpenGL::GetProgramiv(pipeline.program, GL_LINK_STATUS, &linkStatus);
+        if (linkStatus != GL_TRUE)
+        {
+            GLchar infoLog[1024] = {};
+            OpenGL::GetProgramInfoLog(pipeline.program, static_cast<GLsizei>(sizeof(infoLog)), nullptr, infoLog);
+            Logger::WriteError(m_logger, std::string("Failed to link shader program: ") + infoLog);
+            return false;
+        }
+
+        pipeline.pushConstantLocations = std::move(pushConstantTemplate.locations);
+        pipeline.pushConstantOffsets = std::move(pushConstantTemplate.offsets);
+        pipeline.pushConstantBlockSize = pushConstantTemplate.blockByteCount;
+
+        return true;
+    }
+
+    bool OpenGLX11Renderer::LoadVertexArray(const Shader::Visual::InputStructure& inputs, const GLuint vertexArray, const GLuint binding, GLuint& location, GLsizei& stride)
+    {
+        for (auto* inputNode : inputs.GetMembers())
+        {
+            for (auto* outputPin : inputNode->GetOutputPins())
+            {
+                GLint componentCount = 0;
+                GLenum componentType = GL_NONE;
+                GLuint formatSize = 0;
+                if (!GetVertexAttributeFormat(outputPin->GetDataType(), componentCount, componentType, formatSize))
+                {
+                    Logger::WriteError(m_logger, "Failed to find attribute format.");
+                    return false;
+                }
+
+                // Matrices are passed as one attribute per column, each consuming a location.
+                const GLuint columnCount = outputPin->GetDataType() == Shader::VariableDataType::Matrix4x4f32 ? 4 : 1;
+                const GLuint columnSize = formatSize / columnCount;
+
+                for (GLuint i = 0; i < columnCount; i++)
+                {
+                    if (componentType == GL_FLOAT)
+                    {
+                        OpenGL::VertexArrayAttribFormat(vertexArray, location, componentCount, componentType, GL_FALSE, static_cast<GLuint>(stride));
+                    }
+                    else
+                    {
+                        OpenGL::VertexArrayAttribIFormat(vertexArray, location, componentCount, componentType, static_cast<GLuint>(stride));
+                    }
+                    OpenGL::VertexArrayAttribBinding(vertexArray, location, binding);
+                    OpenGL::EnableVertexArrayAttrib(vertexArray, location);
+
+                    location++;
+                    stride += static_cast<GLsizei>(columnSize);
+                }
+            }
+        }
+        return true;
+    }
+
+    bool OpenGLX11Renderer::CheckDynamicBufferWrite(const uint32_t count, const uint32_t capacity)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot write dynamic buffer without any previous call to BeginDraw.");
+            return false;
+        }
+        if (count > capacity)
+        {
+            Logger::WriteError(m_logger, "Trying to write more elements than the capacity of dynamic buffer.");
+            return false;
+        }
+        return true;
+    }
+
+    GLuint OpenGLX11Renderer::GetFrameBuffer(const OpenGLIndexBuffer* indexBuffer) const
+    {
+        return indexBuffer->frames.empty() ? indexBuffer->buffer : indexBuffer->frames[m_currentFrame].buffer;
+    }
+
+    GLuint OpenGLX11Renderer::GetFrameBuffer(const OpenGLVertexBuffer* vertexBuffer) const
+    {
+        return vertexBuffer->frames.empty() ? vertexBuffer->buffer : vertexBuffer->frames[m_currentFrame].buffer;
+    }
+
+    void OpenGLX11Renderer::FlushInlineCommands()
+    {
+        ExecuteCommandStream(m_inlineCommandBuffer.stream);
+        m_frameBindStatistics += m_inlineCommandBuffer.bindStateCache.GetStatistics();
+        m_inlineCommandBuffer.stream.Clear();
+        m_inlineCommandBuffer.bindStateCache.ClearStatistics();
+    }
+
+    void OpenGLX11Renderer::ExecuteCommandStream(const CommandStream& stream)
+    {
+        using Opcode = CommandStream::Opcode;
+
+        size_t position = 0;
+        CommandStream::Command command;
+        while (stream.Read(position, command))
+        {
+            switch (command.opcode)
+            {
+                case Opcode::BindPipeline:
+                {
+                    ExecuteBindPipeline(static_cast<const OpenGLPipeline*>(command.resources[0]));
+                } break;
+                case Opcode::BindUniformBlock:
+                {
+                    auto* uniformBlock = static_cast<const OpenGLUniformBlock*>(command.resources[0]);
+                    auto* uniformBuffer = uniformBlock->buffer;
+                    const size_t offset = command.values[1];
+                    const size_t size = uniformBlock->size ? uniformBlock->size : uniformBuffer->size - offset;
+                    OpenGL::BindBufferRange(GL_UNIFORM_BUFFER, command.values[0], uniformBuffer->buffer,
+                        static_cast<GLintptr>((m_currentFrame * uniformBuffer->frameSize) + offset), static_cast<GLsizeiptr>(size));
+                } break;
+                case Opcode::BindUniformBuffer:
+                {
+                    auto* uniformBuffer = static_cast<const OpenGLUniformBuffer*>(command.resources[1]);
+                    const size_t offset = command.values[1];
+                    const size_t size = command.values[2] ? command.values[2] : uniformBuffer->size - offset;
+                    OpenGL::BindBufferRange(GL_UNIFORM_BUFFER, command.values[0], uniformBuffer->buffer,
+                        static_cast<GLintptr>((m_currentFrame * uniformBuffer->frameSize) + offset), static_cast<GLsizeiptr>(size));
+                } break;
+                case Opcode::BindVertexBuffer:
+                {
+                    ExecuteBindVertexBuffer(static_cast<const OpenGLVertexBuffer*>(command.resources[0]), command.values[0]);
+                } break;
+                case Opcode::BindIndexBuffer:
+                {
+                    ExecuteBindIndexBuffer(static_cast<const OpenGLIndexBuffer*>(command.resources[0]));
+                } break;
+                case Opcode::Draw:
+                {
+                    if (!m_currentPipeline)
+                    {
+                        Logger::WriteWarning(m_logger, "Trying to draw without any bound pipeline.");
+                        break;
+                    }
+
+                    FlushPushConstants();
+                    OpenGL::DrawArraysInstanced(m_currentPipeline->topology, 0,
+                        static_cast<GLsizei>(command.values[0]), static_cast<GLsizei>(command.values[1]));
+                } break;
+                case Opcode::DrawIndexed:
+                {
+                    if (!m_currentPipeline || !m_currentIndexBuffer)
+                    {
+                        Logger::WriteWarning(m_logger, "Trying to draw without any bound pipeline or index buffer.");
+                        break;
+                    }
+
+                    FlushPushConstants();
+                    OpenGL::DrawElementsInstanced(m_currentPipeline->topology, static_cast<GLsizei>(command.values[0]),
+                        m_currentIndexBuffer->dataType, nullptr, static_cast<GLsizei>(command.values[1]));
+                } break;
+                case Opcode::DrawIndirect:
+                case Opcode::DrawIndirectCount:
+                {
+                    if (!m_currentPipeline || !m_currentIndexBuffer)
+                    {
+                        Logger::WriteWarning(m_logger, "Trying to draw without any bound pipeline or index buffer.");
+                        break;
+                    }
+
+                    FlushPushConstants();
+
+                    auto* indirectBuffer = static_cast<const OpenGLIndirectBuffer*>(command.resources[0]);
+                    const size_t frameOffset = m_currentFrame * indirectBuffer->frameSize;
+                    OpenGL::BindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer->buffer);
+
+                    // Without device side draw counts, all commands are drawn. Culled commands have an instance count of 0.
+                    if (command.opcode == Opcode::DrawIndirectCount && m_drawCountSupport)
+                    {
+                        OpenGL::BindBuffer(GL_PARAMETER_BUFFER, indirectBuffer->buffer);
+                        OpenGL::MultiDrawElementsIndirectCount(m_currentPipeline->topology, m_currentIndexBuffer->dataType,
+                            reinterpret_cast<const void*>(frameOffset), static_cast<GLintptr>(frameOffset + indirectBuffer->countOffset),
+                            static_cast<GLsizei>(command.values[0]), static_cast<GLsizei>(sizeof(DrawIndexedIndirectCommand)));
+                    }
+                    else
+                    {
+                        OpenGL::MultiDrawElementsIndirect(m_currentPipeline->topology, m_currentIndexBuffer->dataType,
+                            reinterpret_cast<const void*>(frameOffset), static_cast<GLsizei>(command.values[0]), static_cast<GLsizei>(sizeof(DrawIndexedIndirectCommand)));
+                    }
+                } break;
+                case Opcode::PushConstant:
+                {
+                    ExecutePushConstant(command.values[0], command.data, command.dataSize);
+                } break;
+                case Opcode::BeginMarker:
+                {
+                    OpenGL::PushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, static_cast<GLsizei>(command.dataSize), static_cast<const GLchar*>(command.data));
+                } break;
+                case Opcode::EndMarker:
+                {
+                    OpenGL::PopDebugGroup();
+                } break;
+                case Opcode::CullIndirectBuffer:
+                {
+                    ExecuteCullIndirectBuffer(static_cast<const OpenGLIndirectBuffer*>(command.resources[0]), command.data);
+                } break;
+                case Opcode::UpdateIndirectBuffer:
+                case Opcode::UpdateIndirectBufferDrawCount:
+                case Opcode::UpdateUniformBuffer:
+                {
+                    // Updates are written directly to the mapped regions of the current frame, they are never recorded.
+                } break;
+                case Opcode::BindFramebuffer:
+                {
+                    // Framebuffers are not supported, binding is never recorded.
+                } break;
+            }
+        }
+    }
+
+    void OpenGLX11Renderer::ExecuteBindPipeline(const OpenGLPipeline* pipeline)
+    {
+        m_currentPipeline = pipeline;
+
+        OpenGL::UseProgram(pipeline->program);
+        OpenGL::BindVertexArray(pipeline->vertexArray);
+
+        glPolygonMode(GL_FRONT_AND_BACK, pipeline->polygonMode);
+        glFrontFace(pipeline->frontFace);
+        if (pipeline->cullMode != GL_NONE)
+        {
+            glEnable(GL_CULL_FACE);
+            glCullFace(pipeline->cullMode);
+        }
+        else
+        {
+            glDisable(GL_CULL_FACE);
+        }
+
+        // Buffer bindings are state of the vertex array, attach the bound buffers to the array of the new pipeline.
+        for (GLuint binding = 0; binding < 2; binding++)
+        {
+            if (m_currentVertexBuffers[binding])
+            {
+                OpenGL::VertexArrayVertexBuffer(pipeline->vertexArray, binding, GetFrameBuffer(m_currentVertexBuffers[binding]), 0, pipeline->vertexStrides[binding]);
+            }
+        }
+        if (m_currentIndexBuffer)
+        {
+            OpenGL::VertexArrayElementBuffer(pipeline->vertexArray, GetFrameBuffer(m_currentIndexBuffer));
+        }
+
+        m_pushConstantBuffer.Resize(pipeline->pushConstantBlockSize);
+    }
+
+    void OpenGLX11Renderer::ExecuteBindVertexBuffer(const OpenGLVertexBuffer* vertexBuffer, const GLuint binding)
+    {
+        if (binding > 1)
+        {
+            return;
+        }
+
+        m_currentVertexBuffers[binding] = vertexBuffer;
+        if (m_currentPipeline)
+        {
+            OpenGL::VertexArrayVertexBuffer(m_currentPipeline->vertexArray, binding, GetFrameBuffer(vertexBuffer), 0, m_currentPipeline->vertexStrides[binding]);
+        }
+    }
+
+    void OpenGLX11Renderer::ExecuteBindIndexBuffer(const OpenGLIndexBuffer* indexBuffer)
+    {
+        m_currentIndexBuffer = indexBuffer;
+        if (m_currentPipeline)
+        {
+            OpenGL::VertexArrayElementBuffer(m_currentPipeline->vertexArray, GetFrameBuffer(indexBuffer));
+        }
+    }
+
+    void OpenGLX11Renderer::ExecutePushConstant(const uint32_t location, const void* data, const uint32_t size)
+    {
+        if (!m_currentPipeline)
+        {
+            Logger::WriteWarning(m_logger, "Trying to set push constant without any bound pipeline.");
+            return;
+        }
+
+        auto& pushConstantOffsets = m_currentPipeline->pushConstantOffsets;
+        if (location >= pushConstantOffsets.size())
+        {
+            Logger::WriteWarning(m_logger, "Trying to set push constant with out of bounds location.");
+            return;
+        }
+
+        if (!m_pushConstantBuffer.Write(pushConstantOffsets[location].offset, data, size))
+        {
+            Logger::WriteWarning(m_logger, "Trying to set push constant outside of push constant block.");
+        }
+    }
+
+    void OpenGLX11Renderer::ExecuteCullIndirectBuffer(const OpenGLIndirectBuffer* indirectBuffer, const void* planeData)
+    {
+        // Plane data of stream is not guaranteed to be aligned.
+        std::array<Vector4f32, Frustum::PlaneCount> planes;
+        std::memcpy(planes.data(), planeData, sizeof(planes));
+
+        const GLintptr frameOffset = static_cast<GLintptr>(m_currentFrame * indirectBuffer->frameSize);
+        const GLsizeiptr outputSize = static_cast<GLsizeiptr>(indirectBuffer->countOffset + sizeof(uint32_t));
+
+        // Culled commands are left cleared to an instance count of 0, and the draw count starts at 0.
+        OpenGL::ClearNamedBufferSubData(indirectBuffer->buffer, GL_R32UI, frameOffset, outputSize, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+
+        OpenGL::ProgramUniform4fv(m_cullProgram, 0, static_cast<GLsizei>(planes.size()), reinterpret_cast<const GLfloat*>(planes.data()));
+        OpenGL::ProgramUniform1ui(m_cullProgram, 6, indirectBuffer->commandCount);
+
+        OpenGL::BindBufferRange(GL_SHADER_STORAGE_BUFFER, 0, indirectBuffer->sourceBuffer, 0, static_cast<GLsizeiptr>(indirectBuffer->countOffset));
+        OpenGL::BindBufferRange(GL_SHADER_STORAGE_BUFFER, 1, indirectBuffer->boundsBuffer, 0,
+            static_cast<GLsizeiptr>(indirectBuffer->commandCount * sizeof(BoundingVolume)));
+        OpenGL::BindBufferRange(GL_SHADER_STORAGE_BUFFER, 2, indirectBuffer->buffer, frameOffset, outputSize);
+
+        OpenGL::UseProgram(m_cullProgram);
+        OpenGL::DispatchCompute((indirectBuffer->commandCount + 63) / 64, 1, 1);
+        OpenGL::MemoryBarriers(GL_COMMAND_BARRIER_BIT);
+
+        if (m_currentPipeline)
+        {
+            OpenGL::UseProgram(m_currentPipeline->program);
+        }
+    }
+
+    void OpenGLX11Renderer::FlushPushConstants()
+    {
+        const uint32_t blockSize = m_pushConstantBuffer.GetSize();
+        if (!blockSize || (!m_pushConstantBuffer.IsDirty() && m_pushConstantBoundSize == blockSize))
+        {
+            return;
+        }
+
+        // Ranges read by previous draws cannot be modified, the entire block is written to a new range.
+        auto& frame = m_frames[m_currentFrame];
+        const size_t alignedOffset = AlignSize(frame.pushConstantOffset, m_uniformBufferAlignment);
+        if (alignedOffset + blockSize > PushConstantFrameSize)
+        {
+            Logger::WriteWarning(m_logger, "Push constant buffer is out of memory for the current frame.");
+            return;
+        }
+
+        const size_t bufferOffset = (m_currentFrame * PushConstantFrameSize) + alignedOffset;
+        std::memcpy(m_pushConstantData + bufferOffset, m_pushConstantBuffer.GetData(), blockSize);
+        OpenGL::BindBufferRange(GL_UNIFORM_BUFFER, Shader::VulkanGenerator::OpenGLPushConstantBinding, m_pushConstantUniformBuffer,
+            static_cast<GLintptr>(bufferOffset), static_cast<GLsizeiptr>(blockSize));
+
+        frame.pushConstantOffset = alignedOffset + blockSize;
+        m_pushConstantBoundSize = blockSize;
+        m_pushConstantBuffer.ClearDirty();
+    }
 
 }
 
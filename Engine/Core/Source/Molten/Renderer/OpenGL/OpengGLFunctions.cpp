@@ -50,6 +50,68 @@ namespace Molten
         PFNGLGENVERTEXARRAYSPROC GenVertexArrays = NULL;
         PFNGLISVERTEXARRAYPROC IsVertexArray = NULL;
 
+        PFNGLCREATEVERTEXARRAYSPROC CreateVertexArrays = NULL;
+        PFNGLENABLEVERTEXARRAYATTRIBPROC EnableVertexArrayAttrib = NULL;
+        PFNGLVERTEXARRAYATTRIBFORMATPROC VertexArrayAttribFormat = NULL;
+        PFNGLVERTEXARRAYATTRIBIFORMATPROC VertexArrayAttribIFormat = NULL;
+        PFNGLVERTEXARRAYATTRIBBINDINGPROC VertexArrayAttribBinding = NULL;
+        PFNGLVERTEXARRAYBINDINGDIVISORPROC VertexArrayBindingDivisor = NULL;
+        PFNGLVERTEXARRAYVERTEXBUFFERPROC VertexArrayVertexBuffer = NULL;
+        PFNGLVERTEXARRAYELEMENTBUFFERPROC VertexArrayElementBuffer = NULL;
+        PFNGLCREATEBUFFERSPROC CreateBuffers = NULL;
+        PFNGLDELETEBUFFERSPROC DeleteBuffers = NULL;
+        PFNGLBINDBUFFERPROC BindBuffer = NULL;
+        PFNGLBINDBUFFERRANGEPROC BindBufferRange = NULL;
+        PFNGLNAMEDBUFFERSTORAGEPROC NamedBufferStorage = NULL;
+        PFNGLMAPNAMEDBUFFERRANGEPROC MapNamedBufferRange = NULL;
+        PFNGLUNMAPNAMEDBUFFERPROC UnmapNamedBuffer = NULL;
+        PFNGLCLEARNAMEDBUFFERSUBDATAPROC ClearNamedBufferSubData = NULL;
+        PFNGLCREATETEXTURESPROC CreateTextures = NULL;
+        PFNGLTEXTURESTORAGE2DPROC TextureStorage2D = NULL;
+        PFNGLTEXTURESUBIMAGE2DPROC TextureSubImage2D = NULL;
+        PFNGLCREATESAMPLERSPROC CreateSamplers = NULL;
+        PFNGLDELETESAMPLERSPROC DeleteSamplers = NULL;
+        PFNGLSAMPLERPARAMETERIPROC SamplerParameteri = NULL;
+        PFNGLSAMPLERPARAMETERFPROC SamplerParameterf = NULL;
+        PFNGLCREATEFRAMEBUFFERSPROC CreateFramebuffers = NULL;
+        PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers = NULL;
+        PFNGLBINDFRAMEBUFFERPROC BindFramebuffer = NULL;
+        PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC NamedFramebufferRenderbuffer = NULL;
+        PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC CheckNamedFramebufferStatus = NULL;
+        PFNGLCREATERENDERBUFFERSPROC CreateRenderbuffers = NULL;
+        PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers = NULL;
+        PFNGLNAMEDRENDERBUFFERSTORAGEPROC NamedRenderbufferStorage = NULL;
+        PFNGLCREATESHADERPROC CreateShader = NULL;
+        PFNGLDELETESHADERPROC DeleteShader = NULL;
+        PFNGLSHADERBINARYPROC ShaderBinary = NULL;
+        PFNGLSHADERSOURCEPROC ShaderSource = NULL;
+        PFNGLCOMPILESHADERPROC CompileShader = NULL;
+        PFNGLGETSHADERIVPROC GetShaderiv = NULL;
+        PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog = NULL;
+        PFNGLCREATEPROGRAMPROC CreateProgram = NULL;
+        PFNGLDELETEPROGRAMPROC DeleteProgram = NULL;
+        PFNGLATTACHSHADERPROC AttachShader = NULL;
+        PFNGLDETACHSHADERPROC DetachShader = NULL;
+        PFNGLLINKPROGRAMPROC LinkProgram = NULL;
+        PFNGLGETPROGRAMIVPROC GetProgramiv = NULL;
+        PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog = NULL;
+        PFNGLUSEPROGRAMPROC UseProgram = NULL;
+        PFNGLPROGRAMUNIFORM4FVPROC ProgramUniform4fv = NULL;
+        PFNGLPROGRAMUNIFORM1UIPROC ProgramUniform1ui = NULL;
+        PFNGLSPECIALIZESHADERPROC SpecializeShader = NULL;
+        PFNGLDRAWARRAYSINSTANCEDPROC DrawArraysInstanced = NULL;
+        PFNGLDRAWELEMENTSINSTANCEDPROC DrawElementsInstanced = NULL;
+        PFNGLMULTIDRAWELEMENTSINDIRECTPROC MultiDrawElementsIndirect = NULL;
+        PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC MultiDrawElementsIndirectCount = NULL;
+        PFNGLDISPATCHCOMPUTEPROC DispatchCompute = NULL;
+        PFNGLMEMORYBARRIERPROC MemoryBarriers = NULL;
+        PFNGLFENCESYNCPROC FenceSync = NULL;
+        PFNGLCLIENTWAITSYNCPROC ClientWaitSync = NULL;
+        PFNGLDELETESYNCPROC DeleteSync = NULL;
+        PFNGLCLIPCONTROLPROC ClipControl = NULL;
+        PFNGLPUSHDEBUGGROUPPROC PushDebugGroup = NULL;
+        PFNGLPOPDEBUGGROUPPROC PopDebugGroup = NULL;
+
         bool BindOpenGLExtensions()
         {
             bool error = false;
@@ -70,8 +132,86 @@ namespace Molten
             error |= (GenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)GetProcAddress("glGenVertexArrays")) == NULL;
             error |= (IsVertexArray = (PFNGLISVERTEXARRAYPROC)GetProcAddress("glIsVertexArray")) == NULL;
 
+        #elif MOLTEN_PLATFORM == MOLTEN_PLATFORM_LINUX
+
+            error |= (GetStringi = (PFNGLGETSTRINGIPROC)GetProcAddress("glGetStringi")) == NULL;
+            error |= (BindVertexArray = (PFNGLBINDVERTEXARRAYPROC)GetProcAddress("glBindVertexArray")) == NULL;
+            error |= (DeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)GetProcAddress("glDeleteVertexArrays")) == NULL;
+            error |= (GenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)GetProcAddress("glGenVertexArrays")) == NULL;
+            error |= (IsVertexArray = (PFNGLISVERTEXARRAYPROC)GetProcAddress("glIsVertexArray")) == NULL;
+
         #endif
 
+            error |= (CreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)GetProcAddress("glCreateVertexArrays")) == NULL;
+            error |= (EnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)GetProcAddress("glEnableVertexArrayAttrib")) == NULL;
+            error |= (VertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)GetProcAddress("glVertexArrayAttribFormat")) == NULL;
+            error |= (VertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)GetProcAddress("glVertexArrayAttribIFormat")) == NULL;
+            error |= (VertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)GetProcAddress("glVertexArrayAttribBinding")) == NULL;
+            error |= (VertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)GetProcAddress("glVertexArrayBindingDivisor")) == NULL;
+            error |= (VertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)GetProcAddress("glVertexArrayVertexBuffer")) == NULL;
+            error |= (VertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)GetProcAddress("glVertexArrayElementBuffer")) == NULL;
+            error |= (CreateBuffers = (PFNGLCREATEBUFFERSPROC)GetProcAddress("glCreateBuffers")) == NULL;
+            error |= (DeleteBuffers = (PFNGLDELETEBUFFERSPROC)GetProcAddress("glDeleteBuffers")) == NULL;
+            error |= (BindBuffer = (PFNGLBINDBUFFERPROC)GetProcAddress("glBindBuffer")) == NULL;
+            error |= (BindBufferRange = (PFNGLBINDBUFFERRANGEPROC)GetProcAddress("glBindBufferRange")) == NULL;
+            error |= (NamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)GetProcAddress("glNamedBufferStorage")) == NULL;
+            error |= (MapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)GetProcAddress("glMapNamedBufferRange")) == NULL;
+            error |= (UnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)GetProcAddress("glUnmapNamedBuffer")) == NULL;
+            error |= (ClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)GetProcAddress("glClearNamedBufferSubData")) == NULL;
+            error |= (CreateTextures = (PFNGLCREATETEXTURESPROC)GetProcAddress("glCreateTextures")) == NULL;
+            error |= (TextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)GetProcAddress("glTextureStorage2D")) == NULL;
+            error |= (TextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)GetProcAddress("glTextureSubImage2D")) == NULL;
+            error |= (CreateSamplers = (PFNGLCREATESAMPLERSPROC)GetProcAddress("glCreateSamplers")) == NULL;
+            error |= (DeleteSamplers = (PFNGLDELETESAMPLERSPROC)GetProcAddress("glDeleteSamplers")) == NULL;
+            error |= (SamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)GetProcAddress("glSamplerParameteri")) == NULL;
+            error |= (SamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)GetProcAddress("glSamplerParameterf")) == NULL;
+            error |= (CreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)GetProcAddress("glCreateFramebuffers")) == NULL;
+            error |= (DeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)GetProcAddress("glDeleteFramebuffers")) == NULL;
+            error |= (BindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)GetProcAddress("glBindFramebuffer")) == NULL;
+            error |= (NamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)GetProcAddress("glNamedFramebufferRenderbuffer")) == NULL;
+            error |= (CheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)GetProcAddress("glCheckNamedFramebufferStatus")) == NULL;
+            error |= (CreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)GetProcAddress("glCreateRenderbuffers")) == NULL;
+            error |= (DeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)GetProcAddress("glDeleteRenderbuffers")) == NULL;
+            error |= (NamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)GetProcAddress("glNamedRenderbufferStorage")) == NULL;
+            error |= (CreateShader = (PFNGLCREATESHADERPROC)GetProcAddress("glCreateShader")) == NULL;
+            error |= (DeleteShader = (PFNGLDELETESHADERPROC)GetProcAddress("glDeleteShader")) == NULL;
+            error |= (ShaderBinary = (PFNGLSHADERBINARYPROC)GetProcAddress("glShaderBinary")) == NULL;
+            error |= (ShaderSource = (PFNGLSHADERSOURCEPROC)GetProcAddress("glShaderSource")) == NULL;
+            error |= (CompileShader = (PFNGLCOMPILESHADERPROC)GetProcAddress("glCompileShader")) == NULL;
+            error |= (GetShaderiv = (PFNGLGETSHADERIVPROC)GetProcAddress("glGetShaderiv")) == NULL;
+            error |= (GetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)GetProcAddress("glGetShaderInfoLog")) == NULL;
+            error |= (CreateProgram = (PFNGLCREATEPROGRAMPROC)GetProcAddress("glCreateProgram")) == NULL;
+            error |= (DeleteProgram = (PFNGLDELETEPROGRAMPROC)GetProcAddress("glDeleteProgram")) == NULL;
+            error |= (AttachShader = (PFNGLATTACHSHADERPROC)GetProcAddress("glAttachShader")) == NULL;
+            error |= (DetachShader = (PFNGLDETACHSHADERPROC)GetProcAddress("glDetachShader")) == NULL;
+            error |= (LinkProgram = (PFNGLLINKPROGRAMPROC)GetProcAddress("glLinkProgram")) == NULL;
+            error |= (GetProgramiv = (PFNGLGETPROGRAMIVPROC)GetProcAddress("glGetProgramiv")) == NULL;
+            error |= (GetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)GetProcAddress("glGetProgramInfoLog")) == NULL;
+            error |= (UseProgram = (PFNGLUSEPROGRAMPROC)GetProcAddress("glUseProgram")) == NULL;
+            error |= (ProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)GetProcAddress("glProgramUniform4fv")) == NULL;
+            error |= (ProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)GetProcAddress("glProgramUniform1ui")) == NULL;
+            error |= (DrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)GetProcAddress("glDrawArraysInstanced")) == NULL;
+            error |= (DrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)GetProcAddress("glDrawElementsInstanced")) == NULL;
+            error |= (MultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)GetProcAddress("glMultiDrawElementsIndirect")) == NULL;
+            error |= (DispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)GetProcAddress("glDispatchCompute")) == NULL;
+            error |= (MemoryBarriers = (PFNGLMEMORYBARRIERPROC)GetProcAddress("glMemoryBarrier")) == NULL;
+            error |= (FenceSync = (PFNGLFENCESYNCPROC)GetProcAddress("glFenceSync")) == NULL;
+            error |= (ClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)GetProcAddress("glClientWaitSync")) == NULL;
+            error |= (DeleteSync = (PFNGLDELETESYNCPROC)GetProcAddress("glDeleteSync")) == NULL;
+            error |= (ClipControl = (PFNGLCLIPCONTROLPROC)GetProcAddress("glClipControl")) == NULL;
+            error |= (PushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)GetProcAddress("glPushDebugGroup")) == NULL;
+            error |= (PopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)GetProcAddress("glPopDebugGroup")) == NULL;
+
+            // Optional functions, core in OpenGL 4.6 and otherwise provided by ARB extensions.
+            if ((SpecializeShader = (PFNGLSPECIALIZESHADERPROC)GetProcAddress("glSpecializeShader")) == NULL)
+            {
+                SpecializeShader = (PFNGLSPECIALIZESHADERPROC)GetProcAddress("glSpecializeShaderARB");
+            }
+            if ((MultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)GetProcAddress("glMultiDrawElementsIndirectCount")) == NULL)
+            {
+                MultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)GetProcAddress("glMultiDrawElementsIndirectCountARB");
+            }
+
             return !error;
         }
 
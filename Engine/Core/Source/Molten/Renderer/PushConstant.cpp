@@ -24,6 +24,8 @@
 */
 
 #include "Molten/Renderer/PushConstant.hpp"
+#include <algorithm>
+#include <cstring>
 
 namespace Molten
 {
@@ -35,4 +37,82 @@ namespace Molten
         dataType(dataType)
     {}
 
+
+    // Push constant buffer implementations.
+    PushConstantBuffer::PushConstantBuffer() :
+        m_data{},
+        m_dirtyBegin(0),
+        m_dirtyEnd(0)
+    {}
+
+    void PushConstantBuffer::Resize(const uint32_t size)
+    {
+        m_data.resize(size, 0);
+        m_dirtyEnd = std::min(m_dirtyEnd, size);
+        m_dirtyBegin = std::min(m_dirtyBegin, m_dirtyEnd);
+    }
+
+    void PushConstantBuffer::Reset()
+    {
+        std::fill(m_data.begin(), m_data.end(), uint8_t(0));
+        ClearDirty();
+    }
+
+    bool PushConstantBuffer::Write(const uint32_t offset, const void* data, const uint32_t size)
+    {
+        if (static_cast<size_t>(offset) + static_cast<size_t>(size) > m_data.size())
+        {
+            return false;
+        }
+        if (size == 0)
+        {
+            return true;
+        }
+
+        std::memcpy(m_data.data() + offset, data, size);
+
+        if (IsDirty())
+        {
+            m_dirtyBegin = std::min(m_dirtyBegin, offset);
+            m_dirtyEnd = std::max(m_dirtyEnd, offset + size);
+        }
+        else
+        {
+            m_dirtyBegin = offset;
+            m_dirtyEnd = offset + size;
+        }
+        return true;
+    }
+
+    bool PushConstantBuffer::IsDirty() const
+    {
+        return m_dirtyEnd > m_dirtyBegin;
+    }
+
+    uint32_t PushConstantBuffer::GetDirtyOffset() const
+    {
+        return m_dirtyBegin;
+    }
+
+    uint32_t PushConstantBuffer::GetDirtySize() const
+    {
+        return m_dirtyEnd - m_dirtyBegin;
+    }
+
+    const uint8_t* PushConstantBuffer::GetData() const
+    {
+        return m_data.data();
+    }
+
+    uint32_t PushConstantBuffer::GetSize() const
+    {
+        return static_cast<uint32_t>(m_data.size());
+    }
+
+    void PushConstantBuffer::ClearDirty()
+    {
+        m_dirtyBegin = 0;
+        m_dirtyEnd = 0;
+    }
+
 }
\ No newline at end of file
@@ -0,0 +1,247 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/RenderQueue.hpp"
+#include "Molten/Renderer/Renderer.hpp"
+#include "Molten/System/ThreadPool.hpp"
+#include <algorithm>
+#include <array>
+
+namespace Molten
+{
+
+    // Draw packet implementations.
+    DrawPacket::DrawPacket() :
+        sortKey(0),
+        pipeline(nullptr),
+        uniformBlock(nullptr),
+        uniformOffset(0),
+        indexBuffer(nullptr),
+        vertexBuffer(nullptr),
+        instanceBuffer(nullptr),
+        instanceCount(0)
+    {}
+
+
+    // Render queue implementations.
+    uint64_t RenderQueue::CreateSortKey(const uint8_t pass, const uint16_t pipeline, const uint16_t material, const uint32_t depth)
+    {
+        return
+            (static_cast<uint64_t>(pass) << 56) |
+            (static_cast<uint64_t>(pipeline) << 40) |
+            (static_cast<uint64_t>(material) << 24) |
+            (static_cast<uint64_t>(depth) & 0xFFFFFF);
+    }
+
+    uint32_t RenderQueue::QuantizeDepth(const float depth, const bool reverse)
+    {
+        const double clampedDepth = std::min(std::max(static_cast<double>(depth), 0.0), 1.0);
+        const uint32_t quantizedDepth = static_cast<uint32_t>(clampedDepth * static_cast<double>(0xFFFFFF) + 0.5);
+        return reverse ? 0xFFFFFF - quantizedDepth : quantizedDepth;
+    }
+
+    RenderQueue::RenderQueue(ThreadPool* threadPool) :
+        m_threadPool(threadPool),
+        m_sorted(false)
+    {}
+
+    void RenderQueue::Clear()
+    {
+        m_packets.clear();
+        m_entries.clear();
+        m_sorted = false;
+    }
+
+    void RenderQueue::Push(const DrawPacket& packet)
+    {
+        m_packets.push_back(packet);
+        m_sorted = false;
+    }
+
+    void RenderQueue::Sort()
+    {
+        m_entries.resize(m_packets.size());
+        for (size_t i = 0; i < m_packets.size(); i++)
+        {
+            m_entries[i] = { m_packets[i].sortKey, static_cast<uint32_t>(i) };
+        }
+
+        SortEntries();
+        m_sorted = true;
+    }
+
+    void RenderQueue::Submit(Renderer& renderer) const
+    {
+        Pipeline* boundPipeline = nullptr;
+        UniformBlock* boundUniformBlock = nullptr;
+        uint32_t boundUniformOffset = 0;
+
+        const size_t packetCount = GetPacketCount();
+        for (size_t i = 0; i < packetCount; i++)
+        {
+            const auto& packet = GetPacket(i);
+
+            if (packet.pipeline != boundPipeline)
+            {
+                renderer.BindPipeline(packet.pipeline);
+                boundPipeline = packet.pipeline;
+                boundUniformBlock = nullptr;
+            }
+
+            if (packet.uniformBlock && (packet.uniformBlock != boundUniformBlock || packet.uniformOffset != boundUniformOffset))
+            {
+                renderer.BindUniformBlock(packet.uniformBlock, packet.uniformOffset);
+                boundUniformBlock = packet.uniformBlock;
+                boundUniformOffset = packet.uniformOffset;
+            }
+
+            if (packet.instanceBuffer)
+            {
+                if (packet.indexBuffer)
+                {
+                    renderer.DrawVertexBufferInstanced(packet.indexBuffer, packet.vertexBuffer, packet.instanceBuffer, packet.instanceCount);
+                }
+                else
+                {
+                    renderer.DrawVertexBufferInstanced(packet.vertexBuffer, packet.instanceBuffer, packet.instanceCount);
+                }
+            }
+            else if (packet.indexBuffer)
+            {
+                renderer.DrawVertexBuffer(packet.indexBuffer, packet.vertexBuffer);
+            }
+            else
+            {
+                renderer.DrawVertexBuffer(packet.vertexBuffer);
+            }
+        }
+    }
+
+    size_t RenderQueue::GetPacketCount() const
+    {
+        return m_packets.size();
+    }
+
+    const DrawPacket& RenderQueue::GetPacket(const size_t index) const
+    {
+        return m_sorted ? m_packets[m_entries[index].index] : m_packets[index];
+    }
+
+    void RenderQueue::SortEntries()
+    {
+        const size_t count = m_entries.size();
+        m_scratchEntries.resize(count);
+
+        // Each chunk of entries is histogrammed and scattered by its own task.
+        size_t chunkCount = 1;
+        if (m_threadPool && count >= ParallelSortThreshold && !m_threadPool->IsWorkerThread())
+        {
+            chunkCount = std::max(std::min(m_threadPool->GetThreadCount(), count / (ParallelSortThreshold / 4)), size_t(1));
+        }
+        const size_t chunkSize = (count + chunkCount - 1) / std::max(chunkCount, size_t(1));
+
+        auto forEachChunk = [&](const auto& function)
+        {
+            if (chunkCount == 1)
+            {
+                function(size_t(0));
+                return;
+            }
+
+            std::vector<std::future<void>> futures;
+            futures.reserve(chunkCount);
+            for (size_t chunk = 0; chunk < chunkCount; chunk++)
+            {
+                futures.push_back(m_threadPool->Execute([&function, chunk]()
+                {
+                    function(chunk);
+                }));
+            }
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+        };
+
+        std::vector<std::array<size_t, 256>> histograms(chunkCount);
+        SortEntry* source = m_entries.data();
+        SortEntry* destination = m_scratchEntries.data();
+
+        for (uint32_t shift = 0; shift < 64; shift += 8)
+        {
+            forEachChunk([&](const size_t chunk)
+            {
+                auto& histogram = histograms[chunk];
+                histogram.fill(0);
+
+                const size_t end = std::min((chunk + 1) * chunkSize, count);
+                for (size_t i = chunk * chunkSize; i < end; i++)
+                {
+                    ++histogram[(source[i].key >> shift) & 0xFF];
+                }
+            });
+
+            // Exclusive prefix sum, ordered by digit and then by chunk to keep the sort stable.
+            bool uniformDigit = false;
+            size_t offset = 0;
+            for (size_t digit = 0; digit < 256; digit++)
+            {
+                const size_t digitStart = offset;
+                for (auto& histogram : histograms)
+                {
+                    const size_t digitCount = histogram[digit];
+                    histogram[digit] = offset;
+                    offset += digitCount;
+                }
+                uniformDigit |= (offset - digitStart) == count;
+            }
+
+            // All keys share the same digit, entries are already in order for this pass.
+            if (uniformDigit)
+            {
+                continue;
+            }
+
+            forEachChunk([&](const size_t chunk)
+            {
+                auto& offsets = histograms[chunk];
+
+                const size_t end = std::min((chunk + 1) * chunkSize, count);
+                for (size_t i = chunk * chunkSize; i < end; i++)
+                {
+                    destination[offsets[(source[i].key >> shift) & 0xFF]++] = source[i];
+                }
+            });
+
+            std::swap(source, destination);
+        }
+
+        if (source != m_entries.data())
+        {
+            m_entries.swap(m_scratchEntries);
+        }
+    }
+
+}
\ No newline at end of file
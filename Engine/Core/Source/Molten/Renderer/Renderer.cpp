@@ -24,6 +24,7 @@
 */
 
 #include "Molten/Renderer/Renderer.hpp"
+#include "Molten/Renderer/Null/NullRenderer.hpp"
 #include "Molten/Renderer/OpenGL/OpenGLRenderer.hpp"
 #include "Molten/Renderer/Vulkan/VulkanRenderer.hpp"
 
@@ -46,6 +47,8 @@ namespace Molten
 #else
             break;
 #endif
+        case BackendApi::Null:
+            return new NullRenderer;
         }
 
         return nullptr;
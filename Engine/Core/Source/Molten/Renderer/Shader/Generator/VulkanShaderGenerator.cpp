@@ -26,9 +26,11 @@
 #include "Molten/Renderer/Shader/Generator/VulkanShaderGenerator.hpp"
 #include "Molten/Renderer/Shader/Visual/VisualShaderScript.hpp"
 #include "Molten/Logger.hpp"
+#include "Molten/System/Profiler.hpp"
 #include <memory>
 #include <map>
 #include <stack>
+#include <mutex>
 
 #if defined(MOLTEN_ENABLE_GLSLANG)
 #include "ThirdParty/glslang/glslang/Public/ShaderLang.h"
@@ -91,6 +93,12 @@ namespace Molten::Shader
         throw Exception("GetGlslVariableDataType is missing return value for dataType = " + std::to_string(static_cast<size_t>(dataType)) + ".");
     }
 
+    /** Number of consumed locations of an input variable, matrices consume one location per column. */
+    static size_t GetGlslVariableLocationCount(const VariableDataType dataType)
+    {
+        return dataType == VariableDataType::Matrix4x4f32 ? 4 : 1;
+    }
+
     static const std::string& GetGlslArithmeticOperator(const Visual::ArithmeticOperatorType op)
     {
         switch (op)
@@ -232,6 +240,7 @@ namespace Molten::Shader
         {
             case Shader::Type::Vertex: return g_glslVertexName;
             case Shader::Type::Fragment: return g_glslFragmentName;
+            default: break;
         }
         throw Exception("GetGlslShaderTypeName is missing return value for type = " + std::to_string(static_cast<size_t>(type)) + ".");
     }
@@ -255,6 +264,8 @@ namespace Molten::Shader
         const std::vector<Visual::Script*>& scripts,
         Logger* logger)
     {
+        MOLTEN_PROFILE_ZONE("VulkanGenerator::GenerateGlslTemplate");
+
         PushConstantOffsets pushConstantOffsets;
         PushConstantLocations pushConstantLocations;
         uint32_t nextByteOffset = 0;
@@ -326,8 +337,11 @@ namespace Molten::Shader
     std::vector<uint8_t> VulkanGenerator::GenerateGlsl(
         const Visual::Script& script, 
         const GlslStageTemplates* templateData,
-        Logger* logger)
+        Logger* logger,
+        const TargetApi targetApi)
     {
+        MOLTEN_PROFILE_ZONE("VulkanGenerator::GenerateGlsl");
+
         struct Variable
         {
             Variable(const std::string& name, const Visual::Node* node, const Visual::Pin* pin) :
@@ -429,6 +443,7 @@ namespace Molten::Shader
         constexpr size_t estLocalLength = 35;
 
         auto& inputInterface = script.GetInputInterface();
+        auto* instanceInputInterface = script.GetInstanceInputInterface();
         auto& outputInterface = script.GetOutputInterface();
         auto& uniformInterfaces = script.GetUniformInterfaces();
         const Visual::OutputVariable<Vector4f32>* vertexOutputNode =
@@ -436,6 +451,7 @@ namespace Molten::Shader
 
         const size_t estimatedSourceLength = estMainLength + estPreMainLength +
             (inputInterface.GetMemberCount() * estInputLength) +
+            (instanceInputInterface ? instanceInputInterface->GetMemberCount() * estInputLength : 0) +
             (outputInterface.GetMemberCount() * estOutputLength) +
             (vertexOutputNode ? estVertOutputLength : 0) +
             (script.GetNodeCount() * estLocalLength) +
@@ -451,20 +467,31 @@ namespace Molten::Shader
 
         std::map<const Visual::Pin*, VariablePtr> visitedOutputPins;
 
-        // Input variables.
+        // Input variables, followed by per instance input variables.
         size_t index = 0;
-        for (auto* member : inputInterface.GetMembers())
+        size_t location = 0;
+        auto appendInputVariables = [&](const Visual::InputInterface& interface)
         {
-            for (auto* pin : member->GetOutputPins())
+            for (auto* member : interface.GetMembers())
             {
-                const std::string name = "in_" + std::to_string(index);
-                AppendToVector(source,
-                    "layout(location = " + std::to_string(index) + ") in " +
-                    GetGlslVariableDataType(pin->GetDataType()) + " " + name + ";\n");
-
-                visitedOutputPins.insert({ pin, std::make_shared<Variable>(name, member, pin) });
-                index++;
+                for (auto* pin : member->GetOutputPins())
+                {
+                    const std::string name = "in_" + std::to_string(index);
+                    AppendToVector(source,
+                        "layout(location = " + std::to_string(location) + ") in " +
+                        GetGlslVariableDataType(pin->GetDataType()) + " " + name + ";\n");
+
+                    visitedOutputPins.insert({ pin, std::make_shared<Variable>(name, member, pin) });
+                    index++;
+                    location += GetGlslVariableLocationCount(pin->GetDataType());
+                }
             }
+        };
+
+        appendInputVariables(inputInterface);
+        if (instanceInputInterface)
+        {
+            appendInputVariables(*instanceInputInterface);
         }
 
         // Uniform variables.
@@ -472,7 +499,15 @@ namespace Molten::Shader
         for (auto* uniformInterface : uniformInterfaces)
         {
             const std::string blockName = "ubo_" + std::to_string(index);
-            AppendToVector(source, "layout(std140, binding= 0, set = " + std::to_string(index) + ") uniform s_" + blockName + "\n{\n");
+            if (targetApi == TargetApi::OpenGL)
+            {
+                // OpenGL has no descriptor sets, every set is bound to the uniform buffer binding of equal index.
+                AppendToVector(source, "layout(std140, binding = " + std::to_string(index) + ") uniform s_" + blockName + "\n{\n");
+            }
+            else
+            {
+                AppendToVector(source, "layout(std140, binding= 0, set = " + std::to_string(index) + ") uniform s_" + blockName + "\n{\n");
+            }
             index++;
 
             size_t varIndex = 0;
@@ -522,7 +557,14 @@ namespace Molten::Shader
         if (usePushConstants)
         {    
             const std::string blockName = "pc";
-            AppendToVector(source, "layout(std140, push_constant) uniform s_" + shaderTypeName + '_' + blockName + "\n{\n");
+            if (targetApi == TargetApi::OpenGL)
+            {
+                AppendToVector(source, "layout(std140, binding = " + std::to_string(OpenGLPushConstantBinding) + ") uniform s_" + shaderTypeName + '_' + blockName + "\n{\n");
+            }
+            else
+            {
+                AppendToVector(source, "layout(std140, push_constant) uniform s_" + shaderTypeName + '_' + blockName + "\n{\n");
+            }
             AppendToVector(source, *pushConstantSource);
             AppendToVector(source, "} " + blockName + ";\n");
 
@@ -705,7 +747,7 @@ namespace Molten::Shader
     }
 
 #if defined(MOLTEN_ENABLE_GLSLANG)
-    std::vector<uint8_t> VulkanGenerator::ConvertGlslToSpriV(const std::vector<uint8_t>& code, Type shaderType, Logger* logger)
+    std::vector<uint8_t> VulkanGenerator::ConvertGlslToSpriV(const std::vector<uint8_t>& code, Type shaderType, Logger* logger, const TargetApi targetApi)
     {
         // Helper function for getting the shader type.
         static auto GetEShShaderType = [](const Shader::Type type) -> EShLanguage
@@ -714,6 +756,7 @@ namespace Molten::Shader
             {
                 case Type::Vertex:   return EShLanguage::EShLangVertex;
                 case Type::Fragment: return EShLanguage::EShLangFragment;
+                case Type::Compute:  return EShLanguage::EShLangCompute;
                 default: break;
             }
 
@@ -832,13 +875,12 @@ namespace Molten::Shader
 
         static const TBuiltInResource resources = GetDefaultResources();
 
-        // Initialize glslang for the first time we run.
-        static bool glslangInitialized = false;
-        if (!glslangInitialized)
+        // Initialize glslang for the first time we run, stages may be compiled by multiple threads.
+        static std::once_flag glslangInitialized;
+        std::call_once(glslangInitialized, []()
         {
             glslang::InitializeProcess();
-            glslangInitialized = true;
-        }
+        });
 
         // Set configs of shader.
         EShLanguage language = GetEShShaderType(shaderType);
@@ -847,15 +889,26 @@ namespace Molten::Shader
         glslang::EShTargetLanguageVersion TargetVersion = glslang::EShTargetSpv_1_1;
 
         glslang::TShader shader(language);
-        shader.setEnvInput(glslang::EShSourceGlsl, language, glslang::EShClientVulkan, clientInputSemanticsVersion);
-        shader.setEnvClient(glslang::EShClientVulkan, VulkanClientVersion);
-        shader.setEnvTarget(glslang::EShTargetSpv, TargetVersion);
+        EShMessages messages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules);
+
+        if (targetApi == TargetApi::OpenGL)
+        {
+            // GL_ARB_gl_spirv consumes SPIR-V 1.0.
+            shader.setEnvInput(glslang::EShSourceGlsl, language, glslang::EShClientOpenGL, clientInputSemanticsVersion);
+            shader.setEnvClient(glslang::EShClientOpenGL, glslang::EShTargetOpenGL_450);
+            shader.setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_0);
+            messages = EShMsgSpvRules;
+        }
+        else
+        {
+            shader.setEnvInput(glslang::EShSourceGlsl, language, glslang::EShClientVulkan, clientInputSemanticsVersion);
+            shader.setEnvClient(glslang::EShClientVulkan, VulkanClientVersion);
+            shader.setEnvTarget(glslang::EShTargetSpv, TargetVersion);
+        }
 
         const char* inputCString = reinterpret_cast<const char*>(code.data());
         const int inputCLength = static_cast<int>(code.size());
         shader.setStringsWithLengths(&inputCString, &inputCLength, 1);
-
-        EShMessages messages = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules);
         const int defaultVersion = 100;
 
         // Preprocess the shader.
@@ -906,7 +959,7 @@ namespace Molten::Shader
         return output;
     }
 #else
-    std::vector<uint8_t> VulkanGenerator::ConvertGlslToSpriV(const std::vector<uint8_t>&, Type, Logger* logger)
+    std::vector<uint8_t> VulkanGenerator::ConvertGlslToSpriV(const std::vector<uint8_t>&, Type, Logger* logger, const TargetApi)
     {
         Logger::WriteError(logger, "Failed to convert GLSL code to SPIR-V. MOLTEN_ENABLE_GLSLANG is not enabled.");
         return {};
@@ -0,0 +1,188 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/Shader/SpirvCache.hpp"
+#include "Molten/Renderer/Shader/Generator/VulkanShaderGenerator.hpp"
+#include "Molten/System/FileSystem.hpp"
+#include "Molten/System/Exception.hpp"
+#include <cstdio>
+#include <cstring>
+
+namespace Molten::Shader
+{
+
+    static const uint32_t g_spirvMagicNumber = 0x07230203;
+    static const uint64_t g_fnvOffsetBasis = 14695981039346656037ULL;
+    static const uint64_t g_fnvPrime = 1099511628211ULL;
+
+    static uint64_t HashBytes(uint64_t hash, const uint8_t* data, const size_t size)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            hash ^= static_cast<uint64_t>(data[i]);
+            hash *= g_fnvPrime;
+        }
+        return hash;
+    }
+
+
+    SpirvCache::SpirvCache()
+    { }
+
+    SpirvCache::SpirvCache(const std::string& directory) :
+        m_directory(directory)
+    { }
+
+    void SpirvCache::SetDirectory(const std::string& directory)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_directory = directory;
+    }
+
+    std::string SpirvCache::GetDirectory() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_directory;
+    }
+
+    uint64_t SpirvCache::CreateKey(const std::vector<uint8_t>& sourceCode, const Type shaderType)
+    {
+        const uint32_t generatorVersion = VulkanGenerator::GeneratorVersion;
+        const uint8_t type = static_cast<uint8_t>(shaderType);
+
+        uint64_t hash = g_fnvOffsetBasis;
+        hash = HashBytes(hash, reinterpret_cast<const uint8_t*>(&generatorVersion), sizeof(generatorVersion));
+        hash = HashBytes(hash, &type, sizeof(type));
+        hash = HashBytes(hash, sourceCode.data(), sourceCode.size());
+        return hash;
+    }
+
+    bool SpirvCache::Load(const uint64_t key, std::vector<uint8_t>& spirvCode)
+    {
+        std::string directory;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto it = m_entries.find(key);
+            if (it != m_entries.end())
+            {
+                spirvCode = it->second;
+                return true;
+            }
+
+            directory = m_directory;
+        }
+
+        if (directory.empty())
+        {
+            return false;
+        }
+
+        // File IO is done without holding the lock, other threads may still hit the in-memory entries.
+        std::vector<uint8_t> fileData;
+        try
+        {
+            fileData = FileSystem::ReadFile(GetFilename(directory, key));
+        }
+        catch (Exception &)
+        {
+            return false;
+        }
+
+        if (!IsValidSpirv(fileData))
+        {
+            return false;
+        }
+
+        spirvCode = fileData;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.insert({ key, std::move(fileData) });
+        return true;
+    }
+
+    bool SpirvCache::Store(const uint64_t key, const std::vector<uint8_t>& spirvCode)
+    {
+        if (!IsValidSpirv(spirvCode))
+        {
+            return false;
+        }
+
+        const std::string directory = GetDirectory();
+        const bool written = directory.empty() || WriteFile(directory, key, spirvCode);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries[key] = spirvCode;
+        return written;
+    }
+
+    void SpirvCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+    }
+
+    size_t SpirvCache::GetEntryCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_entries.size();
+    }
+
+    std::string SpirvCache::GetFilename(const std::string& directory, const uint64_t key)
+    {
+        char keyString[17];
+        std::snprintf(keyString, sizeof(keyString), "%016llx", static_cast<unsigned long long>(key));
+        return directory + "/" + keyString + ".spv";
+    }
+
+    bool SpirvCache::WriteFile(const std::string& directory, const uint64_t key, const std::vector<uint8_t>& spirvCode)
+    {
+        FileSystem::MakeDirectory(directory);
+
+        // Write to temporary file first, partially written files are never loaded by concurrent runs.
+        const std::string filename = GetFilename(directory, key);
+        const std::string temporaryFilename = filename + ".tmp";
+        if (!FileSystem::WriteFile(temporaryFilename, spirvCode.data(), spirvCode.size()))
+        {
+            return false;
+        }
+
+        std::remove(filename.c_str());
+        return std::rename(temporaryFilename.c_str(), filename.c_str()) == 0;
+    }
+
+    bool SpirvCache::IsValidSpirv(const std::vector<uint8_t>& spirvCode)
+    {
+        if (spirvCode.size() < sizeof(uint32_t) * 5 || spirvCode.size() % sizeof(uint32_t) != 0)
+        {
+            return false;
+        }
+
+        uint32_t magicNumber = 0;
+        std::memcpy(&magicNumber, spirvCode.data(), sizeof(magicNumber));
+        return magicNumber == g_spirvMagicNumber;
+    }
+
+}
\ No newline at end of file
@@ -38,10 +38,20 @@ namespace Molten::Shader::Visual
         return nullptr;
     }
 
+    InputInterface* Script::GetInstanceInputInterface()
+    {
+        return nullptr;
+    }
+    const InputInterface* Script::GetInstanceInputInterface() const
+    {
+        return nullptr;
+    }
+
 
     // Vertex shader script implementations.
     VertexScript::VertexScript() :
         m_inputInterface(*this),
+        m_instanceInputInterface(*this),
         m_outputInterface(*this),
         m_uniformInterfaces(*this),
         m_pushConstantInterface(*this),
@@ -133,6 +143,15 @@ namespace Molten::Shader::Visual
         return &m_vertexOutputVariable;
     }
 
+    InputInterface* VertexScript::GetInstanceInputInterface()
+    {
+        return &m_instanceInputInterface;
+    }
+    const InputInterface* VertexScript::GetInstanceInputInterface() const
+    {
+        return &m_instanceInputInterface;
+    }
+
 
     // Fragment shader script implementations.
     FragmentScript::FragmentScript() :
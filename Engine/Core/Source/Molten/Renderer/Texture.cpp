@@ -0,0 +1,80 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/Texture.hpp"
+#include "Molten/System/Exception.hpp"
+#include <algorithm>
+#include <string>
+
+namespace Molten
+{
+
+    size_t Texture::GetFormatSize(const Format format)
+    {
+        switch (format)
+        {
+            case Format::Red8:        return 1;
+            case Format::RedGreen8:   return 2;
+            case Format::Rgba8:       return 4;
+            case Format::Rgba8Srgb:   return 4;
+            case Format::Rgba16Float: return 8;
+            case Format::Rgba32Float: return 16;
+        }
+        throw Exception("GetFormatSize is missing return value for format = " + std::to_string(static_cast<size_t>(format)) + ".");
+    }
+
+    uint32_t Texture::GetMipLevelCount(const Vector2ui32& dimensions)
+    {
+        uint32_t levelCount = 1;
+        for (uint32_t size = std::max(dimensions.x, dimensions.y); size > 1; size >>= 1)
+        {
+            ++levelCount;
+        }
+        return levelCount;
+    }
+
+    Vector2ui32 Texture::GetMipLevelDimensions(const Vector2ui32& dimensions, const uint32_t mipLevel)
+    {
+        if (mipLevel >= 32)
+        {
+            return { 1, 1 };
+        }
+        return { std::max(dimensions.x >> mipLevel, uint32_t(1)), std::max(dimensions.y >> mipLevel, uint32_t(1)) };
+    }
+
+    size_t Texture::GetMipChainSize(const Vector2ui32& dimensions, const Format format, const uint32_t firstMipLevel, const uint32_t mipLevelCount)
+    {
+        const size_t formatSize = GetFormatSize(format);
+
+        size_t size = 0;
+        for (uint32_t level = firstMipLevel; level < firstMipLevel + mipLevelCount; level++)
+        {
+            const auto levelDimensions = GetMipLevelDimensions(dimensions, level);
+            size += static_cast<size_t>(levelDimensions.x) * static_cast<size_t>(levelDimensions.y) * formatSize;
+        }
+        return size;
+    }
+
+}
\ No newline at end of file
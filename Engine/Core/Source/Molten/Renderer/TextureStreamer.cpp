@@ -0,0 +1,194 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/TextureStreamer.hpp"
+#include "Molten/System/Exception.hpp"
+#include <algorithm>
+
+namespace Molten
+{
+
+    TextureStreamer::TextureStreamer(const size_t memoryBudget, const size_t frameUploadBudget) :
+        m_memoryBudget(memoryBudget),
+        m_frameUploadBudget(frameUploadBudget),
+        m_residentSize(0)
+    {}
+
+    void TextureStreamer::SetMemoryBudget(const size_t memoryBudget)
+    {
+        m_memoryBudget = memoryBudget;
+    }
+
+    void TextureStreamer::SetFrameUploadBudget(const size_t frameUploadBudget)
+    {
+        m_frameUploadBudget = frameUploadBudget;
+    }
+
+    void TextureStreamer::Add(Texture* texture, const Vector2ui32& dimensions, const Texture::Format format, const uint32_t mipLevelCount)
+    {
+        if (m_entryIndices.find(texture) != m_entryIndices.end())
+        {
+            throw Exception("Texture is already added to texture streamer.");
+        }
+        if (!mipLevelCount)
+        {
+            throw Exception("Cannot stream texture without any mip levels.");
+        }
+
+        m_entryIndices.insert({ texture, m_entries.size() });
+        m_entries.push_back({ texture, dimensions, format, mipLevelCount, mipLevelCount, 0, mipLevelCount, 0 });
+    }
+
+    void TextureStreamer::Remove(Texture* texture)
+    {
+        auto it = m_entryIndices.find(texture);
+        if (it == m_entryIndices.end())
+        {
+            return;
+        }
+
+        const size_t index = it->second;
+        m_residentSize -= m_entries[index].residentSize;
+        m_entryIndices.erase(it);
+
+        // Keep the entries packed, by moving the last entry into the removed slot.
+        if (index + 1 != m_entries.size())
+        {
+            m_entries[index] = m_entries.back();
+            m_entryIndices[m_entries[index].texture] = index;
+        }
+        m_entries.pop_back();
+    }
+
+    void TextureStreamer::Update(std::vector<Request>& requests)
+    {
+        requests.clear();
+
+        m_candidates.clear();
+        for (size_t i = 0; i < m_entries.size(); i++)
+        {
+            const auto& entry = m_entries[i];
+            if (entry.residentMipLevel == 0)
+            {
+                continue;
+            }
+
+            const uint32_t mipLevel = entry.residentMipLevel == entry.mipLevelCount ? GetInitialMipLevel(entry) : entry.residentMipLevel - 1;
+            const size_t uploadSize = Texture::GetMipChainSize(entry.dimensions, entry.format, mipLevel, entry.mipLevelCount - mipLevel);
+            m_candidates.push_back({ i, mipLevel, uploadSize });
+        }
+
+        // Coarse chains first, new textures get usable before any texture is refined further.
+        std::stable_sort(m_candidates.begin(), m_candidates.end(), [](const Candidate& lhs, const Candidate& rhs)
+        {
+            return lhs.uploadSize < rhs.uploadSize;
+        });
+
+        size_t uploadedSize = 0;
+        for (const auto& candidate : m_candidates)
+        {
+            if (uploadedSize && uploadedSize + candidate.uploadSize > m_frameUploadBudget)
+            {
+                break;
+            }
+
+            auto& entry = m_entries[candidate.entryIndex];
+            const bool initial = entry.residentMipLevel == entry.mipLevelCount;
+            const size_t newResidentSize = m_residentSize - entry.residentSize + candidate.uploadSize;
+            if (!initial && newResidentSize > m_memoryBudget)
+            {
+                continue;
+            }
+
+            entry.previousMipLevel = entry.residentMipLevel;
+            entry.previousSize = entry.residentSize;
+            entry.residentMipLevel = candidate.mipLevel;
+            entry.residentSize = candidate.uploadSize;
+            m_residentSize = newResidentSize;
+            uploadedSize += candidate.uploadSize;
+            requests.push_back({ entry.texture, candidate.mipLevel, candidate.uploadSize });
+        }
+    }
+
+    void TextureStreamer::Reject(Texture* texture)
+    {
+        auto it = m_entryIndices.find(texture);
+        if (it == m_entryIndices.end())
+        {
+            return;
+        }
+
+        auto& entry = m_entries[it->second];
+        m_residentSize = m_residentSize - entry.residentSize + entry.previousSize;
+        entry.residentMipLevel = entry.previousMipLevel;
+        entry.residentSize = entry.previousSize;
+    }
+
+    uint32_t TextureStreamer::GetResidentMipLevel(const Texture* texture) const
+    {
+        return GetEntry(texture).residentMipLevel;
+    }
+
+    bool TextureStreamer::IsFullyResident(const Texture* texture) const
+    {
+        return GetEntry(texture).residentMipLevel == 0;
+    }
+
+    size_t TextureStreamer::GetResidentSize() const
+    {
+        return m_residentSize;
+    }
+
+    size_t TextureStreamer::GetTextureCount() const
+    {
+        return m_entries.size();
+    }
+
+    const TextureStreamer::Entry& TextureStreamer::GetEntry(const Texture* texture) const
+    {
+        auto it = m_entryIndices.find(texture);
+        if (it == m_entryIndices.end())
+        {
+            throw Exception("Texture is not added to texture streamer.");
+        }
+        return m_entries[it->second];
+    }
+
+    uint32_t TextureStreamer::GetInitialMipLevel(const Entry& entry) const
+    {
+        uint32_t mipLevel = 0;
+        while (mipLevel + 1 < entry.mipLevelCount)
+        {
+            const auto dimensions = Texture::GetMipLevelDimensions(entry.dimensions, mipLevel);
+            if (std::max(dimensions.x, dimensions.y) <= InitialMaxDimension)
+            {
+                break;
+            }
+            ++mipLevel;
+        }
+        return mipLevel;
+    }
+
+}
\ No newline at end of file
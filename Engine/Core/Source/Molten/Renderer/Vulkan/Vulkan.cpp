@@ -51,7 +51,8 @@ namespace Molten
             swapchainInfo.imageColorSpace = surfaceFormat.colorSpace;
             swapchainInfo.imageExtent = capabilities.currentExtent;
             swapchainInfo.imageArrayLayers = 1;
-            swapchainInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+            // Framebuffers are blitted into the images, if supported by the surface.
+            swapchainInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | (capabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT);
             swapchainInfo.preTransform = capabilities.currentTransform;
             swapchainInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
             swapchainInfo.oldSwapchain = oldSwapchain;
@@ -76,11 +77,6 @@ namespace Molten
                 return VK_NULL_HANDLE;
             }
 
-            if (oldSwapchain)
-            {
-                vkDestroySwapchainKHR(logicalDevice, oldSwapchain, nullptr);
-            }
-
             return swapchain;
         }
 
@@ -0,0 +1,406 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/Vulkan/VulkanCommandBuffer.hpp"
+
+#if defined(MOLTEN_ENABLE_VULKAN)
+
+#include "Molten/Renderer/Vulkan/VulkanRenderer.hpp"
+#include "Molten/Renderer/Vulkan/VulkanFramebuffer.hpp"
+#include "Molten/Renderer/Vulkan/VulkanIndexBuffer.hpp"
+#include "Molten/Renderer/Vulkan/VulkanIndirectBuffer.hpp"
+#include "Molten/Renderer/Vulkan/VulkanPipeline.hpp"
+#include "Molten/Renderer/Vulkan/VulkanUniformBlock.hpp"
+#include "Molten/Renderer/Vulkan/VulkanVertexBuffer.hpp"
+#include "Molten/Logger.hpp"
+#include "Molten/System/Exception.hpp"
+#include <algorithm>
+
+namespace Molten
+{
+
+    // Static helper functions.
+    static VkIndexType GetIndexBufferDataType(const IndexBuffer::DataType dataType)
+    {
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (dataType)
+        {
+            case IndexBuffer::DataType::Uint16: return VkIndexType::VK_INDEX_TYPE_UINT16;
+            case IndexBuffer::DataType::Uint32: return VkIndexType::VK_INDEX_TYPE_UINT32;
+        }
+        MOLTEN_UNSCOPED_ENUM_END
+
+        throw Exception("Provided data type is not supported as index buffer data type by the Vulkan renderer.");
+    }
+
+
+    // Vulkan command buffer class implementations.
+    bool VulkanCommandBuffer::Begin(Framebuffer* framebuffer)
+    {
+        auto* logger = renderer->m_logger;
+
+        if (recording)
+        {
+            Logger::WriteError(logger, "Calling Begin of command buffer twice, without any previous call to End.");
+            return false;
+        }
+        if (!renderer->m_beginDraw)
+        {
+            Logger::WriteError(logger, "Cannot begin recording of command buffer without any previous call to BeginDraw.");
+            return false;
+        }
+
+        currentFrame = renderer->m_currentFrame;
+
+        // Number of frames in flight may have been increased since last recording.
+        if (currentFrame >= commandBuffers.size())
+        {
+            const size_t allocatedCount = commandBuffers.size();
+            commandBuffers.resize(currentFrame + 1, VK_NULL_HANDLE);
+
+            VkCommandBufferAllocateInfo commandBufferInfo = {};
+            commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            commandBufferInfo.commandPool = commandPool;
+            commandBufferInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            commandBufferInfo.commandBufferCount = static_cast<uint32_t>(commandBuffers.size() - allocatedCount);
+
+            if (vkAllocateCommandBuffers(renderer->m_logicalDevice, &commandBufferInfo, commandBuffers.data() + allocatedCount) != VK_SUCCESS)
+            {
+                commandBuffers.resize(allocatedCount);
+                Logger::WriteError(logger, "Failed to allocate secondary command buffers.");
+                return false;
+            }
+        }
+
+        currentCommandBuffer = commandBuffers[currentFrame];
+        currentPipeline = nullptr;
+        currentFramebuffer = static_cast<VulkanFramebuffer*>(framebuffer);
+        bindStateCache.Reset();
+        bindStateCache.ClearStatistics();
+        pushConstantBuffer.Reset();
+
+        VkCommandBufferInheritanceInfo inheritanceInfo = {};
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.renderPass = renderer->m_renderPass;
+        inheritanceInfo.subpass = 0;
+        // Framebuffer objects of framebuffers are recreated with the frame graph, possibly before the commands are executed.
+        inheritanceInfo.framebuffer = currentFramebuffer ? VK_NULL_HANDLE : renderer->m_currentFramebuffer;
+
+        VkCommandBufferBeginInfo commandBufferBeginInfo = {};
+        commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+        commandBufferBeginInfo.pInheritanceInfo = &inheritanceInfo;
+
+        if (vkBeginCommandBuffer(currentCommandBuffer, &commandBufferBeginInfo) != VK_SUCCESS)
+        {
+            currentCommandBuffer = VK_NULL_HANDLE;
+            Logger::WriteError(logger, "Failed to begin recording secondary command buffer.");
+            return false;
+        }
+
+        // Dynamic states are not inherited from the primary command buffer.
+        const VkExtent2D extent = currentFramebuffer ?
+            VkExtent2D{ currentFramebuffer->size.x, currentFramebuffer->size.y } :
+            renderer->m_swapChainExtent;
+
+        VkViewport viewport = {};
+        viewport.x = 0.0f;
+        viewport.y = 0.0f;
+        viewport.width = static_cast<float>(extent.width);
+        viewport.height = static_cast<float>(extent.height);
+        viewport.minDepth = 0.0f;
+        viewport.maxDepth = 0.0f;
+
+        VkRect2D scissor = {};
+        scissor.offset = { 0, 0 };
+        scissor.extent = extent;
+
+        vkCmdSetViewport(currentCommandBuffer, 0, 1, &viewport);
+        vkCmdSetScissor(currentCommandBuffer, 0, 1, &scissor);
+
+        recording = true;
+        return true;
+    }
+
+    void VulkanCommandBuffer::End()
+    {
+        if (!recording)
+        {
+            Logger::WriteError(renderer->m_logger, "Calling End of command buffer, without any previous call to Begin.");
+            return;
+        }
+
+        recording = false;
+        currentPipeline = nullptr;
+
+        if (vkEndCommandBuffer(currentCommandBuffer) != VK_SUCCESS)
+        {
+            currentCommandBuffer = VK_NULL_HANDLE;
+            Logger::WriteError(renderer->m_logger, "Failed to record secondary command buffer.");
+        }
+    }
+
+    void VulkanCommandBuffer::BindPipeline(Pipeline* pipeline)
+    {
+        VulkanPipeline* vulkanPipeline = static_cast<VulkanPipeline*>(pipeline);
+        if (!bindStateCache.BindPipeline(vulkanPipeline))
+        {
+            return;
+        }
+
+        // Pending writes target the layout of the previous pipeline.
+        InternalFlushPushConstants();
+
+        vkCmdBindPipeline(currentCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vulkanPipeline->graphicsPipeline);
+        currentPipeline = vulkanPipeline;
+        pushConstantBuffer.Resize(vulkanPipeline->pushConstantSize);
+    }
+
+    void VulkanCommandBuffer::BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset)
+    {
+        VulkanUniformBlock* vulkanUniformBlock = static_cast<VulkanUniformBlock*>(uniformBlock);
+        if (!bindStateCache.BindUniformBlock(vulkanUniformBlock->set, vulkanUniformBlock, offset))
+        {
+            return;
+        }
+
+        vkCmdBindDescriptorSets(currentCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vulkanUniformBlock->pipelineLayout, vulkanUniformBlock->set, 1,
+            &vulkanUniformBlock->descriptorSets[currentFrame], 1, &offset);
+    }
+
+    void VulkanCommandBuffer::DrawVertexBuffer(VertexBuffer* vertexBuffer)
+    {
+        VulkanVertexBuffer* vulkanVertexBuffer = static_cast<VulkanVertexBuffer*>(vertexBuffer);
+
+        InternalBindVertexBuffers(vulkanVertexBuffer, nullptr);
+        InternalFlushPushConstants();
+        vkCmdDraw(currentCommandBuffer, static_cast<uint32_t>(vulkanVertexBuffer->vertexCount), 1, 0, 0);
+    }
+
+    void VulkanCommandBuffer::DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer)
+    {
+        VulkanIndexBuffer* vulkanIndexBuffer = static_cast<VulkanIndexBuffer*>(indexBuffer);
+        VulkanVertexBuffer* vulkanVertexBuffer = static_cast<VulkanVertexBuffer*>(vertexBuffer);
+
+        InternalBindVertexBuffers(vulkanVertexBuffer, nullptr);
+        InternalBindIndexBuffer(vulkanIndexBuffer);
+        InternalFlushPushConstants();
+        vkCmdDrawIndexed(currentCommandBuffer, static_cast<uint32_t>(vulkanIndexBuffer->indexCount), 1, 0, 0, 0);
+    }
+
+    void VulkanCommandBuffer::DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount)
+    {
+        VulkanVertexBuffer* vulkanVertexBuffer = static_cast<VulkanVertexBuffer*>(vertexBuffer);
+        VulkanVertexBuffer* vulkanInstanceBuffer = static_cast<VulkanVertexBuffer*>(instanceBuffer);
+
+        InternalBindVertexBuffers(vulkanVertexBuffer, vulkanInstanceBuffer);
+        InternalFlushPushConstants();
+        vkCmdDraw(currentCommandBuffer, static_cast<uint32_t>(vulkanVertexBuffer->vertexCount), instanceCount, 0, 0);
+    }
+
+    void VulkanCommandBuffer::DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount)
+    {
+        VulkanIndexBuffer* vulkanIndexBuffer = static_cast<VulkanIndexBuffer*>(indexBuffer);
+        VulkanVertexBuffer* vulkanVertexBuffer = static_cast<VulkanVertexBuffer*>(vertexBuffer);
+        VulkanVertexBuffer* vulkanInstanceBuffer = static_cast<VulkanVertexBuffer*>(instanceBuffer);
+
+        InternalBindVertexBuffers(vulkanVertexBuffer, vulkanInstanceBuffer);
+        InternalBindIndexBuffer(vulkanIndexBuffer);
+        InternalFlushPushConstants();
+        vkCmdDrawIndexed(currentCommandBuffer, static_cast<uint32_t>(vulkanIndexBuffer->indexCount), instanceCount, 0, 0, 0);
+    }
+
+    void VulkanCommandBuffer::DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount)
+    {
+        VulkanIndirectBuffer* vulkanIndirectBuffer = static_cast<VulkanIndirectBuffer*>(indirectBuffer);
+        if (drawCount > vulkanIndirectBuffer->commandCount)
+        {
+            Logger::WriteWarning(renderer->m_logger, "Trying to draw more commands than stored in indirect buffer.");
+            return;
+        }
+
+        InternalBindVertexBuffers(static_cast<VulkanVertexBuffer*>(vertexBuffer), static_cast<VulkanVertexBuffer*>(instanceBuffer));
+        InternalBindIndexBuffer(static_cast<VulkanIndexBuffer*>(indexBuffer));
+        InternalFlushPushConstants();
+        InternalDrawIndirect(vulkanIndirectBuffer->frames[currentFrame].buffer, drawCount);
+    }
+
+    void VulkanCommandBuffer::DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer)
+    {
+        VulkanIndirectBuffer* vulkanIndirectBuffer = static_cast<VulkanIndirectBuffer*>(indirectBuffer);
+        VkBuffer buffer = vulkanIndirectBuffer->frames[currentFrame].buffer;
+
+        InternalBindVertexBuffers(static_cast<VulkanVertexBuffer*>(vertexBuffer), static_cast<VulkanVertexBuffer*>(instanceBuffer));
+        InternalBindIndexBuffer(static_cast<VulkanIndexBuffer*>(indexBuffer));
+        InternalFlushPushConstants();
+
+        if (renderer->m_cmdDrawIndexedIndirectCount)
+        {
+            renderer->m_cmdDrawIndexedIndirectCount(currentCommandBuffer, buffer, 0, buffer, vulkanIndirectBuffer->countOffset,
+                vulkanIndirectBuffer->commandCount, sizeof(DrawIndexedIndirectCommand));
+        }
+        else
+        {
+            // Device side draw count is unsupported, culled commands are drawn with zero instances.
+            InternalDrawIndirect(buffer, vulkanIndirectBuffer->commandCount);
+        }
+    }
+
+    void VulkanCommandBuffer::InternalBindVertexBuffers(VulkanVertexBuffer* vertexBuffer, VulkanVertexBuffer* instanceBuffer)
+    {
+        const bool bindVertexBuffer = bindStateCache.BindVertexBuffer(0, vertexBuffer);
+        const bool bindInstanceBuffer = instanceBuffer && bindStateCache.BindVertexBuffer(1, instanceBuffer);
+
+        VkBuffer vertexBuffers[] = { GetFrameBuffer(vertexBuffer), instanceBuffer ? GetFrameBuffer(instanceBuffer) : VK_NULL_HANDLE };
+        const VkDeviceSize offsets[] = { 0, 0 };
+
+        if (bindVertexBuffer)
+        {
+            vkCmdBindVertexBuffers(currentCommandBuffer, 0, bindInstanceBuffer ? 2 : 1, vertexBuffers, offsets);
+        }
+        else if (bindInstanceBuffer)
+        {
+            vkCmdBindVertexBuffers(currentCommandBuffer, 1, 1, vertexBuffers + 1, offsets);
+        }
+    }
+
+    void VulkanCommandBuffer::InternalBindIndexBuffer(VulkanIndexBuffer* indexBuffer)
+    {
+        if (bindStateCache.BindIndexBuffer(indexBuffer))
+        {
+            vkCmdBindIndexBuffer(currentCommandBuffer, GetFrameBuffer(indexBuffer), 0, GetIndexBufferDataType(indexBuffer->dataType));
+        }
+    }
+
+    VkBuffer VulkanCommandBuffer::GetFrameBuffer(const VulkanIndexBuffer* indexBuffer) const
+    {
+        return indexBuffer->frames.empty() ? indexBuffer->buffer : indexBuffer->frames[currentFrame].buffer;
+    }
+
+    VkBuffer VulkanCommandBuffer::GetFrameBuffer(const VulkanVertexBuffer* vertexBuffer) const
+    {
+        return vertexBuffer->frames.empty() ? vertexBuffer->buffer : vertexBuffer->frames[currentFrame].buffer;
+    }
+
+    void VulkanCommandBuffer::InternalDrawIndirect(VkBuffer buffer, const uint32_t drawCount)
+    {
+        const uint32_t stride = sizeof(DrawIndexedIndirectCommand);
+
+        if (renderer->m_physicalDevice.features.multiDrawIndirect || drawCount <= 1)
+        {
+            vkCmdDrawIndexedIndirect(currentCommandBuffer, buffer, 0, drawCount, stride);
+            return;
+        }
+
+        // Without multi draw support, every indirect draw is limited to a single command.
+        for (uint32_t i = 0; i < drawCount; i++)
+        {
+            vkCmdDrawIndexedIndirect(currentCommandBuffer, buffer, static_cast<VkDeviceSize>(i) * stride, 1, stride);
+        }
+    }
+
+    void VulkanCommandBuffer::InternalFlushPushConstants()
+    {
+        if (!currentPipeline || !pushConstantBuffer.IsDirty())
+        {
+            return;
+        }
+
+        // Offset and size of pushed range must be multiples of 4, the block size is always padded to it.
+        const uint32_t begin = pushConstantBuffer.GetDirtyOffset() & ~uint32_t(3);
+        const uint32_t end = std::min((pushConstantBuffer.GetDirtyOffset() + pushConstantBuffer.GetDirtySize() + 3) & ~uint32_t(3), pushConstantBuffer.GetSize());
+
+        vkCmdPushConstants(
+            currentCommandBuffer, currentPipeline->pipelineLayout,
+            VK_SHADER_STAGE_ALL, begin, end - begin, pushConstantBuffer.GetData() + begin);
+
+        pushConstantBuffer.ClearDirty();
+    }
+
+    template<typename T>
+    void VulkanCommandBuffer::InternalPushConstant(const uint32_t location, const T& value)
+    {
+        if (!currentPipeline)
+        {
+            Logger::WriteWarning(renderer->m_logger, "Trying to set push constant without any bound pipeline.");
+            return;
+        }
+
+        auto& pushConstantOffsets = currentPipeline->pushConstantOffsets;
+        if (location >= pushConstantOffsets.size())
+        {
+            Logger::WriteWarning(renderer->m_logger, "Trying to set push constant with out of bounds location.");
+            return;
+        }
+
+        if (!pushConstantBuffer.Write(pushConstantOffsets[location].offset, &value, static_cast<uint32_t>(sizeof(value))))
+        {
+            Logger::WriteWarning(renderer->m_logger, "Trying to set push constant outside of push constant block.");
+        }
+    }
+
+    void VulkanCommandBuffer::PushConstant(const uint32_t location, const bool& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void VulkanCommandBuffer::PushConstant(const uint32_t location, const int32_t& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void VulkanCommandBuffer::PushConstant(const uint32_t location, const float& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void VulkanCommandBuffer::PushConstant(const uint32_t location, const Vector2f32& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void VulkanCommandBuffer::PushConstant(const uint32_t location, const Vector3f32& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void VulkanCommandBuffer::PushConstant(const uint32_t location, const Vector4f32& value)
+    {
+        InternalPushConstant(location, value);
+    }
+    void VulkanCommandBuffer::PushConstant(const uint32_t location, const Matrix4x4f32& value)
+    {
+        InternalPushConstant(location, value);
+    }
+
+    VulkanCommandBuffer::VulkanCommandBuffer(VulkanRenderer* renderer, VkCommandPool commandPool) :
+        renderer(renderer),
+        commandPool(commandPool),
+        commandBuffers{},
+        currentCommandBuffer(VK_NULL_HANDLE),
+        currentPipeline(nullptr),
+        currentFramebuffer(nullptr),
+        currentFrame(0),
+        recording(false)
+    {}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,449 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/Vulkan/VulkanDescriptorAllocator.hpp"
+
+#if defined(MOLTEN_ENABLE_VULKAN)
+
+#include "Molten/Logger.hpp"
+#include <functional>
+
+namespace Molten
+{
+
+    static bool CreateDescriptorPool(VkDevice logicalDevice, const uint32_t maxSets, const VkDescriptorPoolCreateFlags flags, VkDescriptorPool& pool)
+    {
+        const auto capacity = VulkanDescriptorCounts::CreatePoolCapacity(maxSets);
+        const VkDescriptorPoolSize poolSizes[] = {
+            { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, capacity.uniformBufferDynamic },
+            { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, capacity.uniformBuffer },
+            { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, capacity.storageBuffer },
+            { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, capacity.combinedImageSampler }
+        };
+
+        VkDescriptorPoolCreateInfo poolInfo = {};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.flags = flags;
+        poolInfo.maxSets = maxSets;
+        poolInfo.poolSizeCount = static_cast<uint32_t>(sizeof(poolSizes) / sizeof(poolSizes[0]));
+        poolInfo.pPoolSizes = poolSizes;
+
+        return vkCreateDescriptorPool(logicalDevice, &poolInfo, nullptr, &pool) == VK_SUCCESS;
+    }
+
+    static bool AllocateDescriptorSet(VkDevice logicalDevice, VkDescriptorPool pool, VkDescriptorSetLayout layout, VkDescriptorSet& set)
+    {
+        VkDescriptorSetAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = pool;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &layout;
+
+        return vkAllocateDescriptorSets(logicalDevice, &allocInfo, &set) == VK_SUCCESS;
+    }
+
+
+    // Vulkan descriptor counts implementations.
+    VulkanDescriptorCounts::VulkanDescriptorCounts() :
+        uniformBufferDynamic(0),
+        uniformBuffer(0),
+        storageBuffer(0),
+        combinedImageSampler(0)
+    { }
+
+    VulkanDescriptorCounts VulkanDescriptorCounts::CreatePoolCapacity(const uint32_t maxSets)
+    {
+        // Sized for a few descriptors of each commonly used type per set.
+        VulkanDescriptorCounts counts;
+        counts.uniformBufferDynamic = maxSets * 2;
+        counts.uniformBuffer = maxSets * 2;
+        counts.storageBuffer = maxSets;
+        counts.combinedImageSampler = maxSets * 4;
+        return counts;
+    }
+
+    bool VulkanDescriptorCounts::Add(const VkDescriptorType type, const uint32_t count)
+    {
+        switch (type)
+        {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC: uniformBufferDynamic += count; return true;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER: uniformBuffer += count; return true;
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER: storageBuffer += count; return true;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER: combinedImageSampler += count; return true;
+            default: break;
+        }
+        return false;
+    }
+
+    bool VulkanDescriptorCounts::Fits(const VulkanDescriptorCounts& counts) const
+    {
+        return counts.uniformBufferDynamic <= uniformBufferDynamic &&
+            counts.uniformBuffer <= uniformBuffer &&
+            counts.storageBuffer <= storageBuffer &&
+            counts.combinedImageSampler <= combinedImageSampler;
+    }
+
+    VulkanDescriptorCounts& VulkanDescriptorCounts::operator +=(const VulkanDescriptorCounts& rhs)
+    {
+        uniformBufferDynamic += rhs.uniformBufferDynamic;
+        uniformBuffer += rhs.uniformBuffer;
+        storageBuffer += rhs.storageBuffer;
+        combinedImageSampler += rhs.combinedImageSampler;
+        return *this;
+    }
+
+    VulkanDescriptorCounts& VulkanDescriptorCounts::operator -=(const VulkanDescriptorCounts& rhs)
+    {
+        uniformBufferDynamic -= rhs.uniformBufferDynamic;
+        uniformBuffer -= rhs.uniformBuffer;
+        storageBuffer -= rhs.storageBuffer;
+        combinedImageSampler -= rhs.combinedImageSampler;
+        return *this;
+    }
+
+
+    // Vulkan descriptor buffer binding implementations.
+    bool VulkanDescriptorBufferBinding::operator ==(const VulkanDescriptorBufferBinding& rhs) const
+    {
+        return binding == rhs.binding && type == rhs.type && buffer == rhs.buffer && offset == rhs.offset && range == rhs.range;
+    }
+
+
+    // Vulkan descriptor arena implementations.
+    VulkanDescriptorArena::VulkanDescriptorArena() :
+        m_logicalDevice(VK_NULL_HANDLE),
+        m_logger(nullptr),
+        m_setsPerPool(0),
+        m_currentPool(0)
+    { }
+
+    VulkanDescriptorArena::~VulkanDescriptorArena()
+    {
+        Close();
+    }
+
+    bool VulkanDescriptorArena::Open(VkDevice logicalDevice, Logger* logger, const uint32_t setsPerPool)
+    {
+        Close();
+
+        if (!setsPerPool)
+        {
+            Logger::WriteError(logger, "Descriptor arena requires at least one set per pool.");
+            return false;
+        }
+
+        m_logicalDevice = logicalDevice;
+        m_logger = logger;
+        m_setsPerPool = setsPerPool;
+        m_poolCapacity = VulkanDescriptorCounts::CreatePoolCapacity(setsPerPool);
+        return true;
+    }
+
+    void VulkanDescriptorArena::Close()
+    {
+        for (auto& pool : m_pools)
+        {
+            vkDestroyDescriptorPool(m_logicalDevice, pool.pool, nullptr);
+        }
+
+        m_logicalDevice = VK_NULL_HANDLE;
+        m_logger = nullptr;
+        m_setsPerPool = 0;
+        m_poolCapacity = {};
+        m_pools.clear();
+        m_currentPool = 0;
+    }
+
+    void VulkanDescriptorArena::Reset()
+    {
+        for (size_t i = 0; i < m_pools.size() && i <= m_currentPool; i++)
+        {
+            auto& pool = m_pools[i];
+            vkResetDescriptorPool(m_logicalDevice, pool.pool, 0);
+            pool.freeSetCount = m_setsPerPool;
+            pool.freeDescriptorCounts = m_poolCapacity;
+        }
+        m_currentPool = 0;
+    }
+
+    bool VulkanDescriptorArena::Allocate(VkDescriptorSetLayout layout, const VulkanDescriptorCounts& descriptorCounts, VkDescriptorSet& set)
+    {
+        if (!m_poolCapacity.Fits(descriptorCounts))
+        {
+            Logger::WriteError(m_logger, "Descriptor set layout requires more descriptors than a pool of descriptor arena provides.");
+            return false;
+        }
+
+        // Allocating beyond the pool sizes is invalid without VK_KHR_maintenance1, skip pools lacking room.
+        while (m_currentPool < m_pools.size())
+        {
+            auto& pool = m_pools[m_currentPool];
+            if (pool.freeSetCount && pool.freeDescriptorCounts.Fits(descriptorCounts))
+            {
+                break;
+            }
+            ++m_currentPool;
+        }
+
+        if (m_currentPool == m_pools.size())
+        {
+            VkDescriptorPool newPool = VK_NULL_HANDLE;
+            if (!CreateDescriptorPool(m_logicalDevice, m_setsPerPool, 0, newPool))
+            {
+                Logger::WriteError(m_logger, "Failed to create descriptor pool of descriptor arena.");
+                return false;
+            }
+            m_pools.push_back({ newPool, m_setsPerPool, m_poolCapacity });
+        }
+
+        auto& pool = m_pools[m_currentPool];
+        if (!AllocateDescriptorSet(m_logicalDevice, pool.pool, layout, set))
+        {
+            Logger::WriteError(m_logger, "Failed to allocate descriptor set from descriptor arena.");
+            return false;
+        }
+
+        --pool.freeSetCount;
+        pool.freeDescriptorCounts -= descriptorCounts;
+        return true;
+    }
+
+    size_t VulkanDescriptorArena::GetPoolCount() const
+    {
+        return m_pools.size();
+    }
+
+
+    // Vulkan descriptor set cache implementations.
+    bool VulkanDescriptorSetCache::Key::operator ==(const Key& rhs) const
+    {
+        return layout == rhs.layout && bindings == rhs.bindings;
+    }
+
+    size_t VulkanDescriptorSetCache::KeyHash::operator()(const Key& key) const
+    {
+        size_t hash = std::hash<VkDescriptorSetLayout>()(key.layout);
+        auto combine = [&hash](const size_t value)
+        {
+            hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        };
+
+        for (const auto& binding : key.bindings)
+        {
+            combine(std::hash<uint32_t>()(binding.binding));
+            combine(std::hash<uint32_t>()(static_cast<uint32_t>(binding.type)));
+            combine(std::hash<VkBuffer>()(binding.buffer));
+            combine(std::hash<VkDeviceSize>()(binding.offset));
+            combine(std::hash<VkDeviceSize>()(binding.range));
+        }
+        return hash;
+    }
+
+    VulkanDescriptorSetCache::VulkanDescriptorSetCache() :
+        m_logicalDevice(VK_NULL_HANDLE),
+        m_logger(nullptr),
+        m_setsPerPool(0)
+    { }
+
+    VulkanDescriptorSetCache::~VulkanDescriptorSetCache()
+    {
+        Close();
+    }
+
+    bool VulkanDescriptorSetCache::Open(VkDevice logicalDevice, Logger* logger, const uint32_t setsPerPool)
+    {
+        Close();
+
+        if (!setsPerPool)
+        {
+            Logger::WriteError(logger, "Descriptor set cache requires at least one set per pool.");
+            return false;
+        }
+
+        m_logicalDevice = logicalDevice;
+        m_logger = logger;
+        m_setsPerPool = setsPerPool;
+        m_poolCapacity = VulkanDescriptorCounts::CreatePoolCapacity(setsPerPool);
+        return true;
+    }
+
+    void VulkanDescriptorSetCache::Close()
+    {
+        if (!m_entries.empty())
+        {
+            Logger::WriteWarning(m_logger, "Closing descriptor set cache with descriptor sets still in use.");
+        }
+
+        for (auto& pool : m_pools)
+        {
+            vkDestroyDescriptorPool(m_logicalDevice, pool.pool, nullptr);
+        }
+
+        m_logicalDevice = VK_NULL_HANDLE;
+        m_logger = nullptr;
+        m_setsPerPool = 0;
+        m_poolCapacity = {};
+        m_pools.clear();
+        m_entries.clear();
+        m_setKeys.clear();
+    }
+
+    bool VulkanDescriptorSetCache::Acquire(VkDescriptorSetLayout layout, const std::vector<VulkanDescriptorBufferBinding>& bindings, VkDescriptorSet& set)
+    {
+        Key key = { layout, bindings };
+
+        auto it = m_entries.find(key);
+        if (it != m_entries.end())
+        {
+            ++it->second.referenceCount;
+            set = it->second.set;
+            return true;
+        }
+
+        VulkanDescriptorCounts descriptorCounts;
+        for (const auto& binding : bindings)
+        {
+            if (!descriptorCounts.Add(binding.type, 1))
+            {
+                Logger::WriteError(m_logger, "Descriptor type of binding is not supported by descriptor set cache.");
+                return false;
+            }
+        }
+
+        size_t poolIndex = 0;
+        if (!AllocateSet(layout, descriptorCounts, set, poolIndex))
+        {
+            return false;
+        }
+
+        std::vector<VkDescriptorBufferInfo> bufferInfos(bindings.size());
+        std::vector<VkWriteDescriptorSet> writes(bindings.size());
+        for (size_t i = 0; i < bindings.size(); i++)
+        {
+            const auto& binding = bindings[i];
+
+            auto& bufferInfo = bufferInfos[i];
+            bufferInfo.buffer = binding.buffer;
+            bufferInfo.offset = binding.offset;
+            bufferInfo.range = binding.range;
+
+            auto& write = writes[i];
+            write = {};
+            write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write.dstSet = set;
+            write.dstBinding = binding.binding;
+            write.dstArrayElement = 0;
+            write.descriptorType = binding.type;
+            write.descriptorCount = 1;
+            write.pBufferInfo = &bufferInfo;
+        }
+        vkUpdateDescriptorSets(m_logicalDevice, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+
+        m_setKeys.insert({ set, key });
+        m_entries.insert({ std::move(key), { set, poolIndex, 1, descriptorCounts } });
+        return true;
+    }
+
+    void VulkanDescriptorSetCache::Release(VkDescriptorSet set)
+    {
+        auto keyIt = m_setKeys.find(set);
+        if (keyIt == m_setKeys.end())
+        {
+            Logger::WriteError(m_logger, "Releasing descriptor set not acquired from descriptor set cache.");
+            return;
+        }
+
+        auto entryIt = m_entries.find(keyIt->second);
+        auto& entry = entryIt->second;
+        if (--entry.referenceCount)
+        {
+            return;
+        }
+
+        auto& pool = m_pools[entry.poolIndex];
+        vkFreeDescriptorSets(m_logicalDevice, pool.pool, 1, &entry.set);
+        ++pool.freeSetCount;
+        pool.freeDescriptorCounts += entry.descriptorCounts;
+
+        m_entries.erase(entryIt);
+        m_setKeys.erase(keyIt);
+    }
+
+    size_t VulkanDescriptorSetCache::GetSetCount() const
+    {
+        return m_entries.size();
+    }
+
+    size_t VulkanDescriptorSetCache::GetPoolCount() const
+    {
+        return m_pools.size();
+    }
+
+    bool VulkanDescriptorSetCache::AllocateSet(VkDescriptorSetLayout layout, const VulkanDescriptorCounts& descriptorCounts, VkDescriptorSet& set, size_t& poolIndex)
+    {
+        if (!m_poolCapacity.Fits(descriptorCounts))
+        {
+            Logger::WriteError(m_logger, "Descriptor set layout requires more descriptors than a pool of descriptor set cache provides.");
+            return false;
+        }
+
+        // Only pools with room left are tried, they may still fail due to fragmentation.
+        for (size_t i = 0; i < m_pools.size(); i++)
+        {
+            auto& pool = m_pools[i];
+            if (pool.freeSetCount && pool.freeDescriptorCounts.Fits(descriptorCounts) &&
+                AllocateDescriptorSet(m_logicalDevice, pool.pool, layout, set))
+            {
+                --pool.freeSetCount;
+                pool.freeDescriptorCounts -= descriptorCounts;
+                poolIndex = i;
+                return true;
+            }
+        }
+
+        // Sets are freed individually when released, requiring pools supporting free.
+        VkDescriptorPool newPool = VK_NULL_HANDLE;
+        if (!CreateDescriptorPool(m_logicalDevice, m_setsPerPool, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, newPool))
+        {
+            Logger::WriteError(m_logger, "Failed to create descriptor pool of descriptor set cache.");
+            return false;
+        }
+        m_pools.push_back({ newPool, m_setsPerPool, m_poolCapacity });
+
+        if (!AllocateDescriptorSet(m_logicalDevice, newPool, layout, set))
+        {
+            Logger::WriteError(m_logger, "Failed to allocate descriptor set from descriptor set cache.");
+            return false;
+        }
+
+        poolIndex = m_pools.size() - 1;
+        --m_pools.back().freeSetCount;
+        m_pools.back().freeDescriptorCounts -= descriptorCounts;
+        return true;
+    }
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,329 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/Renderer/Vulkan/VulkanMemoryAllocator.hpp"
+
+#if defined(MOLTEN_ENABLE_VULKAN)
+
+#include "Molten/Logger.hpp"
+#include <algorithm>
+
+namespace Molten
+{
+
+    // Vulkan memory implementations.
+    VulkanMemory::VulkanMemory() :
+        memory(VK_NULL_HANDLE),
+        offset(0),
+        size(0),
+        mappedData(nullptr),
+        memoryTypeIndex(0),
+        blockIndex(0)
+    { }
+
+
+    // Vulkan memory allocator implementations.
+    VulkanMemoryAllocator::Statistics::Statistics() :
+        blockCount(0),
+        dedicatedAllocationCount(0),
+        allocationCount(0),
+        reservedSize(0),
+        usedSize(0)
+    { }
+
+    VulkanMemoryAllocator::VulkanMemoryAllocator() :
+        m_logicalDevice(VK_NULL_HANDLE),
+        m_memoryProperties{},
+        m_logger(nullptr),
+        m_blockSize(0),
+        m_memoryTypeBlocks{},
+        m_dedicatedAllocationCount(0),
+        m_dedicatedSize(0)
+    { }
+
+    VulkanMemoryAllocator::~VulkanMemoryAllocator()
+    {
+        Close();
+    }
+
+    bool VulkanMemoryAllocator::Open(VkPhysicalDevice physicalDevice, VkDevice logicalDevice, Logger* logger, const VkDeviceSize blockSize)
+    {
+        Close();
+
+        if (!blockSize || (blockSize & (blockSize - 1)))
+        {
+            Logger::WriteError(logger, "Block size of memory allocator must be a power of two.");
+            return false;
+        }
+
+        m_logicalDevice = logicalDevice;
+        m_logger = logger;
+        m_blockSize = blockSize;
+        vkGetPhysicalDeviceMemoryProperties(physicalDevice, &m_memoryProperties);
+        m_memoryTypeBlocks.resize(m_memoryProperties.memoryTypeCount);
+        return true;
+    }
+
+    void VulkanMemoryAllocator::Close()
+    {
+        for (auto& blocks : m_memoryTypeBlocks)
+        {
+            for (auto& block : blocks)
+            {
+                if (block)
+                {
+                    FreeDeviceMemory(block->memory, block->mappedData);
+                }
+            }
+        }
+
+        if (m_dedicatedAllocationCount)
+        {
+            Logger::WriteWarning(m_logger, "Closing memory allocator with dedicated allocations still in use.");
+        }
+
+        m_logicalDevice = VK_NULL_HANDLE;
+        m_memoryProperties = {};
+        m_logger = nullptr;
+        m_blockSize = 0;
+        m_memoryTypeBlocks.clear();
+        m_dedicatedAllocationCount = 0;
+        m_dedicatedSize = 0;
+    }
+
+    bool VulkanMemoryAllocator::Allocate(const VkMemoryRequirements& requirements, const VkMemoryPropertyFlags properties, VulkanMemory& memory)
+    {
+        uint32_t memoryTypeIndex = 0;
+        if (!FindMemoryType(memoryTypeIndex, requirements.memoryTypeBits, properties))
+        {
+            Logger::WriteError(m_logger, "Failed to find matching memory type for allocation.");
+            return false;
+        }
+
+        memory.memoryTypeIndex = memoryTypeIndex;
+        memory.size = requirements.size;
+
+        if (requirements.size > m_blockSize || requirements.alignment > m_blockSize)
+        {
+            if (!AllocateDeviceMemory(memoryTypeIndex, requirements.size, memory.memory, memory.mappedData))
+            {
+                return false;
+            }
+
+            memory.offset = 0;
+            memory.blockIndex = DedicatedBlockIndex;
+            ++m_dedicatedAllocationCount;
+            m_dedicatedSize += requirements.size;
+            return true;
+        }
+
+        const auto allocationSize = static_cast<size_t>(requirements.size);
+        const auto allocationAlignment = static_cast<size_t>(requirements.alignment);
+
+        auto& blocks = m_memoryTypeBlocks[memoryTypeIndex];
+        size_t freeSlot = blocks.size();
+
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            auto& block = blocks[i];
+            if (!block)
+            {
+                freeSlot = std::min(freeSlot, i);
+                continue;
+            }
+
+            size_t offset = 0;
+            if (block->allocator.Allocate(allocationSize, allocationAlignment, offset))
+            {
+                memory.memory = block->memory;
+                memory.offset = static_cast<VkDeviceSize>(offset);
+                memory.mappedData = block->mappedData ? static_cast<uint8_t*>(block->mappedData) + offset : nullptr;
+                memory.blockIndex = i;
+                return true;
+            }
+        }
+
+        VkDeviceMemory deviceMemory = VK_NULL_HANDLE;
+        void* mappedData = nullptr;
+        if (!AllocateDeviceMemory(memoryTypeIndex, m_blockSize, deviceMemory, mappedData))
+        {
+            return false;
+        }
+
+        auto block = std::make_unique<Block>(deviceMemory, mappedData, static_cast<size_t>(m_blockSize), MinAllocationSize);
+
+        size_t offset = 0;
+        block->allocator.Allocate(allocationSize, allocationAlignment, offset);
+
+        memory.memory = deviceMemory;
+        memory.offset = static_cast<VkDeviceSize>(offset);
+        memory.mappedData = mappedData ? static_cast<uint8_t*>(mappedData) + offset : nullptr;
+        memory.blockIndex = freeSlot;
+
+        if (freeSlot == blocks.size())
+        {
+            blocks.push_back(std::move(block));
+        }
+        else
+        {
+            blocks[freeSlot] = std::move(block);
+        }
+
+        return true;
+    }
+
+    void VulkanMemoryAllocator::Free(VulkanMemory& memory)
+    {
+        if (memory.memory == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        if (memory.blockIndex == DedicatedBlockIndex)
+        {
+            FreeDeviceMemory(memory.memory, memory.mappedData);
+            --m_dedicatedAllocationCount;
+            m_dedicatedSize -= memory.size;
+        }
+        else
+        {
+            auto& blocks = m_memoryTypeBlocks[memory.memoryTypeIndex];
+            if (memory.blockIndex >= blocks.size() || !blocks[memory.blockIndex] ||
+                !blocks[memory.blockIndex]->allocator.Free(static_cast<size_t>(memory.offset)))
+            {
+                Logger::WriteError(m_logger, "Trying to free memory not allocated by memory allocator.");
+                return;
+            }
+        }
+
+        memory = VulkanMemory();
+    }
+
+    void VulkanMemoryAllocator::ReleaseUnusedBlocks()
+    {
+        for (auto& blocks : m_memoryTypeBlocks)
+        {
+            for (auto& block : blocks)
+            {
+                if (block && block->allocator.IsEmpty())
+                {
+                    FreeDeviceMemory(block->memory, block->mappedData);
+                    block.reset();
+                }
+            }
+
+            while (!blocks.empty() && !blocks.back())
+            {
+                blocks.pop_back();
+            }
+        }
+    }
+
+    VulkanMemoryAllocator::Statistics VulkanMemoryAllocator::GetStatistics() const
+    {
+        Statistics statistics;
+        statistics.dedicatedAllocationCount = m_dedicatedAllocationCount;
+        statistics.allocationCount = m_dedicatedAllocationCount;
+        statistics.reservedSize = m_dedicatedSize;
+        statistics.usedSize = m_dedicatedSize;
+
+        for (auto& blocks : m_memoryTypeBlocks)
+        {
+            for (auto& block : blocks)
+            {
+                if (block)
+                {
+                    ++statistics.blockCount;
+                    statistics.allocationCount += block->allocator.GetAllocationCount();
+                    statistics.reservedSize += static_cast<VkDeviceSize>(block->allocator.GetSize());
+                    statistics.usedSize += static_cast<VkDeviceSize>(block->allocator.GetUsedSize());
+                }
+            }
+        }
+
+        return statistics;
+    }
+
+    VulkanMemoryAllocator::Block::Block(VkDeviceMemory memory, void* mappedData, const size_t size, const size_t minAllocationSize) :
+        memory(memory),
+        mappedData(mappedData),
+        allocator(size, minAllocationSize)
+    { }
+
+    bool VulkanMemoryAllocator::FindMemoryType(uint32_t& index, const uint32_t filter, const VkMemoryPropertyFlags properties) const
+    {
+        for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; i++)
+        {
+            if ((filter & (uint32_t(1) << i)) && (m_memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+            {
+                index = i;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool VulkanMemoryAllocator::AllocateDeviceMemory(const uint32_t memoryTypeIndex, const VkDeviceSize size, VkDeviceMemory& memory, void*& mappedData)
+    {
+        VkMemoryAllocateInfo memoryAllocateInfo = {};
+        memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        memoryAllocateInfo.allocationSize = size;
+        memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
+
+        if (vkAllocateMemory(m_logicalDevice, &memoryAllocateInfo, nullptr, &memory) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to allocate device memory.");
+            return false;
+        }
+
+        // Host visible memory is mapped once, since device memory objects cannot be mapped more than once at a time.
+        mappedData = nullptr;
+        if (m_memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+        {
+            if (vkMapMemory(m_logicalDevice, memory, 0, VK_WHOLE_SIZE, 0, &mappedData) != VK_SUCCESS)
+            {
+                vkFreeMemory(m_logicalDevice, memory, nullptr);
+                memory = VK_NULL_HANDLE;
+                Logger::WriteError(m_logger, "Failed to map host visible device memory.");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void VulkanMemoryAllocator::FreeDeviceMemory(VkDeviceMemory memory, void* mappedData)
+    {
+        if (mappedData)
+        {
+            vkUnmapMemory(m_logicalDevice, memory);
+        }
+        vkFreeMemory(m_logicalDevice, memory, nullptr);
+    }
+
+}
+
+#endif
\ No newline at end of file
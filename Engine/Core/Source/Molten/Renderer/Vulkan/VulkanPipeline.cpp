@@ -34,14 +34,18 @@ namespace Molten
             VkPipeline graphicsPipeline,
             VkPipelineLayout pipelineLayout,
             std::vector<VkDescriptorSetLayout> descriptionSetLayouts,
+            std::vector<VulkanDescriptorCounts> descriptorSetCounts,
             PushConstantLocations&& pushConstantLocations,
             PushConstantOffsets&& pushConstantOffsets,
+            const uint32_t pushConstantSize,
             std::vector<VkShaderModule>&& shaderModules) :
         graphicsPipeline(graphicsPipeline),
         pipelineLayout(pipelineLayout),
         descriptionSetLayouts(descriptionSetLayouts),
+        descriptorSetCounts(std::move(descriptorSetCounts)),
         pushConstantLocations(std::move(pushConstantLocations)),
         pushConstantOffsets(std::move(pushConstantOffsets)),
+        pushConstantSize(pushConstantSize),
         shaderModules(std::move(shaderModules))
     {}
 
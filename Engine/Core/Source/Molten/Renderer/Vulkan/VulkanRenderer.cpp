@@ -31,8 +31,10 @@
 #include "Molten/Renderer/Shader/Visual/VisualShaderScript.hpp"
 #include "Molten/Renderer/Shader/Visual/VisualShaderStructure.hpp"
 #include "Molten/Renderer/Shader/Generator/VulkanShaderGenerator.hpp"
+#include "Molten/Renderer/Vulkan/VulkanCommandBuffer.hpp"
 #include "Molten/Renderer/Vulkan/VulkanFramebuffer.hpp"
 #include "Molten/Renderer/Vulkan/VulkanIndexBuffer.hpp"
+#include "Molten/Renderer/Vulkan/VulkanIndirectBuffer.hpp"
 #include "Molten/Renderer/Vulkan/VulkanPipeline.hpp"
 #include "Molten/Renderer/Vulkan/VulkanTexture.hpp"
 #include "Molten/Renderer/Vulkan/VulkanUniformBlock.hpp"
@@ -42,6 +44,7 @@
 #include "Molten/Logger.hpp"
 #include "Molten/System/Exception.hpp"
 #include "Molten/System/FileSystem.hpp"
+#include "Molten/System/Profiler.hpp"
 #include "Molten/Utility/SmartFunction.hpp"
 #include <map>
 #include <set>
@@ -61,6 +64,7 @@ namespace Molten
         {
             case Shader::Type::Vertex:   return VkShaderStageFlagBits::VK_SHADER_STAGE_VERTEX_BIT;
             case Shader::Type::Fragment: return VkShaderStageFlagBits::VK_SHADER_STAGE_FRAGMENT_BIT;
+            case Shader::Type::Compute:  return VkShaderStageFlagBits::VK_SHADER_STAGE_COMPUTE_BIT;
         }
 
         throw Exception("Provided shader type is not supported by the Vulkan renderer.");
@@ -201,31 +205,164 @@ namespace Molten
         MOLTEN_UNSCOPED_ENUM_END
     }
 
-    static VkIndexType GetIndexBufferDataType(const IndexBuffer::DataType dataType)
+    static VkDeviceSize GetIndexBufferDataTypeSize(const IndexBuffer::DataType dataType)
     {
-        MOLTEN_UNSCOPED_ENUM_BEGIN
         switch (dataType)
         {
-            case IndexBuffer::DataType::Uint16: return VkIndexType::VK_INDEX_TYPE_UINT16;
-            case IndexBuffer::DataType::Uint32: return VkIndexType::VK_INDEX_TYPE_UINT32;
+            case IndexBuffer::DataType::Uint16: return sizeof(uint16_t);
+            case IndexBuffer::DataType::Uint32: return sizeof(uint32_t);
         }
-        MOLTEN_UNSCOPED_ENUM_END
 
         throw Exception("Provided data type is not supported as index buffer data type by the Vulkan renderer.");
     }
 
-    static VkDeviceSize GetIndexBufferDataTypeSize(const IndexBuffer::DataType dataType)
+    
+
+    static VkFormat GetTextureFormat(const Texture::Format format)
     {
-        switch (dataType)
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (format)
         {
-            case IndexBuffer::DataType::Uint16: return sizeof(uint16_t);
-            case IndexBuffer::DataType::Uint32: return sizeof(uint32_t);
+            case Texture::Format::Red8:        return VkFormat::VK_FORMAT_R8_UNORM;
+            case Texture::Format::RedGreen8:   return VkFormat::VK_FORMAT_R8G8_UNORM;
+            case Texture::Format::Rgba8:       return VkFormat::VK_FORMAT_R8G8B8A8_UNORM;
+            case Texture::Format::Rgba8Srgb:   return VkFormat::VK_FORMAT_R8G8B8A8_SRGB;
+            case Texture::Format::Rgba16Float: return VkFormat::VK_FORMAT_R16G16B16A16_SFLOAT;
+            case Texture::Format::Rgba32Float: return VkFormat::VK_FORMAT_R32G32B32A32_SFLOAT;
         }
+        throw Exception("Provided texture format is not supported by the Vulkan renderer.");
+        MOLTEN_UNSCOPED_ENUM_END
+    }
 
-        throw Exception("Provided data type is not supported as index buffer data type by the Vulkan renderer.");
+    static VkFilter GetSamplerFilter(const Texture::Filter filter)
+    {
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (filter)
+        {
+            case Texture::Filter::Nearest: return VkFilter::VK_FILTER_NEAREST;
+            case Texture::Filter::Linear:  return VkFilter::VK_FILTER_LINEAR;
+        }
+        throw Exception("Provided sampler filter is not supported by the Vulkan renderer.");
+        MOLTEN_UNSCOPED_ENUM_END
     }
 
-    
+    static VkSamplerAddressMode GetSamplerAddressMode(const Texture::AddressMode addressMode)
+    {
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (addressMode)
+        {
+            case Texture::AddressMode::Repeat:         return VkSamplerAddressMode::VK_SAMPLER_ADDRESS_MODE_REPEAT;
+            case Texture::AddressMode::MirroredRepeat: return VkSamplerAddressMode::VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT;
+            case Texture::AddressMode::ClampToEdge:    return VkSamplerAddressMode::VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        }
+        throw Exception("Provided sampler address mode is not supported by the Vulkan renderer.");
+        MOLTEN_UNSCOPED_ENUM_END
+    }
+
+    static VkFormat GetFrameGraphFormat(const FrameGraph::Format format)
+    {
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (format)
+        {
+            case FrameGraph::Format::Rgba8:           return VkFormat::VK_FORMAT_R8G8B8A8_UNORM;
+            case FrameGraph::Format::Bgra8:           return VkFormat::VK_FORMAT_B8G8R8A8_UNORM;
+            case FrameGraph::Format::Rgba16Float:     return VkFormat::VK_FORMAT_R16G16B16A16_SFLOAT;
+            case FrameGraph::Format::Rgba32Float:     return VkFormat::VK_FORMAT_R32G32B32A32_SFLOAT;
+            case FrameGraph::Format::Depth32Float:    return VkFormat::VK_FORMAT_D32_SFLOAT;
+            case FrameGraph::Format::Depth24Stencil8: return VkFormat::VK_FORMAT_D24_UNORM_S8_UINT;
+        }
+        throw Exception("Provided frame graph format is not supported by the Vulkan renderer.");
+        MOLTEN_UNSCOPED_ENUM_END
+    }
+
+    static VkImageAspectFlags GetFrameGraphAspectFlags(const FrameGraph::Format format)
+    {
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (format)
+        {
+            case FrameGraph::Format::Depth32Float:    return VK_IMAGE_ASPECT_DEPTH_BIT;
+            case FrameGraph::Format::Depth24Stencil8: return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+            default: break;
+        }
+        return VK_IMAGE_ASPECT_COLOR_BIT;
+        MOLTEN_UNSCOPED_ENUM_END
+    }
+
+    /** Image layout, access mask and pipeline stages of frame graph resource state. */
+    struct FrameGraphStateInfo
+    {
+        VkImageLayout layout;
+        VkAccessFlags access;
+        VkPipelineStageFlags stages;
+    };
+
+    static FrameGraphStateInfo GetFrameGraphStateInfo(const FrameGraph::ResourceState state)
+    {
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        switch (state)
+        {
+            // Transient images alias memory accessed by earlier passes of this and previous frames, in any stage.
+            // Transitions from undefined wait for all commands, which also chains with the image available semaphore of swap chain images.
+            case FrameGraph::ResourceState::Undefined:
+                return { VK_IMAGE_LAYOUT_UNDEFINED, VK_ACCESS_MEMORY_WRITE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT };
+            case FrameGraph::ResourceState::ColorAttachment:
+                return { VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                    VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
+            case FrameGraph::ResourceState::DepthAttachment:
+                return { VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+                    VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT };
+            case FrameGraph::ResourceState::DepthRead:
+                return { VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL, VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_SHADER_READ_BIT,
+                    VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT };
+            case FrameGraph::ResourceState::ShaderRead:
+                return { VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT };
+            case FrameGraph::ResourceState::TransferSource:
+                return { VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT };
+            case FrameGraph::ResourceState::TransferDestination:
+                return { VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT };
+            case FrameGraph::ResourceState::Present:
+                return { VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, 0, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT };
+        }
+        throw Exception("Provided frame graph resource state is not supported by the Vulkan renderer.");
+        MOLTEN_UNSCOPED_ENUM_END
+    }
+
+    /**
+     * Compute shader culling draw commands against frustum planes, one command per invocation.
+     * Planes are tested in the same order and with the same operations as FrustumCuller, precise prevents fused operations.
+     * Visible commands are appended to the cleared output by incrementing the draw count, following the commands, in unspecified order.
+     */
+    static constexpr char s_cullShaderSource[] =
+        "#version 450\n"
+        "layout(local_size_x = 64) in;\n"
+        "layout(std430, set = 0, binding = 0) readonly buffer SourceCommands { uint sourceCommands[]; };\n"
+        "layout(std430, set = 0, binding = 1) readonly buffer Bounds { vec4 bounds[]; };\n"
+        "layout(std430, set = 0, binding = 2) buffer VisibleCommands { uint visibleCommands[]; };\n"
+        "layout(push_constant) uniform Frustum { vec4 planes[6]; uint commandCount; };\n"
+        "void main()\n"
+        "{\n"
+        "    const uint index = gl_GlobalInvocationID.x;\n"
+        "    if (index >= commandCount) { return; }\n"
+        "    const vec4 sphere = bounds[index * 2];\n"
+        "    const vec4 extents = bounds[index * 2 + 1];\n"
+        "    for (int i = 0; i < 6; i++)\n"
+        "    {\n"
+        "        const vec4 plane = planes[i];\n"
+        "        precise float distance = plane.x * sphere.x + plane.y * sphere.y + plane.z * sphere.z + plane.w;\n"
+        "        precise float reach = sphere.w + abs(plane.x) * extents.x + abs(plane.y) * extents.y + abs(plane.z) * extents.z;\n"
+        "        if (!(distance + reach >= 0.0)) { return; }\n"
+        "    }\n"
+        "    const uint slot = atomicAdd(visibleCommands[commandCount * 5], 1u);\n"
+        "    for (uint i = 0; i < 5; i++) { visibleCommands[slot * 5 + i] = sourceCommands[index * 5 + i]; }\n"
+        "}\n";
+
+    /** Push constants of cull shader, matching the Frustum block of s_cullShaderSource. */
+    struct CullPushConstants
+    {
+        Vector4f32 planes[Frustum::PlaneCount];
+        uint32_t commandCount;
+    };
+
 
     // Vulkan renderer class implementations.
     VulkanRenderer::VulkanRenderer() :
@@ -239,19 +376,52 @@ namespace Molten
         m_logicalDevice(VK_NULL_HANDLE),
         m_graphicsQueue(VK_NULL_HANDLE),
         m_presentQueue(VK_NULL_HANDLE),
+        m_transferQueue(VK_NULL_HANDLE),
+        m_cmdDrawIndexedIndirectCount(nullptr),
+        m_pipelineCache(VK_NULL_HANDLE),
+        m_cullSetLayout(VK_NULL_HANDLE),
+        m_cullPipelineLayout(VK_NULL_HANDLE),
+        m_cullPipeline(VK_NULL_HANDLE),
+        m_threadPool(),
+        m_uploadCommandPool(VK_NULL_HANDLE),
+        m_stagingBuffer(VK_NULL_HANDLE),
+        m_stagingMemory(),
+        m_stagingSize(16 * 1024 * 1024),
+        m_stagingHead(0),
+        m_stagingTail(0),
         m_swapChain(VK_NULL_HANDLE),
         m_swapChainImageFormat(VK_FORMAT_UNDEFINED),
         m_swapChainExtent{0, 0},
+        m_requestedExtent{0, 0},
+        m_offscreen(false),
+        m_readbackAvailable(false),
+        m_readbackImageIndex(0),
+        m_readbackExtent{0, 0},
         m_renderPass(VK_NULL_HANDLE),
+        m_loadRenderPass(VK_NULL_HANDLE),
+        m_frameGraphChanged(false),
+        m_frameGraphBackbuffer(FrameGraph::InvalidId),
         m_commandPool(VK_NULL_HANDLE),
         m_maxFramesInFlight(0),
+        m_requestedMaxFramesInFlight(0),
         m_currentFrame(0),
+        m_presentMode(PresentMode::Fifo),
+        m_requestedPresentMode(PresentMode::Mailbox),
         m_resized(false),
+        m_resizeTime(Time::Zero),
         m_beginDraw(false),
+        m_frameCount(0),
         m_currentImageIndex(0),
         m_currentCommandBuffer(nullptr),
         m_currentFramebuffer(VK_NULL_HANDLE),
-        m_currentPipeline(nullptr)
+        m_boundFramebuffer(nullptr),
+        m_inlineCommandBuffers{},
+        m_inlineCommandBufferIndex(0),
+        m_currentInlineCommandBuffer(nullptr),
+        m_executeCommandBuffers{},
+        m_currentComputeCommandBuffer(VK_NULL_HANDLE),
+        m_timestampSupport(false),
+        m_maxTimestampQueries(128)
     {
     }
 
@@ -272,29 +442,89 @@ namespace Molten
 
         m_renderTarget = &window;
         m_logger = logger;
+        m_requestedExtent = { window.GetSize().x, window.GetSize().y };
 
         bool loaded =
             LoadInstance(version) &&
             LoadSurface() &&
             LoadPhysicalDevice() &&
             LoadLogicalDevice() &&
+            LoadMemoryAllocator() &&
+            LoadDescriptorAllocators() &&
+            LoadPipelineCache() &&
+            LoadCullPipeline() &&
+            LoadUploadResources() &&
             FetchSwapChainSupport(m_physicalDevice) &&
             LoadSwapChain() &&
             LoadImageViews() &&
             LoadRenderPass() &&
             LoadPresentFramebuffer() &&
+            LoadFrameGraph() &&
             LoadCommandPool() &&
             LoadSyncObjects();
 
         return loaded;   
     }
 
+    bool VulkanRenderer::OpenOffscreen(const Vector2ui32& size, const Version& version, Logger* logger)
+    {
+        Close();
+
+        m_logger = logger;
+        m_offscreen = true;
+        m_swapChainExtent = { size.x, size.y };
+        m_requestedExtent = m_swapChainExtent;
+
+        bool loaded =
+            LoadInstance(version) &&
+            LoadPhysicalDevice() &&
+            LoadLogicalDevice() &&
+            LoadMemoryAllocator() &&
+            LoadDescriptorAllocators() &&
+            LoadPipelineCache() &&
+            LoadCullPipeline() &&
+            LoadUploadResources() &&
+            LoadOffscreenImages() &&
+            LoadImageViews() &&
+            LoadRenderPass() &&
+            LoadPresentFramebuffer() &&
+            LoadFrameGraph() &&
+            LoadCommandPool() &&
+            LoadSyncObjects();
+
+        return loaded;
+    }
+
     void VulkanRenderer::Close()
     {   
+        // Pending asynchronous pipelines are using the device.
+        m_threadPool.Wait();
+
         if (m_logicalDevice)
         {
             vkDeviceWaitIdle(m_logicalDevice);  
 
+            for (auto* inlineCommandBuffer : m_inlineCommandBuffers)
+            {
+                DestroyCommandBuffer(inlineCommandBuffer);
+            }
+
+            // Framebuffer objects are owned by the application, only their device objects are destroyed.
+            for (auto* framebuffer : m_framebuffers)
+            {
+                RetireFramebuffer(framebuffer->framebuffer);
+                framebuffer->framebuffer = VK_NULL_HANDLE;
+                framebuffer->resource = FrameGraph::InvalidId;
+                framebuffer->executeCommandBuffers.clear();
+            }
+
+            DestroyRetiredResources(true);
+            UnloadUploadResources();
+            RetireFrameGraphImages();
+            DestroyRetiredImages(true);
+            DestroyRetiredSwapchains(true);
+            UnloadTimestampFrames();
+
             if (m_commandPool)
             {
                 vkDestroyCommandPool(m_logicalDevice, m_commandPool, nullptr);
@@ -304,8 +534,16 @@ namespace Molten
             {
                 vkDestroyRenderPass(m_logicalDevice, m_renderPass, nullptr);
             }
+            if (m_loadRenderPass)
+            {
+                vkDestroyRenderPass(m_logicalDevice, m_loadRenderPass, nullptr);
+            }
 
             UnloadSwapchain();
+            UnloadCullPipeline();
+            UnloadPipelineCache();
+            UnloadDescriptorAllocators();
+            m_memoryAllocator.Close();
             vkDestroyDevice(m_logicalDevice, nullptr);
         }
         if (m_instance)
@@ -332,30 +570,59 @@ namespace Molten
         m_logicalDevice = VK_NULL_HANDLE;
         m_graphicsQueue = VK_NULL_HANDLE;
         m_presentQueue = VK_NULL_HANDLE;
+        m_transferQueue = VK_NULL_HANDLE;
+        m_cmdDrawIndexedIndirectCount = nullptr;
         m_swapChain = VK_NULL_HANDLE;
         m_swapChainImageFormat = VK_FORMAT_UNDEFINED;
         m_swapChainExtent = { 0, 0 };
+        m_requestedExtent = { 0, 0 };
         m_swapChainImages.clear();
         m_physicalDevice.Clear();
         m_debugMessenger.Clear();
         m_validationLayers.clear();
         m_deviceExtensions.clear();
         m_swapChainImageViews.clear();
+        m_offscreen = false;
+        m_offscreenImageMemory.clear();
+        m_readbackAvailable = false;
+        m_readbackImageIndex = 0;
+        m_readbackExtent = { 0, 0 };
         m_renderPass = VK_NULL_HANDLE;
+        m_loadRenderPass = VK_NULL_HANDLE;
         m_presentFramebuffers.clear();
+        m_framebuffers.clear();
+        m_frameGraph.Clear();
+        m_frameGraphChanged = false;
+        m_frameGraphBackbuffer = FrameGraph::InvalidId;
         m_commandPool = VK_NULL_HANDLE;
+        m_commandBuffers.clear();
+        m_computeCommandBuffers.clear();
         m_imageAvailableSemaphores.clear();
         m_renderFinishedSemaphores.clear();
         m_inFlightFences.clear();
         m_imagesInFlight.clear();
         m_maxFramesInFlight = 0;
         m_currentFrame = 0;
+        m_presentMode = PresentMode::Fifo;
+        m_frameInputTime = Time::Zero;
 
         m_resized = false;
+        m_resizeTime = Time::Zero;
         m_beginDraw = false;    
+        m_frameCount = 0;
         m_currentCommandBuffer = nullptr;
         m_currentFramebuffer = VK_NULL_HANDLE;
-        m_currentPipeline = nullptr;
+        m_boundFramebuffer = nullptr;
+        m_inlineCommandBuffers.clear();
+        m_inlineCommandBufferIndex = 0;
+        m_currentInlineCommandBuffer = nullptr;
+        m_executeCommandBuffers.clear();
+        m_currentComputeCommandBuffer = VK_NULL_HANDLE;
+        m_frameBindStatistics.Clear();
+        m_bindStatistics.Clear();
+        m_frameProfiler.Clear();
+        m_timestampSupport = false;
+        m_gpuMarkerStack.clear();
     }
 
     void VulkanRenderer::Resize(const Vector2ui32& size)
@@ -366,14 +633,16 @@ namespace Molten
             return;
         }
 
-        const Vector2ui32 extent(m_swapChainExtent.width, m_swapChainExtent.height);
+        // The swap chain is recreated by BeginDraw, consecutive resizes only update the requested size.
+        const Vector2ui32 extent(m_requestedExtent.width, m_requestedExtent.height);
         if (extent == size)
         {
             return;
         }
 
-        m_swapChainExtent.width = size.x;
-        m_swapChainExtent.height = size.y;
+        m_requestedExtent.width = size.x;
+        m_requestedExtent.height = size.y;
+        m_resizeTime = Time::GetSystemTime();
         m_resized = true;
     }
 
@@ -387,6 +656,43 @@ namespace Molten
         return m_version;
     }
 
+    BindStatistics VulkanRenderer::GetBindStatistics() const
+    {
+        return m_bindStatistics;
+    }
+
+    const FrameProfiler* VulkanRenderer::GetFrameProfiler() const
+    {
+        return &m_frameProfiler;
+    }
+
+    void VulkanRenderer::SetPresentMode(const PresentMode presentMode)
+    {
+        m_requestedPresentMode = presentMode;
+        m_resized = m_resized || m_logicalDevice != VK_NULL_HANDLE;
+    }
+
+    Renderer::PresentMode VulkanRenderer::GetPresentMode() const
+    {
+        return m_presentMode;
+    }
+
+    void VulkanRenderer::SetMaxFramesInFlight(const size_t maxFramesInFlight)
+    {
+        m_requestedMaxFramesInFlight = maxFramesInFlight;
+        m_resized = m_resized || m_logicalDevice != VK_NULL_HANDLE;
+    }
+
+    size_t VulkanRenderer::GetMaxFramesInFlight() const
+    {
+        return m_maxFramesInFlight;
+    }
+
+    void VulkanRenderer::SetFrameInputTime(const Time& inputTime)
+    {
+        m_frameInputTime = inputTime;
+    }
+
     uint32_t VulkanRenderer::GetPushConstantLocation(Pipeline* pipeline, const uint32_t id)
     {
         auto& locations = static_cast<VulkanPipeline*>(pipeline)->pushConstantLocations;
@@ -399,51 +705,187 @@ namespace Molten
         return it->second;
     }
 
-    Framebuffer* VulkanRenderer::CreateFramebuffer(const FramebufferDescriptor& descriptor)
+    void VulkanRenderer::SetCacheDirectory(const std::string& directory)
     {
-        return nullptr;
+        m_cacheDirectory = directory;
+        m_spirvCache.SetDirectory(directory);
     }
 
-    IndexBuffer* VulkanRenderer::CreateIndexBuffer(const IndexBufferDescriptor& descriptor)
+    CommandBuffer* VulkanRenderer::CreateCommandBuffer()
     {
-        const auto bufferSize = static_cast<VkDeviceSize>(descriptor.indexCount) * GetIndexBufferDataTypeSize(descriptor.dataType);
+        VkCommandPoolCreateInfo commandPoolInfo = {};
+        commandPoolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        commandPoolInfo.queueFamilyIndex = m_physicalDevice.graphicsQueueIndex;
+        commandPoolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+        VkCommandPool commandPool = VK_NULL_HANDLE;
+        if (vkCreateCommandPool(m_logicalDevice, &commandPoolInfo, nullptr, &commandPool) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to create command pool of command buffer.");
+            return nullptr;
+        }
 
-        VkBuffer stagingBuffer;
-        VkDeviceMemory stagingMemory;        
+        return new VulkanCommandBuffer(this, commandPool);
+    }
 
-        if (!CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingMemory))
+    Framebuffer* VulkanRenderer::CreateFramebuffer(const FramebufferDescriptor& descriptor)
+    {
+        if (descriptor.size.x == 0 || descriptor.size.y == 0)
         {
+            Logger::WriteError(m_logger, "Cannot create framebuffer of size 0.");
             return nullptr;
         }
 
-        SmartFunction stagingDestroyer = [&]()
+        // The framebuffer object is created with the transient texture, once the frame graph is loaded.
+        VulkanFramebuffer* framebuffer = new VulkanFramebuffer;
+        framebuffer->framebuffer = VK_NULL_HANDLE;
+        framebuffer->size = descriptor.size;
+        framebuffer->resource = FrameGraph::InvalidId;
+        m_framebuffers.push_back(framebuffer);
+        m_frameGraphChanged = true;
+        return framebuffer;
+    }
+
+    IndexBuffer* VulkanRenderer::CreateIndexBuffer(const IndexBufferDescriptor& descriptor)
+    {
+        const auto bufferSize = static_cast<VkDeviceSize>(descriptor.indexCount) * GetIndexBufferDataTypeSize(descriptor.dataType);
+
+        if (descriptor.usage == IndexBuffer::Usage::Dynamic)
         {
-            vkDestroyBuffer(m_logicalDevice, stagingBuffer, nullptr);
-            vkFreeMemory(m_logicalDevice, stagingMemory, nullptr);
-        };
+            std::vector<VulkanIndexBuffer::Frame> frames(MaxFramesInFlight, { VK_NULL_HANDLE, {} });
+            for (size_t i = 0; i < frames.size(); i++)
+            {
+                if (!CreateDynamicBuffer(bufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, descriptor.data, frames[i].buffer, frames[i].memory))
+                {
+                    for (size_t j = 0; j < i; j++)
+                    {
+                        DestroyBuffer(frames[j].buffer, frames[j].memory);
+                    }
+                    return nullptr;
+                }
+            }
 
-        void* data;
-        vkMapMemory(m_logicalDevice, stagingMemory, 0, bufferSize, 0, &data);
-        memcpy(data, descriptor.data, (size_t)bufferSize);
-        vkUnmapMemory(m_logicalDevice, stagingMemory);
+            VulkanIndexBuffer* buffer = new VulkanIndexBuffer;
+            buffer->buffer = VK_NULL_HANDLE;
+            buffer->frames = std::move(frames);
+            buffer->indexCount = descriptor.data ? descriptor.indexCount : 0;
+            buffer->capacity = descriptor.indexCount;
+            buffer->dataType = descriptor.dataType;
+            return buffer;
+        }
 
         VkBuffer indexBuffer;
-        VkDeviceMemory indexMemory;
+        VulkanMemory indexMemory;
         if (!CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, indexBuffer, indexMemory))
         {
             return nullptr;
         }
 
-        CopyBuffer(stagingBuffer, indexBuffer, bufferSize);
+        if (!UploadBuffer(indexBuffer, descriptor.data, bufferSize))
+        {
+            DestroyBuffer(indexBuffer, indexMemory);
+            return nullptr;
+        }
 
         VulkanIndexBuffer* buffer = new VulkanIndexBuffer;
         buffer->buffer = indexBuffer;
         buffer->memory = indexMemory;
         buffer->indexCount = descriptor.indexCount;
+        buffer->capacity = descriptor.indexCount;
         buffer->dataType = descriptor.dataType;
         return buffer;
     }
 
+    IndirectBuffer* VulkanRenderer::CreateIndirectBuffer(const IndirectBufferDescriptor& descriptor)
+    {
+        if (!descriptor.commandCount)
+        {
+            Logger::WriteError(m_logger, "Cannot create indirect buffer without any commands.");
+            return nullptr;
+        }
+
+        // Commands are followed by the draw count, written by the device or at creation.
+        const VkDeviceSize countOffset = static_cast<VkDeviceSize>(descriptor.commandCount) * sizeof(DrawIndexedIndirectCommand);
+        const VkDeviceSize bufferSize = countOffset + sizeof(uint32_t);
+
+        std::vector<VulkanIndirectBuffer::Frame> frames(MaxFramesInFlight, { VK_NULL_HANDLE, {} });
+
+        VulkanIndirectBuffer::Frame sourceBuffer = { VK_NULL_HANDLE, {} };
+        VulkanIndirectBuffer::Frame boundsBuffer = { VK_NULL_HANDLE, {} };
+
+        auto destroyBuffers = [&]()
+        {
+            for (auto& frame : frames)
+            {
+                if (frame.buffer != VK_NULL_HANDLE)
+                {
+                    DestroyBuffer(frame.buffer, frame.memory);
+                }
+            }
+            if (sourceBuffer.buffer != VK_NULL_HANDLE)
+            {
+                DestroyBuffer(sourceBuffer.buffer, sourceBuffer.memory);
+            }
+            if (boundsBuffer.buffer != VK_NULL_HANDLE)
+            {
+                DestroyBuffer(boundsBuffer.buffer, boundsBuffer.memory);
+            }
+        };
+
+        // Frames are cleared by the transfer stage before being culled on the device.
+        for (auto& frame : frames)
+        {
+            if (!CreateBuffer(bufferSize, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, frame.buffer, frame.memory))
+            {
+                destroyBuffers();
+                return nullptr;
+            }
+
+            auto* data = static_cast<uint8_t*>(frame.memory.mappedData);
+            if (descriptor.commands)
+            {
+                memcpy(data, descriptor.commands, static_cast<size_t>(countOffset));
+            }
+            else
+            {
+                memset(data, 0, static_cast<size_t>(countOffset));
+            }
+            memcpy(data + countOffset, &descriptor.commandCount, sizeof(uint32_t));
+        }
+
+        // Source commands and bounding volumes are read by the cull shader, or kept on the host without any cull pipeline.
+        const bool cullable = descriptor.commands && descriptor.bounds;
+        if (cullable && m_cullPipeline != VK_NULL_HANDLE)
+        {
+            const VkDeviceSize boundsSize = static_cast<VkDeviceSize>(descriptor.commandCount) * sizeof(BoundingVolume);
+            if (!CreateBuffer(countOffset, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, sourceBuffer.buffer, sourceBuffer.memory) ||
+                !CreateBuffer(boundsSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, boundsBuffer.buffer, boundsBuffer.memory))
+            {
+                destroyBuffers();
+                return nullptr;
+            }
+
+            memcpy(sourceBuffer.memory.mappedData, descriptor.commands, static_cast<size_t>(countOffset));
+            memcpy(boundsBuffer.memory.mappedData, descriptor.bounds, static_cast<size_t>(boundsSize));
+        }
+
+        auto* buffer = new VulkanIndirectBuffer;
+        buffer->frames = std::move(frames);
+        buffer->commandCount = descriptor.commandCount;
+        buffer->countOffset = countOffset;
+        buffer->sourceBuffer = sourceBuffer;
+        buffer->boundsBuffer = boundsBuffer;
+        if (cullable && m_cullPipeline == VK_NULL_HANDLE)
+        {
+            buffer->sourceCommands.assign(descriptor.commands, descriptor.commands + descriptor.commandCount);
+            buffer->bounds.assign(descriptor.bounds, descriptor.bounds + descriptor.commandCount);
+        }
+        return buffer;
+    }
+
     Pipeline* VulkanRenderer::CreatePipeline(const PipelineDescriptor& descriptor)
     {
         if (descriptor.vertexScript == nullptr)
@@ -490,26 +932,38 @@ namespace Molten
             return nullptr;
         }
 
+        // Binding 0 is stepped per vertex, binding 1 per instance and only present if the script has instance inputs.
         std::vector<VkVertexInputAttributeDescription> vertexInputAttributes;
         uint32_t vertexBindingStride = 0;
+        uint32_t instanceBindingStride = 0;
         if (descriptor.vertexScript)
         {
+            uint32_t location = 0;
             auto& vertexInputs = descriptor.vertexScript->GetInputInterface();
-            if (!CreateVertexInputAttributes(vertexInputs, vertexInputAttributes, vertexBindingStride))
+            if (!CreateVertexInputAttributes(vertexInputs, 0, vertexInputAttributes, location, vertexBindingStride))
+            {
+                return nullptr;
+            }
+
+            auto* instanceInputs = descriptor.vertexScript->GetInstanceInputInterface();
+            if (instanceInputs && !CreateVertexInputAttributes(*instanceInputs, 1, vertexInputAttributes, location, instanceBindingStride))
             {
                 return nullptr;
             }
         }
 
-        VkVertexInputBindingDescription vertexBinding;
-        vertexBinding.binding = 0;
-        vertexBinding.stride = vertexBindingStride;
-        vertexBinding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        VkVertexInputBindingDescription vertexBindings[2];
+        vertexBindings[0].binding = 0;
+        vertexBindings[0].stride = vertexBindingStride;
+        vertexBindings[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        vertexBindings[1].binding = 1;
+        vertexBindings[1].stride = instanceBindingStride;
+        vertexBindings[1].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
 
         VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
         vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-        vertexInputInfo.vertexBindingDescriptionCount = 1;
-        vertexInputInfo.pVertexBindingDescriptions = &vertexBinding;
+        vertexInputInfo.vertexBindingDescriptionCount = instanceBindingStride > 0 ? 2 : 1;
+        vertexInputInfo.pVertexBindingDescriptions = vertexBindings;
         vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(vertexInputAttributes.size());
         vertexInputInfo.pVertexAttributeDescriptions = vertexInputAttributes.data();        
 
@@ -583,7 +1037,8 @@ namespace Molten
         dynamicStateInfo.flags = 0;
 
         std::vector<VkDescriptorSetLayout> setLayouts;
-        if (!CreateDescriptorSetLayouts(shaderScripts, setLayouts))
+        std::vector<VulkanDescriptorCounts> setDescriptorCounts;
+        if (!CreateDescriptorSetLayouts(shaderScripts, setLayouts, setDescriptorCounts))
         {
             return nullptr;
         }
@@ -622,7 +1077,7 @@ namespace Molten
         pipelineInfo.basePipelineIndex = -1;
 
         VkPipeline graphicsPipeline;
-        if (vkCreateGraphicsPipelines(m_logicalDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &graphicsPipeline) != VK_SUCCESS)
+        if (vkCreateGraphicsPipelines(m_logicalDevice, m_pipelineCache, 1, &pipelineInfo, nullptr, &graphicsPipeline) != VK_SUCCESS)
         {
             vkDestroyPipelineLayout(m_logicalDevice, pipelineLayout, nullptr);
             Logger::WriteError(m_logger, "Failed to create pipeline.");
@@ -633,81 +1088,117 @@ namespace Molten
             graphicsPipeline, 
             pipelineLayout, 
             setLayouts, 
+            std::move(setDescriptorCounts),
             std::move(pushConstantLocations), 
             std::move(pushConstantOffsets),
+            pushConstantRange.size,
             std::move(shaderModules));
     }
 
-    Texture* VulkanRenderer::CreateTexture()
+    std::future<Pipeline*> VulkanRenderer::CreatePipelineAsync(const PipelineDescriptor& descriptor)
     {
-        return new VulkanTexture;
+        return m_threadPool.Execute([this, descriptor]()
+        {
+            return CreatePipeline(descriptor);
+        });
     }
 
-    UniformBlock* VulkanRenderer::CreateUniformBlock(const UniformBlockDescriptor& descriptor)
+    Texture* VulkanRenderer::CreateTexture(const TextureDescriptor& descriptor)
     {
-        VulkanPipeline* vulkanPipeline = static_cast<VulkanPipeline*>(descriptor.pipeline);
-        VulkanUniformBuffer* vulkanUniformBuffer = static_cast<VulkanUniformBuffer*>(descriptor.buffer);      
+        const auto& dimensions = descriptor.dimensions;
+        if (!dimensions.x || !dimensions.y)
+        {
+            Logger::WriteError(m_logger, "Cannot create texture of zero dimensions.");
+            return nullptr;
+        }
+        if (!descriptor.data)
+        {
+            Logger::WriteError(m_logger, "Cannot create texture without any data.");
+            return nullptr;
+        }
 
-        if (descriptor.id >= vulkanPipeline->descriptionSetLayouts.size())
+        const uint32_t maxMipLevelCount = Texture::GetMipLevelCount(dimensions);
+        const uint32_t mipLevelCount = descriptor.mipLevelCount ? descriptor.mipLevelCount : maxMipLevelCount;
+        if (mipLevelCount > maxMipLevelCount)
         {
-            Logger::WriteError(m_logger, "Id of uniform descriptor block is too large.");
+            Logger::WriteError(m_logger, "Mip level count of texture is too large.");
             return nullptr;
         }
 
-        std::unique_ptr<VulkanUniformBlock, std::function<void(VulkanUniformBlock*)> > vulkanUniformBlock(new VulkanUniformBlock,
-            [&](VulkanUniformBlock* uniformBlock)
+        std::unique_ptr<VulkanTexture, std::function<void(VulkanTexture*)> > vulkanTexture(new VulkanTexture,
+            [&](VulkanTexture* texture)
         {
-            DestroyUniformBlock(uniformBlock);
+            DestroyTexture(texture);
         });
 
-        VkDescriptorPoolSize poolSize = {};
-        poolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
-        poolSize.descriptorCount = static_cast<uint32_t>(m_swapChainImages.size());
+        vulkanTexture->image = VK_NULL_HANDLE;
+        vulkanTexture->imageView = VK_NULL_HANDLE;
+        vulkanTexture->sampler = VK_NULL_HANDLE;
+        vulkanTexture->imageFormat = GetTextureFormat(descriptor.format);
+        vulkanTexture->format = descriptor.format;
+        vulkanTexture->dimensions = dimensions;
+        vulkanTexture->mipLevelCount = mipLevelCount;
+        vulkanTexture->residentMipLevel = mipLevelCount;
+
+        if (!CreateSampler(descriptor.sampler, mipLevelCount, vulkanTexture->sampler))
+        {
+            return nullptr;
+        }
 
-        VkDescriptorPoolCreateInfo poolInfo = {};
-        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-        poolInfo.poolSizeCount = 1;
-        poolInfo.pPoolSizes = &poolSize;
-        poolInfo.maxSets = static_cast<uint32_t>(m_swapChainImages.size());
-        poolInfo.flags = 0;
+        const auto* data = static_cast<const uint8_t*>(descriptor.data);
+        if (descriptor.streaming && mipLevelCount > 1)
+        {
+            // Levels are uploaded by StreamTextures, starting at the next frame.
+            const size_t dataSize = Texture::GetMipChainSize(dimensions, descriptor.format, 0, mipLevelCount);
+            vulkanTexture->streamData.assign(data, data + dataSize);
+            m_textureStreamer.Add(vulkanTexture.get(), dimensions, descriptor.format, mipLevelCount);
+            return vulkanTexture.release();
+        }
 
-        if (vkCreateDescriptorPool(m_logicalDevice, &poolInfo, nullptr, &vulkanUniformBlock->descriptorPool) != VK_SUCCESS)
+        if (!LoadTextureImage(*vulkanTexture, 0, data))
         {
-            Logger::WriteError(m_logger, "Failed to create descriptor pool.");
             return nullptr;
         }
-      
-        std::vector<VkDescriptorSetLayout> layouts(m_swapChainImages.size(), vulkanPipeline->descriptionSetLayouts[descriptor.id]);
-        VkDescriptorSetAllocateInfo allocInfo = {};
-        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-        allocInfo.descriptorPool = vulkanUniformBlock->descriptorPool;
-        allocInfo.descriptorSetCount = static_cast<uint32_t>(m_swapChainImages.size());
-        allocInfo.pSetLayouts = layouts.data(); 
 
-        vulkanUniformBlock->descriptorSets.resize(m_swapChainImages.size());
-        if (vkAllocateDescriptorSets(m_logicalDevice, &allocInfo, vulkanUniformBlock->descriptorSets.data()) != VK_SUCCESS)
+        return vulkanTexture.release();
+    }
+
+    UniformBlock* VulkanRenderer::CreateUniformBlock(const UniformBlockDescriptor& descriptor)
+    {
+        VulkanPipeline* vulkanPipeline = static_cast<VulkanPipeline*>(descriptor.pipeline);
+        VulkanUniformBuffer* vulkanUniformBuffer = static_cast<VulkanUniformBuffer*>(descriptor.buffer);      
+
+        if (descriptor.id >= vulkanPipeline->descriptionSetLayouts.size())
         {
-            Logger::WriteError(m_logger, "Failed to create descriptor sets.");
+            Logger::WriteError(m_logger, "Id of uniform descriptor block is too large.");
             return nullptr;
         }
 
-        for (size_t i = 0; i < m_swapChainImages.size(); i++)
+        std::unique_ptr<VulkanUniformBlock, std::function<void(VulkanUniformBlock*)> > vulkanUniformBlock(new VulkanUniformBlock,
+            [&](VulkanUniformBlock* uniformBlock)
         {
-            VkDescriptorBufferInfo bufferInfo = {};
-            bufferInfo.buffer = vulkanUniformBuffer->frames[i].buffer;
-            bufferInfo.offset = 0;
-            bufferInfo.range = VK_WHOLE_SIZE;
+            DestroyUniformBlock(uniformBlock);
+        });
 
-            VkWriteDescriptorSet descWrite = {};
-            descWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-            descWrite.dstSet = vulkanUniformBlock->descriptorSets[i];
-            descWrite.dstBinding = 0;//descriptor.binding;
-            descWrite.dstArrayElement = 0;
-            descWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
-            descWrite.descriptorCount = 1;
-            descWrite.pBufferInfo = &bufferInfo;
+        // Blocks of equal layout and buffer share cached descriptor sets, instead of one pool per block.
+        const VkDescriptorSetLayout layout = vulkanPipeline->descriptionSetLayouts[descriptor.id];
+        vulkanUniformBlock->descriptorSets.reserve(vulkanUniformBuffer->frames.size());
+        for (size_t i = 0; i < vulkanUniformBuffer->frames.size(); i++)
+        {
+            VulkanDescriptorBufferBinding binding = {};
+            binding.binding = 0;
+            binding.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+            binding.buffer = vulkanUniformBuffer->frames[i].buffer;
+            binding.offset = 0;
+            binding.range = descriptor.size ? static_cast<VkDeviceSize>(descriptor.size) : VK_WHOLE_SIZE;
 
-            vkUpdateDescriptorSets(m_logicalDevice, 1, &descWrite, 0, nullptr);
+            VkDescriptorSet set = VK_NULL_HANDLE;
+            if (!m_descriptorSetCache.Acquire(layout, { binding }, set))
+            {
+                Logger::WriteError(m_logger, "Failed to create descriptor sets.");
+                return nullptr;
+            }
+            vulkanUniformBlock->descriptorSets.push_back(set);
         }
 
         vulkanUniformBlock->pipelineLayout = vulkanPipeline->pipelineLayout;
@@ -719,7 +1210,7 @@ namespace Molten
     UniformBuffer* VulkanRenderer::CreateUniformBuffer(const UniformBufferDescriptor& descriptor)
     {
         std::vector<VulkanUniformBuffer::Frame> frames;
-        frames.resize(m_swapChainImages.size());
+        frames.resize(MaxFramesInFlight);
 
         auto destroyBuffers = [&]()
         {
@@ -727,11 +1218,7 @@ namespace Molten
             {
                 if (frame.buffer != VK_NULL_HANDLE)
                 {
-                    vkDestroyBuffer(m_logicalDevice, frame.buffer, nullptr);
-                }
-                if ( frame.memory != VK_NULL_HANDLE)
-                {
-                    vkFreeMemory(m_logicalDevice, frame.memory, nullptr);
+                    DestroyBuffer(frame.buffer, frame.memory);
                 }
             }    
         };
@@ -742,11 +1229,12 @@ namespace Molten
             {
                 destroyBuffers();
                 return nullptr;
-            }             
+            }
         }
 
         auto vulkanUniformBuffer = new VulkanUniformBuffer;
         vulkanUniformBuffer->frames = frames;
+        vulkanUniformBuffer->size = static_cast<size_t>(descriptor.size);
         return vulkanUniformBuffer;
     }
 
@@ -756,55 +1244,113 @@ namespace Molten
             static_cast<VkDeviceSize>(static_cast<VkDeviceSize>(descriptor.vertexCount) *
             static_cast<VkDeviceSize>(descriptor.vertexSize));
 
-        VkBuffer stagingBuffer;
-        VkDeviceMemory stagingMemory;
-
-        if (!CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingMemory))
-        {
-            return nullptr;
-        }
-
-        SmartFunction stagingDestroyer = [&]()
+        if (descriptor.usage == VertexBuffer::Usage::Dynamic)
         {
-            vkDestroyBuffer(m_logicalDevice, stagingBuffer, nullptr);
-            vkFreeMemory(m_logicalDevice, stagingMemory, nullptr);
-        };
+            std::vector<VulkanVertexBuffer::Frame> frames(MaxFramesInFlight, { VK_NULL_HANDLE, {} });
+            for (size_t i = 0; i < frames.size(); i++)
+            {
+                if (!CreateDynamicBuffer(bufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, descriptor.data, frames[i].buffer, frames[i].memory))
+                {
+                    for (size_t j = 0; j < i; j++)
+                    {
+                        DestroyBuffer(frames[j].buffer, frames[j].memory);
+                    }
+                    return nullptr;
+                }
+            }
 
-        void* data;
-        vkMapMemory(m_logicalDevice, stagingMemory, 0, bufferSize, 0, &data);
-        memcpy(data, descriptor.data, (size_t)bufferSize);
-        vkUnmapMemory(m_logicalDevice, stagingMemory);
+            VulkanVertexBuffer* buffer = new VulkanVertexBuffer;
+            buffer->buffer = VK_NULL_HANDLE;
+            buffer->frames = std::move(frames);
+            buffer->vertexCount = descriptor.data ? descriptor.vertexCount : 0;
+            buffer->capacity = descriptor.vertexCount;
+            buffer->vertexSize = descriptor.vertexSize;
+            return buffer;
+        }
 
         VkBuffer vertexBuffer;
-        VkDeviceMemory vertexMemory;
+        VulkanMemory vertexMemory;
         if (!CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vertexBuffer, vertexMemory))
         {
             return nullptr;
         }
 
-        CopyBuffer(stagingBuffer, vertexBuffer, bufferSize);
+        if (!UploadBuffer(vertexBuffer, descriptor.data, bufferSize))
+        {
+            DestroyBuffer(vertexBuffer, vertexMemory);
+            return nullptr;
+        }
 
         VulkanVertexBuffer* buffer = new VulkanVertexBuffer;
         buffer->buffer = vertexBuffer;
         buffer->memory = vertexMemory;
         buffer->vertexCount = descriptor.vertexCount;
+        buffer->capacity = descriptor.vertexCount;
         buffer->vertexSize = descriptor.vertexSize;
         return buffer;
     }
 
+    void VulkanRenderer::DestroyCommandBuffer(CommandBuffer* commandBuffer)
+    {
+        VulkanCommandBuffer* vulkanCommandBuffer = static_cast<VulkanCommandBuffer*>(commandBuffer);
+
+        // Secondary command buffers of frames in flight may still be executing.
+        RetireCommandPool(vulkanCommandBuffer->commandPool);
+        delete vulkanCommandBuffer;
+    }
+
     void VulkanRenderer::DestroyFramebuffer(Framebuffer* framebuffer)
     {
         VulkanFramebuffer* vulkanFramebuffer = static_cast<VulkanFramebuffer*>(framebuffer);
-        vkDestroyFramebuffer(m_logicalDevice, vulkanFramebuffer->framebuffer, nullptr);
+        if (m_boundFramebuffer == vulkanFramebuffer)
+        {
+            EndInlineCommandBuffer();
+            m_boundFramebuffer = nullptr;
+        }
+        m_framebuffers.erase(std::remove(m_framebuffers.begin(), m_framebuffers.end(), vulkanFramebuffer), m_framebuffers.end());
+
+        // Frames in flight may still draw into the framebuffer, its pass is removed at the next call to EndDraw.
+        if (vulkanFramebuffer->framebuffer != VK_NULL_HANDLE)
+        {
+            RetireFramebuffer(vulkanFramebuffer->framebuffer);
+        }
+        m_frameGraphChanged = true;
         delete vulkanFramebuffer;
     }
 
     void VulkanRenderer::DestroyIndexBuffer(IndexBuffer* indexBuffer)
     {
         VulkanIndexBuffer* vulkanIndexBuffer = static_cast<VulkanIndexBuffer*>(indexBuffer);
-        vkDestroyBuffer(m_logicalDevice, vulkanIndexBuffer->buffer, nullptr);
-        vkFreeMemory(m_logicalDevice, vulkanIndexBuffer->memory, nullptr);
-        delete vulkanIndexBuffer;
+
+        // Frames in flight may still use the buffers.
+        for (auto& frame : vulkanIndexBuffer->frames)
+        {
+            RetireBuffer(frame.buffer, frame.memory, false);
+        }
+        if (vulkanIndexBuffer->buffer != VK_NULL_HANDLE)
+        {
+            RetireBuffer(vulkanIndexBuffer->buffer, vulkanIndexBuffer->memory, true);
+        }
+
+        delete vulkanIndexBuffer;
+    }
+
+    void VulkanRenderer::DestroyIndirectBuffer(IndirectBuffer* indirectBuffer)
+    {
+        VulkanIndirectBuffer* vulkanIndirectBuffer = static_cast<VulkanIndirectBuffer*>(indirectBuffer);
+
+        // Frames in flight may still draw or cull the buffers.
+        for (auto& frame : vulkanIndirectBuffer->frames)
+        {
+            RetireBuffer(frame.buffer, frame.memory, false);
+        }
+        if (vulkanIndirectBuffer->sourceBuffer.buffer != VK_NULL_HANDLE)
+        {
+            RetireBuffer(vulkanIndirectBuffer->sourceBuffer.buffer, vulkanIndirectBuffer->sourceBuffer.memory, false);
+            RetireBuffer(vulkanIndirectBuffer->boundsBuffer.buffer, vulkanIndirectBuffer->boundsBuffer.memory, false);
+        }
+
+        delete vulkanIndirectBuffer;
     }
 
     void VulkanRenderer::DestroyPipeline(Pipeline* pipeline)
@@ -834,15 +1380,31 @@ namespace Molten
 
     void VulkanRenderer::DestroyTexture(Texture* texture)
     {
-        delete static_cast<VulkanTexture*>(texture);
+        VulkanTexture* vulkanTexture = static_cast<VulkanTexture*>(texture);
+
+        m_textureStreamer.Remove(vulkanTexture);
+
+        // Frames in flight may still use the image.
+        if (vulkanTexture->image != VK_NULL_HANDLE)
+        {
+            m_retiredImages.push_back({ vulkanTexture->image, vulkanTexture->memory, vulkanTexture->imageView, m_frameCount });
+        }
+        if (vulkanTexture->sampler != VK_NULL_HANDLE)
+        {
+            vkDestroySampler(m_logicalDevice, vulkanTexture->sampler, nullptr);
+        }
+
+        delete vulkanTexture;
     }
 
     void VulkanRenderer::DestroyUniformBlock(UniformBlock* uniformBlock)
     {
         VulkanUniformBlock* vulkanUniformBlock = static_cast<VulkanUniformBlock*>(uniformBlock);
-        if(vulkanUniformBlock->descriptorPool != VK_NULL_HANDLE)
+
+        // Command buffers of frames in flight may still reference the sets.
+        for (auto set : vulkanUniformBlock->descriptorSets)
         {
-            vkDestroyDescriptorPool(m_logicalDevice, vulkanUniformBlock->descriptorPool, nullptr);
+            RetireDescriptorSet(set);
         }
         delete vulkanUniformBlock;
     }
@@ -851,10 +1413,10 @@ namespace Molten
     {
         VulkanUniformBuffer* vulkanUniformBuffer = static_cast<VulkanUniformBuffer*>(uniformBuffer);
 
+        // Frames in flight may still use the buffers.
         for (auto& frame : vulkanUniformBuffer->frames)
         {
-            vkDestroyBuffer(m_logicalDevice, frame.buffer, nullptr);
-            vkFreeMemory(m_logicalDevice, frame.memory, nullptr);
+            RetireBuffer(frame.buffer, frame.memory, false);
         }
 
         delete vulkanUniformBuffer;
@@ -863,51 +1425,172 @@ namespace Molten
     void VulkanRenderer::DestroyVertexBuffer(VertexBuffer* vertexBuffer)
     {
         VulkanVertexBuffer* vulkanVertexBuffer = static_cast<VulkanVertexBuffer*>(vertexBuffer);
-        vkDestroyBuffer(m_logicalDevice, vulkanVertexBuffer->buffer, nullptr);
-        vkFreeMemory(m_logicalDevice, vulkanVertexBuffer->memory, nullptr);
+
+        // Frames in flight may still use the buffers.
+        for (auto& frame : vulkanVertexBuffer->frames)
+        {
+            RetireBuffer(frame.buffer, frame.memory, false);
+        }
+        if (vulkanVertexBuffer->buffer != VK_NULL_HANDLE)
+        {
+            RetireBuffer(vulkanVertexBuffer->buffer, vulkanVertexBuffer->memory, true);
+        }
+
         delete vulkanVertexBuffer;
     }
 
     void VulkanRenderer::BindPipeline(Pipeline* pipeline)
     {
-        VulkanPipeline* vulkanPipeline = static_cast<VulkanPipeline*>(pipeline);
-        vkCmdBindPipeline(*m_currentCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vulkanPipeline->graphicsPipeline);
-        m_currentPipeline = vulkanPipeline;
+        auto* commandBuffer = GetInlineCommandBuffer();
+        if (commandBuffer)
+        {
+            commandBuffer->BindPipeline(pipeline);
+        }
     }
 
     void VulkanRenderer::BindUniformBlock(UniformBlock* uniformBlock, const uint32_t offset)
     {
-        VulkanUniformBlock* vulkanUniformBlock = static_cast<VulkanUniformBlock*>(uniformBlock);
-        vkCmdBindDescriptorSets(*m_currentCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vulkanUniformBlock->pipelineLayout, vulkanUniformBlock->set, 1,
-            &vulkanUniformBlock->descriptorSets[m_currentImageIndex], 1, &offset);
+        auto* commandBuffer = GetInlineCommandBuffer();
+        if (commandBuffer)
+        {
+            commandBuffer->BindUniformBlock(uniformBlock, offset);
+        }
+    }
+
+    void VulkanRenderer::BindUniformBuffer(Pipeline* pipeline, const uint32_t set, UniformBuffer* uniformBuffer, const uint32_t offset, const uint32_t size)
+    {
+        VulkanPipeline* vulkanPipeline = static_cast<VulkanPipeline*>(pipeline);
+        VulkanUniformBuffer* vulkanUniformBuffer = static_cast<VulkanUniformBuffer*>(uniformBuffer);
+
+        if (set >= vulkanPipeline->descriptionSetLayouts.size())
+        {
+            Logger::WriteError(m_logger, "Set of uniform buffer binding is too large.");
+            return;
+        }
+
+        auto* commandBuffer = GetInlineCommandBuffer();
+        if (!commandBuffer)
+        {
+            return;
+        }
+
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+        if (!m_descriptorArenas[m_currentImageIndex]->Allocate(vulkanPipeline->descriptionSetLayouts[set], vulkanPipeline->descriptorSetCounts[set], descriptorSet))
+        {
+            return;
+        }
+
+        VkDescriptorBufferInfo bufferInfo = {};
+        bufferInfo.buffer = vulkanUniformBuffer->frames[m_currentFrame].buffer;
+        bufferInfo.offset = 0;
+        bufferInfo.range = size ? static_cast<VkDeviceSize>(size) : VK_WHOLE_SIZE;
+
+        VkWriteDescriptorSet descWrite = {};
+        descWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descWrite.dstSet = descriptorSet;
+        descWrite.dstBinding = 0;
+        descWrite.dstArrayElement = 0;
+        descWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        descWrite.descriptorCount = 1;
+        descWrite.pBufferInfo = &bufferInfo;
+        vkUpdateDescriptorSets(m_logicalDevice, 1, &descWrite, 0, nullptr);
+
+        commandBuffer->bindStateCache.InvalidateUniformBlock(set);
+        vkCmdBindDescriptorSets(commandBuffer->currentCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vulkanPipeline->pipelineLayout, set, 1,
+            &descriptorSet, 1, &offset);
     }
 
     void VulkanRenderer::BeginDraw()
     {
+        MOLTEN_PROFILE_ZONE("VulkanRenderer::BeginDraw");
+
         if (m_beginDraw)
         {
             Logger::WriteError(m_logger, "Calling BeginDraw twice, without any previous call to EndDraw.");
             return;
         }
+
+        const Time beginTime = Time::GetSystemTime();
+        if (m_frameBeginTime == Time::Zero)
+        {
+            m_frameBeginTime = beginTime;
+        }
       
         vkWaitForFences(m_logicalDevice, 1, &m_inFlightFences[m_currentFrame], VK_TRUE, std::numeric_limits<uint64_t>::max());
+        const Time waitTime = Time::GetSystemTime();
+        m_frameProfiler.AddSample(FrameProfiler::Domain::Cpu, "Wait", waitTime - beginTime);
+        RecycleUploadSemaphores(m_currentFrame);
+        RetireUploadBatches(false);
+        DestroyRetiredSwapchains(false);
+        DestroyRetiredResources(false);
        
-        MOLTEN_UNSCOPED_ENUM_BEGIN
-        VkResult result = vkAcquireNextImageKHR(m_logicalDevice, m_swapChain, std::numeric_limits<uint64_t>::max(), 
-            m_imageAvailableSemaphores[m_currentFrame], VK_NULL_HANDLE, &m_currentImageIndex);
-        MOLTEN_UNSCOPED_ENUM_END
+        if (m_offscreen)
+        {
+            if (m_resized)
+            {
+                m_resized = false;
+                if (!RecreateSwapChain())
+                {
+                    m_resized = true;
+                    return;
+                }
+            }
 
-        if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || m_resized)
-        {    
-            m_resized = false;
-            RecreateSwapChain();
-            BeginDraw();
-            return;
+            // Offscreen images are used in round robin order.
+            m_currentImageIndex = static_cast<uint32_t>(m_frameCount % m_swapChainImages.size());
         }
-        else if (result != VK_SUCCESS)
+        else
         {
-            Logger::WriteError(m_logger, "Failed to acquire the next swap chain image.");
-            return;
+            // Without any images of a previously failed recreation, nothing can be acquired and recreation is retried at once.
+            // Otherwise window resizes are coalesced, the swap chain is recreated once the requested size has settled.
+            const bool missingImages = m_swapChain == VK_NULL_HANDLE || m_presentFramebuffers.empty();
+            if (missingImages || (m_resized && waitTime - m_resizeTime >= Milliseconds(50)))
+            {
+                m_resized = false;
+                if (!RecreateSwapChain())
+                {
+                    m_resized = true;
+                    return;
+                }
+            }
+
+            auto acquireNextImage = [&]()
+            {
+                return vkAcquireNextImageKHR(m_logicalDevice, m_swapChain, std::numeric_limits<uint64_t>::max(),
+                    m_imageAvailableSemaphores[m_currentFrame], VK_NULL_HANDLE, &m_currentImageIndex);
+            };
+
+            MOLTEN_UNSCOPED_ENUM_BEGIN
+            // No image is acquired from an out of date swap chain, it has to be recreated before acquiring once more.
+            VkResult result = acquireNextImage();
+            if (result == VK_ERROR_OUT_OF_DATE_KHR)
+            {
+                m_resized = false;
+                if (!RecreateSwapChain())
+                {
+                    m_resized = true;
+                    return;
+                }
+                result = acquireNextImage();
+            }
+
+            // Suboptimal images are still presentable, recreate the swap chain at a later frame.
+            if (result == VK_SUBOPTIMAL_KHR)
+            {
+                if (!m_resized)
+                {
+                    m_resized = true;
+                    m_resizeTime = waitTime;
+                }
+            }
+            else if (result != VK_SUCCESS)
+            {
+                Logger::WriteError(m_logger, "Failed to acquire the next swap chain image.");
+                return;
+            }
+            MOLTEN_UNSCOPED_ENUM_END
+
+            m_frameProfiler.AddSample(FrameProfiler::Domain::Cpu, "Acquire", Time::GetSystemTime() - waitTime);
         }
 
         if (m_imagesInFlight[m_currentImageIndex] != VK_NULL_HANDLE)
@@ -922,6 +1605,20 @@ namespace Molten
             return;
         }
 
+        StreamTextures();
+
+        // Transient descriptor sets of the previous use of this image are no longer referenced.
+        while (m_descriptorArenas.size() <= static_cast<size_t>(m_currentImageIndex))
+        {
+            auto arena = std::make_unique<VulkanDescriptorArena>();
+            if (!arena->Open(m_logicalDevice, m_logger))
+            {
+                return;
+            }
+            m_descriptorArenas.push_back(std::move(arena));
+        }
+        m_descriptorArenas[m_currentImageIndex]->Reset();
+
         m_currentCommandBuffer = &m_commandBuffers[m_currentImageIndex];
         m_currentFramebuffer = m_presentFramebuffers[m_currentImageIndex]->framebuffer;
 
@@ -936,58 +1633,122 @@ namespace Molten
             return;
         }
 
-        VkRenderPassBeginInfo renderPassBeginInfo = {};
-        renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassBeginInfo.renderPass = m_renderPass;
-        renderPassBeginInfo.framebuffer = m_currentFramebuffer;
-        renderPassBeginInfo.renderArea.offset = { 0, 0 };
-        renderPassBeginInfo.renderArea.extent = m_swapChainExtent;
+        // Timestamps of the previous use of this image are available, since its fence is signaled.
+        if (!BeginTimestampFrame())
+        {
+            return;
+        }
 
-        const VkClearValue clearColor = { 0.3f, 0.0f, 0.0f, 0.0f };
-        renderPassBeginInfo.clearValueCount = 1;
-        renderPassBeginInfo.pClearValues = &clearColor;
+        m_inlineCommandBufferIndex = 0;
+        m_currentInlineCommandBuffer = nullptr;
+        m_executeCommandBuffers.clear();
+        for (auto* framebuffer : m_framebuffers)
+        {
+            framebuffer->executeCommandBuffers.clear();
+        }
+        m_boundFramebuffer = nullptr;
+        m_currentComputeCommandBuffer = VK_NULL_HANDLE;
+
+        ++m_frameCount;
+        m_beginDraw = true;
+        m_recordBeginTime = Time::GetSystemTime();
+    }
+
+    void VulkanRenderer::BindFramebuffer(Framebuffer* framebuffer)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot bind framebuffer without any previous call to BeginDraw.");
+            return;
+        }
+
+        // Commands recorded directly on the renderer before this call are drawn into the previously bound framebuffer.
+        EndInlineCommandBuffer();
+        m_boundFramebuffer = static_cast<VulkanFramebuffer*>(framebuffer);
+    }
 
-        VkViewport viewport = {};
-        viewport.x = 0.0f;
-        viewport.y = 0.0f;
-        viewport.width = static_cast<float>(m_swapChainExtent.width);
-        viewport.height = static_cast<float>(m_swapChainExtent.height);
-        viewport.minDepth = 0.0f;
-        viewport.maxDepth = 0.0f;
+    void VulkanRenderer::ExecuteCommandBuffer(CommandBuffer* commandBuffer)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot execute command buffer without any previous call to BeginDraw.");
+            return;
+        }
 
-        VkRect2D scissor = {};
-        scissor.offset = { 0, 0 };
-        scissor.extent = m_swapChainExtent;
+        VulkanCommandBuffer* vulkanCommandBuffer = static_cast<VulkanCommandBuffer*>(commandBuffer);
+        if (vulkanCommandBuffer->recording ||
+            vulkanCommandBuffer->currentCommandBuffer == VK_NULL_HANDLE ||
+            vulkanCommandBuffer->currentFrame != m_currentFrame)
+        {
+            Logger::WriteError(m_logger, "Cannot execute command buffer that is not recorded for the current frame.");
+            return;
+        }
+        if (vulkanCommandBuffer->currentFramebuffer != m_boundFramebuffer)
+        {
+            Logger::WriteError(m_logger, "Cannot execute command buffer recorded for another framebuffer than the bound framebuffer.");
+            return;
+        }
 
-        vkCmdBeginRenderPass(*m_currentCommandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
-        vkCmdSetViewport(*m_currentCommandBuffer, 0, 1, &viewport);
-        vkCmdSetScissor(*m_currentCommandBuffer, 0, 1, &scissor);
+        EndInlineCommandBuffer();
+        GetExecuteCommandBuffers().push_back(vulkanCommandBuffer->currentCommandBuffer);
+        m_frameBindStatistics += vulkanCommandBuffer->bindStateCache.GetStatistics();
 
-        m_beginDraw = true;
+        // Secondary command buffers cannot be executed twice in the same primary command buffer.
+        vulkanCommandBuffer->currentCommandBuffer = VK_NULL_HANDLE;
     }
 
     void VulkanRenderer::DrawVertexBuffer(VertexBuffer* vertexBuffer)
     {
-        VulkanVertexBuffer* vulkanVertexBuffer = static_cast<VulkanVertexBuffer*>(vertexBuffer);
+        auto* commandBuffer = GetInlineCommandBuffer();
+        if (commandBuffer)
+        {
+            commandBuffer->DrawVertexBuffer(vertexBuffer);
+        }
+    }
 
-        VkBuffer vertexBuffers[] = { vulkanVertexBuffer->buffer };
-        const VkDeviceSize offsets[] = { 0 };
+    void VulkanRenderer::DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer)
+    {
+        auto* commandBuffer = GetInlineCommandBuffer();
+        if (commandBuffer)
+        {
+            commandBuffer->DrawVertexBuffer(indexBuffer, vertexBuffer);
+        }
+    }
 
-        vkCmdBindVertexBuffers(*m_currentCommandBuffer, 0, 1, vertexBuffers, offsets);
-        vkCmdDraw(*m_currentCommandBuffer, static_cast<uint32_t>(vulkanVertexBuffer->vertexCount), 1, 0, 0);
+    void VulkanRenderer::DrawVertexBufferInstanced(VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount)
+    {
+        auto* commandBuffer = GetInlineCommandBuffer();
+        if (commandBuffer)
+        {
+            commandBuffer->DrawVertexBufferInstanced(vertexBuffer, instanceBuffer, instanceCount);
+        }
     }
 
-    void VulkanRenderer::DrawVertexBuffer(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer)
+    void VulkanRenderer::DrawVertexBufferInstanced(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, const uint32_t instanceCount)
     {
-        VulkanIndexBuffer* vulkanIndexBuffer = static_cast<VulkanIndexBuffer*>(indexBuffer);
-        VulkanVertexBuffer* vulkanVertexBuffer = static_cast<VulkanVertexBuffer*>(vertexBuffer);
+        auto* commandBuffer = GetInlineCommandBuffer();
+        if (commandBuffer)
+        {
+            commandBuffer->DrawVertexBufferInstanced(indexBuffer, vertexBuffer, instanceBuffer, instanceCount);
+        }
+    }
 
-        VkBuffer vertexBuffers[] = { vulkanVertexBuffer->buffer };
-        const VkDeviceSize offsets[] = { 0 };
+    void VulkanRenderer::DrawVertexBufferIndirect(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer, const uint32_t drawCount)
+    {
+        auto* commandBuffer = GetInlineCommandBuffer();
+        if (commandBuffer)
+        {
+            commandBuffer->DrawVertexBufferIndirect(indexBuffer, vertexBuffer, instanceBuffer, indirectBuffer, drawCount);
+        }
+    }
 
-        vkCmdBindVertexBuffers(*m_currentCommandBuffer, 0, 1, vertexBuffers, offsets);
-        vkCmdBindIndexBuffer(*m_currentCommandBuffer, vulkanIndexBuffer->buffer, 0, GetIndexBufferDataType(vulkanIndexBuffer->dataType));
-        vkCmdDrawIndexed(*m_currentCommandBuffer, static_cast<uint32_t>(vulkanIndexBuffer->indexCount), 1, 0, 0, 0);
+    void VulkanRenderer::DrawVertexBufferIndirectCount(IndexBuffer* indexBuffer, VertexBuffer* vertexBuffer, VertexBuffer* instanceBuffer, IndirectBuffer* indirectBuffer)
+    {
+        auto* commandBuffer = GetInlineCommandBuffer();
+        if (commandBuffer)
+        {
+            commandBuffer->DrawVertexBufferIndirectCount(indexBuffer, vertexBuffer, instanceBuffer, indirectBuffer);
+        }
     }
 
     void VulkanRenderer::PushConstant(const uint32_t location, const bool& value)
@@ -1021,32 +1782,97 @@ namespace Molten
 
     void VulkanRenderer::EndDraw()
     {
+        MOLTEN_PROFILE_ZONE("VulkanRenderer::EndDraw");
+
         if (!m_beginDraw)
         {
             Logger::WriteError(m_logger, "Calling EndDraw, without any previous call to BeginDraw.");
             return;
         }
 
-        vkCmdEndRenderPass(*m_currentCommandBuffer);
+        const Time endTime = Time::GetSystemTime();
+        m_frameProfiler.AddSample(FrameProfiler::Domain::Cpu, "Record", endTime - m_recordBeginTime);
+
+        if (!m_gpuMarkerStack.empty())
+        {
+            Logger::WriteError(m_logger, "Calling EndDraw, without ending all GPU markers.");
+            while (!m_gpuMarkerStack.empty())
+            {
+                EndGpuMarker();
+            }
+        }
+
+        EndInlineCommandBuffer();
+        m_boundFramebuffer = nullptr;
+
+        m_bindStatistics = m_frameBindStatistics;
+        m_frameBindStatistics.Clear();
+
+        // Passes of framebuffers created or destroyed during this frame are added or removed before execution.
+        if (m_frameGraphChanged)
+        {
+            LoadFrameGraph();
+        }
+
+        // Barriers of the frame graph are recorded by its passes, each pass executes the command buffers of its framebuffer.
+        m_frameGraph.Execute();
+        RecordFrameGraphBarriers(m_frameGraph.GetFinalBarriers());
+        EndTimestampFrame();
         if (vkEndCommandBuffer(*m_currentCommandBuffer) != VK_SUCCESS)
         {
             Logger::WriteError(m_logger, "Failed to record command buffer.");
             return;
         }
 
+        // Culled indirect buffers are read by the draw commands, submitted after the compute command buffer in the same batch.
+        std::vector<VkCommandBuffer> submitCommandBuffers;
+        if (m_currentComputeCommandBuffer != VK_NULL_HANDLE)
+        {
+            VkMemoryBarrier memoryBarrier = {};
+            memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            memoryBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+            vkCmdPipelineBarrier(m_currentComputeCommandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 0,
+                1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+            const VkCommandBuffer computeCommandBuffer = m_currentComputeCommandBuffer;
+            m_currentComputeCommandBuffer = VK_NULL_HANDLE;
+            if (vkEndCommandBuffer(computeCommandBuffer) != VK_SUCCESS)
+            {
+                Logger::WriteError(m_logger, "Failed to record compute command buffer.");
+                return;
+            }
+            submitCommandBuffers.push_back(computeCommandBuffer);
+        }
+        submitCommandBuffers.push_back(*m_currentCommandBuffer);
+
+        // Uploads of this frame are submitted before the draw commands, which waits for them at the vertex input stage.
+        FlushUploads();
+
+        std::vector<VkSemaphore> waitSemaphores;
+        std::vector<VkPipelineStageFlags> pipelineWaitStages;
+        if (!m_offscreen)
+        {
+            waitSemaphores.push_back(m_imageAvailableSemaphores[m_currentFrame]);
+            pipelineWaitStages.push_back(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+        }
+        for (auto uploadSemaphore : m_uploadWaitSemaphores)
+        {
+            waitSemaphores.push_back(uploadSemaphore);
+            pipelineWaitStages.push_back(VK_PIPELINE_STAGE_VERTEX_INPUT_BIT);
+        }
+
         VkSubmitInfo submitInfo = {};
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.waitSemaphoreCount = static_cast<uint32_t>(waitSemaphores.size());
+        submitInfo.pWaitSemaphores = waitSemaphores.data();
+        submitInfo.pWaitDstStageMask = pipelineWaitStages.data();
+        submitInfo.commandBufferCount = static_cast<uint32_t>(submitCommandBuffers.size());
+        submitInfo.pCommandBuffers = submitCommandBuffers.data();
 
-        VkSemaphore imageSemaphores[] = { m_imageAvailableSemaphores[m_currentFrame] };
-        VkPipelineStageFlags pipelineWaitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-        submitInfo.waitSemaphoreCount = 1;
-        submitInfo.pWaitSemaphores = imageSemaphores;
-        submitInfo.pWaitDstStageMask = pipelineWaitStages;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = m_currentCommandBuffer;
-
+        // Offscreen images are not presented, nothing waits for the rendering to finish on the device.
         VkSemaphore renderSemaphores[] = { m_renderFinishedSemaphores[m_currentFrame] };
-        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.signalSemaphoreCount = m_offscreen ? 0 : 1;
         submitInfo.pSignalSemaphores = renderSemaphores;
 
         vkResetFences(m_logicalDevice, 1, &m_inFlightFences[m_currentFrame]);
@@ -1056,6 +1882,33 @@ namespace Molten
             return;
         }
 
+        // Upload semaphores are reusable as soon as the in flight fence of this frame is signaled.
+        if (m_currentFrame >= m_frameUploadSemaphores.size())
+        {
+            m_frameUploadSemaphores.resize(m_currentFrame + 1);
+        }
+        auto& frameUploadSemaphores = m_frameUploadSemaphores[m_currentFrame];
+        frameUploadSemaphores.insert(frameUploadSemaphores.end(), m_uploadWaitSemaphores.begin(), m_uploadWaitSemaphores.end());
+        m_uploadWaitSemaphores.clear();
+
+        const Time submitTime = Time::GetSystemTime();
+        m_frameProfiler.AddSample(FrameProfiler::Domain::Cpu, "Submit", submitTime - endTime);
+
+        if (m_offscreen)
+        {
+            m_readbackAvailable = true;
+            m_readbackImageIndex = m_currentImageIndex;
+            m_readbackExtent = m_swapChainExtent;
+            m_currentFrame = (m_currentFrame + 1) % m_maxFramesInFlight;
+            m_beginDraw = false;
+
+            m_frameProfiler.AddSample(FrameProfiler::Domain::Cpu, "Frame", submitTime - m_frameBeginTime);
+            m_frameProfiler.EndFrame();
+            m_frameBeginTime = Time::Zero;
+            m_frameInputTime = Time::Zero;
+            return;
+        }
+
         VkPresentInfoKHR presentInfo = {};
         presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
         presentInfo.waitSemaphoreCount = 1;
@@ -1066,60 +1919,525 @@ namespace Molten
         presentInfo.pSwapchains = swapChains;
         presentInfo.pImageIndices = &m_currentImageIndex;
 
-        vkQueuePresentKHR(m_presentQueue, &presentInfo);
+        const VkResult presentResult = vkQueuePresentKHR(m_presentQueue, &presentInfo);
 
         m_currentFrame = (m_currentFrame + 1) % m_maxFramesInFlight;
         m_beginDraw = false;
+
+        const Time presentTime = Time::GetSystemTime();
+
+        // Out of date swap chains are recreated by the next BeginDraw, without waiting for the requested size to settle.
+        // Suboptimal swap chains are recreated once the requested size has settled, as when acquiring.
+        MOLTEN_UNSCOPED_ENUM_BEGIN
+        if (presentResult == VK_ERROR_OUT_OF_DATE_KHR)
+        {
+            m_resized = true;
+            m_resizeTime = Time::Zero;
+        }
+        else if (presentResult == VK_SUBOPTIMAL_KHR)
+        {
+            if (!m_resized)
+            {
+                m_resized = true;
+                m_resizeTime = presentTime;
+            }
+        }
+        else if (presentResult != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to present swap chain image.");
+        }
+        MOLTEN_UNSCOPED_ENUM_END
+
+        m_frameProfiler.AddSample(FrameProfiler::Domain::Cpu, "Present", presentTime - submitTime);
+        if (m_frameInputTime != Time::Zero)
+        {
+            m_frameProfiler.AddSample(FrameProfiler::Domain::Cpu, "InputToPresent", presentTime - m_frameInputTime);
+            m_frameInputTime = Time::Zero;
+        }
+        m_frameProfiler.AddSample(FrameProfiler::Domain::Cpu, "Frame", presentTime - m_frameBeginTime);
+        m_frameProfiler.EndFrame();
+        m_frameBeginTime = Time::Zero;
     }
 
     void VulkanRenderer::WaitForDevice()
     {
+        FlushUploads();
         vkDeviceWaitIdle(m_logicalDevice);
+        RetireUploadBatches(false);
     }
 
-    void VulkanRenderer::UpdateUniformBuffer(UniformBuffer* uniformBuffer, const size_t offset, const size_t size, const void* data)
+    bool VulkanRenderer::ReadRenderTarget(std::vector<uint8_t>& pixels)
     {
-        VulkanUniformBuffer* vulkanUniformBuffer = static_cast<VulkanUniformBuffer*>(uniformBuffer);
+        if (!m_offscreen)
+        {
+            Logger::WriteError(m_logger, "Reading render target is only supported by offscreen renderers.");
+            return false;
+        }
+        if (m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot read render target while drawing.");
+            return false;
+        }
+        if (!m_readbackAvailable)
+        {
+            Logger::WriteError(m_logger, "Cannot read render target before any frame is rendered.");
+            return false;
+        }
 
-        auto& frame = vulkanUniformBuffer->frames[m_currentImageIndex];
+        const VkDeviceSize dataSize = static_cast<VkDeviceSize>(m_readbackExtent.width) * static_cast<VkDeviceSize>(m_readbackExtent.height) * 4;
 
-        void* dataMap;
-        vkMapMemory(m_logicalDevice, frame.memory, offset, size, 0, &dataMap);
-        memcpy(dataMap, data, size);
-        vkUnmapMemory(m_logicalDevice, frame.memory);
-    }
+        VkBuffer readbackBuffer;
+        VulkanMemory readbackMemory;
+        if (!CreateBuffer(dataSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, readbackBuffer, readbackMemory))
+        {
+            return false;
+        }
 
+        SmartFunction bufferDestroyer = [&]()
+        {
+            DestroyBuffer(readbackBuffer, readbackMemory);
+        };
 
-    // DebugMessenger implementations.
-    VulkanRenderer::DebugMessenger::DebugMessenger() :
-        messenger(VK_NULL_HANDLE),
-        CreateDebugUtilsMessengerEXT(nullptr),
-        DestroyDebugUtilsMessengerEXT(nullptr)
-    { }
+        VkCommandBufferAllocateInfo commandBufferInfo = {};
+        commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        commandBufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        commandBufferInfo.commandPool = m_commandPool;
+        commandBufferInfo.commandBufferCount = 1;
 
-    void VulkanRenderer::DebugMessenger::Clear()
-    {
-        messenger = VK_NULL_HANDLE;
-        CreateDebugUtilsMessengerEXT = nullptr;
-        DestroyDebugUtilsMessengerEXT = nullptr;      
-    }
+        VkCommandBuffer commandBuffer;
+        if (vkAllocateCommandBuffers(m_logicalDevice, &commandBufferInfo, &commandBuffer) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to allocate readback command buffer.");
+            return false;
+        }
 
-    VulkanRenderer::PhysicalDevice::PhysicalDevice() :
-        device(VK_NULL_HANDLE),
-        graphicsQueueIndex(0),
-        presentQueueIndex(0)
-    { }
+        SmartFunction commandBufferDestroyer = [&]()
+        {
+            vkFreeCommandBuffers(m_logicalDevice, m_commandPool, 1, &commandBuffer);
+        };
 
-    VulkanRenderer::PhysicalDevice::PhysicalDevice(VkPhysicalDevice device) :
-        device(device),
-        graphicsQueueIndex(0),
-        presentQueueIndex(0)
-    { }
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(commandBuffer, &beginInfo);
 
-    VulkanRenderer::PhysicalDevice::PhysicalDevice(VkPhysicalDevice device, uint32_t graphicsQueueIndex, uint32_t presentQueueIndex) :
-        device(device),
+        // Render pass leaves offscreen images in transfer source layout, only wait for color writes.
+        VkImageMemoryBarrier imageBarrier = {};
+        imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        imageBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        imageBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        imageBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.image = m_swapChainImages[m_readbackImageIndex];
+        imageBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        imageBarrier.subresourceRange.baseMipLevel = 0;
+        imageBarrier.subresourceRange.levelCount = 1;
+        imageBarrier.subresourceRange.baseArrayLayer = 0;
+        imageBarrier.subresourceRange.layerCount = 1;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+            0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+
+        VkBufferImageCopy region = {};
+        region.bufferOffset = 0;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = 0;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = { 0, 0, 0 };
+        region.imageExtent = { m_readbackExtent.width, m_readbackExtent.height, 1 };
+        vkCmdCopyImageToBuffer(commandBuffer, m_swapChainImages[m_readbackImageIndex], VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, readbackBuffer, 1, &region);
+
+        VkBufferMemoryBarrier bufferBarrier = {};
+        bufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        bufferBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        bufferBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferBarrier.buffer = readbackBuffer;
+        bufferBarrier.offset = 0;
+        bufferBarrier.size = VK_WHOLE_SIZE;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+            0, 0, nullptr, 1, &bufferBarrier, 0, nullptr);
+
+        vkEndCommandBuffer(commandBuffer);
+
+        VkFenceCreateInfo fenceInfo = {};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        VkFence fence;
+        if (vkCreateFence(m_logicalDevice, &fenceInfo, nullptr, &fence) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to create readback fence.");
+            return false;
+        }
+
+        SmartFunction fenceDestroyer = [&]()
+        {
+            vkDestroyFence(m_logicalDevice, fence, nullptr);
+        };
+
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+
+        if (vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, fence) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to submit readback command buffer.");
+            return false;
+        }
+        vkWaitForFences(m_logicalDevice, 1, &fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+        pixels.resize(static_cast<size_t>(dataSize));
+        memcpy(pixels.data(), readbackMemory.mappedData, static_cast<size_t>(dataSize));
+        return true;
+    }
+
+    void VulkanRenderer::CullIndirectBuffer(IndirectBuffer* indirectBuffer, const Frustum& frustum)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot cull indirect buffer without any previous call to BeginDraw.");
+            return;
+        }
+
+        VulkanIndirectBuffer* vulkanIndirectBuffer = static_cast<VulkanIndirectBuffer*>(indirectBuffer);
+
+        if (vulkanIndirectBuffer->sourceBuffer.buffer == VK_NULL_HANDLE && vulkanIndirectBuffer->bounds.empty())
+        {
+            Logger::WriteError(m_logger, "Cannot cull indirect buffer created without commands and bounding volumes.");
+            return;
+        }
+
+        auto& frame = vulkanIndirectBuffer->frames[m_currentFrame];
+
+        if (vulkanIndirectBuffer->sourceBuffer.buffer == VK_NULL_HANDLE)
+        {
+            auto* data = static_cast<uint8_t*>(frame.memory.mappedData);
+            const uint32_t visibleCount = FrustumCuller::Cull(frustum, vulkanIndirectBuffer->bounds.data(), vulkanIndirectBuffer->sourceCommands.data(),
+                vulkanIndirectBuffer->commandCount, reinterpret_cast<DrawIndexedIndirectCommand*>(data));
+            memcpy(data + vulkanIndirectBuffer->countOffset, &visibleCount, sizeof(uint32_t));
+            return;
+        }
+
+        // Dispatches are not allowed within the render pass, culling is recorded to the compute command buffer submitted ahead of it.
+        const VkCommandBuffer commandBuffer = GetComputeCommandBuffer();
+        if (commandBuffer == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+        if (!m_descriptorArenas[m_currentImageIndex]->Allocate(m_cullSetLayout, m_cullDescriptorCounts, descriptorSet))
+        {
+            return;
+        }
+
+        const VkDeviceSize frameSize = vulkanIndirectBuffer->countOffset + sizeof(uint32_t);
+        const VkDescriptorBufferInfo bufferInfos[] = {
+            { vulkanIndirectBuffer->sourceBuffer.buffer, 0, vulkanIndirectBuffer->countOffset },
+            { vulkanIndirectBuffer->boundsBuffer.buffer, 0, static_cast<VkDeviceSize>(vulkanIndirectBuffer->commandCount) * sizeof(BoundingVolume) },
+            { frame.buffer, 0, frameSize }
+        };
+
+        VkWriteDescriptorSet descWrites[3] = {};
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            descWrites[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descWrites[i].dstSet = descriptorSet;
+            descWrites[i].dstBinding = i;
+            descWrites[i].dstArrayElement = 0;
+            descWrites[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            descWrites[i].descriptorCount = 1;
+            descWrites[i].pBufferInfo = &bufferInfos[i];
+        }
+        vkUpdateDescriptorSets(m_logicalDevice, 3, descWrites, 0, nullptr);
+
+        // The output may be culled more than once per frame, previous dispatches are finished before clearing it.
+        VkMemoryBarrier memoryBarrier = {};
+        memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+            1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+        vkCmdFillBuffer(commandBuffer, frame.buffer, 0, frameSize, 0);
+
+        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+            1, &memoryBarrier, 0, nullptr, 0, nullptr);
+
+        CullPushConstants pushConstants = {};
+        const auto& planes = frustum.GetPlanes();
+        std::copy(planes.begin(), planes.end(), pushConstants.planes);
+        pushConstants.commandCount = vulkanIndirectBuffer->commandCount;
+
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_cullPipeline);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_cullPipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+        vkCmdPushConstants(commandBuffer, m_cullPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(CullPushConstants), &pushConstants);
+        vkCmdDispatch(commandBuffer, (vulkanIndirectBuffer->commandCount + 63) / 64, 1, 1);
+    }
+
+    void VulkanRenderer::UpdateIndirectBuffer(IndirectBuffer* indirectBuffer, const uint32_t firstCommand, const uint32_t commandCount, const DrawIndexedIndirectCommand* commands)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot update indirect buffer without any previous call to BeginDraw.");
+            return;
+        }
+
+        VulkanIndirectBuffer* vulkanIndirectBuffer = static_cast<VulkanIndirectBuffer*>(indirectBuffer);
+
+        if (vulkanIndirectBuffer->sourceBuffer.buffer != VK_NULL_HANDLE || !vulkanIndirectBuffer->bounds.empty())
+        {
+            Logger::WriteError(m_logger, "Cannot update indirect buffer created with bounding volumes, commands are written by culling.");
+            return;
+        }
+        if (static_cast<uint64_t>(firstCommand) + commandCount > vulkanIndirectBuffer->commandCount)
+        {
+            Logger::WriteError(m_logger, "Trying to update indirect buffer out of bounds.");
+            return;
+        }
+
+        auto& frame = vulkanIndirectBuffer->frames[m_currentFrame];
+        memcpy(static_cast<DrawIndexedIndirectCommand*>(frame.memory.mappedData) + firstCommand, commands, commandCount * sizeof(DrawIndexedIndirectCommand));
+    }
+
+    void VulkanRenderer::UpdateIndirectBufferDrawCount(IndirectBuffer* indirectBuffer, const uint32_t drawCount)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot update indirect buffer without any previous call to BeginDraw.");
+            return;
+        }
+
+        VulkanIndirectBuffer* vulkanIndirectBuffer = static_cast<VulkanIndirectBuffer*>(indirectBuffer);
+
+        if (vulkanIndirectBuffer->sourceBuffer.buffer != VK_NULL_HANDLE || !vulkanIndirectBuffer->bounds.empty())
+        {
+            Logger::WriteError(m_logger, "Cannot update indirect buffer created with bounding volumes, commands are written by culling.");
+            return;
+        }
+        if (drawCount > vulkanIndirectBuffer->commandCount)
+        {
+            Logger::WriteError(m_logger, "Trying to set draw count greater than number of commands in indirect buffer.");
+            return;
+        }
+
+        auto& frame = vulkanIndirectBuffer->frames[m_currentFrame];
+        memcpy(static_cast<uint8_t*>(frame.memory.mappedData) + vulkanIndirectBuffer->countOffset, &drawCount, sizeof(uint32_t));
+    }
+
+    void VulkanRenderer::UpdateUniformBuffer(UniformBuffer* uniformBuffer, const size_t offset, const size_t size, const void* data)
+    {
+        VulkanUniformBuffer* vulkanUniformBuffer = static_cast<VulkanUniformBuffer*>(uniformBuffer);
+
+        if (offset + size > vulkanUniformBuffer->size)
+        {
+            Logger::WriteError(m_logger, "Trying to update uniform buffer out of bounds.");
+            return;
+        }
+
+        auto& frame = vulkanUniformBuffer->frames[m_currentFrame];
+        memcpy(static_cast<uint8_t*>(frame.memory.mappedData) + offset, data, size);
+    }
+
+    bool VulkanRenderer::AllocateUniformBufferData(UniformBuffer* uniformBuffer, const size_t size, const void* data, uint32_t& offset)
+    {
+        VulkanUniformBuffer* vulkanUniformBuffer = static_cast<VulkanUniformBuffer*>(uniformBuffer);
+        auto& frame = vulkanUniformBuffer->frames[m_currentFrame];
+
+        // The previous frame of this frame in flight slot is no longer in use by the device, reset allocations of previous draws.
+        if (frame.allocationFrame != m_frameCount)
+        {
+            frame.allocationFrame = m_frameCount;
+            frame.allocationOffset = 0;
+        }
+
+        const size_t alignment = std::max(static_cast<size_t>(m_physicalDevice.properties.limits.minUniformBufferOffsetAlignment), size_t(1));
+        const size_t alignedOffset = ((frame.allocationOffset + alignment - 1) / alignment) * alignment;
+        if (alignedOffset + size > vulkanUniformBuffer->size)
+        {
+            Logger::WriteError(m_logger, "Uniform buffer is out of memory for the current frame.");
+            return false;
+        }
+
+        memcpy(static_cast<uint8_t*>(frame.memory.mappedData) + alignedOffset, data, size);
+        frame.allocationOffset = alignedOffset + size;
+        offset = static_cast<uint32_t>(alignedOffset);
+        return true;
+    }
+
+    void* VulkanRenderer::MapIndexBufferForWrite(IndexBuffer* indexBuffer, const uint32_t indexCount)
+    {
+        VulkanIndexBuffer* vulkanIndexBuffer = static_cast<VulkanIndexBuffer*>(indexBuffer);
+        if (vulkanIndexBuffer->frames.empty())
+        {
+            Logger::WriteError(m_logger, "Cannot map static index buffer for write.");
+            return nullptr;
+        }
+        if (!CheckDynamicBufferWrite(indexCount, vulkanIndexBuffer->capacity))
+        {
+            return nullptr;
+        }
+
+        vulkanIndexBuffer->indexCount = indexCount;
+        return vulkanIndexBuffer->frames[m_currentFrame].memory.mappedData;
+    }
+
+    void* VulkanRenderer::MapVertexBufferForWrite(VertexBuffer* vertexBuffer, const uint32_t vertexCount)
+    {
+        VulkanVertexBuffer* vulkanVertexBuffer = static_cast<VulkanVertexBuffer*>(vertexBuffer);
+        if (vulkanVertexBuffer->frames.empty())
+        {
+            Logger::WriteError(m_logger, "Cannot map static vertex buffer for write.");
+            return nullptr;
+        }
+        if (!CheckDynamicBufferWrite(vertexCount, vulkanVertexBuffer->capacity))
+        {
+            return nullptr;
+        }
+
+        vulkanVertexBuffer->vertexCount = vertexCount;
+        return vulkanVertexBuffer->frames[m_currentFrame].memory.mappedData;
+    }
+
+    bool VulkanRenderer::UpdateIndexBuffer(IndexBuffer* indexBuffer, const uint32_t indexCount, const void* data)
+    {
+        auto* frameData = MapIndexBufferForWrite(indexBuffer, indexCount);
+        if (!frameData)
+        {
+            return false;
+        }
+
+        const auto dataType = static_cast<VulkanIndexBuffer*>(indexBuffer)->dataType;
+        memcpy(frameData, data, static_cast<size_t>(indexCount * GetIndexBufferDataTypeSize(dataType)));
+        return true;
+    }
+
+    bool VulkanRenderer::UpdateVertexBuffer(VertexBuffer* vertexBuffer, const uint32_t vertexCount, const void* data)
+    {
+        auto* frameData = MapVertexBufferForWrite(vertexBuffer, vertexCount);
+        if (!frameData)
+        {
+            return false;
+        }
+
+        memcpy(frameData, data, static_cast<size_t>(vertexCount) * static_cast<VulkanVertexBuffer*>(vertexBuffer)->vertexSize);
+        return true;
+    }
+
+    void VulkanRenderer::SetTextureStreamingBudget(const size_t memoryBudget, const size_t frameUploadBudget)
+    {
+        m_textureStreamer.SetMemoryBudget(memoryBudget);
+        m_textureStreamer.SetFrameUploadBudget(frameUploadBudget);
+    }
+
+    void VulkanRenderer::BeginGpuMarker(const std::string& name)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot begin GPU marker without any previous call to BeginDraw.");
+            return;
+        }
+
+        // Markers exceeding the query pool are not timed, but still pushed to match the calls to EndGpuMarker.
+        auto& timestampFrame = m_timestampFrames[m_currentImageIndex];
+        if (!m_timestampSupport || timestampFrame.queryCount + 2 > m_maxTimestampQueries)
+        {
+            m_gpuMarkerStack.push_back(std::numeric_limits<size_t>::max());
+            return;
+        }
+
+        auto* commandBuffer = GetInlineCommandBuffer();
+        if (!commandBuffer)
+        {
+            m_gpuMarkerStack.push_back(std::numeric_limits<size_t>::max());
+            return;
+        }
+
+        const uint32_t beginQuery = timestampFrame.queryCount;
+        timestampFrame.queryCount += 2;
+        timestampFrame.markers.push_back({ name, beginQuery, beginQuery + 1 });
+        m_gpuMarkerStack.push_back(timestampFrame.markers.size() - 1);
+
+        vkCmdWriteTimestamp(commandBuffer->currentCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestampFrame.queryPool, beginQuery);
+    }
+
+    void VulkanRenderer::EndGpuMarker()
+    {
+        if (m_gpuMarkerStack.empty())
+        {
+            Logger::WriteError(m_logger, "Calling EndGpuMarker, without any previous call to BeginGpuMarker.");
+            return;
+        }
+
+        const size_t markerIndex = m_gpuMarkerStack.back();
+        m_gpuMarkerStack.pop_back();
+        if (markerIndex == std::numeric_limits<size_t>::max())
+        {
+            return;
+        }
+
+        auto* commandBuffer = GetInlineCommandBuffer();
+        if (!commandBuffer)
+        {
+            return;
+        }
+
+        auto& timestampFrame = m_timestampFrames[m_currentImageIndex];
+        vkCmdWriteTimestamp(commandBuffer->currentCommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestampFrame.queryPool, 
+            timestampFrame.markers[markerIndex].endQuery);
+    }
+
+
+    // DebugMessenger implementations.
+    VulkanRenderer::DebugMessenger::DebugMessenger() :
+        messenger(VK_NULL_HANDLE),
+        CreateDebugUtilsMessengerEXT(nullptr),
+        DestroyDebugUtilsMessengerEXT(nullptr)
+    { }
+
+    void VulkanRenderer::DebugMessenger::Clear()
+    {
+        messenger = VK_NULL_HANDLE;
+        CreateDebugUtilsMessengerEXT = nullptr;
+        DestroyDebugUtilsMessengerEXT = nullptr;      
+    }
+
+    VulkanRenderer::PhysicalDevice::PhysicalDevice() :
+        device(VK_NULL_HANDLE),
+        graphicsQueueIndex(0),
+        presentQueueIndex(0),
+        transferQueueIndex(0),
+        properties{},
+        features{},
+        drawIndirectCountSupport(false)
+    { }
+
+    VulkanRenderer::PhysicalDevice::PhysicalDevice(VkPhysicalDevice device) :
+        device(device),
+        graphicsQueueIndex(0),
+        presentQueueIndex(0),
+        transferQueueIndex(0),
+        properties{},
+        features{},
+        drawIndirectCountSupport(false)
+    { }
+
+    VulkanRenderer::PhysicalDevice::PhysicalDevice(VkPhysicalDevice device, uint32_t graphicsQueueIndex, uint32_t presentQueueIndex) :
+        device(device),
         graphicsQueueIndex(graphicsQueueIndex),
-        presentQueueIndex(presentQueueIndex)
+        presentQueueIndex(presentQueueIndex),
+        transferQueueIndex(graphicsQueueIndex),
+        properties{},
+        features{},
+        drawIndirectCountSupport(false)
     { }
 
     void VulkanRenderer::PhysicalDevice::Clear()
@@ -1127,6 +2445,10 @@ namespace Molten
         device = VK_NULL_HANDLE;
         graphicsQueueIndex = 0;
         presentQueueIndex = 0;
+        transferQueueIndex = 0;
+        properties = {};
+        features = {};
+        drawIndirectCountSupport = false;
     }
 
     PFN_vkVoidFunction VulkanRenderer::GetVulkanFunction(const char* functionName) const
@@ -1240,16 +2562,19 @@ namespace Molten
         */
         
         out.clear();
-        out.push_back("VK_KHR_surface");
         if (requestDebugger)
         {
             out.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
         }
-        #if MOLTEN_PLATFORM == MOLTEN_PLATFORM_WINDOWS
-            out.push_back("VK_KHR_win32_surface");
-        #elif MOLTEN_PLATFORM == MOLTEN_PLATFORM_LINUX
-            out.push_back("VK_KHR_xlib_surface");
-        #endif
+        if (!m_offscreen)
+        {
+            out.push_back("VK_KHR_surface");
+            #if MOLTEN_PLATFORM == MOLTEN_PLATFORM_WINDOWS
+                out.push_back("VK_KHR_win32_surface");
+            #elif MOLTEN_PLATFORM == MOLTEN_PLATFORM_LINUX
+                out.push_back("VK_KHR_xlib_surface");
+            #endif
+        }
 
         std::set<std::string> missingExtensions(out.begin(), out.end());
         for (const auto& extension : extensions)
@@ -1369,7 +2694,10 @@ namespace Molten
         std::vector<VkPhysicalDevice> devices(deviceCount);
         vkEnumeratePhysicalDevices(m_instance, &deviceCount, devices.data());
 
-        m_deviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+        if (!m_offscreen)
+        {
+            m_deviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+        }
 
         std::multimap<uint32_t, PhysicalDevice> scoredDevices;
         for (auto& device : devices)
@@ -1402,11 +2730,13 @@ namespace Molten
         VkPhysicalDeviceFeatures deviceFeatures;
         vkGetPhysicalDeviceProperties(device, &deviceProps);
         vkGetPhysicalDeviceFeatures(device, &deviceFeatures);
+        physicalDevice.properties = deviceProps;
+        physicalDevice.features = deviceFeatures;
 
         if (!deviceFeatures.fillModeNonSolid ||
             !deviceFeatures.geometryShader ||
             !CheckDeviceExtensionSupport(physicalDevice) ||
-            !FetchSwapChainSupport(physicalDevice))
+            (!m_offscreen && !FetchSwapChainSupport(physicalDevice)))
         {
             return false;
         }
@@ -1433,8 +2763,16 @@ namespace Molten
                 graphicsQueueIndex = queueIndex;
             }
 
+            // Offscreen renderers never present, use the graphics family.
             VkBool32 presentSupport = false;
-            vkGetPhysicalDeviceSurfaceSupportKHR(device, queueIndex, m_surface, &presentSupport);
+            if (m_offscreen)
+            {
+                presentSupport = (queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT) ? VK_TRUE : VK_FALSE;
+            }
+            else
+            {
+                vkGetPhysicalDeviceSurfaceSupportKHR(device, queueIndex, m_surface, &presentSupport);
+            }
             if (presentSupport)
             {
                 presentFamilySupport = true;
@@ -1453,6 +2791,20 @@ namespace Molten
             return false;
         }
 
+        // Prefer a dedicated transfer family for uploads, usually backed by a DMA engine.
+        uint32_t transferQueueIndex = graphicsQueueIndex;
+        for (uint32_t i = 0; i < queueFamilyCount; i++)
+        {
+            const auto queueFlags = queueFamilies[i].queueFlags;
+            if ((queueFlags & VK_QUEUE_TRANSFER_BIT) &&
+                !(queueFlags & VK_QUEUE_GRAPHICS_BIT) &&
+                !(queueFlags & VK_QUEUE_COMPUTE_BIT))
+            {
+                transferQueueIndex = i;
+                break;
+            }
+        }
+
         
         if (deviceProps.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU)
         {
@@ -1471,23 +2823,24 @@ namespace Molten
 
         physicalDevice.graphicsQueueIndex = graphicsQueueIndex;
         physicalDevice.presentQueueIndex = presentQueueIndex;
+        physicalDevice.transferQueueIndex = transferQueueIndex;
         return true;
     }
 
     bool VulkanRenderer::CheckDeviceExtensionSupport(PhysicalDevice& physicalDevice)
     {
-        if (!m_deviceExtensions.size())
-        {
-            return true;
-        }
-
         VkPhysicalDevice device = physicalDevice.device;
 
-        uint32_t extensionCount;
+        uint32_t extensionCount = 0;
         vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, nullptr);
         
         if (!extensionCount)
         {
+            if (!m_deviceExtensions.size())
+            {
+                return true;
+            }
+
             Logger::WriteError(m_logger, "Failed to find any device extensions.");
             return false;
         }
@@ -1499,6 +2852,12 @@ namespace Molten
         for (auto& extension : availableExtensions)
         {
             missingExtensions.erase(extension.extensionName);
+
+            // Optional extensions, enabled by LoadLogicalDevice if available.
+            if (std::string(extension.extensionName) == VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME)
+            {
+                physicalDevice.drawIndirectCountSupport = true;
+            }
         }
   
         return missingExtensions.size() == 0;
@@ -1538,7 +2897,7 @@ namespace Molten
     {
         std::vector<VkDeviceQueueCreateInfo> queueInfos;
 
-        std::set<uint32_t> uniqueFamilies = { m_physicalDevice.graphicsQueueIndex, m_physicalDevice.presentQueueIndex };
+        std::set<uint32_t> uniqueFamilies = { m_physicalDevice.graphicsQueueIndex, m_physicalDevice.presentQueueIndex, m_physicalDevice.transferQueueIndex };
         float queuePriority = 1.0f;
 
         for (auto family : uniqueFamilies)
@@ -1553,6 +2912,13 @@ namespace Molten
 
         VkPhysicalDeviceFeatures deviceFeatures = {};
         deviceFeatures.fillModeNonSolid = VK_TRUE;
+        deviceFeatures.multiDrawIndirect = m_physicalDevice.features.multiDrawIndirect;
+        deviceFeatures.samplerAnisotropy = m_physicalDevice.features.samplerAnisotropy;
+
+        if (m_physicalDevice.drawIndirectCountSupport)
+        {
+            m_deviceExtensions.push_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+        }
 
         VkDeviceCreateInfo deviceInfo = {};
         deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -1577,6 +2943,17 @@ namespace Molten
 
         vkGetDeviceQueue(m_logicalDevice, m_physicalDevice.graphicsQueueIndex, 0, &m_graphicsQueue);
         vkGetDeviceQueue(m_logicalDevice, m_physicalDevice.presentQueueIndex, 0, &m_presentQueue);
+        vkGetDeviceQueue(m_logicalDevice, m_physicalDevice.transferQueueIndex, 0, &m_transferQueue);
+
+        if (m_physicalDevice.drawIndirectCountSupport)
+        {
+            m_cmdDrawIndexedIndirectCount = reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCountKHR>(
+                vkGetDeviceProcAddr(m_logicalDevice, "vkCmdDrawIndexedIndirectCountKHR"));
+        }
+
+        // All graphics and compute queues support timestamps if timestampComputeAndGraphics is set.
+        const auto& limits = m_physicalDevice.properties.limits;
+        m_timestampSupport = limits.timestampComputeAndGraphics == VK_TRUE && limits.timestampPeriod > 0.0f;
         return true;
     }
 
@@ -1601,47 +2978,77 @@ namespace Molten
             return false;
         }
 
+        // Fifo is the only present mode required to be supported.
+        const auto& presentModes = m_physicalDevice.swapChainSupport.presentModes;
+        auto isPresentModeSupported = [&](const VkPresentModeKHR mode)
+        {
+            return std::find(presentModes.begin(), presentModes.end(), mode) != presentModes.end();
+        };
+
         MOLTEN_UNSCOPED_ENUM_BEGIN
         VkPresentModeKHR presentMode = VkPresentModeKHR::VK_PRESENT_MODE_FIFO_KHR;
-        MOLTEN_UNSCOPED_ENUM_END
-        for (auto& mode : m_physicalDevice.swapChainSupport.presentModes)
+        m_presentMode = PresentMode::Fifo;
+        if (m_requestedPresentMode == PresentMode::Immediate && isPresentModeSupported(VkPresentModeKHR::VK_PRESENT_MODE_IMMEDIATE_KHR))
         {
-            if (mode == VkPresentModeKHR::VK_PRESENT_MODE_MAILBOX_KHR)
-            {  
-                presentMode = mode;
-                break;
-            }
+            presentMode = VkPresentModeKHR::VK_PRESENT_MODE_IMMEDIATE_KHR;
+            m_presentMode = PresentMode::Immediate;
+        }
+        else if (m_requestedPresentMode != PresentMode::Fifo && isPresentModeSupported(VkPresentModeKHR::VK_PRESENT_MODE_MAILBOX_KHR))
+        {
+            presentMode = VkPresentModeKHR::VK_PRESENT_MODE_MAILBOX_KHR;
+            m_presentMode = PresentMode::Mailbox;
         }
+        MOLTEN_UNSCOPED_ENUM_END
 
         vkGetPhysicalDeviceSurfaceCapabilitiesKHR(m_physicalDevice.device, m_surface, &m_physicalDevice.swapChainSupport.capabilities);
         VkSurfaceCapabilitiesKHR& capabilities = m_physicalDevice.swapChainSupport.capabilities;
         
         if (capabilities.currentExtent.width != std::numeric_limits<uint32_t>::max())
         {
-            auto windowSize = m_renderTarget->GetSize();
             capabilities.currentExtent = {
-                std::max(capabilities.currentExtent.width, std::min(windowSize.x, capabilities.maxImageExtent.width)),
-                std::max(capabilities.currentExtent.height, std::min(windowSize.y, capabilities.maxImageExtent.height))
+                std::max(capabilities.currentExtent.width, std::min(m_requestedExtent.width, capabilities.maxImageExtent.width)),
+                std::max(capabilities.currentExtent.height, std::min(m_requestedExtent.height, capabilities.maxImageExtent.height))
             };
         }
         m_swapChainExtent = capabilities.currentExtent;
 
-        const uint32_t imageCount = std::min(capabilities.minImageCount + 1, capabilities.maxImageCount);
+        // One image more than the frames in flight, so acquiring an image never waits for the presentation engine.
+        // A maximum image count of 0 means there is no limit.
+        const size_t requestedFramesInFlight = std::min(m_requestedMaxFramesInFlight, MaxFramesInFlight);
+        uint32_t imageCount = std::max(capabilities.minImageCount + 1, static_cast<uint32_t>(requestedFramesInFlight) + 1);
+        if (capabilities.maxImageCount > 0)
+        {
+            imageCount = std::min(imageCount, capabilities.maxImageCount);
+        }
 
+        // The current swap chain is handed over to the new one, which retires it even if the creation fails.
+        // It is destroyed when no frame in flight uses it.
+        const VkSwapchainKHR oldSwapChain = m_swapChain;
         m_swapChain = Vulkan::CreateSwapchain(
             m_physicalDevice.device, m_logicalDevice, m_surface, surfaceFormat,
-            presentMode, capabilities, imageCount, m_physicalDevice.graphicsQueueIndex, m_physicalDevice.presentQueueIndex, m_swapChain);
+            presentMode, capabilities, imageCount, m_physicalDevice.graphicsQueueIndex, m_physicalDevice.presentQueueIndex, oldSwapChain);
 
-        if(m_swapChain == VK_NULL_HANDLE)
+        if (oldSwapChain != VK_NULL_HANDLE)
         {
-            Logger::WriteError(m_logger, "Failed create swap chain.");
+            RetiredSwapchain retiredSwapchain = {};
+            retiredSwapchain.swapChain = oldSwapChain;
+            retiredSwapchain.frame = m_frameCount;
+            m_retiredSwapchains.push_back(std::move(retiredSwapchain));
+        }
+
+        if(m_swapChain == VK_NULL_HANDLE)
+        {
+            Logger::WriteError(m_logger, "Failed create swap chain.");
             return false;
         }
 
+        // The implementation may create more images than requested.
         Vulkan::GetSwapchainImages(m_logicalDevice, m_swapChain, m_swapChainImages);
-        if(m_swapChainImages.size() != imageCount)
+        if(m_swapChainImages.size() < imageCount)
         {
             vkDestroySwapchainKHR(m_logicalDevice, m_swapChain, nullptr);
+            m_swapChain = VK_NULL_HANDLE;
+            m_swapChainImages.clear();
             Logger::WriteError(m_logger, "Failed to create the requested number of swap chain images.");
             return false;
         }
@@ -1649,6 +3056,79 @@ namespace Molten
         return true;
     }
 
+    bool VulkanRenderer::LoadOffscreenImages()
+    {
+        // Like swap chains, one image more than the requested frames in flight.
+        const size_t imageCount = std::max(std::min(m_requestedMaxFramesInFlight, MaxFramesInFlight) + 1, size_t(3));
+        m_swapChainImageFormat = VK_FORMAT_R8G8B8A8_UNORM;
+        m_swapChainImages.resize(imageCount, VK_NULL_HANDLE);
+        m_offscreenImageMemory.resize(imageCount);
+
+        const VkDeviceSize granularity = std::max(m_physicalDevice.properties.limits.bufferImageGranularity, VkDeviceSize(1));
+
+        for (size_t i = 0; i < imageCount; i++)
+        {
+            VkImageCreateInfo imageInfo = {};
+            imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+            imageInfo.imageType = VK_IMAGE_TYPE_2D;
+            imageInfo.extent = { m_swapChainExtent.width, m_swapChainExtent.height, 1 };
+            imageInfo.mipLevels = 1;
+            imageInfo.arrayLayers = 1;
+            imageInfo.format = m_swapChainImageFormat;
+            imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+            imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+            imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+            imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+            if (vkCreateImage(m_logicalDevice, &imageInfo, nullptr, &m_swapChainImages[i]) != VK_SUCCESS)
+            {
+                Logger::WriteError(m_logger, "Failed to create offscreen image.");
+                return false;
+            }
+
+            // Optimal tiled images share memory blocks with linear buffers, keep them on separate pages.
+            VkMemoryRequirements memoryReq;
+            vkGetImageMemoryRequirements(m_logicalDevice, m_swapChainImages[i], &memoryReq);
+            memoryReq.alignment = std::max(memoryReq.alignment, granularity);
+            memoryReq.size = ((memoryReq.size + granularity - 1) / granularity) * granularity;
+
+            auto& memory = m_offscreenImageMemory[i];
+            if (!m_memoryAllocator.Allocate(memoryReq, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, memory))
+            {
+                Logger::WriteError(m_logger, "Failed to allocate offscreen image memory.");
+                return false;
+            }
+
+            if (vkBindImageMemory(m_logicalDevice, m_swapChainImages[i], memory.memory, memory.offset) != VK_SUCCESS)
+            {
+                Logger::WriteError(m_logger, "Failed to bind memory to offscreen image.");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void VulkanRenderer::UnloadOffscreenImages()
+    {
+        for (size_t i = 0; i < m_swapChainImages.size(); i++)
+        {
+            if (m_swapChainImages[i] != VK_NULL_HANDLE)
+            {
+                vkDestroyImage(m_logicalDevice, m_swapChainImages[i], nullptr);
+            }
+            if (i < m_offscreenImageMemory.size())
+            {
+                m_memoryAllocator.Free(m_offscreenImageMemory[i]);
+            }
+        }
+
+        m_swapChainImages.clear();
+        m_offscreenImageMemory.clear();
+        m_readbackAvailable = false;
+    }
+
     bool VulkanRenderer::LoadImageViews()
     {
         m_swapChainImageViews.resize(m_swapChainImages.size(), VK_NULL_HANDLE);
@@ -1689,8 +3169,9 @@ namespace Molten
         colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
         colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
         colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-        colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        colorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        // Layout transitions of the attachment are recorded as barriers of the frame graph.
+        colorAttachment.initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        colorAttachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 
         VkAttachmentReference colorAttachmentReference = {};
         colorAttachmentReference.attachment = 0;
@@ -1724,6 +3205,14 @@ namespace Molten
             return false;
         }
 
+        // Only load operations differ, pipelines and command buffers of the render pass are compatible with it.
+        colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+        if (vkCreateRenderPass(m_logicalDevice, &renderPassInfo, nullptr, &m_loadRenderPass) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to create load render pass.");
+            return false;
+        }
+
         return true;
     }
 
@@ -1742,11 +3231,382 @@ namespace Molten
             return false;
         }
 
-        m_maxFramesInFlight = m_presentFramebuffers.size() - 1;
+        const size_t imageCount = m_presentFramebuffers.size();
+        m_maxFramesInFlight = m_requestedMaxFramesInFlight > 0 ?
+            std::min(m_requestedMaxFramesInFlight, imageCount) :
+            std::max(imageCount - 1, size_t(1));
+        m_maxFramesInFlight = std::min(m_maxFramesInFlight, MaxFramesInFlight);
+
+        return true;
+    }
+
+    bool VulkanRenderer::LoadFrameGraph()
+    {
+        m_frameGraphChanged = false;
+
+        if (!m_framebuffers.empty())
+        {
+            // Swap chain images are optionally transfer destinations, offscreen images always are.
+            const auto supportedUsage = m_physicalDevice.swapChainSupport.capabilities.supportedUsageFlags;
+            if (!m_offscreen && (supportedUsage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) == 0)
+            {
+                Logger::WriteError(m_logger, "Framebuffers cannot be blitted into the swap chain images of this surface, they are not drawn.");
+            }
+            else if (BuildFrameGraph(true))
+            {
+                return true;
+            }
+            else
+            {
+                Logger::WriteError(m_logger, "Failed to load passes of framebuffers, they are not drawn.");
+            }
+        }
+
+        return BuildFrameGraph(false);
+    }
+
+    bool VulkanRenderer::BuildFrameGraph(const bool framebufferPasses)
+    {
+        RetireFrameGraphImages();
+        for (auto* framebuffer : m_framebuffers)
+        {
+            if (framebuffer->framebuffer != VK_NULL_HANDLE)
+            {
+                RetireFramebuffer(framebuffer->framebuffer);
+                framebuffer->framebuffer = VK_NULL_HANDLE;
+            }
+            framebuffer->resource = FrameGraph::InvalidId;
+        }
+        m_frameGraph.Clear();
+
+        // Transient textures share the format of the swap chain, keeping them compatible with the render pass of all pipelines.
+        const auto format = m_swapChainImageFormat == VK_FORMAT_B8G8R8A8_UNORM ? FrameGraph::Format::Bgra8 : FrameGraph::Format::Rgba8;
+
+        const FrameGraph::TextureDescriptor backbufferDescriptor = {
+            { m_swapChainExtent.width, m_swapChainExtent.height }, format
+        };
+        m_frameGraphBackbuffer = m_frameGraph.ImportTexture("Backbuffer", backbufferDescriptor, FrameGraph::ResourceState::Undefined,
+            m_offscreen ? FrameGraph::ResourceState::TransferSource : FrameGraph::ResourceState::Present);
+
+        if (framebufferPasses)
+        {
+            for (auto* framebuffer : m_framebuffers)
+            {
+                framebuffer->resource = m_frameGraph.CreateTexture("Framebuffer", { framebuffer->size, format });
+
+                const auto framebufferPass = m_frameGraph.AddPass("Framebuffer", [this, framebuffer](const FrameGraph::CompiledPass& compiledPass)
+                {
+                    RecordFrameGraphBarriers(compiledPass.barriers);
+                    BeginRenderPass(m_renderPass, framebuffer->framebuffer, { framebuffer->size.x, framebuffer->size.y });
+                    ExecuteCommandBuffers(framebuffer->executeCommandBuffers);
+                    vkCmdEndRenderPass(*m_currentCommandBuffer);
+                });
+                m_frameGraph.Write(framebufferPass, framebuffer->resource, FrameGraph::ResourceState::ColorAttachment);
+            }
+
+            const auto blitPass = m_frameGraph.AddPass("Blit", [this](const FrameGraph::CompiledPass& compiledPass)
+            {
+                RecordFrameGraphBarriers(compiledPass.barriers);
+                BlitFramebuffers();
+            });
+            for (auto* framebuffer : m_framebuffers)
+            {
+                m_frameGraph.Read(blitPass, framebuffer->resource, FrameGraph::ResourceState::TransferSource);
+            }
+            m_frameGraph.Write(blitPass, m_frameGraphBackbuffer, FrameGraph::ResourceState::TransferDestination);
+        }
+
+        // Blitted framebuffers are loaded by the present pass and drawn on top of, the backbuffer is cleared otherwise.
+        const auto presentPass = m_frameGraph.AddPass("Present", [this, framebufferPasses](const FrameGraph::CompiledPass& compiledPass)
+        {
+            RecordFrameGraphBarriers(compiledPass.barriers);
+            BeginRenderPass(framebufferPasses ? m_loadRenderPass : m_renderPass, m_currentFramebuffer, m_swapChainExtent);
+            ExecuteCommandBuffers(m_executeCommandBuffers);
+            vkCmdEndRenderPass(*m_currentCommandBuffer);
+        });
+        m_frameGraph.Write(presentPass, m_frameGraphBackbuffer, FrameGraph::ResourceState::ColorAttachment);
+
+        m_frameGraph.Compile();
+        return LoadFrameGraphImages() && (!framebufferPasses || LoadFramebufferObjects());
+    }
+
+    bool VulkanRenderer::LoadFrameGraphImages()
+    {
+        if (m_frameGraph.GetTransientMemorySize() == 0)
+        {
+            return true;
+        }
+
+        // Optimal tiled images share memory blocks with linear buffers, keep them on separate pages.
+        const VkDeviceSize granularity = std::max(m_physicalDevice.properties.limits.bufferImageGranularity, VkDeviceSize(1));
+        const VkDeviceSize alignment = std::max(static_cast<VkDeviceSize>(FrameGraph::AllocationAlignment), granularity);
+
+        VkMemoryRequirements memoryReq = {};
+        memoryReq.size = ((static_cast<VkDeviceSize>(m_frameGraph.GetTransientMemorySize()) + alignment - 1) / alignment) * alignment;
+        memoryReq.alignment = alignment;
+        memoryReq.memoryTypeBits = std::numeric_limits<uint32_t>::max();
+
+        for (FrameGraph::ResourceId resource = 0; resource < static_cast<FrameGraph::ResourceId>(m_frameGraph.GetResourceCount()); resource++)
+        {
+            if (!m_frameGraph.IsAllocated(resource))
+            {
+                continue;
+            }
+
+            const auto& descriptor = m_frameGraph.GetResourceDescriptor(resource);
+            const bool depth = (GetFrameGraphAspectFlags(descriptor.format) & VK_IMAGE_ASPECT_DEPTH_BIT) != 0;
+
+            VkImageCreateInfo imageInfo = {};
+            imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+            imageInfo.imageType = VK_IMAGE_TYPE_2D;
+            imageInfo.extent = { descriptor.size.x, descriptor.size.y, 1 };
+            imageInfo.mipLevels = 1;
+            imageInfo.arrayLayers = 1;
+            imageInfo.format = GetFrameGraphFormat(descriptor.format);
+            imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+            imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            imageInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT | (depth ?
+                VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT :
+                (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT));
+            imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+            imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+            FrameGraphImage frameGraphImage = { resource, VK_NULL_HANDLE, VK_NULL_HANDLE };
+            if (vkCreateImage(m_logicalDevice, &imageInfo, nullptr, &frameGraphImage.image) != VK_SUCCESS)
+            {
+                Logger::WriteError(m_logger, "Failed to create transient image \"" + m_frameGraph.GetResourceName(resource) + "\".");
+                return false;
+            }
+            m_frameGraphImages.push_back(frameGraphImage);
+
+            // Images are placed at the offsets of the frame graph, their requirements must fit into the aliased ranges.
+            VkMemoryRequirements imageMemoryReq;
+            vkGetImageMemoryRequirements(m_logicalDevice, frameGraphImage.image, &imageMemoryReq);
+            const auto& allocation = m_frameGraph.GetAllocation(resource);
+            if (imageMemoryReq.size > static_cast<VkDeviceSize>(allocation.size) || imageMemoryReq.alignment > alignment)
+            {
+                Logger::WriteError(m_logger, "Transient image \"" + m_frameGraph.GetResourceName(resource) + "\" does not fit into its frame graph allocation.");
+                return false;
+            }
+            memoryReq.memoryTypeBits &= imageMemoryReq.memoryTypeBits;
+        }
+
+        if (!m_memoryAllocator.Allocate(memoryReq, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_frameGraphMemory))
+        {
+            Logger::WriteError(m_logger, "Failed to allocate transient image memory.");
+            return false;
+        }
+
+        for (auto& frameGraphImage : m_frameGraphImages)
+        {
+            const auto& descriptor = m_frameGraph.GetResourceDescriptor(frameGraphImage.resource);
+            const auto& allocation = m_frameGraph.GetAllocation(frameGraphImage.resource);
+            const VkDeviceSize offset = m_frameGraphMemory.offset + static_cast<VkDeviceSize>(allocation.offset);
+            if (vkBindImageMemory(m_logicalDevice, frameGraphImage.image, m_frameGraphMemory.memory, offset) != VK_SUCCESS)
+            {
+                Logger::WriteError(m_logger, "Failed to bind memory to transient image.");
+                return false;
+            }
+
+            VkImageViewCreateInfo imageViewInfo = {};
+            imageViewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+            imageViewInfo.image = frameGraphImage.image;
+            imageViewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+            imageViewInfo.format = GetFrameGraphFormat(descriptor.format);
+            imageViewInfo.components.r = VK_COMPONENT_SWIZZLE_IDENTITY;
+            imageViewInfo.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
+            imageViewInfo.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
+            imageViewInfo.components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
+            imageViewInfo.subresourceRange.aspectMask = GetFrameGraphAspectFlags(descriptor.format);
+            imageViewInfo.subresourceRange.baseMipLevel = 0;
+            imageViewInfo.subresourceRange.levelCount = 1;
+            imageViewInfo.subresourceRange.baseArrayLayer = 0;
+            imageViewInfo.subresourceRange.layerCount = 1;
+
+            if (vkCreateImageView(m_logicalDevice, &imageViewInfo, nullptr, &frameGraphImage.imageView) != VK_SUCCESS)
+            {
+                Logger::WriteError(m_logger, "Failed to create transient image view.");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void VulkanRenderer::RetireFrameGraphImages()
+    {
+        // Frames in flight may still use the images, all aliased images share memory freed with the last one.
+        for (size_t i = 0; i < m_frameGraphImages.size(); i++)
+        {
+            const auto& frameGraphImage = m_frameGraphImages[i];
+            RetiredImage retiredImage = { frameGraphImage.image, {}, frameGraphImage.imageView, m_frameCount };
+            if (i + 1 == m_frameGraphImages.size())
+            {
+                retiredImage.memory = m_frameGraphMemory;
+            }
+            m_retiredImages.push_back(retiredImage);
+        }
+        if (m_frameGraphImages.empty())
+        {
+            m_memoryAllocator.Free(m_frameGraphMemory);
+        }
+
+        m_frameGraphImages.clear();
+        m_frameGraphMemory = {};
+    }
+
+    bool VulkanRenderer::LoadFramebufferObjects()
+    {
+        for (auto* framebuffer : m_framebuffers)
+        {
+            auto it = std::find_if(m_frameGraphImages.begin(), m_frameGraphImages.end(), [&](const FrameGraphImage& frameGraphImage)
+            {
+                return frameGraphImage.resource == framebuffer->resource;
+            });
+            if (it == m_frameGraphImages.end())
+            {
+                Logger::WriteError(m_logger, "Transient image of framebuffer is not allocated.");
+                return false;
+            }
+
+            VkFramebufferCreateInfo framebufferInfo = {};
+            framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+            framebufferInfo.renderPass = m_renderPass;
+            framebufferInfo.attachmentCount = 1;
+            framebufferInfo.pAttachments = &it->imageView;
+            framebufferInfo.width = framebuffer->size.x;
+            framebufferInfo.height = framebuffer->size.y;
+            framebufferInfo.layers = 1;
+
+            if (vkCreateFramebuffer(m_logicalDevice, &framebufferInfo, nullptr, &framebuffer->framebuffer) != VK_SUCCESS)
+            {
+                framebuffer->framebuffer = VK_NULL_HANDLE;
+                Logger::WriteError(m_logger, "Failed to create framebuffer.");
+                return false;
+            }
+        }
 
         return true;
     }
 
+    VkImage VulkanRenderer::GetFrameGraphImage(const FrameGraph::ResourceId resource) const
+    {
+        if (resource == m_frameGraphBackbuffer)
+        {
+            return m_swapChainImages[m_currentImageIndex];
+        }
+
+        auto it = std::find_if(m_frameGraphImages.begin(), m_frameGraphImages.end(), [&](const FrameGraphImage& frameGraphImage)
+        {
+            return frameGraphImage.resource == resource;
+        });
+        return it != m_frameGraphImages.end() ? it->image : VK_NULL_HANDLE;
+    }
+
+    void VulkanRenderer::RecordFrameGraphBarriers(const std::vector<FrameGraph::Barrier>& barriers)
+    {
+        if (barriers.empty())
+        {
+            return;
+        }
+
+        std::vector<VkImageMemoryBarrier> imageBarriers;
+        imageBarriers.reserve(barriers.size());
+        VkPipelineStageFlags sourceStages = 0;
+        VkPipelineStageFlags destinationStages = 0;
+
+        for (const auto& barrier : barriers)
+        {
+            const auto before = GetFrameGraphStateInfo(barrier.before);
+            const auto after = GetFrameGraphStateInfo(barrier.after);
+            const auto& descriptor = m_frameGraph.GetResourceDescriptor(barrier.resource);
+
+            VkImageMemoryBarrier imageBarrier = {};
+            imageBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            imageBarrier.srcAccessMask = before.access;
+            imageBarrier.dstAccessMask = after.access;
+            imageBarrier.oldLayout = before.layout;
+            imageBarrier.newLayout = after.layout;
+            imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier.image = GetFrameGraphImage(barrier.resource);
+            imageBarrier.subresourceRange.aspectMask = GetFrameGraphAspectFlags(descriptor.format);
+            imageBarrier.subresourceRange.baseMipLevel = 0;
+            imageBarrier.subresourceRange.levelCount = 1;
+            imageBarrier.subresourceRange.baseArrayLayer = 0;
+            imageBarrier.subresourceRange.layerCount = 1;
+            imageBarriers.push_back(imageBarrier);
+
+            sourceStages |= before.stages;
+            destinationStages |= after.stages;
+        }
+
+        vkCmdPipelineBarrier(*m_currentCommandBuffer, sourceStages, destinationStages, 0, 0, nullptr, 0, nullptr,
+            static_cast<uint32_t>(imageBarriers.size()), imageBarriers.data());
+    }
+
+    void VulkanRenderer::BeginRenderPass(VkRenderPass renderPass, VkFramebuffer framebuffer, const VkExtent2D extent)
+    {
+        VkRenderPassBeginInfo renderPassBeginInfo = {};
+        renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        renderPassBeginInfo.renderPass = renderPass;
+        renderPassBeginInfo.framebuffer = framebuffer;
+        renderPassBeginInfo.renderArea.offset = { 0, 0 };
+        renderPassBeginInfo.renderArea.extent = extent;
+
+        const VkClearValue clearColor = { 0.3f, 0.0f, 0.0f, 0.0f };
+        renderPassBeginInfo.clearValueCount = 1;
+        renderPassBeginInfo.pClearValues = &clearColor;
+
+        // All commands of the render pass are recorded in secondary command buffers,
+        // commands recorded directly on the renderer included.
+        vkCmdBeginRenderPass(*m_currentCommandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+    }
+
+    void VulkanRenderer::ExecuteCommandBuffers(std::vector<VkCommandBuffer>& commandBuffers)
+    {
+        if (!commandBuffers.empty())
+        {
+            vkCmdExecuteCommands(*m_currentCommandBuffer, static_cast<uint32_t>(commandBuffers.size()), commandBuffers.data());
+            commandBuffers.clear();
+        }
+    }
+
+    void VulkanRenderer::BlitFramebuffers()
+    {
+        const VkImage backbuffer = m_swapChainImages[m_currentImageIndex];
+
+        for (size_t i = 0; i < m_framebuffers.size(); i++)
+        {
+            const auto* framebuffer = m_framebuffers[i];
+
+            // Framebuffers cover the whole backbuffer, later framebuffers are blitted after the earlier ones.
+            if (i > 0)
+            {
+                VkMemoryBarrier memoryBarrier = {};
+                memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                memoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                vkCmdPipelineBarrier(*m_currentCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                    1, &memoryBarrier, 0, nullptr, 0, nullptr);
+            }
+
+            VkImageBlit region = {};
+            region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.srcSubresource.mipLevel = 0;
+            region.srcSubresource.baseArrayLayer = 0;
+            region.srcSubresource.layerCount = 1;
+            region.srcOffsets[1] = { static_cast<int32_t>(framebuffer->size.x), static_cast<int32_t>(framebuffer->size.y), 1 };
+            region.dstSubresource = region.srcSubresource;
+            region.dstOffsets[1] = { static_cast<int32_t>(m_swapChainExtent.width), static_cast<int32_t>(m_swapChainExtent.height), 1 };
+
+            vkCmdBlitImage(*m_currentCommandBuffer,
+                GetFrameGraphImage(framebuffer->resource), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                backbuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                1, &region, VK_FILTER_LINEAR);
+        }
+    }
+
     Framebuffer* VulkanRenderer::CreateFramebuffer(const VkImageView& imageView, const Vector2ui32 size)
     {
         VkImageView attachments[] = { imageView };
@@ -1769,9 +3629,17 @@ namespace Molten
 
         VulkanFramebuffer* vulkanFramebuffer = new VulkanFramebuffer;
         vulkanFramebuffer->framebuffer = framebuffer;
+        vulkanFramebuffer->size = size;
+        vulkanFramebuffer->resource = FrameGraph::InvalidId;
         return vulkanFramebuffer;
     }
 
+    void VulkanRenderer::DestroyPresentFramebuffer(VulkanFramebuffer* framebuffer)
+    {
+        vkDestroyFramebuffer(m_logicalDevice, framebuffer->framebuffer, nullptr);
+        delete framebuffer;
+    }
+
     bool VulkanRenderer::LoadCommandPool()
     {
         VkCommandPoolCreateInfo commandPoolInfo = {};
@@ -1785,17 +3653,29 @@ namespace Molten
             return false;
         }
 
-        m_commandBuffers.resize(m_presentFramebuffers.size());
+        return LoadCommandBuffers();
+    }
+
+    bool VulkanRenderer::LoadCommandBuffers()
+    {
+        // Command buffers are kept when the swap chain is recreated with fewer images, frames in flight may still use them.
+        const size_t firstCommandBuffer = m_commandBuffers.size();
+        if (m_presentFramebuffers.size() <= firstCommandBuffer)
+        {
+            return true;
+        }
+
+        m_commandBuffers.resize(m_presentFramebuffers.size(), VK_NULL_HANDLE);
 
         VkCommandBufferAllocateInfo commandBufferInfo = {};
         commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         commandBufferInfo.commandPool = m_commandPool;
         commandBufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        commandBufferInfo.commandBufferCount = static_cast<uint32_t>(m_commandBuffers.size());
+        commandBufferInfo.commandBufferCount = static_cast<uint32_t>(m_commandBuffers.size() - firstCommandBuffer);
 
-        if (vkAllocateCommandBuffers(m_logicalDevice, &commandBufferInfo, m_commandBuffers.data()) != VK_SUCCESS)
+        if (vkAllocateCommandBuffers(m_logicalDevice, &commandBufferInfo, m_commandBuffers.data() + firstCommandBuffer) != VK_SUCCESS)
         {
-            vkDestroyCommandPool(m_logicalDevice, m_commandPool, nullptr);
+            m_commandBuffers.resize(firstCommandBuffer);
             Logger::WriteError(m_logger, "Failed to allocate command buffers.");
             return false;
         }
@@ -1831,170 +3711,1191 @@ namespace Molten
         return true;
     }
 
+    void VulkanRenderer::UnloadSyncObjects()
+    {
+        Vulkan::DestroySemaphores(m_logicalDevice, m_imageAvailableSemaphores);
+        Vulkan::DestroySemaphores(m_logicalDevice, m_renderFinishedSemaphores);
+        Vulkan::DestroyFences(m_logicalDevice, m_inFlightFences);
+
+        m_imageAvailableSemaphores.clear();
+        m_renderFinishedSemaphores.clear();
+        m_inFlightFences.clear();
+        m_imagesInFlight.clear();
+    }
+
     bool VulkanRenderer::RecreateSwapChain()
     {
-        vkDeviceWaitIdle(m_logicalDevice);
+        MOLTEN_PROFILE_ZONE("VulkanRenderer::RecreateSwapChain");
 
-        if (m_swapChain)
+        // Frames in flight keep rendering to the retired images, the old swap chain is handed over to the new one.
+        // If recreation fails before creating a new swap chain, the old one stays current and is handed over by the next attempt.
+        RetireSwapchain();
+
+        if (m_offscreen)
         {
-            Vulkan::DestroySemaphores(m_logicalDevice, m_imageAvailableSemaphores);
-            Vulkan::DestroySemaphores(m_logicalDevice, m_renderFinishedSemaphores);
-            Vulkan::DestroyFences(m_logicalDevice, m_inFlightFences);
+            m_swapChainExtent = m_requestedExtent;
+        }
 
-            m_imagesInFlight.clear();
+        if (!(m_offscreen ? LoadOffscreenImages() : LoadSwapChain()) ||
+            !LoadImageViews() ||
+            !LoadPresentFramebuffer() ||
+            !LoadFrameGraph() ||
+            !LoadCommandBuffers())
+        {
+            return false;
+        }
 
-            for (auto& framebuffer : m_presentFramebuffers)
+        // Synchronization objects are kept, unless the number of frames in flight changes.
+        if (m_maxFramesInFlight == m_inFlightFences.size())
+        {
+            if (m_imagesInFlight.size() < m_swapChainImages.size())
             {
-                DestroyFramebuffer(framebuffer);
+                m_imagesInFlight.resize(m_swapChainImages.size(), VK_NULL_HANDLE);
             }
-            m_presentFramebuffers.clear();
-
-            Vulkan::DestroyImageViews(m_logicalDevice, m_swapChainImageViews);
+            return true;
         }
 
+        if (!m_inFlightFences.empty())
+        {
+            vkWaitForFences(m_logicalDevice, static_cast<uint32_t>(m_inFlightFences.size()), m_inFlightFences.data(),
+                VK_TRUE, std::numeric_limits<uint64_t>::max());
+        }
 
-        bool loaded =
-            LoadSwapChain() &&
-            LoadImageViews() &&
-            LoadPresentFramebuffer()&&
-            LoadSyncObjects();
+        for (size_t i = 0; i < m_frameUploadSemaphores.size(); i++)
+        {
+            RecycleUploadSemaphores(i);
+        }
 
-        return loaded;
+        m_currentFrame = 0;
+        UnloadSyncObjects();
+        return LoadSyncObjects();
     }
 
-    void VulkanRenderer::UnloadSwapchain()
+    void VulkanRenderer::RetireSwapchain()
     {
-        Vulkan::DestroySemaphores(m_logicalDevice, m_imageAvailableSemaphores);
-        Vulkan::DestroySemaphores(m_logicalDevice, m_renderFinishedSemaphores);
-        Vulkan::DestroyFences(m_logicalDevice, m_inFlightFences);
-
-        m_imagesInFlight.clear();
-
-        for (auto& framebuffer : m_presentFramebuffers)
+        // The swap chain itself is retired by LoadSwapChain, once it has been handed over to a new swap chain.
+        RetiredSwapchain retiredSwapchain = {};
+        retiredSwapchain.swapChain = VK_NULL_HANDLE;
+        retiredSwapchain.imageViews = std::move(m_swapChainImageViews);
+        retiredSwapchain.framebuffers = std::move(m_presentFramebuffers);
+        retiredSwapchain.frame = m_frameCount;
+
+        if (m_offscreen)
         {
-            DestroyFramebuffer(framebuffer);
+            retiredSwapchain.offscreenImages = std::move(m_swapChainImages);
+            retiredSwapchain.offscreenImageMemory = std::move(m_offscreenImageMemory);
+            m_readbackAvailable = false;
         }
+
+        m_swapChainImages.clear();
+        m_swapChainImageViews.clear();
         m_presentFramebuffers.clear();
+        m_offscreenImageMemory.clear();
 
-        Vulkan::DestroyImageViews(m_logicalDevice, m_swapChainImageViews);
+        m_retiredSwapchains.push_back(std::move(retiredSwapchain));
+    }
+
+    void VulkanRenderer::DestroyRetiredSwapchains(const bool all)
+    {
+        // Same rule as retired images, frames recorded before the swap chain was retired have finished.
+        auto it = std::remove_if(m_retiredSwapchains.begin(), m_retiredSwapchains.end(), [&](RetiredSwapchain& retiredSwapchain)
+        {
+            if (!all && m_frameCount < retiredSwapchain.frame + static_cast<uint64_t>(m_maxFramesInFlight))
+            {
+                return false;
+            }
+
+            for (auto* framebuffer : retiredSwapchain.framebuffers)
+            {
+                DestroyPresentFramebuffer(framebuffer);
+            }
+            Vulkan::DestroyImageViews(m_logicalDevice, retiredSwapchain.imageViews);
+
+            for (size_t i = 0; i < retiredSwapchain.offscreenImages.size(); i++)
+            {
+                if (retiredSwapchain.offscreenImages[i] != VK_NULL_HANDLE)
+                {
+                    vkDestroyImage(m_logicalDevice, retiredSwapchain.offscreenImages[i], nullptr);
+                }
+                if (i < retiredSwapchain.offscreenImageMemory.size())
+                {
+                    m_memoryAllocator.Free(retiredSwapchain.offscreenImageMemory[i]);
+                }
+            }
+
+            if (retiredSwapchain.swapChain != VK_NULL_HANDLE)
+            {
+                vkDestroySwapchainKHR(m_logicalDevice, retiredSwapchain.swapChain, nullptr);
+            }
+            return true;
+        });
+        m_retiredSwapchains.erase(it, m_retiredSwapchains.end());
+    }
+
+    void VulkanRenderer::UnloadSwapchain()
+    {
+        UnloadSyncObjects();
+
+        for (auto& framebuffer : m_presentFramebuffers)
+        {
+            DestroyPresentFramebuffer(framebuffer);
+        }
+        m_presentFramebuffers.clear();
+
+        Vulkan::DestroyImageViews(m_logicalDevice, m_swapChainImageViews);
+
+        if (m_offscreen)
+        {
+            UnloadOffscreenImages();
+        }
+
+        if (m_swapChain)
+        {
+            vkDestroySwapchainKHR(m_logicalDevice, m_swapChain, nullptr);
+            m_swapChain = VK_NULL_HANDLE;
+        }      
+    }
+
+    bool VulkanRenderer::LoadMemoryAllocator()
+    {
+        return m_memoryAllocator.Open(m_physicalDevice.device, m_logicalDevice, m_logger);
+    }
+
+    bool VulkanRenderer::LoadDescriptorAllocators()
+    {
+        // Arenas are created on demand in BeginDraw, the number of swap chain images is not known yet.
+        return m_descriptorSetCache.Open(m_logicalDevice, m_logger);
+    }
+
+    void VulkanRenderer::UnloadDescriptorAllocators()
+    {
+        m_descriptorArenas.clear();
+        m_descriptorSetCache.Close();
+    }
+
+    bool VulkanRenderer::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VulkanMemory& memory)
+    {
+        VkBufferCreateInfo bufferInfo = {};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = size;
+        bufferInfo.usage = usage;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        // Upload destinations are written by the transfer queue and read by the graphics queue.
+        const uint32_t queueFamilies[] = { m_physicalDevice.graphicsQueueIndex, m_physicalDevice.transferQueueIndex };
+        if ((usage & VK_BUFFER_USAGE_TRANSFER_DST_BIT) && queueFamilies[0] != queueFamilies[1])
+        {
+            bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+            bufferInfo.queueFamilyIndexCount = 2;
+            bufferInfo.pQueueFamilyIndices = queueFamilies;
+        }
+
+        if (vkCreateBuffer(m_logicalDevice, &bufferInfo, nullptr, &buffer) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to create buffer.");
+            return false;
+        }
+
+        VkMemoryRequirements memoryReq;
+        vkGetBufferMemoryRequirements(m_logicalDevice, buffer, &memoryReq);
+
+        if (!m_memoryAllocator.Allocate(memoryReq, properties, memory))
+        {
+            vkDestroyBuffer(m_logicalDevice, buffer, nullptr);
+            Logger::WriteError(m_logger, "Failed to allocate buffer memory.");
+            return false;
+        }
+
+        if (vkBindBufferMemory(m_logicalDevice, buffer, memory.memory, memory.offset) != VK_SUCCESS)
+        {
+            vkDestroyBuffer(m_logicalDevice, buffer, nullptr);
+            m_memoryAllocator.Free(memory);
+            Logger::WriteError(m_logger, "Failed to bind memory to buffer.");
+            return false;
+        }
+
+        return true;
+    }
+
+    void VulkanRenderer::DestroyBuffer(VkBuffer buffer, VulkanMemory& memory)
+    {
+        vkDestroyBuffer(m_logicalDevice, buffer, nullptr);
+        m_memoryAllocator.Free(memory);
+    }
+
+    bool VulkanRenderer::CreateDynamicBuffer(VkDeviceSize size, VkBufferUsageFlags usage, const void* data, VkBuffer& buffer, VulkanMemory& memory)
+    {
+        // Host coherent memory is written directly by the frame owning the buffer, without any staging copy.
+        if (!CreateBuffer(std::max(size, VkDeviceSize(1)), usage, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, buffer, memory))
+        {
+            return false;
+        }
+
+        if (data)
+        {
+            memcpy(memory.mappedData, data, static_cast<size_t>(size));
+        }
+        return true;
+    }
+
+    bool VulkanRenderer::CheckDynamicBufferWrite(const size_t count, const size_t capacity)
+    {
+        if (!m_beginDraw)
+        {
+            Logger::WriteError(m_logger, "Cannot write dynamic buffer without any previous call to BeginDraw.");
+            return false;
+        }
+        if (count > capacity)
+        {
+            Logger::WriteError(m_logger, "Trying to write more elements than the capacity of dynamic buffer.");
+            return false;
+        }
+        return true;
+    }
+
+    bool VulkanRenderer::LoadPipelineCache()
+    {
+        std::vector<uint8_t> cacheData;
+        if (!m_cacheDirectory.empty())
+        {
+            try
+            {
+                cacheData = FileSystem::ReadFile(m_cacheDirectory + "/PipelineCache.bin");
+            }
+            catch (Exception &)
+            {
+                cacheData.clear();
+            }
+        }
+
+        // Pipeline cache data of other devices or drivers is ignored.
+        const auto& properties = m_physicalDevice.properties;
+        const size_t headerSize = 16 + VK_UUID_SIZE;
+        if (cacheData.size() >= headerSize)
+        {
+            uint32_t header[4];
+            memcpy(header, cacheData.data(), sizeof(header));
+            if (header[0] < headerSize ||
+                header[1] != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+                header[2] != properties.vendorID ||
+                header[3] != properties.deviceID ||
+                memcmp(cacheData.data() + 16, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+            {
+                cacheData.clear();
+            }
+        }
+        else
+        {
+            cacheData.clear();
+        }
+
+        VkPipelineCacheCreateInfo pipelineCacheInfo = {};
+        pipelineCacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        pipelineCacheInfo.initialDataSize = cacheData.size();
+        pipelineCacheInfo.pInitialData = cacheData.size() ? cacheData.data() : nullptr;
+
+        if (vkCreatePipelineCache(m_logicalDevice, &pipelineCacheInfo, nullptr, &m_pipelineCache) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to create pipeline cache.");
+            return false;
+        }
+
+        return true;
+    }
+
+    void VulkanRenderer::UnloadPipelineCache()
+    {
+        if (!m_pipelineCache)
+        {
+            return;
+        }
+
+        if (!m_cacheDirectory.empty())
+        {
+            size_t dataSize = 0;
+            std::vector<uint8_t> cacheData;
+            if (vkGetPipelineCacheData(m_logicalDevice, m_pipelineCache, &dataSize, nullptr) == VK_SUCCESS && dataSize)
+            {
+                cacheData.resize(dataSize);
+                if (vkGetPipelineCacheData(m_logicalDevice, m_pipelineCache, &dataSize, cacheData.data()) == VK_SUCCESS)
+                {
+                    FileSystem::MakeDirectory(m_cacheDirectory);
+                    if (!FileSystem::WriteFile(m_cacheDirectory + "/PipelineCache.bin", cacheData.data(), dataSize))
+                    {
+                        Logger::WriteWarning(m_logger, "Failed to write pipeline cache file.");
+                    }
+                }
+            }
+        }
+
+        vkDestroyPipelineCache(m_logicalDevice, m_pipelineCache, nullptr);
+        m_pipelineCache = VK_NULL_HANDLE;
+    }
+
+    bool VulkanRenderer::LoadCullPipeline()
+    {
+        // Indirect buffers are culled on the host if the cull shader cannot be compiled.
+        const std::vector<uint8_t> glslCode(s_cullShaderSource, s_cullShaderSource + sizeof(s_cullShaderSource) - 1);
+        const auto spirvCode = CompileShaderStage(glslCode, Shader::Type::Compute);
+        if (spirvCode.empty())
+        {
+            Logger::WriteWarning(m_logger, "Failed to compile cull shader, indirect buffers are culled on the host.");
+            return true;
+        }
+
+        VkDescriptorSetLayoutBinding bindings[3] = {};
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            bindings[i].binding = i;
+            bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            bindings[i].descriptorCount = 1;
+            bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+            bindings[i].pImmutableSamplers = nullptr;
+        }
+
+        VkDescriptorSetLayoutCreateInfo descriptorSetLayoutInfo = {};
+        descriptorSetLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        descriptorSetLayoutInfo.bindingCount = 3;
+        descriptorSetLayoutInfo.pBindings = bindings;
+
+        if (vkCreateDescriptorSetLayout(m_logicalDevice, &descriptorSetLayoutInfo, nullptr, &m_cullSetLayout) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to create descriptor set layout of cull pipeline.");
+            return false;
+        }
+
+        m_cullDescriptorCounts = VulkanDescriptorCounts();
+        m_cullDescriptorCounts.Add(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 3);
+
+        VkPushConstantRange pushConstantRange = {};
+        pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushConstantRange.offset = 0;
+        pushConstantRange.size = sizeof(CullPushConstants);
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 1;
+        pipelineLayoutInfo.pSetLayouts = &m_cullSetLayout;
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+        if (vkCreatePipelineLayout(m_logicalDevice, &pipelineLayoutInfo, nullptr, &m_cullPipelineLayout) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to create pipeline layout of cull pipeline.");
+            return false;
+        }
+
+        const VkShaderModule shaderModule = CreateShaderModule(spirvCode);
+        if (shaderModule == VK_NULL_HANDLE)
+        {
+            return false;
+        }
+
+        VkComputePipelineCreateInfo pipelineInfo = {};
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipelineInfo.stage.module = shaderModule;
+        pipelineInfo.stage.pName = "main";
+        pipelineInfo.layout = m_cullPipelineLayout;
+
+        const VkResult result = vkCreateComputePipelines(m_logicalDevice, m_pipelineCache, 1, &pipelineInfo, nullptr, &m_cullPipeline);
+        vkDestroyShaderModule(m_logicalDevice, shaderModule, nullptr);
+        if (result != VK_SUCCESS)
+        {
+            m_cullPipeline = VK_NULL_HANDLE;
+            Logger::WriteError(m_logger, "Failed to create cull pipeline.");
+            return false;
+        }
+
+        return true;
+    }
+
+    void VulkanRenderer::UnloadCullPipeline()
+    {
+        if (m_cullPipeline)
+        {
+            vkDestroyPipeline(m_logicalDevice, m_cullPipeline, nullptr);
+            m_cullPipeline = VK_NULL_HANDLE;
+        }
+        if (m_cullPipelineLayout)
+        {
+            vkDestroyPipelineLayout(m_logicalDevice, m_cullPipelineLayout, nullptr);
+            m_cullPipelineLayout = VK_NULL_HANDLE;
+        }
+        if (m_cullSetLayout)
+        {
+            vkDestroyDescriptorSetLayout(m_logicalDevice, m_cullSetLayout, nullptr);
+            m_cullSetLayout = VK_NULL_HANDLE;
+        }
+    }
+
+    bool VulkanRenderer::LoadUploadResources()
+    {
+        VkCommandPoolCreateInfo commandPoolInfo = {};
+        commandPoolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        commandPoolInfo.queueFamilyIndex = m_physicalDevice.transferQueueIndex;
+        commandPoolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+        if (vkCreateCommandPool(m_logicalDevice, &commandPoolInfo, nullptr, &m_uploadCommandPool) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to create upload command pool.");
+            return false;
+        }
+
+        if (!CreateBuffer(m_stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, 
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, m_stagingBuffer, m_stagingMemory))
+        {
+            Logger::WriteError(m_logger, "Failed to create staging buffer.");
+            return false;
+        }
+
+        m_stagingHead = 0;
+        m_stagingTail = 0;
+        return true;
+    }
+
+    void VulkanRenderer::UnloadUploadResources()
+    {
+        // Expects the device to be idle.
+        RetireUploadBatches(false);
+
+        for (auto& batch : m_submittedUploadBatches)
+        {
+            for (auto& temporaryBuffer : batch.temporaryBuffers)
+            {
+                DestroyBuffer(temporaryBuffer.buffer, temporaryBuffer.memory);
+            }
+            for (auto& destroyedBuffer : batch.destroyedBuffers)
+            {
+                DestroyBuffer(destroyedBuffer.buffer, destroyedBuffer.memory);
+            }
+            vkDestroyFence(m_logicalDevice, batch.fence, nullptr);
+        }
+        m_submittedUploadBatches.clear();
+
+        for (auto& batch : m_freeUploadBatches)
+        {
+            vkDestroyFence(m_logicalDevice, batch.fence, nullptr);
+        }
+        m_freeUploadBatches.clear();
+
+        for (auto& temporaryBuffer : m_pendingTemporaryBuffers)
+        {
+            DestroyBuffer(temporaryBuffer.buffer, temporaryBuffer.memory);
+        }
+        m_pendingTemporaryBuffers.clear();
+        m_pendingUploads.clear();
+        m_pendingImageUploads.clear();
+
+        for (size_t i = 0; i < m_frameUploadSemaphores.size(); i++)
+        {
+            RecycleUploadSemaphores(i);
+        }
+        m_frameUploadSemaphores.clear();
+        Vulkan::DestroySemaphores(m_logicalDevice, m_uploadWaitSemaphores);
+        Vulkan::DestroySemaphores(m_logicalDevice, m_freeUploadSemaphores);
+        m_uploadWaitSemaphores.clear();
+        m_freeUploadSemaphores.clear();
+
+        if (m_stagingBuffer)
+        {
+            DestroyBuffer(m_stagingBuffer, m_stagingMemory);
+            m_stagingBuffer = VK_NULL_HANDLE;
+        }
+        if (m_uploadCommandPool)
+        {
+            vkDestroyCommandPool(m_logicalDevice, m_uploadCommandPool, nullptr);
+            m_uploadCommandPool = VK_NULL_HANDLE;
+        }
+
+        m_stagingHead = 0;
+        m_stagingTail = 0;
+    }
+
+    bool VulkanRenderer::AllocateUploadSource(const VkDeviceSize size, VkBuffer& source, VkDeviceSize& offset, uint8_t*& mappedData)
+    {
+        if (size > m_stagingSize)
+        {
+            // Data does not fit in the staging ring, use a temporary staging buffer released with its batch.
+            StagingBuffer temporaryBuffer;
+            if (!CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, temporaryBuffer.buffer, temporaryBuffer.memory))
+            {
+                return false;
+            }
+
+            m_pendingTemporaryBuffers.push_back(temporaryBuffer);
+            source = temporaryBuffer.buffer;
+            offset = 0;
+            mappedData = static_cast<uint8_t*>(temporaryBuffer.memory.mappedData);
+            return true;
+        }
+
+        if (!AllocateStaging(size, offset))
+        {
+            return false;
+        }
+
+        source = m_stagingBuffer;
+        mappedData = static_cast<uint8_t*>(m_stagingMemory.mappedData) + offset;
+        return true;
+    }
+
+    bool VulkanRenderer::UploadBuffer(VkBuffer destination, const void* data, const VkDeviceSize size)
+    {
+        VkBuffer source = VK_NULL_HANDLE;
+        VkDeviceSize sourceOffset = 0;
+        uint8_t* mappedData = nullptr;
+        if (!AllocateUploadSource(size, source, sourceOffset, mappedData))
+        {
+            return false;
+        }
+
+        memcpy(mappedData, data, static_cast<size_t>(size));
+        m_pendingUploads.push_back({ source, destination, sourceOffset, size });
+        return true;
+    }
+
+    bool VulkanRenderer::UploadImage(VkImage destination, const Vector2ui32& dimensions, const Texture::Format format, const uint32_t mipLevelCount, const uint8_t* data)
+    {
+        // Copy offsets must be multiples of 4 and of the texel size, levels are padded to 16 bytes in staging memory.
+        std::vector<VkBufferImageCopy> regions(mipLevelCount);
+        std::vector<size_t> levelSizes(mipLevelCount);
+        VkDeviceSize size = 0;
+        for (uint32_t level = 0; level < mipLevelCount; level++)
+        {
+            const auto levelDimensions = Texture::GetMipLevelDimensions(dimensions, level);
+            levelSizes[level] = Texture::GetMipChainSize(dimensions, format, level, 1);
+
+            auto& region = regions[level];
+            region = {};
+            region.bufferOffset = size;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.mipLevel = level;
+            region.imageSubresource.baseArrayLayer = 0;
+            region.imageSubresource.layerCount = 1;
+            region.imageExtent = { levelDimensions.x, levelDimensions.y, 1 };
+
+            size += (static_cast<VkDeviceSize>(levelSizes[level]) + 15) & ~VkDeviceSize(15);
+        }
+
+        VkBuffer source = VK_NULL_HANDLE;
+        VkDeviceSize sourceOffset = 0;
+        uint8_t* mappedData = nullptr;
+        if (!AllocateUploadSource(size, source, sourceOffset, mappedData))
+        {
+            return false;
+        }
+
+        size_t dataOffset = 0;
+        for (uint32_t level = 0; level < mipLevelCount; level++)
+        {
+            auto& region = regions[level];
+            memcpy(mappedData + region.bufferOffset, data + dataOffset, levelSizes[level]);
+            region.bufferOffset += sourceOffset;
+            dataOffset += levelSizes[level];
+        }
+
+        m_pendingImageUploads.push_back({ source, destination, mipLevelCount, std::move(regions) });
+        return true;
+    }
+
+    void VulkanRenderer::CancelUploads(VkBuffer destination)
+    {
+        m_pendingUploads.erase(
+            std::remove_if(m_pendingUploads.begin(), m_pendingUploads.end(), [&](const UploadCopy& upload)
+            {
+                return upload.destination == destination;
+            }),
+            m_pendingUploads.end());
+    }
+
+    void VulkanRenderer::DestroyUploadDestination(VkBuffer destination, VulkanMemory& memory)
+    {
+        CancelUploads(destination);
+
+        // Submitted copies may still write the buffer, it is destroyed when the newest batch and all batches before it are complete.
+        if (!m_submittedUploadBatches.empty())
+        {
+            m_submittedUploadBatches.back().destroyedBuffers.push_back({ destination, memory });
+            return;
+        }
+
+        DestroyBuffer(destination, memory);
+    }
+
+    void VulkanRenderer::CancelImageUploads(VkImage destination)
+    {
+        m_pendingImageUploads.erase(
+            std::remove_if(m_pendingImageUploads.begin(), m_pendingImageUploads.end(), [&](const ImageUpload& upload)
+            {
+                return upload.destination == destination;
+            }),
+            m_pendingImageUploads.end());
+    }
+
+    bool VulkanRenderer::CreateSampler(const SamplerDescriptor& descriptor, const uint32_t mipLevelCount, VkSampler& sampler)
+    {
+        const bool anisotropy = descriptor.maxAnisotropy > 1.0f && m_physicalDevice.features.samplerAnisotropy;
+
+        VkSamplerCreateInfo samplerInfo = {};
+        samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        samplerInfo.magFilter = GetSamplerFilter(descriptor.magFilter);
+        samplerInfo.minFilter = GetSamplerFilter(descriptor.minFilter);
+        samplerInfo.mipmapMode = descriptor.mipmapFilter == Texture::Filter::Linear ? VK_SAMPLER_MIPMAP_MODE_LINEAR : VK_SAMPLER_MIPMAP_MODE_NEAREST;
+        samplerInfo.addressModeU = GetSamplerAddressMode(descriptor.addressModeU);
+        samplerInfo.addressModeV = GetSamplerAddressMode(descriptor.addressModeV);
+        samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        samplerInfo.mipLodBias = 0.0f;
+        samplerInfo.anisotropyEnable = anisotropy ? VK_TRUE : VK_FALSE;
+        samplerInfo.maxAnisotropy = anisotropy ? std::min(descriptor.maxAnisotropy, m_physicalDevice.properties.limits.maxSamplerAnisotropy) : 1.0f;
+        samplerInfo.compareEnable = VK_FALSE;
+        samplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
+        samplerInfo.minLod = 0.0f;
+        samplerInfo.maxLod = static_cast<float>(mipLevelCount);
+        samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+        samplerInfo.unnormalizedCoordinates = VK_FALSE;
+
+        if (vkCreateSampler(m_logicalDevice, &samplerInfo, nullptr, &sampler) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to create sampler.");
+            return false;
+        }
+        return true;
+    }
+
+    bool VulkanRenderer::LoadTextureImage(VulkanTexture& texture, const uint32_t firstMipLevel, const uint8_t* data)
+    {
+        const uint32_t mipLevelCount = texture.mipLevelCount - firstMipLevel;
+        const auto dimensions = Texture::GetMipLevelDimensions(texture.dimensions, firstMipLevel);
+
+        VkImageCreateInfo imageInfo = {};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.extent = { dimensions.x, dimensions.y, 1 };
+        imageInfo.mipLevels = mipLevelCount;
+        imageInfo.arrayLayers = 1;
+        imageInfo.format = texture.imageFormat;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageInfo.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        // Images are written by the transfer queue and sampled by the graphics queue.
+        const uint32_t queueFamilies[] = { m_physicalDevice.graphicsQueueIndex, m_physicalDevice.transferQueueIndex };
+        if (queueFamilies[0] != queueFamilies[1])
+        {
+            imageInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+            imageInfo.queueFamilyIndexCount = 2;
+            imageInfo.pQueueFamilyIndices = queueFamilies;
+        }
+
+        VkImage image = VK_NULL_HANDLE;
+        VulkanMemory memory;
+        VkImageView imageView = VK_NULL_HANDLE;
+
+        if (vkCreateImage(m_logicalDevice, &imageInfo, nullptr, &image) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to create texture image.");
+            return false;
+        }
+
+        // Optimal tiled images share memory blocks with linear buffers, keep them on separate pages.
+        const VkDeviceSize granularity = std::max(m_physicalDevice.properties.limits.bufferImageGranularity, VkDeviceSize(1));
+        VkMemoryRequirements memoryReq;
+        vkGetImageMemoryRequirements(m_logicalDevice, image, &memoryReq);
+        memoryReq.alignment = std::max(memoryReq.alignment, granularity);
+        memoryReq.size = ((memoryReq.size + granularity - 1) / granularity) * granularity;
+
+        if (!m_memoryAllocator.Allocate(memoryReq, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, memory))
+        {
+            UnloadTextureImage(image, memory, imageView);
+            Logger::WriteError(m_logger, "Failed to allocate texture image memory.");
+            return false;
+        }
+
+        if (vkBindImageMemory(m_logicalDevice, image, memory.memory, memory.offset) != VK_SUCCESS)
+        {
+            UnloadTextureImage(image, memory, imageView);
+            Logger::WriteError(m_logger, "Failed to bind memory to texture image.");
+            return false;
+        }
+
+        VkImageViewCreateInfo imageViewInfo = {};
+        imageViewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        imageViewInfo.image = image;
+        imageViewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        imageViewInfo.format = texture.imageFormat;
+        imageViewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        imageViewInfo.subresourceRange.baseMipLevel = 0;
+        imageViewInfo.subresourceRange.levelCount = mipLevelCount;
+        imageViewInfo.subresourceRange.baseArrayLayer = 0;
+        imageViewInfo.subresourceRange.layerCount = 1;
+
+        if (vkCreateImageView(m_logicalDevice, &imageViewInfo, nullptr, &imageView) != VK_SUCCESS)
+        {
+            UnloadTextureImage(image, memory, imageView);
+            Logger::WriteError(m_logger, "Failed to create texture image view.");
+            return false;
+        }
+
+        if (!UploadImage(image, dimensions, texture.format, mipLevelCount, data))
+        {
+            UnloadTextureImage(image, memory, imageView);
+            return false;
+        }
+
+        // The previous image may still be used by frames in flight.
+        if (texture.image != VK_NULL_HANDLE)
+        {
+            m_retiredImages.push_back({ texture.image, texture.memory, texture.imageView, m_frameCount });
+        }
+
+        texture.image = image;
+        texture.memory = memory;
+        texture.imageView = imageView;
+        texture.residentMipLevel = firstMipLevel;
+        return true;
+    }
+
+    void VulkanRenderer::UnloadTextureImage(VkImage image, VulkanMemory& memory, VkImageView imageView)
+    {
+        if (image != VK_NULL_HANDLE)
+        {
+            CancelImageUploads(image);
+        }
+        if (imageView != VK_NULL_HANDLE)
+        {
+            vkDestroyImageView(m_logicalDevice, imageView, nullptr);
+        }
+        if (image != VK_NULL_HANDLE)
+        {
+            vkDestroyImage(m_logicalDevice, image, nullptr);
+        }
+        m_memoryAllocator.Free(memory);
+    }
+
+    void VulkanRenderer::StreamTextures()
+    {
+        MOLTEN_PROFILE_ZONE("VulkanRenderer::StreamTextures");
+
+        DestroyRetiredImages(false);
+
+        m_textureStreamer.Update(m_textureStreamRequests);
+        for (const auto& request : m_textureStreamRequests)
+        {
+            auto* vulkanTexture = static_cast<VulkanTexture*>(request.texture);
+            const size_t dataOffset = Texture::GetMipChainSize(vulkanTexture->dimensions, vulkanTexture->format, 0, request.mipLevel);
+
+            if (!LoadTextureImage(*vulkanTexture, request.mipLevel, vulkanTexture->streamData.data() + dataOffset))
+            {
+                Logger::WriteError(m_logger, "Failed to stream mip levels of texture.");
+                m_textureStreamer.Reject(vulkanTexture);
+                continue;
+            }
+
+            if (request.mipLevel == 0)
+            {
+                vulkanTexture->streamData.clear();
+                vulkanTexture->streamData.shrink_to_fit();
+            }
+        }
+    }
+
+    void VulkanRenderer::DestroyRetiredImages(const bool all)
+    {
+        // Frames recorded before the image was retired have finished once the frames in flight have wrapped around.
+        auto it = std::remove_if(m_retiredImages.begin(), m_retiredImages.end(), [&](RetiredImage& retiredImage)
+        {
+            if (!all && m_frameCount < retiredImage.frame + static_cast<uint64_t>(m_maxFramesInFlight))
+            {
+                return false;
+            }
+
+            UnloadTextureImage(retiredImage.image, retiredImage.memory, retiredImage.imageView);
+            return true;
+        });
+        m_retiredImages.erase(it, m_retiredImages.end());
+    }
+
+    void VulkanRenderer::RetireBuffer(VkBuffer buffer, VulkanMemory& memory, const bool uploadDestination)
+    {
+        // Pending uploads are canceled at once, the destination is no longer written by any later batch.
+        if (uploadDestination)
+        {
+            CancelUploads(buffer);
+        }
+        m_retiredResources.push_back({ buffer, memory, uploadDestination, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, m_frameCount });
+    }
+
+    void VulkanRenderer::RetireDescriptorSet(VkDescriptorSet descriptorSet)
+    {
+        m_retiredResources.push_back({ VK_NULL_HANDLE, {}, false, descriptorSet, VK_NULL_HANDLE, VK_NULL_HANDLE, m_frameCount });
+    }
 
-        if (m_swapChain)
+    void VulkanRenderer::RetireCommandPool(VkCommandPool commandPool)
+    {
+        m_retiredResources.push_back({ VK_NULL_HANDLE, {}, false, VK_NULL_HANDLE, commandPool, VK_NULL_HANDLE, m_frameCount });
+    }
+
+    void VulkanRenderer::RetireFramebuffer(VkFramebuffer framebuffer)
+    {
+        m_retiredResources.push_back({ VK_NULL_HANDLE, {}, false, VK_NULL_HANDLE, VK_NULL_HANDLE, framebuffer, m_frameCount });
+    }
+
+    void VulkanRenderer::DestroyRetiredResources(const bool all)
+    {
+        // Frames recorded before the resource was retired have finished once the frames in flight have wrapped around.
+        auto it = std::remove_if(m_retiredResources.begin(), m_retiredResources.end(), [&](RetiredResource& retiredResource)
         {
-            vkDestroySwapchainKHR(m_logicalDevice, m_swapChain, nullptr);
-            m_swapChain = VK_NULL_HANDLE;
-        }      
+            if (!all && m_frameCount < retiredResource.frame + static_cast<uint64_t>(m_maxFramesInFlight))
+            {
+                return false;
+            }
+
+            if (retiredResource.uploadDestination)
+            {
+                DestroyUploadDestination(retiredResource.buffer, retiredResource.memory);
+            }
+            else if (retiredResource.buffer != VK_NULL_HANDLE)
+            {
+                DestroyBuffer(retiredResource.buffer, retiredResource.memory);
+            }
+            if (retiredResource.descriptorSet != VK_NULL_HANDLE)
+            {
+                m_descriptorSetCache.Release(retiredResource.descriptorSet);
+            }
+            if (retiredResource.commandPool != VK_NULL_HANDLE)
+            {
+                vkDestroyCommandPool(m_logicalDevice, retiredResource.commandPool, nullptr);
+            }
+            if (retiredResource.framebuffer != VK_NULL_HANDLE)
+            {
+                vkDestroyFramebuffer(m_logicalDevice, retiredResource.framebuffer, nullptr);
+            }
+            return true;
+        });
+        m_retiredResources.erase(it, m_retiredResources.end());
     }
 
-    bool VulkanRenderer::FindPhysicalDeviceMemoryType(uint32_t& index, const uint32_t filter, const VkMemoryPropertyFlags properties)
+    bool VulkanRenderer::AllocateStaging(const VkDeviceSize size, VkDeviceSize& offset)
     {
-        /// < MOVE THIS CODE TO ScorePhysicalDevice....
-        VkPhysicalDeviceMemoryProperties memProperties;
-        vkGetPhysicalDeviceMemoryProperties(m_physicalDevice.device, &memProperties);
-        /// < MOVE THIS CODE TO ScorePhysicalDevice....
+        // Keep copy regions aligned, the staging ring size is a multiple of this alignment.
+        const VkDeviceSize alignedSize = (size + 15) & ~VkDeviceSize(15);
 
-        for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++)
+        while (true)
         {
-            if ((filter & (i << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties)
+            // Head and tail are never wrapped, allocations crossing the end of the ring are moved to the beginning.
+            const VkDeviceSize ringOffset = m_stagingHead % m_stagingSize;
+            const VkDeviceSize padding = ringOffset + alignedSize > m_stagingSize ? m_stagingSize - ringOffset : 0;
+            if (m_stagingHead + padding + alignedSize - m_stagingTail <= m_stagingSize)
             {
-                index = i;
+                m_stagingHead += padding;
+                offset = m_stagingHead % m_stagingSize;
+                m_stagingHead += alignedSize;
                 return true;
             }
-        }
 
-        return false;
+            if (m_stagingHead == m_stagingTail)
+            {
+                m_stagingHead = m_stagingTail = m_stagingHead + padding;
+                continue;
+            }
+
+            // Staging ring is full, submit pending copies and wait for the oldest batch to release its memory.
+            if (!FlushUploads())
+            {
+                return false;
+            }
+            if (m_submittedUploadBatches.empty())
+            {
+                Logger::WriteError(m_logger, "Staging buffer is out of memory.");
+                return false;
+            }
+            RetireUploadBatches(true);
+        }
     }
 
-    bool VulkanRenderer::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& memory)
+    bool VulkanRenderer::FlushUploads()
     {
-        VkBufferCreateInfo bufferInfo = {};
-        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        bufferInfo.size = size;
-        bufferInfo.usage = usage;
-        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        MOLTEN_PROFILE_ZONE("VulkanRenderer::FlushUploads");
+        MOLTEN_PROFILE_COUNTER("VulkanRenderer uploads", m_pendingUploads.size() + m_pendingImageUploads.size());
 
-        if (vkCreateBuffer(m_logicalDevice, &bufferInfo, nullptr, &buffer) != VK_SUCCESS)
+        if (m_pendingUploads.empty() && m_pendingImageUploads.empty())
         {
-            Logger::WriteError(m_logger, "Failed to create vertex buffer.");
-            return false;
+            return true;
         }
 
-        VkMemoryRequirements memoryReq;
-        vkGetBufferMemoryRequirements(m_logicalDevice, buffer, &memoryReq);
+        UploadBatch batch = {};
+        if (!m_freeUploadBatches.empty())
+        {
+            batch = std::move(m_freeUploadBatches.back());
+            m_freeUploadBatches.pop_back();
+        }
+        else
+        {
+            VkCommandBufferAllocateInfo commandBufferInfo = {};
+            commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            commandBufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            commandBufferInfo.commandPool = m_uploadCommandPool;
+            commandBufferInfo.commandBufferCount = 1;
+
+            if (vkAllocateCommandBuffers(m_logicalDevice, &commandBufferInfo, &batch.commandBuffer) != VK_SUCCESS)
+            {
+                Logger::WriteError(m_logger, "Failed to allocate upload command buffer.");
+                return false;
+            }
+
+            VkFenceCreateInfo fenceInfo = {};
+            fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+            if (vkCreateFence(m_logicalDevice, &fenceInfo, nullptr, &batch.fence) != VK_SUCCESS)
+            {
+                vkFreeCommandBuffers(m_logicalDevice, m_uploadCommandPool, 1, &batch.commandBuffer);
+                Logger::WriteError(m_logger, "Failed to create upload fence.");
+                return false;
+            }
+        }
 
-        uint32_t memoryTypeIndex = 0;
-        if (!FindPhysicalDeviceMemoryType(memoryTypeIndex, memoryReq.memoryTypeBits, properties))
+        VkSemaphore semaphore = VK_NULL_HANDLE;
+        if (!m_freeUploadSemaphores.empty())
         {
-            vkDestroyBuffer(m_logicalDevice, buffer, nullptr);
-            Logger::WriteError(m_logger, "Failed to find matching memory type for vertex buffer.");
-            return false;
+            semaphore = m_freeUploadSemaphores.back();
+            m_freeUploadSemaphores.pop_back();
+        }
+        else
+        {
+            VkSemaphoreCreateInfo semaphoreInfo = {};
+            semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+            if (vkCreateSemaphore(m_logicalDevice, &semaphoreInfo, nullptr, &semaphore) != VK_SUCCESS)
+            {
+                m_freeUploadBatches.push_back(std::move(batch));
+                Logger::WriteError(m_logger, "Failed to create upload semaphore.");
+                return false;
+            }
         }
 
-        VkMemoryAllocateInfo memoryAllocateInfo = {};
-        memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        memoryAllocateInfo.allocationSize = memoryReq.size;
-        memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 
-        if (vkAllocateMemory(m_logicalDevice, &memoryAllocateInfo, nullptr, &memory) != VK_SUCCESS)
+        vkBeginCommandBuffer(batch.commandBuffer, &beginInfo);
+        for (auto& upload : m_pendingUploads)
         {
-            vkDestroyBuffer(m_logicalDevice, buffer, nullptr);
-            Logger::WriteError(m_logger, "Failed to allocate vertex buffer memory.");
-            return false;
+            VkBufferCopy copy = {};
+            copy.srcOffset = upload.sourceOffset;
+            copy.dstOffset = 0;
+            copy.size = upload.size;
+            vkCmdCopyBuffer(batch.commandBuffer, upload.source, upload.destination, 1, &copy);
+        }
+        for (auto& upload : m_pendingImageUploads)
+        {
+            // Transitioned to shader read only layout on the transfer queue, frames sampling the image wait for the batch semaphore.
+            VkImageMemoryBarrier barrier = {};
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = upload.destination;
+            barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            barrier.subresourceRange.baseMipLevel = 0;
+            barrier.subresourceRange.levelCount = upload.mipLevelCount;
+            barrier.subresourceRange.baseArrayLayer = 0;
+            barrier.subresourceRange.layerCount = 1;
+
+            vkCmdPipelineBarrier(batch.commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+            vkCmdCopyBufferToImage(batch.commandBuffer, upload.source, upload.destination, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                static_cast<uint32_t>(upload.regions.size()), upload.regions.data());
+
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = 0;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+            vkCmdPipelineBarrier(batch.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                0, 0, nullptr, 0, nullptr, 1, &barrier);
         }
+        vkEndCommandBuffer(batch.commandBuffer);
+
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &batch.commandBuffer;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &semaphore;
 
-        if (vkBindBufferMemory(m_logicalDevice, buffer, memory, 0) != VK_SUCCESS)
+        vkResetFences(m_logicalDevice, 1, &batch.fence);
+        if (vkQueueSubmit(m_transferQueue, 1, &submitInfo, batch.fence) != VK_SUCCESS)
         {
-            vkDestroyBuffer(m_logicalDevice, buffer, nullptr);
-            vkFreeMemory(m_logicalDevice, memory, nullptr);
-            Logger::WriteError(m_logger, "Failed to bind memory to vertex buffer.");
+            m_freeUploadSemaphores.push_back(semaphore);
+            m_freeUploadBatches.push_back(std::move(batch));
+            Logger::WriteError(m_logger, "Failed to submit upload command buffer.");
             return false;
         }
 
+        batch.stagingEnd = m_stagingHead;
+        batch.temporaryBuffers = std::move(m_pendingTemporaryBuffers);
+        m_pendingTemporaryBuffers.clear();
+        m_submittedUploadBatches.push_back(std::move(batch));
+        m_uploadWaitSemaphores.push_back(semaphore);
+        m_pendingUploads.clear();
+        m_pendingImageUploads.clear();
         return true;
     }
 
-    void VulkanRenderer::CopyBuffer(VkBuffer source, VkBuffer destination, VkDeviceSize size)
+    void VulkanRenderer::RetireUploadBatches(const bool waitForOldest)
     {
-        VkCommandBufferAllocateInfo commandBufferInfo = {};
-        commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        commandBufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        commandBufferInfo.commandPool = m_commandPool;
-        commandBufferInfo.commandBufferCount = 1;
+        if (waitForOldest && !m_submittedUploadBatches.empty())
+        {
+            vkWaitForFences(m_logicalDevice, 1, &m_submittedUploadBatches.front().fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+        }
 
-        VkCommandBuffer commandBuffer;
-        vkAllocateCommandBuffers(m_logicalDevice, &commandBufferInfo, &commandBuffer);
+        // Batches are submitted to a single queue and complete in order.
+        while (!m_submittedUploadBatches.empty())
+        {
+            auto& batch = m_submittedUploadBatches.front();
+            if (vkGetFenceStatus(m_logicalDevice, batch.fence) != VK_SUCCESS)
+            {
+                break;
+            }
 
-        VkCommandBufferBeginInfo beginInfo = {};
-        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            m_stagingTail = batch.stagingEnd;
+            for (auto& temporaryBuffer : batch.temporaryBuffers)
+            {
+                DestroyBuffer(temporaryBuffer.buffer, temporaryBuffer.memory);
+            }
+            batch.temporaryBuffers.clear();
+            for (auto& destroyedBuffer : batch.destroyedBuffers)
+            {
+                DestroyBuffer(destroyedBuffer.buffer, destroyedBuffer.memory);
+            }
+            batch.destroyedBuffers.clear();
 
-        vkBeginCommandBuffer(commandBuffer, &beginInfo);
-        VkBufferCopy copy = {};
-        copy.srcOffset = 0;
-        copy.dstOffset = 0;
-        copy.size = size;
-        vkCmdCopyBuffer(commandBuffer, source, destination, 1, &copy);
-        vkEndCommandBuffer(commandBuffer);
+            m_freeUploadBatches.push_back(std::move(batch));
+            m_submittedUploadBatches.pop_front();
+        }
+    }
 
-        VkSubmitInfo submitInfo = {};
-        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &commandBuffer;
-        // USE FENCE?
-        vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
-        vkQueueWaitIdle(m_graphicsQueue);
+    void VulkanRenderer::RecycleUploadSemaphores(const size_t frameIndex)
+    {
+        if (frameIndex >= m_frameUploadSemaphores.size())
+        {
+            return;
+        }
+
+        auto& frameUploadSemaphores = m_frameUploadSemaphores[frameIndex];
+        m_freeUploadSemaphores.insert(m_freeUploadSemaphores.end(), frameUploadSemaphores.begin(), frameUploadSemaphores.end());
+        frameUploadSemaphores.clear();
+    }
+
+    bool VulkanRenderer::BeginTimestampFrame()
+    {
+        while (m_timestampFrames.size() <= static_cast<size_t>(m_currentImageIndex))
+        {
+            m_timestampFrames.push_back({ VK_NULL_HANDLE, 0, {} });
+        }
+
+        auto& timestampFrame = m_timestampFrames[m_currentImageIndex];
+        if (!m_timestampSupport)
+        {
+            timestampFrame.queryCount = 0;
+            timestampFrame.markers.clear();
+            return true;
+        }
+
+        if (timestampFrame.queryPool == VK_NULL_HANDLE)
+        {
+            VkQueryPoolCreateInfo queryPoolInfo = {};
+            queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+            queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+            queryPoolInfo.queryCount = m_maxTimestampQueries;
 
-        vkFreeCommandBuffers(m_logicalDevice, m_commandPool, 1, &commandBuffer);
+            if (vkCreateQueryPool(m_logicalDevice, &queryPoolInfo, nullptr, &timestampFrame.queryPool) != VK_SUCCESS)
+            {
+                Logger::WriteError(m_logger, "Failed to create timestamp query pool.");
+                return false;
+            }
+        }
+        else
+        {
+            ReadTimestampFrame(timestampFrame);
+        }
+
+        timestampFrame.queryCount = 2;
+        timestampFrame.markers.clear();
+
+        vkCmdResetQueryPool(*m_currentCommandBuffer, timestampFrame.queryPool, 0, m_maxTimestampQueries);
+        vkCmdWriteTimestamp(*m_currentCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestampFrame.queryPool, 0);
+        return true;
+    }
+
+    void VulkanRenderer::ReadTimestampFrame(TimestampFrame& timestampFrame)
+    {
+        if (timestampFrame.queryCount == 0)
+        {
+            return;
+        }
+
+        // Queries of frames whose submission failed are never written, results are skipped if not available.
+        std::vector<uint64_t> timestamps(timestampFrame.queryCount, 0);
+        if (vkGetQueryPoolResults(m_logicalDevice, timestampFrame.queryPool, 0, timestampFrame.queryCount,
+            timestamps.size() * sizeof(uint64_t), timestamps.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT) != VK_SUCCESS)
+        {
+            return;
+        }
+
+        const double timestampPeriod = static_cast<double>(m_physicalDevice.properties.limits.timestampPeriod);
+        auto getDuration = [&](const uint32_t beginQuery, const uint32_t endQuery)
+        {
+            const uint64_t ticks = timestamps[endQuery] > timestamps[beginQuery] ? timestamps[endQuery] - timestamps[beginQuery] : 0;
+            return Nanoseconds(static_cast<double>(ticks) * timestampPeriod);
+        };
+
+        m_frameProfiler.AddSample(FrameProfiler::Domain::Gpu, "Frame", getDuration(0, 1));
+        for (auto& marker : timestampFrame.markers)
+        {
+            m_frameProfiler.AddSample(FrameProfiler::Domain::Gpu, marker.name, getDuration(marker.beginQuery, marker.endQuery));
+        }
+    }
+
+    void VulkanRenderer::EndTimestampFrame()
+    {
+        auto& timestampFrame = m_timestampFrames[m_currentImageIndex];
+        if (timestampFrame.queryCount == 0)
+        {
+            return;
+        }
+
+        vkCmdWriteTimestamp(*m_currentCommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestampFrame.queryPool, 1);
+    }
+
+    void VulkanRenderer::UnloadTimestampFrames()
+    {
+        for (auto& timestampFrame : m_timestampFrames)
+        {
+            if (timestampFrame.queryPool)
+            {
+                vkDestroyQueryPool(m_logicalDevice, timestampFrame.queryPool, nullptr);
+            }
+        }
+        m_timestampFrames.clear();
     }
 
     bool VulkanRenderer::CreateVertexInputAttributes(
         const Shader::Visual::InputStructure& inputs,
-        std::vector<VkVertexInputAttributeDescription>& attributes, 
+        const uint32_t binding,
+        std::vector<VkVertexInputAttributeDescription>& attributes,
+        uint32_t& location,
         uint32_t& stride)
     {
-        attributes.resize(inputs.GetMemberCount());
-        size_t index = 0;
-        uint32_t location = 0;
-
         for (auto* inputNode : inputs.GetMembers())
         {
             for (auto* outputPin : inputNode->GetOutputPins())
@@ -2007,14 +4908,22 @@ namespace Molten
                     return false;
                 }
 
-                auto& attribute = attributes[index++];
-                attribute.binding = 0;
-                attribute.location = location;
-                attribute.offset = stride;
-                attribute.format = format;
+                // Matrices are passed as one attribute per column, each consuming a location.
+                const uint32_t columnCount = outputPin->GetDataType() == Shader::VariableDataType::Matrix4x4f32 ? 4 : 1;
+                const uint32_t columnSize = formatSize / columnCount;
 
-                location++;
-                stride += formatSize;
+                for (uint32_t i = 0; i < columnCount; i++)
+                {
+                    VkVertexInputAttributeDescription attribute;
+                    attribute.binding = binding;
+                    attribute.location = location;
+                    attribute.offset = stride;
+                    attribute.format = format;
+                    attributes.push_back(attribute);
+
+                    location++;
+                    stride += columnSize;
+                }
             }
         }
         return true;
@@ -2022,7 +4931,8 @@ namespace Molten
 
     bool VulkanRenderer::CreateDescriptorSetLayouts(
         const std::vector<Shader::Visual::Script*>& visualScripts, 
-        std::vector<VkDescriptorSetLayout>& setLayouts)
+        std::vector<VkDescriptorSetLayout>& setLayouts,
+        std::vector<VulkanDescriptorCounts>& setDescriptorCounts)
     {
         std::map<uint32_t, VkShaderStageFlags> uniformShaderStageFlags;
         uint32_t highestSetId = 0;
@@ -2054,6 +4964,7 @@ namespace Molten
         }
 
         setLayouts.clear();
+        setDescriptorCounts.clear();
         for (auto& pair : uniformShaderStageFlags)
         {
             auto stageFlags = pair.second;
@@ -2077,7 +4988,11 @@ namespace Molten
                 return false;
             }
 
+            VulkanDescriptorCounts descriptorCounts;
+            descriptorCounts.Add(binding.descriptorType, binding.descriptorCount);
+
             setLayouts.push_back(descriptorSetLayout);
+            setDescriptorCounts.push_back(descriptorCounts);
         }
         return true;
     }
@@ -2098,39 +5013,66 @@ namespace Molten
             return false;
         }
 
-        shaderStageCreateInfos.reserve(visualScripts.size());
-        shaderModules.reserve(visualScripts.size());
-
         auto& pushConstantTemplate = glslTemplates.pushConstantTemplate;
 
-        for(size_t i = 0; i < visualScripts.size(); i++)
+        std::vector<std::vector<uint8_t>> glslCodes(visualScripts.size());
+        for (size_t i = 0; i < visualScripts.size(); i++)
         {
-            auto* script = visualScripts[i];
-            auto scriptType = script->GetType();
-
             Shader::VulkanGenerator::GlslStageTemplates stageTemplate;
             stageTemplate.pushConstantTemplate.blockSource = &pushConstantTemplate.blockSource;
             stageTemplate.pushConstantTemplate.offsets = &pushConstantTemplate.stageOffsets[i];
 
-            auto glslCode = Shader::VulkanGenerator::GenerateGlsl(*script, &stageTemplate, m_logger);
-            if (!glslCode.size())
+            glslCodes[i] = Shader::VulkanGenerator::GenerateGlsl(*visualScripts[i], &stageTemplate, m_logger);
+            if (!glslCodes[i].size())
             {
                 Logger::WriteError(m_logger, "Failed to generate GLSL code.");
-                return nullptr;
+                return false;
+            }
+        }
+
+        // Stages are compiled in parallel, unless already running as an asynchronous pipeline task of the pool.
+        std::vector<std::vector<uint8_t>> spirvCodes(visualScripts.size());
+        if (visualScripts.size() > 1 && !m_threadPool.IsWorkerThread())
+        {
+            std::vector<std::future<std::vector<uint8_t>>> stageFutures;
+            for (size_t i = 1; i < visualScripts.size(); i++)
+            {
+                stageFutures.push_back(m_threadPool.Execute([this, &glslCodes, &visualScripts, i]()
+                {
+                    return CompileShaderStage(glslCodes[i], visualScripts[i]->GetType());
+                }));
+            }
+
+            spirvCodes[0] = CompileShaderStage(glslCodes[0], visualScripts[0]->GetType());
+            for (size_t i = 0; i < stageFutures.size(); i++)
+            {
+                spirvCodes[i + 1] = stageFutures[i].get();
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < visualScripts.size(); i++)
+            {
+                spirvCodes[i] = CompileShaderStage(glslCodes[i], visualScripts[i]->GetType());
             }
+        }
+
+        shaderStageCreateInfos.reserve(visualScripts.size());
+        shaderModules.reserve(visualScripts.size());
 
-            auto sprivCode = Shader::VulkanGenerator::ConvertGlslToSpriV(glslCode, scriptType, m_logger);
-            if (!sprivCode.size())
+        for (size_t i = 0; i < visualScripts.size(); i++)
+        {
+            if (!spirvCodes[i].size())
             {
                 Logger::WriteError(m_logger, "Failed to convert GLSL to SPIR-V.");
-                return nullptr;
+                return false;
             }
 
-            auto shaderModule = CreateShaderModule(sprivCode);
+            auto shaderModule = CreateShaderModule(spirvCodes[i]);
             if (shaderModule == VK_NULL_HANDLE)
             {
                 Logger::WriteError(m_logger, "Failed to create shader module.");
-                return nullptr;
+                return false;
             }
             shaderModules.push_back(shaderModule);
 
@@ -2138,7 +5080,7 @@ namespace Molten
             stageCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
             stageCreateInfo.pName = "main";
             stageCreateInfo.module = shaderModule;
-            stageCreateInfo.stage = GetShaderProgramStageFlag(scriptType);
+            stageCreateInfo.stage = GetShaderProgramStageFlag(visualScripts[i]->GetType());
             shaderStageCreateInfos.push_back(stageCreateInfo);
         }
 
@@ -2155,6 +5097,116 @@ namespace Molten
         return true;
     }
 
+    std::vector<uint8_t> VulkanRenderer::CompileShaderStage(const std::vector<uint8_t>& glslCode, const Shader::Type shaderType)
+    {
+        const auto cacheKey = Shader::SpirvCache::CreateKey(glslCode, shaderType);
+
+        std::vector<uint8_t> spirvCode;
+        if (m_spirvCache.Load(cacheKey, spirvCode))
+        {
+            return spirvCode;
+        }
+
+        spirvCode = Shader::VulkanGenerator::ConvertGlslToSpriV(glslCode, shaderType, m_logger);
+        if (spirvCode.size())
+        {
+            m_spirvCache.Store(cacheKey, spirvCode);
+        }
+        return spirvCode;
+    }
+
+    VulkanCommandBuffer* VulkanRenderer::GetInlineCommandBuffer()
+    {
+        if (m_currentInlineCommandBuffer)
+        {
+            return m_currentInlineCommandBuffer;
+        }
+
+        if (m_inlineCommandBufferIndex >= m_inlineCommandBuffers.size())
+        {
+            auto* commandBuffer = static_cast<VulkanCommandBuffer*>(CreateCommandBuffer());
+            if (!commandBuffer)
+            {
+                return nullptr;
+            }
+            m_inlineCommandBuffers.push_back(commandBuffer);
+        }
+
+        auto* commandBuffer = m_inlineCommandBuffers[m_inlineCommandBufferIndex];
+        if (!commandBuffer->Begin(m_boundFramebuffer))
+        {
+            return nullptr;
+        }
+
+        ++m_inlineCommandBufferIndex;
+        m_currentInlineCommandBuffer = commandBuffer;
+        return commandBuffer;
+    }
+
+    void VulkanRenderer::EndInlineCommandBuffer()
+    {
+        if (!m_currentInlineCommandBuffer)
+        {
+            return;
+        }
+
+        m_currentInlineCommandBuffer->End();
+        if (m_currentInlineCommandBuffer->currentCommandBuffer != VK_NULL_HANDLE)
+        {
+            GetExecuteCommandBuffers().push_back(m_currentInlineCommandBuffer->currentCommandBuffer);
+            m_frameBindStatistics += m_currentInlineCommandBuffer->bindStateCache.GetStatistics();
+        }
+        m_currentInlineCommandBuffer = nullptr;
+    }
+
+    std::vector<VkCommandBuffer>& VulkanRenderer::GetExecuteCommandBuffers()
+    {
+        return m_boundFramebuffer ? m_boundFramebuffer->executeCommandBuffers : m_executeCommandBuffers;
+    }
+
+    VkCommandBuffer VulkanRenderer::GetComputeCommandBuffer()
+    {
+        if (m_currentComputeCommandBuffer != VK_NULL_HANDLE)
+        {
+            return m_currentComputeCommandBuffer;
+        }
+
+        // Compute command buffers are reused by the same swap chain image, which fence is waited for in BeginDraw.
+        const size_t imageIndex = static_cast<size_t>(m_currentImageIndex);
+        if (imageIndex >= m_computeCommandBuffers.size())
+        {
+            const size_t firstCommandBuffer = m_computeCommandBuffers.size();
+            m_computeCommandBuffers.resize(imageIndex + 1, VK_NULL_HANDLE);
+
+            VkCommandBufferAllocateInfo commandBufferInfo = {};
+            commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            commandBufferInfo.commandPool = m_commandPool;
+            commandBufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            commandBufferInfo.commandBufferCount = static_cast<uint32_t>(m_computeCommandBuffers.size() - firstCommandBuffer);
+
+            if (vkAllocateCommandBuffers(m_logicalDevice, &commandBufferInfo, m_computeCommandBuffers.data() + firstCommandBuffer) != VK_SUCCESS)
+            {
+                m_computeCommandBuffers.resize(firstCommandBuffer);
+                Logger::WriteError(m_logger, "Failed to allocate compute command buffers.");
+                return VK_NULL_HANDLE;
+            }
+        }
+
+        VkCommandBufferBeginInfo commandBufferBeginInfo = {};
+        commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        const VkCommandBuffer commandBuffer = m_computeCommandBuffers[imageIndex];
+        if (vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo) != VK_SUCCESS)
+        {
+            Logger::WriteError(m_logger, "Failed to begin recording compute command buffer.");
+            return VK_NULL_HANDLE;
+        }
+
+        m_currentComputeCommandBuffer = commandBuffer;
+        return commandBuffer;
+    }
+
     VkShaderModule VulkanRenderer::CreateShaderModule(const std::vector<uint8_t>& spirvCode)
     {
         VkShaderModuleCreateInfo shaderModuleInfo = {};
@@ -42,7 +42,8 @@ namespace Molten
             m_windowSize { 0, 0 },
             m_rotationMatrix(Matrix3x3f32::Identity()),
             m_projectionMatrix(Matrix4x4f32::Identity()),
-            m_viewMatrix(Matrix4x4f32::Identity())
+            m_viewMatrix(Matrix4x4f32::Identity()),
+            m_frustum()
         { }
 
         Camera::~Camera()
@@ -50,6 +51,8 @@ namespace Molten
 
         void Camera::PostProcess()
         {
+            const bool frustumUpdated = m_projectionUpdated || m_viewUpdated;
+
             if (m_projectionUpdated)
             {
                 m_projectionUpdated = false;
@@ -113,7 +116,12 @@ namespace Molten
                 up = rotUp * m_rotationMatrix * up;
 
                 m_viewMatrix = Matrix4x4f32::LookAtDirection(m_position, m_direction, up);
-            }                   
+            }
+
+            if (frustumUpdated)
+            {
+                m_frustum = Frustum::FromViewProjection(m_projectionMatrix * m_viewMatrix);
+            }
         }
 
         void Camera::AddYaw(const Angle angle)
@@ -204,6 +212,11 @@ namespace Molten
             return m_viewMatrix;
         }
 
+        const Frustum& Camera::GetFrustum() const
+        {
+            return m_frustum;
+        }
+
         void Camera::SetPosition(const Vector3f32& position)
         {
             if (m_position != position)
@@ -29,6 +29,9 @@
 
 #if MOLTEN_PLATFORM == MOLTEN_PLATFORM_WINDOWS
 #include "Molten/Platform/Win32Headers.hpp"
+#else
+#include <sys/stat.h>
+#include <cstdio>
 #endif
 
 namespace Molten
@@ -55,6 +58,18 @@ namespace Molten
         return data;
     }
 
+    bool FileSystem::WriteFile(const std::string& filename, const void* data, const size_t dataSize)
+    {
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(data), dataSize);
+        return file.good();
+    }
+
 #if MOLTEN_PLATFORM == MOLTEN_PLATFORM_WINDOWS
 
     bool FileSystem::MakeDirectory(const std::string& directory)
@@ -85,14 +100,14 @@ namespace Molten
 
 #else
 
-    bool FileSystem::MakeDirectory(const std::string&)
+    bool FileSystem::MakeDirectory(const std::string& directory)
     {
-        return false;
+        return mkdir(directory.c_str(), 0755) == 0;
     }
 
-    bool FileSystem::DeleteFile(const std::string&)
+    bool FileSystem::DeleteFile(const std::string& filename)
     {
-        return false;
+        return std::remove(filename.c_str()) == 0;
     }
     
 #endif  
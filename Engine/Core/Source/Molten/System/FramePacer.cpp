@@ -0,0 +1,85 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/System/FramePacer.hpp"
+#include <thread>
+
+namespace Molten
+{
+
+    FramePacer::FramePacer(const Time frameTime) :
+        m_frameTime(frameTime),
+        m_clock()
+    {}
+
+    void FramePacer::SetFrameTime(const Time frameTime)
+    {
+        m_frameTime = frameTime;
+        m_clock.Reset();
+    }
+
+    void FramePacer::SetFrameRate(const double framesPerSecond)
+    {
+        SetFrameTime(framesPerSecond > 0.0 ? Seconds(1.0 / framesPerSecond) : Time::Zero);
+    }
+
+    Time FramePacer::GetFrameTime() const
+    {
+        return m_frameTime;
+    }
+
+    Time FramePacer::Wait()
+    {
+        if (m_frameTime <= Time::Zero)
+        {
+            return Time::Zero;
+        }
+
+        const Time startTime = m_clock.GetTime();
+
+        // Sleeping is coarse, the last millisecond is spent yielding.
+        const Time spinTime = Milliseconds(1);
+        Time currentTime = startTime;
+        while (currentTime < m_frameTime)
+        {
+            const Time remainingTime = m_frameTime - currentTime;
+            if (remainingTime > spinTime)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds((remainingTime - spinTime).AsMicroseconds<int64_t>()));
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+            currentTime = m_clock.GetTime();
+        }
+
+        const Time overshoot = currentTime - m_frameTime;
+        m_clock.Reset(overshoot < m_frameTime ? overshoot : Time::Zero);
+
+        return currentTime > startTime ? currentTime - startTime : Time::Zero;
+    }
+
+}
\ No newline at end of file
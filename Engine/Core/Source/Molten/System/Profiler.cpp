@@ -0,0 +1,335 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/System/Profiler.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Molten
+{
+
+    // Static helper functions and types.
+    namespace
+    {
+
+        enum class EventType : uint8_t
+        {
+            Begin,
+            End,
+            Counter
+        };
+
+        struct Event
+        {
+            EventType type;
+            const char* name;
+            uint64_t timestamp;
+            double value;
+        };
+
+        /** Single producer ring buffer of a thread, consumed while holding the registry mutex. */
+        struct ThreadBuffer
+        {
+            explicit ThreadBuffer(const uint32_t threadId) :
+                threadId(threadId),
+                threadName(),
+                released(false),
+                events(new Event[Profiler::ThreadBufferCapacity]),
+                head(0),
+                tail(0),
+                dropped(0),
+                openZones(0),
+                skippedZones(0)
+            {}
+
+            uint32_t threadId;
+            std::string threadName;
+            bool released; ///< Owning thread has exited, buffer is reusable when consumed.
+            std::unique_ptr<Event[]> events;
+            std::atomic<size_t> head;
+            std::atomic<size_t> tail;
+            std::atomic<size_t> dropped;
+            size_t openZones; ///< Recorded begin events without end event, a slot is reserved for each of their end events.
+            size_t skippedZones; ///< Nesting depth of zones dropped as a whole, their end events are dropped as well.
+        };
+
+        struct Registry
+        {
+            Registry() :
+                epoch(std::chrono::steady_clock::now()),
+                nextThreadId(1)
+            {}
+
+            std::mutex mutex;
+            std::chrono::steady_clock::time_point epoch;
+            std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+            uint32_t nextThreadId;
+        };
+
+        Registry& GetRegistry()
+        {
+            static Registry registry;
+            return registry;
+        }
+
+        /** Owner of the buffer of a thread, releasing it for reuse by later threads at thread exit. */
+        struct ThreadBufferOwner
+        {
+            ThreadBufferOwner() :
+                buffer(nullptr)
+            {
+                auto& registry = GetRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+
+                for (auto& registeredBuffer : registry.buffers)
+                {
+                    if (registeredBuffer->released &&
+                        registeredBuffer->head.load(std::memory_order_relaxed) == registeredBuffer->tail.load(std::memory_order_relaxed))
+                    {
+                        buffer = registeredBuffer.get();
+                        buffer->threadId = registry.nextThreadId++;
+                        buffer->threadName.clear();
+                        buffer->released = false;
+                        buffer->openZones = 0;
+                        buffer->skippedZones = 0;
+                        return;
+                    }
+                }
+
+                registry.buffers.push_back(std::make_unique<ThreadBuffer>(registry.nextThreadId++));
+                buffer = registry.buffers.back().get();
+            }
+
+            ~ThreadBufferOwner()
+            {
+                auto& registry = GetRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                buffer->released = true;
+            }
+
+            ThreadBuffer* buffer;
+        };
+
+        ThreadBuffer& GetThreadBuffer()
+        {
+            thread_local ThreadBufferOwner owner;
+            return *owner.buffer;
+        }
+
+        /** Push event to ring of thread, if there is room left besides reservedCount slots. */
+        bool PushEvent(ThreadBuffer& buffer, const EventType type, const char* name, const double value, const size_t reservedCount)
+        {
+            static const auto epoch = GetRegistry().epoch;
+            const auto timestamp = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+
+            const size_t head = buffer.head.load(std::memory_order_relaxed);
+            if (head - buffer.tail.load(std::memory_order_acquire) + reservedCount >= Profiler::ThreadBufferCapacity)
+            {
+                return false;
+            }
+
+            buffer.events[head % Profiler::ThreadBufferCapacity] = { type, name, timestamp, value };
+            buffer.head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        void WriteJsonString(std::ostream& stream, const char* string)
+        {
+            stream << '"';
+            for (const char* character = string; *character != '\0'; ++character)
+            {
+                const auto value = static_cast<unsigned char>(*character);
+                if (*character == '"' || *character == '\\')
+                {
+                    stream << '\\' << *character;
+                }
+                else if (value < 0x20)
+                {
+                    static const char hexDigits[] = "0123456789abcdef";
+                    stream << "\\u00" << hexDigits[value >> 4] << hexDigits[value & 0x0F];
+                }
+                else
+                {
+                    stream << *character;
+                }
+            }
+            stream << '"';
+        }
+
+        void WriteTimestamp(std::ostream& stream, const uint64_t timestamp)
+        {
+            const uint64_t fraction = timestamp % 1000;
+            stream << timestamp / 1000 << '.' << (fraction / 100) << ((fraction / 10) % 10) << (fraction % 10);
+        }
+
+    }
+
+
+    // Profiler zone implementations.
+    Profiler::Zone::Zone(const char* name)
+    {
+        BeginZone(name);
+    }
+
+    Profiler::Zone::~Zone()
+    {
+        EndZone();
+    }
+
+
+    // Profiler implementations.
+    void Profiler::BeginZone(const char* name)
+    {
+        // Zones are dropped as a whole, including nested zones, keeping begin and end events of the trace balanced.
+        // A begun zone reserves the slot of its end event, so recorded zones are always ended.
+        auto& buffer = GetThreadBuffer();
+        if (buffer.skippedZones || !PushEvent(buffer, EventType::Begin, name, 0.0, buffer.openZones + 1))
+        {
+            ++buffer.skippedZones;
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        ++buffer.openZones;
+    }
+
+    void Profiler::EndZone()
+    {
+        auto& buffer = GetThreadBuffer();
+        if (buffer.skippedZones)
+        {
+            --buffer.skippedZones;
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        buffer.openZones -= buffer.openZones ? 1 : 0;
+        if (!PushEvent(buffer, EventType::End, "", 0.0, 0))
+        {
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void Profiler::AddCounter(const char* name, const double value)
+    {
+        auto& buffer = GetThreadBuffer();
+        if (!PushEvent(buffer, EventType::Counter, name, value, buffer.openZones))
+        {
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void Profiler::SetThreadName(const std::string& name)
+    {
+        auto& buffer = GetThreadBuffer();
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        buffer.threadName = name;
+    }
+
+    size_t Profiler::GetDroppedEventCount()
+    {
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        size_t dropped = 0;
+        for (auto& buffer : registry.buffers)
+        {
+            dropped += buffer->dropped.load(std::memory_order_relaxed);
+        }
+        return dropped;
+    }
+
+    void Profiler::WriteChromeTrace(std::ostream& stream)
+    {
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        stream << "{\"traceEvents\":[";
+        bool first = true;
+        auto beginEvent = [&]()
+        {
+            stream << (first ? "\n" : ",\n");
+            first = false;
+        };
+
+        for (auto& buffer : registry.buffers)
+        {
+            if (!buffer->threadName.empty())
+            {
+                beginEvent();
+                stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"args\":{\"name\":";
+                WriteJsonString(stream, buffer->threadName.c_str());
+                stream << "}}";
+            }
+
+            const size_t tail = buffer->tail.load(std::memory_order_relaxed);
+            const size_t head = buffer->head.load(std::memory_order_acquire);
+            for (size_t i = tail; i < head; i++)
+            {
+                const auto& event = buffer->events[i % ThreadBufferCapacity];
+
+                beginEvent();
+                stream << "{\"name\":";
+                WriteJsonString(stream, event.name);
+                switch (event.type)
+                {
+                    case EventType::Begin: stream << ",\"ph\":\"B\""; break;
+                    case EventType::End: stream << ",\"ph\":\"E\""; break;
+                    case EventType::Counter: stream << ",\"ph\":\"C\""; break;
+                }
+                stream << ",\"ts\":";
+                WriteTimestamp(stream, event.timestamp);
+                stream << ",\"pid\":1,\"tid\":" << buffer->threadId;
+                if (event.type == EventType::Counter)
+                {
+                    stream << ",\"args\":{\"value\":" << event.value << "}";
+                }
+                stream << "}";
+            }
+
+            buffer->tail.store(head, std::memory_order_release);
+            buffer->dropped.store(0, std::memory_order_relaxed);
+        }
+
+        stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    void Profiler::Clear()
+    {
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        for (auto& buffer : registry.buffers)
+        {
+            buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+            buffer->dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Molten/System/ThreadPool.hpp"
+#include "Molten/System/Profiler.hpp"
+#include <algorithm>
+
+namespace Molten
+{
+
+    ThreadPool::ThreadPool(const size_t threadCount) :
+        m_activeCount(0),
+        m_stop(false)
+    {
+        const size_t count = threadCount ? threadCount : std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t(1));
+        m_threads.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            m_threads.emplace_back(&ThreadPool::Work, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    void ThreadPool::Wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_idleCondition.wait(lock, [&]() { return m_tasks.empty() && m_activeCount == 0; });
+    }
+
+    size_t ThreadPool::GetThreadCount() const
+    {
+        return m_threads.size();
+    }
+
+    bool ThreadPool::IsWorkerThread() const
+    {
+        const auto threadId = std::this_thread::get_id();
+        return std::find_if(m_threads.begin(), m_threads.end(), [&](const std::thread& thread)
+        {
+            return thread.get_id() == threadId;
+        }) != m_threads.end();
+    }
+
+    void ThreadPool::Push(std::function<void()>&& task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.push_back(std::move(task));
+        }
+        m_condition.notify_one();
+    }
+
+    void ThreadPool::Work()
+    {
+        MOLTEN_PROFILE_THREAD_NAME("ThreadPool worker");
+
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [&]() { return m_stop || !m_tasks.empty(); });
+
+                // Remaining tasks are finished before stopping.
+                if (m_tasks.empty())
+                {
+                    return;
+                }
+
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+                ++m_activeCount;
+            }
+
+            task();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                --m_activeCount;
+                if (m_tasks.empty() && m_activeCount == 0)
+                {
+                    m_idleCondition.notify_all();
+                }
+            }
+        }
+    }
+
+}
\ No newline at end of file
@@ -32,6 +32,7 @@
 #include "Molten/Renderer/Shader/Visual/VisualShaderScript.hpp"
 #include "Molten/Scene/Camera.hpp"
 #include "Molten/System/Clock.hpp"
+#include "Molten/System/FramePipeline.hpp"
 #include "Molten/Window/Window.hpp"
 #include "Molten/Gui/Canvas.hpp"
 #include <memory>
@@ -56,6 +57,14 @@ namespace Molten::Editor
 
     private:
 
+        /** State of frame, passed from simulation to the render thread. */
+        struct FrameState
+        {
+            Matrix4x4f32 projViewMatrix;
+            Vector2ui32 windowSize;
+            Time inputTime;
+        };
+
         void Load();
         void LoadGui();
 
@@ -68,11 +77,12 @@ namespace Molten::Editor
 
         bool Update();
 
-        void Draw();            
+        void Draw(const FrameState& frameState);
 
-        Logger m_logger;
+        Logger m_logger; ///< Shared by the simulation and render threads, writes are serialized by the logger.
         std::unique_ptr<Window> m_window;
         std::unique_ptr <Renderer> m_renderer;
+        std::unique_ptr<FramePipeline<FrameState>> m_framePipeline;
         Pipeline* m_pipeline;
         Shader::Visual::VertexScript m_vertexScript;
         Shader::Visual::FragmentScript m_fragmentScript;
@@ -71,6 +71,12 @@ namespace Molten
                 return -1;
             }          
 
+            // Simulation of the next frame overlaps rendering of the current frame.
+            m_framePipeline = std::make_unique<FramePipeline<FrameState>>([&](const FrameState& frameState)
+            {
+                Draw(frameState);
+            }, 2);
+
             m_window->Show();
             m_deltaTimer.Reset();
             while (m_window->IsOpen())
@@ -78,6 +84,7 @@ namespace Molten
                 Tick();
             }
 
+            m_framePipeline.reset();
             return 0;
         }
 
@@ -108,12 +115,14 @@ namespace Molten
                 m_logger.Write(Logger::Severity::Info, "Changed scale: " + std::to_string(scale.x) + ", " + std::to_string(scale.y));
             });
 
+            // Rendering is made by the render thread of the frame pipeline, requiring a backend not bound to the opening thread.
             m_renderer = std::unique_ptr<Renderer>(Renderer::Create(Renderer::BackendApi::Vulkan));
             if (!m_renderer)
             {
                 throw Exception("Failed to create Vulkan renderer.");
             }
 
+            m_renderer->SetCacheDirectory("Cache");
             if (!m_renderer->Open(*m_window, Version(1, 1), &m_logger))
             {
                 throw Exception("Failed to open Vulkan renderer.");
@@ -353,6 +362,7 @@ namespace Molten
 
         void Application::Unload()
         {
+            m_framePipeline.reset();
             m_guiCanvas.Unload();
 
             if (m_renderer)
@@ -400,11 +410,25 @@ namespace Molten
             m_deltaTime = m_deltaTimer.GetTime().AsSeconds<float>();
             m_deltaTimer.Reset();
 
-            if (!Update())
+            const Time inputTime = Time::GetSystemTime();
+
+            if (!Update() || !m_framePipeline)
             {
                 return;
             }
-            Draw();
+
+            const auto windowSize = m_window->GetSize();
+            if (!windowSize.x || !windowSize.y)
+            {
+                std::this_thread::sleep_for(std::chrono::duration<double>(0.01f));
+                return;
+            }
+
+            auto& frameState = m_framePipeline->BeginFrame();
+            frameState.projViewMatrix = m_camera.GetProjectionMatrix() * m_camera.GetViewMatrix();
+            frameState.windowSize = windowSize;
+            frameState.inputTime = inputTime;
+            m_framePipeline->EndFrame();
         }
 
         bool Application::Update()
@@ -481,27 +505,22 @@ namespace Molten
 
             m_camera.PostProcess();
 
-            m_guiCanvas.Update();
-
             return true;
         }
 
-        void Application::Draw()
+        void Application::Draw(const FrameState& frameState)
         {
-            auto windowSize = m_window->GetSize();
-            if (!windowSize.x || !windowSize.y)
-            {
-                std::this_thread::sleep_for(std::chrono::duration<double>(0.01f));
-                return;
-            }
+            // The canvas is only used by the render thread.
+            m_guiCanvas.Update();
 
-            m_renderer->Resize(windowSize);
+            m_renderer->Resize(frameState.windowSize);
 
             m_renderer->BeginDraw();
+            m_renderer->SetFrameInputTime(frameState.inputTime);
 
             m_renderer->BindPipeline(m_pipeline);
 
-            const auto projViewMatrix = m_camera.GetProjectionMatrix() * m_camera.GetViewMatrix();
+            const auto& projViewMatrix = frameState.projViewMatrix;
 
             struct UniformBuffer
             {
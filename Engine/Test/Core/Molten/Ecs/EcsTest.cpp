@@ -26,6 +26,7 @@
 #include "Test.hpp"
 #include "Molten/Ecs/EcsContext.hpp"
 #include "Molten/Math/Vector.hpp"
+#include "Molten/System/ThreadPool.hpp"
 #include <type_traits>
 #include <string>
 
@@ -1114,6 +1115,93 @@ namespace Molten
            
         }
 
+        TEST(ECS, Hierarchy)
+        {
+            TestContext context;
+
+            auto root = context.CreateEntity<TestTranslation>();
+            auto child1 = context.CreateEntity<TestTranslation>();
+            auto child2 = context.CreateEntity<TestTranslation, TestPhysics>();
+            auto grandChild = context.CreateEntity<TestTranslation>();
+            auto noTranslation = context.CreateEntity<TestPhysics>();
+
+            context.SetParent(child1, root);
+            context.SetParent(child2, root);
+            context.SetParent(grandChild, child2);
+            context.SetParent(noTranslation, grandChild);
+
+            EXPECT_EQ(context.GetChildCount(root), size_t(2));
+            EXPECT_EQ(context.GetChildCount(child2), size_t(1));
+            EXPECT_EQ(context.GetParent(grandChild).GetEntityId(), child2.GetEntityId());
+            EXPECT_EQ(grandChild.GetParent().GetEntityId(), child2.GetEntityId());
+            EXPECT_THROW(context.SetParent(root, grandChild), Exception);
+
+            root.GetComponent<TestTranslation>()->position = { 1, 2, 3 };
+            child1.GetComponent<TestTranslation>()->position = { 10, 0, 0 };
+            child2.GetComponent<TestTranslation>()->position = { 0, 10, 0 };
+            grandChild.GetComponent<TestTranslation>()->position = { 0, 0, 10 };
+
+            auto propagate = [](const TestTranslation& parent, TestTranslation& child)
+            {
+                child.position += parent.position;
+            };
+
+            context.PropagateHierarchy<TestTranslation>(propagate);
+            EXPECT_EQ(child1.GetComponent<TestTranslation>()->position, Vector3i32(11, 2, 3));
+            EXPECT_EQ(child2.GetComponent<TestTranslation>()->position, Vector3i32(1, 12, 3));
+            EXPECT_EQ(grandChild.GetComponent<TestTranslation>()->position, Vector3i32(1, 12, 13));
+
+            grandChild.SetParent(child1);
+            grandChild.GetComponent<TestTranslation>()->position = { 0, 0, 10 };
+            context.PropagateHierarchy<TestTranslation>(propagate);
+            EXPECT_EQ(grandChild.GetComponent<TestTranslation>()->position, Vector3i32(12, 4, 16));
+
+            context.DestroyEntity(child1);
+            EXPECT_EQ(grandChild.GetParent().GetEntityId(), TestEntity().GetEntityId());
+            EXPECT_EQ(context.GetChildCount(root), size_t(1));
+
+            grandChild.GetComponent<TestTranslation>()->position = { 0, 0, 10 };
+            context.PropagateHierarchy<TestTranslation>(propagate);
+            EXPECT_EQ(grandChild.GetComponent<TestTranslation>()->position, Vector3i32(0, 0, 10));
+
+            child2.RemoveParent();
+            EXPECT_EQ(context.GetChildCount(root), size_t(0));
+        }
+
+        TEST(ECS, Hierarchy_Threaded)
+        {
+            TestContext context;
+
+            const size_t treeCount = 50;
+            const size_t depth = 20;
+            std::vector<TestEntity> leafs;
+
+            for (size_t i = 0; i < treeCount; i++)
+            {
+                auto parent = context.CreateEntity<TestTranslation>();
+                parent.GetComponent<TestTranslation>()->position = { 1, 0, 0 };
+                for (size_t j = 1; j < depth; j++)
+                {
+                    auto child = context.CreateEntity<TestTranslation>();
+                    child.GetComponent<TestTranslation>()->position = { 1, 0, 0 };
+                    context.SetParent(child, parent);
+                    parent = child;
+                }
+                leafs.push_back(parent);
+            }
+
+            ThreadPool threadPool(3);
+            context.PropagateHierarchy<TestTranslation>([](const TestTranslation& parent, TestTranslation& child)
+            {
+                child.position += parent.position;
+            }, &threadPool);
+
+            for (auto& leaf : leafs)
+            {
+                EXPECT_EQ(leaf.GetComponent<TestTranslation>()->position.x, static_cast<int32_t>(depth));
+            }
+        }
+
     }
 
 }
\ No newline at end of file
@@ -28,6 +28,47 @@
 #include "Molten/Logger.hpp"
 #include <memory>
 #include <fstream>
+#include <thread>
+#include <vector>
+
+namespace Molten
+{
+    TEST(Core, Logger_ConcurrentWrite)
+    {
+        std::vector<std::string> messages;
+        Logger logger([&messages](const Logger::Severity, const char* message)
+        {
+            messages.push_back(message);
+        });
+        Logger childLogger(Logger::SeverityAllFlags, &logger);
+
+        const size_t threadCount = 4;
+        const size_t messageCount = 1000;
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < threadCount; i++)
+        {
+            Logger* threadLogger = (i % 2) ? &childLogger : &logger;
+            threads.emplace_back([threadLogger]()
+            {
+                for (size_t j = 0; j < messageCount; j++)
+                {
+                    Logger::WriteInfo(threadLogger, "Test info message.");
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_EQ(messages.size(), threadCount * messageCount);
+        for (auto& message : messages)
+        {
+            EXPECT_STREQ(message.c_str(), "Test info message.");
+        }
+    }
+
+}
 
 #if MOLTEN_PLATFORM == MOLTEN_PLATFORM_WINDOWS
 
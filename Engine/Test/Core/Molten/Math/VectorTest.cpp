@@ -687,4 +687,27 @@ namespace Molten
             EXPECT_NEAR(cross.z, float(0.0f), 1e-5);
         }
     }
+
+    TEST(Math, Vector4_Operators)
+    {
+        {
+            EXPECT_EQ(Vector4i32(120, 300, 40, 90) / Vector4i32(30, 20, 4, 10), Vector4i32(4, 15, 10, 9));
+
+            {
+                Vector4i32 vec(100, 200, 300, 400);
+                vec /= Vector4i32(10, 2, 3, 8);
+                EXPECT_EQ(vec, Vector4i32(10, 100, 100, 50));
+            }
+            {
+                Vector4i32 vec(100, 200, 300, 400);
+                vec /= int32_t(4);
+                EXPECT_EQ(vec, Vector4i32(25, 50, 75, 100));
+            }
+            {
+                Vector4f32 vec(2.0f, 4.0f, 6.0f, 8.0f);
+                vec /= 2.0f;
+                EXPECT_EQ(vec, Vector4f32(1.0f, 2.0f, 3.0f, 4.0f));
+            }
+        }
+    }
 }
@@ -0,0 +1,80 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/Memory/BuddyAllocator.hpp"
+#include "Molten/System/Exception.hpp"
+
+namespace Molten
+{
+
+    TEST(Memory, BuddyAllocator)
+    {
+        EXPECT_THROW(BuddyAllocator(1024, 100), Exception);
+        EXPECT_THROW(BuddyAllocator(64, 128), Exception);
+
+        BuddyAllocator allocator(1000, 64);
+        EXPECT_EQ(allocator.GetSize(), size_t(512));
+        EXPECT_TRUE(allocator.IsEmpty());
+        EXPECT_EQ(allocator.GetLargestFreeBlockSize(), size_t(512));
+
+        size_t offset1 = 0;
+        size_t offset2 = 0;
+        size_t offset3 = 0;
+        size_t offset4 = 0;
+        EXPECT_TRUE(allocator.Allocate(10, 1, offset1));
+        EXPECT_EQ(offset1, size_t(0));
+        EXPECT_EQ(allocator.GetUsedSize(), size_t(64));
+        EXPECT_EQ(allocator.GetLargestFreeBlockSize(), size_t(256));
+
+        EXPECT_TRUE(allocator.Allocate(100, 1, offset2));
+        EXPECT_EQ(offset2, size_t(128));
+
+        EXPECT_TRUE(allocator.Allocate(64, 256, offset3));
+        EXPECT_EQ(offset3, size_t(256));
+        EXPECT_EQ(allocator.GetUsedSize(), size_t(448));
+        EXPECT_EQ(allocator.GetAllocationCount(), size_t(3));
+
+        EXPECT_TRUE(allocator.Allocate(1, 1, offset4));
+        EXPECT_EQ(offset4, size_t(64));
+        EXPECT_FALSE(allocator.Allocate(1, 1, offset4));
+
+        EXPECT_FALSE(allocator.Free(32));
+        EXPECT_TRUE(allocator.Free(offset1));
+        EXPECT_FALSE(allocator.Free(offset1));
+        EXPECT_TRUE(allocator.Free(offset4));
+        EXPECT_EQ(allocator.GetLargestFreeBlockSize(), size_t(128));
+        EXPECT_TRUE(allocator.Free(offset2));
+        EXPECT_EQ(allocator.GetLargestFreeBlockSize(), size_t(256));
+        EXPECT_TRUE(allocator.Free(offset3));
+
+        EXPECT_TRUE(allocator.IsEmpty());
+        EXPECT_EQ(allocator.GetUsedSize(), size_t(0));
+        EXPECT_EQ(allocator.GetLargestFreeBlockSize(), size_t(512));
+        EXPECT_FALSE(allocator.Allocate(513, 1, offset1));
+        EXPECT_TRUE(allocator.Allocate(512, 1, offset1));
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/Renderer/BindStateCache.hpp"
+
+namespace Molten
+{
+
+    TEST(Renderer, BindStateCache)
+    {
+        int pipelines[2];
+        int uniformBlocks[2];
+        int vertexBuffers[2];
+        int indexBuffer;
+
+        BindStateCache cache;
+
+        EXPECT_TRUE(cache.BindPipeline(&pipelines[0]));
+        EXPECT_FALSE(cache.BindPipeline(&pipelines[0]));
+
+        EXPECT_TRUE(cache.BindUniformBlock(0, &uniformBlocks[0], 0));
+        EXPECT_FALSE(cache.BindUniformBlock(0, &uniformBlocks[0], 0));
+        EXPECT_TRUE(cache.BindUniformBlock(0, &uniformBlocks[0], 256));
+        EXPECT_TRUE(cache.BindUniformBlock(2, &uniformBlocks[1], 0));
+        EXPECT_FALSE(cache.BindUniformBlock(2, &uniformBlocks[1], 0));
+
+        // New pipelines invalidate bound uniform blocks.
+        EXPECT_TRUE(cache.BindPipeline(&pipelines[1]));
+        EXPECT_TRUE(cache.BindUniformBlock(2, &uniformBlocks[1], 0));
+
+        EXPECT_TRUE(cache.BindVertexBuffer(0, &vertexBuffers[0]));
+        EXPECT_FALSE(cache.BindVertexBuffer(0, &vertexBuffers[0]));
+        EXPECT_TRUE(cache.BindVertexBuffer(1, &vertexBuffers[1]));
+        EXPECT_TRUE(cache.BindVertexBuffer(0, &vertexBuffers[1]));
+        EXPECT_TRUE(cache.BindIndexBuffer(&indexBuffer));
+        EXPECT_FALSE(cache.BindIndexBuffer(&indexBuffer));
+
+        const auto statistics = cache.GetStatistics();
+        EXPECT_EQ(statistics.pipelineBinds, uint32_t(2));
+        EXPECT_EQ(statistics.pipelineBindsSkipped, uint32_t(1));
+        EXPECT_EQ(statistics.uniformBlockBinds, uint32_t(4));
+        EXPECT_EQ(statistics.uniformBlockBindsSkipped, uint32_t(2));
+        EXPECT_EQ(statistics.vertexBufferBinds, uint32_t(3));
+        EXPECT_EQ(statistics.vertexBufferBindsSkipped, uint32_t(1));
+        EXPECT_EQ(statistics.indexBufferBinds, uint32_t(1));
+        EXPECT_EQ(statistics.indexBufferBindsSkipped, uint32_t(1));
+
+        // Reset forgets bound state, but keeps statistics.
+        cache.Reset();
+        EXPECT_TRUE(cache.BindPipeline(&pipelines[1]));
+        EXPECT_TRUE(cache.BindVertexBuffer(0, &vertexBuffers[1]));
+        EXPECT_TRUE(cache.BindIndexBuffer(&indexBuffer));
+        EXPECT_EQ(cache.GetStatistics().pipelineBinds, uint32_t(3));
+
+        // Invalidated sets are rebound, invalidating unbound sets is ignored.
+        EXPECT_TRUE(cache.BindUniformBlock(1, &uniformBlocks[0], 0));
+        EXPECT_FALSE(cache.BindUniformBlock(1, &uniformBlocks[0], 0));
+        cache.InvalidateUniformBlock(1);
+        cache.InvalidateUniformBlock(5);
+        EXPECT_TRUE(cache.BindUniformBlock(1, &uniformBlocks[0], 0));
+
+        BindStatistics sum;
+        sum += cache.GetStatistics();
+        sum += cache.GetStatistics();
+        EXPECT_EQ(sum.pipelineBinds, uint32_t(6));
+        EXPECT_EQ(sum.indexBufferBindsSkipped, uint32_t(2));
+
+        cache.ClearStatistics();
+        EXPECT_EQ(cache.GetStatistics().pipelineBinds, uint32_t(0));
+        EXPECT_EQ(cache.GetStatistics().vertexBufferBinds, uint32_t(0));
+    }
+
+}
\ No newline at end of file
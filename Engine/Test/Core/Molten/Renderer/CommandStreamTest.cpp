@@ -0,0 +1,97 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#include "Test.hpp"
+#include "Molten/Renderer/CommandStream.hpp"
+#include <cstring>
+
+namespace Molten
+{
+
+    TEST(Renderer, CommandStream)
+    {
+        CommandStream stream;
+        EXPECT_EQ(stream.GetCommandCount(), size_t(0));
+
+        int resource = 0;
+        const float value = 2.5f;
+
+        CommandStream::Command bind(CommandStream::Opcode::BindUniformBuffer);
+        bind.resources[0] = &resource;
+        bind.resources[1] = &value;
+        bind.values[0] = 1;
+        bind.values[1] = 0;
+        bind.values[2] = 64;
+        stream.Write(bind);
+
+        CommandStream::Command push(CommandStream::Opcode::PushConstant);
+        push.values[0] = 3;
+        push.data = &value;
+        push.dataSize = sizeof(value);
+        stream.Write(push);
+
+        // Trailing nullptr resources and zero values are not stored.
+        const size_t size = stream.GetSize();
+        stream.Write(CommandStream::Command(CommandStream::Opcode::EndMarker));
+        EXPECT_EQ(stream.GetSize(), size + 2);
+        EXPECT_EQ(stream.GetCommandCount(), size_t(3));
+
+        size_t position = 0;
+        CommandStream::Command command;
+        ASSERT_TRUE(stream.Read(position, command));
+        EXPECT_EQ(command.opcode, CommandStream::Opcode::BindUniformBuffer);
+        EXPECT_EQ(command.resources[0], &resource);
+        EXPECT_EQ(command.resources[1], &value);
+        EXPECT_EQ(command.values[0], uint32_t(1));
+        EXPECT_EQ(command.values[1], uint32_t(0));
+        EXPECT_EQ(command.values[2], uint32_t(64));
+        EXPECT_EQ(command.data, nullptr);
+
+        ASSERT_TRUE(stream.Read(position, command));
+        EXPECT_EQ(command.opcode, CommandStream::Opcode::PushConstant);
+        EXPECT_EQ(command.resources[0], nullptr);
+        EXPECT_EQ(command.values[0], uint32_t(3));
+        ASSERT_EQ(command.dataSize, uint32_t(sizeof(float)));
+        float readValue = 0.0f;
+        std::memcpy(&readValue, command.data, sizeof(float));
+        EXPECT_EQ(readValue, value);
+
+        ASSERT_TRUE(stream.Read(position, command));
+        EXPECT_EQ(command.opcode, CommandStream::Opcode::EndMarker);
+        EXPECT_FALSE(stream.Read(position, command));
+
+        CommandStream appended;
+        appended.Append(stream);
+        appended.Append(stream);
+        EXPECT_EQ(appended.GetCommandCount(), size_t(6));
+        EXPECT_EQ(appended.GetSize(), stream.GetSize() * 2);
+
+        stream.Clear();
+        EXPECT_EQ(stream.GetCommandCount(), size_t(0));
+        EXPECT_EQ(stream.GetSize(), size_t(0));
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,236 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/Renderer/FrameGraph.hpp"
+#include "Molten/System/Exception.hpp"
+
+namespace Molten
+{
+
+    TEST(Renderer, FrameGraph_Culling)
+    {
+        using State = FrameGraph::ResourceState;
+        const FrameGraph::TextureDescriptor descriptor = { { 256, 256 }, FrameGraph::Format::Rgba8 };
+
+        FrameGraph frameGraph;
+        auto backbuffer = frameGraph.ImportTexture("backbuffer", descriptor, State::Undefined, State::Present);
+        auto color = frameGraph.CreateTexture("color", descriptor);
+        auto unused = frameGraph.CreateTexture("unused", descriptor);
+        auto debug = frameGraph.CreateTexture("debug", descriptor);
+
+        auto scenePass = frameGraph.AddPass("scene");
+        frameGraph.Write(scenePass, color);
+
+        auto unusedPass = frameGraph.AddPass("unused");
+        frameGraph.Write(unusedPass, unused);
+
+        auto debugPass = frameGraph.AddPass("debug");
+        frameGraph.Write(debugPass, debug);
+        frameGraph.KeepPass(debugPass);
+
+        auto postPass = frameGraph.AddPass("post");
+        frameGraph.Read(postPass, color);
+        frameGraph.Write(postPass, backbuffer);
+
+        frameGraph.Compile();
+
+        EXPECT_FALSE(frameGraph.IsPassCulled(scenePass));
+        EXPECT_TRUE(frameGraph.IsPassCulled(unusedPass));
+        EXPECT_FALSE(frameGraph.IsPassCulled(debugPass));
+        EXPECT_FALSE(frameGraph.IsPassCulled(postPass));
+
+        const auto& compiledPasses = frameGraph.GetCompiledPasses();
+        ASSERT_EQ(compiledPasses.size(), size_t{ 3 });
+        EXPECT_EQ(compiledPasses[0].pass, scenePass);
+        EXPECT_EQ(compiledPasses[1].pass, debugPass);
+        EXPECT_EQ(compiledPasses[2].pass, postPass);
+
+        EXPECT_TRUE(frameGraph.IsAllocated(color));
+        EXPECT_FALSE(frameGraph.IsAllocated(unused));
+        EXPECT_FALSE(frameGraph.IsAllocated(backbuffer));
+
+        EXPECT_THROW(frameGraph.Read(postPass, color, State::ColorAttachment), Exception);
+        EXPECT_THROW(frameGraph.Write(postPass, color, State::ShaderRead), Exception);
+        EXPECT_THROW(frameGraph.Write(postPass, FrameGraph::InvalidId), Exception);
+        EXPECT_THROW(frameGraph.KeepPass(FrameGraph::InvalidId), Exception);
+    }
+
+    TEST(Renderer, FrameGraph_Barriers)
+    {
+        using State = FrameGraph::ResourceState;
+        const FrameGraph::TextureDescriptor descriptor = { { 256, 256 }, FrameGraph::Format::Rgba8 };
+        const FrameGraph::TextureDescriptor depthDescriptor = { { 256, 256 }, FrameGraph::Format::Depth32Float };
+
+        FrameGraph frameGraph;
+        auto backbuffer = frameGraph.ImportTexture("backbuffer", descriptor, State::Undefined, State::Present);
+        auto depth = frameGraph.CreateTexture("depth", depthDescriptor);
+        auto color = frameGraph.CreateTexture("color", descriptor);
+
+        auto depthPass = frameGraph.AddPass("depth");
+        frameGraph.Write(depthPass, depth, State::DepthAttachment);
+
+        auto scenePass = frameGraph.AddPass("scene");
+        frameGraph.Read(scenePass, depth, State::DepthRead);
+        frameGraph.Write(scenePass, color);
+
+        auto ssaoPass = frameGraph.AddPass("ssao");
+        frameGraph.Read(ssaoPass, depth, State::DepthRead);
+        frameGraph.Read(ssaoPass, color);
+        frameGraph.Write(ssaoPass, color);
+
+        auto postPass = frameGraph.AddPass("post");
+        frameGraph.Read(postPass, color);
+        frameGraph.Write(postPass, backbuffer);
+
+        frameGraph.Compile();
+
+        const auto& compiledPasses = frameGraph.GetCompiledPasses();
+        ASSERT_EQ(compiledPasses.size(), size_t{ 4 });
+
+        {
+            const auto& barriers = compiledPasses[0].barriers;
+            ASSERT_EQ(barriers.size(), size_t{ 1 });
+            EXPECT_EQ(barriers[0].resource, depth);
+            EXPECT_EQ(barriers[0].before, State::Undefined);
+            EXPECT_EQ(barriers[0].after, State::DepthAttachment);
+        }
+        {
+            const auto& barriers = compiledPasses[1].barriers;
+            ASSERT_EQ(barriers.size(), size_t{ 2 });
+            EXPECT_EQ(barriers[0].resource, depth);
+            EXPECT_EQ(barriers[0].before, State::DepthAttachment);
+            EXPECT_EQ(barriers[0].after, State::DepthRead);
+            EXPECT_EQ(barriers[1].resource, color);
+            EXPECT_EQ(barriers[1].before, State::Undefined);
+            EXPECT_EQ(barriers[1].after, State::ColorAttachment);
+        }
+        {
+            // Depth is still in read state, color is read and written, so the write state wins.
+            const auto& barriers = compiledPasses[2].barriers;
+            ASSERT_EQ(barriers.size(), size_t{ 1 });
+            EXPECT_EQ(barriers[0].resource, color);
+            EXPECT_EQ(barriers[0].before, State::ColorAttachment);
+            EXPECT_EQ(barriers[0].after, State::ColorAttachment);
+        }
+        {
+            const auto& barriers = compiledPasses[3].barriers;
+            ASSERT_EQ(barriers.size(), size_t{ 2 });
+            EXPECT_EQ(barriers[0].resource, color);
+            EXPECT_EQ(barriers[0].before, State::ColorAttachment);
+            EXPECT_EQ(barriers[0].after, State::ShaderRead);
+            EXPECT_EQ(barriers[1].resource, backbuffer);
+            EXPECT_EQ(barriers[1].before, State::Undefined);
+            EXPECT_EQ(barriers[1].after, State::ColorAttachment);
+        }
+
+        const auto& finalBarriers = frameGraph.GetFinalBarriers();
+        ASSERT_EQ(finalBarriers.size(), size_t{ 1 });
+        EXPECT_EQ(finalBarriers[0].resource, backbuffer);
+        EXPECT_EQ(finalBarriers[0].before, State::ColorAttachment);
+        EXPECT_EQ(finalBarriers[0].after, State::Present);
+    }
+
+    TEST(Renderer, FrameGraph_Aliasing)
+    {
+        using State = FrameGraph::ResourceState;
+        const FrameGraph::TextureDescriptor descriptor = { { 512, 512 }, FrameGraph::Format::Rgba16Float };
+        const size_t textureSize = 512 * 512 * 8;
+
+        FrameGraph frameGraph;
+        auto backbuffer = frameGraph.ImportTexture("backbuffer", descriptor, State::Undefined, State::Present);
+        auto textureA = frameGraph.CreateTexture("a", descriptor);
+        auto textureB = frameGraph.CreateTexture("b", descriptor);
+        auto textureC = frameGraph.CreateTexture("c", descriptor);
+
+        // Chain a -> b -> c -> backbuffer, a and c are never alive at the same time.
+        auto passA = frameGraph.AddPass("a");
+        frameGraph.Write(passA, textureA);
+        auto passB = frameGraph.AddPass("b");
+        frameGraph.Read(passB, textureA);
+        frameGraph.Write(passB, textureB);
+        auto passC = frameGraph.AddPass("c");
+        frameGraph.Read(passC, textureB);
+        frameGraph.Write(passC, textureC);
+        auto passD = frameGraph.AddPass("d");
+        frameGraph.Read(passD, textureC);
+        frameGraph.Write(passD, backbuffer);
+
+        frameGraph.Compile();
+
+        EXPECT_EQ(frameGraph.GetUnaliasedMemorySize(), textureSize * 3);
+        EXPECT_EQ(frameGraph.GetTransientMemorySize(), textureSize * 2);
+        EXPECT_FALSE(frameGraph.IsAllocated(backbuffer));
+        EXPECT_EQ(frameGraph.GetResourceDescriptor(textureB).size, descriptor.size);
+        EXPECT_EQ(frameGraph.GetResourceDescriptor(textureB).format, descriptor.format);
+
+        const auto& allocationA = frameGraph.GetAllocation(textureA);
+        const auto& allocationB = frameGraph.GetAllocation(textureB);
+        const auto& allocationC = frameGraph.GetAllocation(textureC);
+        EXPECT_EQ(allocationA.size, textureSize);
+        EXPECT_EQ(allocationA.offset, allocationC.offset);
+        EXPECT_NE(allocationA.offset, allocationB.offset);
+        EXPECT_NE(allocationB.offset, allocationC.offset);
+    }
+
+    TEST(Renderer, FrameGraph_Execute)
+    {
+        using State = FrameGraph::ResourceState;
+        const FrameGraph::TextureDescriptor descriptor = { { 64, 64 }, FrameGraph::Format::Rgba8 };
+
+        std::vector<std::string> executed;
+        FrameGraph frameGraph;
+
+        auto createPass = [&](const std::string& name)
+        {
+            return frameGraph.AddPass(name, [&executed, &frameGraph](const FrameGraph::CompiledPass& compiledPass)
+            {
+                executed.push_back(frameGraph.GetPassName(compiledPass.pass));
+            });
+        };
+
+        auto backbuffer = frameGraph.ImportTexture("backbuffer", descriptor, State::Present, State::Present);
+        auto color = frameGraph.CreateTexture("color", descriptor);
+
+        auto scenePass = createPass("scene");
+        frameGraph.Write(scenePass, color);
+        createPass("culled");
+        auto postPass = createPass("post");
+        frameGraph.Read(postPass, color);
+        frameGraph.Write(postPass, backbuffer);
+
+        frameGraph.Compile();
+        frameGraph.Execute();
+
+        ASSERT_EQ(executed.size(), size_t{ 2 });
+        EXPECT_EQ(executed[0], "scene");
+        EXPECT_EQ(executed[1], "post");
+
+        frameGraph.Clear();
+        EXPECT_EQ(frameGraph.GetPassCount(), size_t{ 0 });
+        EXPECT_EQ(frameGraph.GetResourceCount(), size_t{ 0 });
+    }
+
+}
\ No newline at end of file
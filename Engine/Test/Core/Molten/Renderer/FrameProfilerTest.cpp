@@ -0,0 +1,107 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/Renderer/FrameProfiler.hpp"
+#include <sstream>
+
+namespace Molten
+{
+
+    TEST(Renderer, FrameProfiler_Statistics)
+    {
+        using Domain = FrameProfiler::Domain;
+
+        FrameProfiler profiler(100);
+        FrameProfiler::Statistics statistics;
+        EXPECT_FALSE(profiler.GetStatistics(Domain::Cpu, "Record", statistics));
+
+        // Frames of 1 to 150 milliseconds, only the last 100 are kept.
+        for (int32_t i = 1; i <= 150; i++)
+        {
+            profiler.AddSample(Domain::Cpu, "Record", Milliseconds(i));
+            if (i % 2 == 0)
+            {
+                // Samples of the same series in a frame are summed.
+                profiler.AddSample(Domain::Gpu, "Shadows", Milliseconds(1));
+                profiler.AddSample(Domain::Gpu, "Shadows", Milliseconds(1));
+            }
+            profiler.EndFrame();
+        }
+
+        EXPECT_EQ(profiler.GetFrameCount(), size_t(100));
+
+        ASSERT_TRUE(profiler.GetStatistics(Domain::Cpu, "Record", statistics));
+        EXPECT_EQ(statistics.frameCount, size_t(100));
+        EXPECT_EQ(statistics.minimum, Milliseconds(51));
+        EXPECT_EQ(statistics.last, Milliseconds(150));
+        EXPECT_EQ(statistics.percentile99, Milliseconds(149));
+        EXPECT_NEAR(statistics.average.AsMilliseconds<double>(), 100.5, 0.001);
+
+        ASSERT_TRUE(profiler.GetStatistics(Domain::Gpu, "Shadows", statistics));
+        EXPECT_EQ(statistics.frameCount, size_t(50));
+        EXPECT_EQ(statistics.minimum, Milliseconds(2));
+        EXPECT_EQ(statistics.percentile99, Milliseconds(2));
+        EXPECT_FALSE(profiler.GetStatistics(Domain::Cpu, "Shadows", statistics));
+
+        const auto cpuNames = profiler.GetSeriesNames(Domain::Cpu);
+        ASSERT_EQ(cpuNames.size(), size_t(1));
+        EXPECT_EQ(cpuNames[0], "Record");
+
+        profiler.Clear();
+        EXPECT_EQ(profiler.GetFrameCount(), size_t(0));
+        EXPECT_TRUE(profiler.GetSeriesNames(Domain::Gpu).empty());
+    }
+
+    TEST(Renderer, FrameProfiler_CpuScopeAndCsv)
+    {
+        using Domain = FrameProfiler::Domain;
+
+        FrameProfiler profiler(4);
+        {
+            FrameProfiler::CpuScope scope(profiler, "Submit");
+        }
+        profiler.AddSample(Domain::Gpu, "Frame", Milliseconds(2));
+        profiler.EndFrame();
+        profiler.AddSample(Domain::Gpu, "Frame", Milliseconds(3));
+        profiler.EndFrame();
+
+        FrameProfiler::Statistics statistics;
+        ASSERT_TRUE(profiler.GetStatistics(Domain::Cpu, "Submit", statistics));
+        EXPECT_EQ(statistics.frameCount, size_t(1));
+
+        std::stringstream stream;
+        profiler.WriteCsv(stream);
+
+        std::string line;
+        ASSERT_TRUE(std::getline(stream, line));
+        EXPECT_EQ(line, "Frame,Cpu Submit,Gpu Frame");
+        ASSERT_TRUE(std::getline(stream, line));
+        EXPECT_EQ(line.substr(0, 2), "0,");
+        ASSERT_TRUE(std::getline(stream, line));
+        EXPECT_EQ(line, "1,,3");
+    }
+
+}
\ No newline at end of file
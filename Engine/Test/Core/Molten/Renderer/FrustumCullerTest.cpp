@@ -0,0 +1,213 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#include "Test.hpp"
+#include "Molten/Renderer/FrustumCuller.hpp"
+#include "Molten/Renderer/IndirectBuffer.hpp"
+#include "Molten/Scene/Camera.hpp"
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace Molten
+{
+
+    static Matrix4x4f32 CreateTestViewProjection()
+    {
+        const auto projection = Matrix4x4f32::Perspective(Degrees(70.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+        const auto view = Matrix4x4f32::LookAtDirection({ 1.0f, -2.0f, 3.0f }, { 0.3f, 1.0f, -0.2f }, { 0.0f, 0.0f, 1.0f });
+        return projection * view;
+    }
+
+    static std::vector<BoundingVolume> CreateRandomBounds(const size_t count, const uint32_t seed)
+    {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+        std::uniform_real_distribution<float> size(0.0f, 4.0f);
+
+        std::vector<BoundingVolume> bounds;
+        for (size_t i = 0; i < count; i++)
+        {
+            const Vector3f32 center = { position(random), position(random), position(random) };
+            if (i % 2 == 0)
+            {
+                bounds.push_back(BoundingVolume::FromSphere(center, size(random)));
+            }
+            else
+            {
+                const Vector3f32 extents = { size(random), size(random), size(random) };
+                bounds.push_back(BoundingVolume::FromAabb(center - extents, center + extents));
+            }
+        }
+        return bounds;
+    }
+
+    static std::vector<DrawIndexedIndirectCommand> CreateCommands(const size_t count)
+    {
+        std::vector<DrawIndexedIndirectCommand> commands;
+        for (size_t i = 0; i < count; i++)
+        {
+            const uint32_t index = static_cast<uint32_t>(i);
+            commands.push_back({ 3 + index, 1, index * 3, static_cast<int32_t>(index), index });
+        }
+        return commands;
+    }
+
+    TEST(Renderer, BoundingVolume)
+    {
+        const auto sphere = BoundingVolume::FromSphere({ 1.0f, 2.0f, 3.0f }, 4.0f);
+        EXPECT_EQ(sphere.center, Vector3f32(1.0f, 2.0f, 3.0f));
+        EXPECT_FLOAT_EQ(sphere.radius, 4.0f);
+        EXPECT_EQ(sphere.extents, Vector3f32(0.0f, 0.0f, 0.0f));
+
+        const auto box = BoundingVolume::FromAabb({ -1.0f, 0.0f, 2.0f }, { 3.0f, 4.0f, 4.0f });
+        EXPECT_EQ(box.center, Vector3f32(1.0f, 2.0f, 3.0f));
+        EXPECT_FLOAT_EQ(box.radius, 0.0f);
+        EXPECT_EQ(box.extents, Vector3f32(2.0f, 2.0f, 1.0f));
+    }
+
+    TEST(Renderer, Frustum_FromViewProjection)
+    {
+        const auto viewProjection = CreateTestViewProjection();
+        const auto frustum = Frustum::FromViewProjection(viewProjection);
+
+        for (const auto& plane : frustum.GetPlanes())
+        {
+            EXPECT_NEAR(std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z), 1.0f, 1e-5f);
+        }
+
+        // Points are inside if their clip space coordinates are within [-w, w].
+        std::mt19937 random(5678);
+        std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+        const auto& e = viewProjection.e;
+
+        size_t insideCount = 0;
+        for (size_t i = 0; i < 10000; i++)
+        {
+            const Vector3f32 point = { position(random), position(random), position(random) };
+            const float clip[4] = {
+                e[0] * point.x + e[4] * point.y + e[8] * point.z + e[12],
+                e[1] * point.x + e[5] * point.y + e[9] * point.z + e[13],
+                e[2] * point.x + e[6] * point.y + e[10] * point.z + e[14],
+                e[3] * point.x + e[7] * point.y + e[11] * point.z + e[15]
+            };
+
+            // Skip points close to any plane.
+            const float margin = 1e-3f * std::abs(clip[3]) + 1e-3f;
+            if (std::abs(std::abs(clip[0]) - clip[3]) < margin ||
+                std::abs(std::abs(clip[1]) - clip[3]) < margin ||
+                std::abs(std::abs(clip[2]) - clip[3]) < margin)
+            {
+                continue;
+            }
+
+            const bool inside = clip[3] > 0.0f &&
+                std::abs(clip[0]) <= clip[3] && std::abs(clip[1]) <= clip[3] && std::abs(clip[2]) <= clip[3];
+            insideCount += inside ? 1 : 0;
+
+            EXPECT_EQ(frustum.Intersects(BoundingVolume::FromSphere(point, 0.0f)), inside);
+        }
+        EXPECT_GT(insideCount, size_t(0));
+    }
+
+    TEST(Renderer, Frustum_Camera)
+    {
+        Scene::Camera camera;
+        camera.SetWindowSize({ 800, 600 });
+        camera.SetPosition({ 5.0f, 5.0f, 5.0f });
+        camera.PostProcess();
+
+        const auto& frustum = camera.GetFrustum();
+        const Vector3f32 position = camera.GetPosition();
+        const Vector3f32 forward = camera.GetForwardDirection();
+
+        EXPECT_TRUE(frustum.Intersects(BoundingVolume::FromSphere(position + forward * 10.0f, 1.0f)));
+        EXPECT_FALSE(frustum.Intersects(BoundingVolume::FromSphere(position - forward * 10.0f, 1.0f)));
+        EXPECT_FALSE(frustum.Intersects(BoundingVolume::FromSphere(position + forward * 200.0f, 1.0f)));
+        EXPECT_TRUE(frustum.Intersects(BoundingVolume::FromAabb(position - Vector3f32(1.0f), position + Vector3f32(1.0f))));
+
+        EXPECT_TRUE(Frustum().Intersects(BoundingVolume::FromSphere(position - forward * 10.0f, 1.0f)));
+    }
+
+    TEST(Renderer, FrustumCuller_Compaction)
+    {
+        const auto frustum = Frustum::FromViewProjection(CreateTestViewProjection());
+        const auto bounds = CreateRandomBounds(103, 1234);
+        const auto commands = CreateCommands(bounds.size());
+
+        std::vector<DrawIndexedIndirectCommand> output(commands.size());
+        const uint32_t visibleCount = FrustumCuller::Cull(frustum, bounds.data(), commands.data(), static_cast<uint32_t>(commands.size()), output.data());
+        EXPECT_GT(visibleCount, uint32_t(0));
+        EXPECT_LT(visibleCount, static_cast<uint32_t>(commands.size()));
+
+        // Visible commands are compacted in input order, remaining commands are cleared.
+        uint32_t outputIndex = 0;
+        for (size_t i = 0; i < commands.size(); i++)
+        {
+            if (frustum.Intersects(bounds[i]))
+            {
+                ASSERT_LT(outputIndex, visibleCount);
+                EXPECT_EQ(output[outputIndex].firstInstance, commands[i].firstInstance);
+                EXPECT_EQ(output[outputIndex].instanceCount, uint32_t(1));
+                outputIndex++;
+            }
+        }
+        EXPECT_EQ(outputIndex, visibleCount);
+
+        for (size_t i = visibleCount; i < output.size(); i++)
+        {
+            EXPECT_EQ(output[i].indexCount, uint32_t(0));
+            EXPECT_EQ(output[i].instanceCount, uint32_t(0));
+        }
+    }
+
+    TEST(Renderer, FrustumCuller_SimdMatchesScalar)
+    {
+        const auto frustum = Frustum::FromViewProjection(CreateTestViewProjection());
+
+        for (const size_t count : { size_t(0), size_t(1), size_t(4), size_t(7), size_t(1000), size_t(4099) })
+        {
+            const auto bounds = CreateRandomBounds(count, static_cast<uint32_t>(count));
+            const auto commands = CreateCommands(count);
+            const uint32_t commandCount = static_cast<uint32_t>(count);
+
+            std::vector<DrawIndexedIndirectCommand> simdOutput(count);
+            std::vector<DrawIndexedIndirectCommand> scalarOutput(count);
+            const uint32_t simdVisibleCount = FrustumCuller::Cull(frustum, bounds.data(), commands.data(), commandCount, simdOutput.data());
+            const uint32_t scalarVisibleCount = FrustumCuller::CullScalar(frustum, bounds.data(), commands.data(), commandCount, scalarOutput.data());
+
+            EXPECT_EQ(simdVisibleCount, scalarVisibleCount);
+            EXPECT_EQ(std::memcmp(simdOutput.data(), scalarOutput.data(), count * sizeof(DrawIndexedIndirectCommand)), 0);
+
+            // Culling in place.
+            auto inPlace = commands;
+            EXPECT_EQ(FrustumCuller::Cull(frustum, bounds.data(), inPlace.data(), commandCount, inPlace.data()), scalarVisibleCount);
+            EXPECT_EQ(std::memcmp(inPlace.data(), scalarOutput.data(), count * sizeof(DrawIndexedIndirectCommand)), 0);
+        }
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,454 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/Renderer/Null/NullRenderer.hpp"
+#include "Molten/Scene/Camera.hpp"
+#include <cstring>
+#include <memory>
+
+namespace Molten
+{
+
+    static std::vector<CommandStream::Opcode> GetOpcodes(const CommandStream& stream)
+    {
+        std::vector<CommandStream::Opcode> opcodes;
+
+        size_t position = 0;
+        CommandStream::Command command;
+        while (stream.Read(position, command))
+        {
+            opcodes.push_back(command.opcode);
+        }
+        return opcodes;
+    }
+
+    TEST(Renderer, NullRenderer)
+    {
+        std::unique_ptr<Renderer> renderer(Renderer::Create(Renderer::BackendApi::Null));
+        ASSERT_NE(renderer, nullptr);
+        ASSERT_TRUE(renderer->OpenOffscreen({ 64, 32 }, Version(1, 2)));
+        EXPECT_EQ(renderer->GetBackendApi(), Renderer::BackendApi::Null);
+        EXPECT_EQ(renderer->GetVersion(), Version(1, 2));
+
+        Pipeline* pipeline = renderer->CreatePipeline(PipelineDescriptor());
+
+        VertexBufferDescriptor vertexBufferDesc;
+        vertexBufferDesc.vertexCount = 6;
+        vertexBufferDesc.vertexSize = 16;
+        vertexBufferDesc.data = nullptr;
+        VertexBuffer* vertexBuffer = renderer->CreateVertexBuffer(vertexBufferDesc);
+
+        IndexBufferDescriptor indexBufferDesc;
+        indexBufferDesc.indexCount = 12;
+        indexBufferDesc.data = nullptr;
+        indexBufferDesc.dataType = IndexBuffer::DataType::Uint16;
+        IndexBuffer* indexBuffer = renderer->CreateIndexBuffer(indexBufferDesc);
+
+        CommandBuffer* commandBuffer = renderer->CreateCommandBuffer();
+        EXPECT_FALSE(commandBuffer->Begin());
+
+        using Opcode = CommandStream::Opcode;
+        auto* nullRenderer = static_cast<NullRenderer*>(renderer.get());
+
+        for (uint64_t frame = 1; frame <= 2; frame++)
+        {
+            renderer->BeginDraw();
+            renderer->BeginGpuMarker("Scene");
+            renderer->BindPipeline(pipeline);
+            renderer->BindPipeline(pipeline);
+            renderer->PushConstant(0, 1.0f);
+            renderer->DrawVertexBuffer(vertexBuffer);
+            renderer->DrawVertexBuffer(vertexBuffer);
+
+            ASSERT_TRUE(commandBuffer->Begin());
+            commandBuffer->BindPipeline(pipeline);
+            commandBuffer->DrawVertexBuffer(indexBuffer, vertexBuffer);
+            commandBuffer->End();
+            renderer->ExecuteCommandBuffer(commandBuffer);
+
+            // Bound state of the renderer is reset by the executed command buffer.
+            renderer->BindPipeline(pipeline);
+            renderer->EndGpuMarker();
+            renderer->EndDraw();
+
+            EXPECT_EQ(nullRenderer->GetFrameCount(), frame);
+
+            const std::vector<Opcode> expectedOpcodes = {
+                Opcode::BeginMarker, Opcode::BindPipeline, Opcode::PushConstant, Opcode::BindVertexBuffer, Opcode::Draw, Opcode::Draw,
+                Opcode::BindPipeline, Opcode::BindVertexBuffer, Opcode::BindIndexBuffer, Opcode::DrawIndexed,
+                Opcode::BindPipeline, Opcode::EndMarker
+            };
+            EXPECT_EQ(GetOpcodes(nullRenderer->GetFrameStream()), expectedOpcodes);
+
+            const auto bindStatistics = renderer->GetBindStatistics();
+            EXPECT_EQ(bindStatistics.pipelineBinds, uint32_t(3));
+            EXPECT_EQ(bindStatistics.pipelineBindsSkipped, uint32_t(1));
+            EXPECT_EQ(bindStatistics.vertexBufferBinds, uint32_t(2));
+            EXPECT_EQ(bindStatistics.vertexBufferBindsSkipped, uint32_t(1));
+        }
+
+        std::vector<uint8_t> pixels;
+        EXPECT_FALSE(renderer->ReadRenderTarget(pixels));
+
+        renderer->DestroyCommandBuffer(commandBuffer);
+        renderer->DestroyIndexBuffer(indexBuffer);
+        renderer->DestroyVertexBuffer(vertexBuffer);
+        renderer->DestroyPipeline(pipeline);
+    }
+
+    TEST(Renderer, NullRenderer_UniformBuffer)
+    {
+        NullRenderer renderer;
+        ASSERT_TRUE(renderer.OpenOffscreen({ 64, 32 }));
+
+        UniformBufferDescriptor uniformBufferDesc;
+        uniformBufferDesc.size = NullRenderer::UniformBufferAlignment * 2;
+        UniformBuffer* uniformBuffer = renderer.CreateUniformBuffer(uniformBufferDesc);
+
+        const Matrix4x4f32 data = Matrix4x4f32::Identity();
+        uint32_t offset = 1;
+
+        renderer.BeginDraw();
+        EXPECT_TRUE(renderer.AllocateUniformBufferData(uniformBuffer, sizeof(data), &data, offset));
+        EXPECT_EQ(offset, uint32_t(0));
+        EXPECT_TRUE(renderer.AllocateUniformBufferData(uniformBuffer, sizeof(data), &data, offset));
+        EXPECT_EQ(offset, uint32_t(NullRenderer::UniformBufferAlignment));
+        EXPECT_FALSE(renderer.AllocateUniformBufferData(uniformBuffer, sizeof(data), &data, offset));
+        renderer.EndDraw();
+
+        EXPECT_EQ(renderer.GetFrameStream().GetCommandCount(), size_t(2));
+        EXPECT_GT(renderer.GetFrameStream().GetSize(), sizeof(data) * 2);
+
+        // Allocations are released at the next frame.
+        renderer.BeginDraw();
+        EXPECT_TRUE(renderer.AllocateUniformBufferData(uniformBuffer, sizeof(data), &data, offset));
+        EXPECT_EQ(offset, uint32_t(0));
+        renderer.EndDraw();
+
+        renderer.DestroyUniformBuffer(uniformBuffer);
+    }
+
+    TEST(Renderer, NullRenderer_DynamicBuffer)
+    {
+        NullRenderer renderer;
+        renderer.SetMaxFramesInFlight(2);
+        ASSERT_TRUE(renderer.OpenOffscreen({ 64, 32 }));
+
+        VertexBufferDescriptor vertexBufferDesc;
+        vertexBufferDesc.vertexCount = 4;
+        vertexBufferDesc.vertexSize = sizeof(Vector2f32);
+        vertexBufferDesc.data = nullptr;
+        vertexBufferDesc.usage = VertexBuffer::Usage::Dynamic;
+        VertexBuffer* vertexBuffer = renderer.CreateVertexBuffer(vertexBufferDesc);
+
+        VertexBufferDescriptor staticBufferDesc = vertexBufferDesc;
+        staticBufferDesc.usage = VertexBuffer::Usage::Static;
+        VertexBuffer* staticBuffer = renderer.CreateVertexBuffer(staticBufferDesc);
+
+        IndexBufferDescriptor indexBufferDesc;
+        indexBufferDesc.indexCount = 6;
+        indexBufferDesc.data = nullptr;
+        indexBufferDesc.dataType = IndexBuffer::DataType::Uint16;
+        indexBufferDesc.usage = IndexBuffer::Usage::Dynamic;
+        IndexBuffer* indexBuffer = renderer.CreateIndexBuffer(indexBufferDesc);
+
+        Pipeline* pipeline = renderer.CreatePipeline(PipelineDescriptor());
+
+        const Vector2f32 vertices[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f } };
+        const uint16_t indices[] = { 0, 1, 2 };
+
+        // Dynamic buffers are written between BeginDraw and EndDraw only.
+        EXPECT_FALSE(renderer.UpdateVertexBuffer(vertexBuffer, 3, vertices));
+
+        void* frameData[3] = {};
+        for (size_t frame = 0; frame < 3; frame++)
+        {
+            renderer.BeginDraw();
+
+            EXPECT_FALSE(renderer.UpdateVertexBuffer(staticBuffer, 3, vertices));
+            EXPECT_EQ(renderer.MapVertexBufferForWrite(vertexBuffer, 5), nullptr);
+
+            frameData[frame] = renderer.MapVertexBufferForWrite(vertexBuffer, 3);
+            ASSERT_NE(frameData[frame], nullptr);
+            std::memcpy(frameData[frame], vertices, sizeof(vertices));
+            EXPECT_TRUE(renderer.UpdateIndexBuffer(indexBuffer, 3, indices));
+
+            renderer.BindPipeline(pipeline);
+            renderer.DrawVertexBuffer(indexBuffer, vertexBuffer);
+            renderer.DrawVertexBuffer(vertexBuffer);
+            renderer.EndDraw();
+
+            // Draws use the number of elements written by the current frame.
+            size_t position = 0;
+            CommandStream::Command command;
+            std::vector<uint32_t> drawCounts;
+            while (renderer.GetFrameStream().Read(position, command))
+            {
+                if (command.opcode == CommandStream::Opcode::Draw || command.opcode == CommandStream::Opcode::DrawIndexed)
+                {
+                    drawCounts.push_back(command.values[0]);
+                }
+            }
+            EXPECT_EQ(drawCounts, std::vector<uint32_t>({ 3, 3 }));
+        }
+
+        // Frames in flight write to separate regions, reused after all frames in flight.
+        EXPECT_NE(frameData[0], frameData[1]);
+        EXPECT_EQ(frameData[0], frameData[2]);
+
+        renderer.DestroyPipeline(pipeline);
+        renderer.DestroyIndexBuffer(indexBuffer);
+        renderer.DestroyVertexBuffer(staticBuffer);
+        renderer.DestroyVertexBuffer(vertexBuffer);
+    }
+
+    TEST(Renderer, NullRenderer_IndirectBuffer)
+    {
+        NullRenderer renderer;
+        ASSERT_TRUE(renderer.OpenOffscreen({ 64, 32 }));
+
+        VertexBufferDescriptor vertexBufferDesc;
+        vertexBufferDesc.vertexCount = 6;
+        vertexBufferDesc.vertexSize = 16;
+        vertexBufferDesc.data = nullptr;
+        VertexBuffer* vertexBuffer = renderer.CreateVertexBuffer(vertexBufferDesc);
+
+        IndexBufferDescriptor indexBufferDesc;
+        indexBufferDesc.indexCount = 9;
+        indexBufferDesc.data = nullptr;
+        indexBufferDesc.dataType = IndexBuffer::DataType::Uint16;
+        IndexBuffer* indexBuffer = renderer.CreateIndexBuffer(indexBufferDesc);
+
+        IndirectBufferDescriptor indirectBufferDesc;
+        indirectBufferDesc.commandCount = 2;
+        indirectBufferDesc.commands = nullptr;
+        IndirectBuffer* indirectBuffer = renderer.CreateIndirectBuffer(indirectBufferDesc);
+
+        const DrawIndexedIndirectCommand commands[] = { { 3, 1, 0, 0, 0 }, { 6, 1, 3, 0, 1 } };
+        Pipeline* pipeline = renderer.CreatePipeline(PipelineDescriptor());
+
+        renderer.BeginDraw();
+        renderer.UpdateIndirectBuffer(indirectBuffer, 1, 2, commands);
+        renderer.UpdateIndirectBufferDrawCount(indirectBuffer, 3);
+        renderer.UpdateIndirectBuffer(indirectBuffer, 0, 2, commands);
+        renderer.BindPipeline(pipeline);
+        renderer.DrawVertexBufferIndirect(indexBuffer, vertexBuffer, nullptr, indirectBuffer, 3);
+        renderer.DrawVertexBufferIndirect(indexBuffer, vertexBuffer, nullptr, indirectBuffer, 2);
+        renderer.DrawVertexBufferIndirectCount(indexBuffer, vertexBuffer, nullptr, indirectBuffer);
+        renderer.UpdateIndirectBufferDrawCount(indirectBuffer, 1);
+        renderer.DrawVertexBufferIndirectCount(indexBuffer, vertexBuffer, nullptr, indirectBuffer);
+        renderer.EndDraw();
+
+        // Out of bounds updates and draws are rejected.
+        using Opcode = CommandStream::Opcode;
+        const auto& stream = renderer.GetFrameStream();
+        const std::vector<Opcode> expectedOpcodes = {
+            Opcode::UpdateIndirectBuffer, Opcode::BindPipeline, Opcode::BindVertexBuffer, Opcode::BindIndexBuffer,
+            Opcode::DrawIndirect, Opcode::DrawIndirectCount, Opcode::UpdateIndirectBufferDrawCount, Opcode::DrawIndirectCount
+        };
+        ASSERT_EQ(GetOpcodes(stream), expectedOpcodes);
+
+        size_t position = 0;
+        CommandStream::Command command;
+        ASSERT_TRUE(stream.Read(position, command));
+        EXPECT_EQ(command.resources[0], indirectBuffer);
+        EXPECT_EQ(command.values[0], uint32_t(0));
+        EXPECT_EQ(command.values[1], uint32_t(2));
+        ASSERT_EQ(command.dataSize, sizeof(commands));
+        EXPECT_EQ(std::memcmp(command.data, commands, sizeof(commands)), 0);
+
+        std::vector<CommandStream::Command> draws;
+        while (stream.Read(position, command))
+        {
+            if (command.opcode == Opcode::DrawIndirect || command.opcode == Opcode::DrawIndirectCount)
+            {
+                draws.push_back(command);
+            }
+        }
+        ASSERT_EQ(draws.size(), size_t(3));
+        EXPECT_EQ(draws[0].values[0], uint32_t(2));
+        EXPECT_EQ(draws[1].values[0], uint32_t(2));
+        EXPECT_EQ(draws[1].values[1], uint32_t(2));
+        EXPECT_EQ(draws[2].values[0], uint32_t(2));
+        EXPECT_EQ(draws[2].values[1], uint32_t(1));
+
+        renderer.DestroyPipeline(pipeline);
+        renderer.DestroyIndirectBuffer(indirectBuffer);
+        renderer.DestroyIndexBuffer(indexBuffer);
+        renderer.DestroyVertexBuffer(vertexBuffer);
+    }
+
+    TEST(Renderer, NullRenderer_CullIndirectBuffer)
+    {
+        NullRenderer renderer;
+        ASSERT_TRUE(renderer.OpenOffscreen({ 64, 32 }));
+
+        Scene::Camera camera;
+        camera.SetWindowSize({ 64, 32 });
+        camera.PostProcess();
+        const Vector3f32 forward = camera.GetForwardDirection();
+
+        const DrawIndexedIndirectCommand commands[] = { { 3, 1, 0, 0, 0 }, { 6, 1, 3, 0, 1 } };
+        const BoundingVolume bounds[] = {
+            BoundingVolume::FromSphere(forward * -10.0f, 1.0f),
+            BoundingVolume::FromSphere(forward * 10.0f, 1.0f)
+        };
+
+        IndirectBufferDescriptor indirectBufferDesc;
+        indirectBufferDesc.commandCount = 2;
+        indirectBufferDesc.commands = commands;
+        IndirectBuffer* uncullableBuffer = renderer.CreateIndirectBuffer(indirectBufferDesc);
+
+        indirectBufferDesc.bounds = bounds;
+        IndirectBuffer* indirectBuffer = renderer.CreateIndirectBuffer(indirectBufferDesc);
+
+        renderer.BeginDraw();
+        renderer.CullIndirectBuffer(uncullableBuffer, camera.GetFrustum());
+        renderer.CullIndirectBuffer(indirectBuffer, camera.GetFrustum());
+        renderer.EndDraw();
+
+        // Only buffers created with bounding volumes are culled.
+        const auto& stream = renderer.GetFrameStream();
+        ASSERT_EQ(GetOpcodes(stream), std::vector<CommandStream::Opcode>({ CommandStream::Opcode::CullIndirectBuffer }));
+
+        size_t position = 0;
+        CommandStream::Command command;
+        ASSERT_TRUE(stream.Read(position, command));
+        EXPECT_EQ(command.resources[0], indirectBuffer);
+
+        const auto& planes = camera.GetFrustum().GetPlanes();
+        ASSERT_EQ(command.dataSize, sizeof(planes));
+        EXPECT_EQ(std::memcmp(command.data, planes.data(), sizeof(planes)), 0);
+
+        // Draw count is written by culling.
+        renderer.BeginDraw();
+        renderer.DrawVertexBufferIndirectCount(nullptr, nullptr, nullptr, indirectBuffer);
+        renderer.DrawVertexBufferIndirectCount(nullptr, nullptr, nullptr, uncullableBuffer);
+        renderer.EndDraw();
+
+        std::vector<uint32_t> drawCounts;
+        position = 0;
+        while (stream.Read(position, command))
+        {
+            if (command.opcode == CommandStream::Opcode::DrawIndirectCount)
+            {
+                drawCounts.push_back(command.values[1]);
+            }
+        }
+        EXPECT_EQ(drawCounts, std::vector<uint32_t>({ 1, 2 }));
+
+        // Updates of culled buffers are rejected, culling overwrites them.
+        renderer.BeginDraw();
+        renderer.UpdateIndirectBuffer(indirectBuffer, 0, 2, commands);
+        renderer.UpdateIndirectBufferDrawCount(indirectBuffer, 2);
+        renderer.UpdateIndirectBufferDrawCount(uncullableBuffer, 1);
+        renderer.EndDraw();
+        EXPECT_EQ(GetOpcodes(stream), std::vector<CommandStream::Opcode>({ CommandStream::Opcode::UpdateIndirectBufferDrawCount }));
+
+        renderer.DestroyIndirectBuffer(indirectBuffer);
+        renderer.DestroyIndirectBuffer(uncullableBuffer);
+    }
+
+    TEST(Renderer, NullRenderer_Framebuffer)
+    {
+        NullRenderer renderer;
+        ASSERT_TRUE(renderer.OpenOffscreen({ 64, 32 }));
+
+        auto getPassNames = [&]()
+        {
+            const auto& frameGraph = renderer.GetFrameGraph();
+            std::vector<std::string> names;
+            for (const auto& compiledPass : frameGraph.GetCompiledPasses())
+            {
+                names.push_back(frameGraph.GetPassName(compiledPass.pass));
+            }
+            return names;
+        };
+        EXPECT_EQ(getPassNames(), std::vector<std::string>({ "Present" }));
+
+        FramebufferDescriptor framebufferDesc;
+        framebufferDesc.size = { 0, 32 };
+        EXPECT_EQ(renderer.CreateFramebuffer(framebufferDesc), nullptr);
+
+        framebufferDesc.size = { 32, 16 };
+        Framebuffer* framebuffer = renderer.CreateFramebuffer(framebufferDesc);
+        ASSERT_NE(framebuffer, nullptr);
+        framebufferDesc.size = { 128, 64 };
+        Framebuffer* otherFramebuffer = renderer.CreateFramebuffer(framebufferDesc);
+        ASSERT_NE(otherFramebuffer, nullptr);
+
+        VertexBufferDescriptor vertexBufferDesc;
+        vertexBufferDesc.vertexCount = 3;
+        vertexBufferDesc.vertexSize = 16;
+        vertexBufferDesc.data = nullptr;
+        VertexBuffer* vertexBuffer = renderer.CreateVertexBuffer(vertexBufferDesc);
+
+        // Passes of created framebuffers are added at the end of the frame.
+        CommandBuffer* commandBuffer = renderer.CreateCommandBuffer();
+        renderer.BeginDraw();
+        ASSERT_TRUE(commandBuffer->Begin(framebuffer));
+        commandBuffer->DrawVertexBuffer(vertexBuffer);
+        commandBuffer->End();
+
+        renderer.ExecuteCommandBuffer(commandBuffer);
+        renderer.BindFramebuffer(framebuffer);
+        renderer.ExecuteCommandBuffer(commandBuffer);
+        renderer.BindFramebuffer(nullptr);
+        renderer.DrawVertexBuffer(vertexBuffer);
+        renderer.EndDraw();
+
+        // Command buffers are only executed while their framebuffer is bound.
+        using Opcode = CommandStream::Opcode;
+        EXPECT_EQ(GetOpcodes(renderer.GetFrameStream()), std::vector<Opcode>({
+            Opcode::BindFramebuffer, Opcode::BindVertexBuffer, Opcode::Draw,
+            Opcode::BindFramebuffer, Opcode::BindVertexBuffer, Opcode::Draw }));
+
+        EXPECT_EQ(getPassNames(), std::vector<std::string>({ "Framebuffer", "Framebuffer", "Blit", "Present" }));
+        const auto& frameGraph = renderer.GetFrameGraph();
+        EXPECT_EQ(frameGraph.GetResourceCount(), size_t(3));
+        EXPECT_TRUE(frameGraph.IsAllocated(1));
+        EXPECT_TRUE(frameGraph.IsAllocated(2));
+        EXPECT_EQ(frameGraph.GetResourceDescriptor(2).size, Vector2ui32(128, 64));
+
+        // Both framebuffers are read by the blit pass, their textures cannot alias.
+        EXPECT_EQ(frameGraph.GetTransientMemorySize(), frameGraph.GetUnaliasedMemorySize());
+
+        renderer.DestroyFramebuffer(framebuffer);
+        EXPECT_EQ(getPassNames().size(), size_t(4));
+        renderer.BeginDraw();
+        renderer.EndDraw();
+        EXPECT_EQ(getPassNames(), std::vector<std::string>({ "Framebuffer", "Blit", "Present" }));
+
+        renderer.DestroyFramebuffer(otherFramebuffer);
+        renderer.BeginDraw();
+        renderer.EndDraw();
+        EXPECT_EQ(getPassNames(), std::vector<std::string>({ "Present" }));
+
+        renderer.DestroyCommandBuffer(commandBuffer);
+        renderer.DestroyVertexBuffer(vertexBuffer);
+    }
+
+}
\ No newline at end of file
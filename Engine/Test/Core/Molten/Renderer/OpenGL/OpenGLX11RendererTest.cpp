@@ -0,0 +1,153 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/Renderer/OpenGL/OpenGLX11Renderer.hpp"
+#include "Molten/Renderer/Shader/Visual/VisualShaderScript.hpp"
+#include <cstdlib>
+
+#if defined(MOLTEN_ENABLE_OPENGL) && MOLTEN_PLATFORM == MOLTEN_PLATFORM_LINUX
+
+namespace Molten
+{
+
+    TEST(Renderer, OpenGLX11Renderer_Offscreen)
+    {
+        // Requires an X server, such as Xvfb.
+        if (!std::getenv("DISPLAY"))
+        {
+            GTEST_SKIP();
+        }
+
+        OpenGLX11Renderer renderer;
+        ASSERT_TRUE(renderer.OpenOffscreen({ 64, 32 }));
+
+        std::vector<uint8_t> pixels;
+        EXPECT_FALSE(renderer.ReadRenderTarget(pixels));
+
+        renderer.BeginDraw();
+        renderer.EndDraw();
+
+        ASSERT_TRUE(renderer.ReadRenderTarget(pixels));
+        ASSERT_EQ(pixels.size(), size_t(64 * 32 * 4));
+
+        // Cleared by the frame.
+        EXPECT_NEAR(pixels[0], 77, 1);
+        EXPECT_EQ(pixels[1], 0);
+        EXPECT_EQ(pixels[2], 0);
+
+        EXPECT_EQ(renderer.GetMaxFramesInFlight(), OpenGLX11Renderer::DefaultFramesInFlight);
+        for (const size_t maxFramesInFlight : { size_t(1), size_t(3), OpenGLX11Renderer::MaxFramesInFlight + 4, size_t(0) })
+        {
+            renderer.SetMaxFramesInFlight(maxFramesInFlight);
+            for (size_t i = 0; i < 4; i++)
+            {
+                renderer.BeginDraw();
+                renderer.EndDraw();
+            }
+        }
+        EXPECT_EQ(renderer.GetMaxFramesInFlight(), OpenGLX11Renderer::DefaultFramesInFlight);
+
+        renderer.SetMaxFramesInFlight(OpenGLX11Renderer::MaxFramesInFlight + 4);
+        renderer.BeginDraw();
+        renderer.EndDraw();
+        EXPECT_EQ(renderer.GetMaxFramesInFlight(), OpenGLX11Renderer::MaxFramesInFlight);
+        renderer.SetMaxFramesInFlight(0);
+
+#if defined(MOLTEN_ENABLE_GLSLANG)
+        Shader::Visual::VertexScript vertexScript;
+        {
+            auto inPosition = vertexScript.GetInputInterface().AddMember<Vector3f32>();
+            auto inColor = vertexScript.GetInputInterface().AddMember<Vector4f32>();
+            auto outColor = vertexScript.GetOutputInterface().AddMember<Vector4f32>();
+            auto outPosition = vertexScript.GetVertexOutputVariable();
+
+            auto position = vertexScript.CreateFunction<Shader::Visual::Functions::Vec3ToVec4f32>();
+            position->GetInputPin(0)->Connect(*inPosition->GetOutputPin());
+            static_cast<Shader::Visual::InputPin<float>*>(position->GetInputPin(1))->SetDefaultValue(1.0f);
+
+            outPosition->GetInputPin()->Connect(*position->GetOutputPin());
+            outColor->GetInputPin()->Connect(*inColor->GetOutputPin());
+        }
+
+        Shader::Visual::FragmentScript fragmentScript;
+        {
+            auto inColor = fragmentScript.GetInputInterface().AddMember<Vector4f32>();
+            auto outColor = fragmentScript.GetOutputInterface().AddMember<Vector4f32>();
+            outColor->GetInputPin()->Connect(*inColor->GetOutputPin());
+        }
+
+        PipelineDescriptor pipelineDesc;
+        pipelineDesc.topology = Pipeline::Topology::TriangleList;
+        pipelineDesc.polygonMode = Pipeline::PolygonMode::Fill;
+        pipelineDesc.frontFace = Pipeline::FrontFace::Clockwise;
+        pipelineDesc.cullMode = Pipeline::CullMode::None;
+        pipelineDesc.vertexScript = &vertexScript;
+        pipelineDesc.fragmentScript = &fragmentScript;
+
+        Pipeline* pipeline = renderer.CreatePipeline(pipelineDesc);
+        ASSERT_NE(pipeline, nullptr);
+
+        // Single triangle covering the entire render target.
+        struct Vertex
+        {
+            Vector3f32 position;
+            Vector4f32 color;
+        };
+        const Vertex vertices[] =
+        {
+            { { -1.0f, -1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 1.0f } },
+            { { 3.0f, -1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 1.0f } },
+            { { -1.0f, 3.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 1.0f } }
+        };
+
+        VertexBufferDescriptor vertexBufferDesc;
+        vertexBufferDesc.vertexCount = 3;
+        vertexBufferDesc.vertexSize = sizeof(Vertex);
+        vertexBufferDesc.data = vertices;
+        VertexBuffer* vertexBuffer = renderer.CreateVertexBuffer(vertexBufferDesc);
+        ASSERT_NE(vertexBuffer, nullptr);
+
+        renderer.BeginDraw();
+        renderer.BindPipeline(pipeline);
+        renderer.DrawVertexBuffer(vertexBuffer);
+        renderer.EndDraw();
+
+        ASSERT_TRUE(renderer.ReadRenderTarget(pixels));
+        for (const size_t pixel : { size_t(0), size_t(64 * 16 + 32), size_t(64 * 32 - 1) })
+        {
+            EXPECT_EQ(pixels[pixel * 4], 0);
+            EXPECT_EQ(pixels[pixel * 4 + 1], 255);
+            EXPECT_EQ(pixels[pixel * 4 + 2], 0);
+        }
+
+        renderer.DestroyVertexBuffer(vertexBuffer);
+        renderer.DestroyPipeline(pipeline);
+#endif
+    }
+
+}
+
+#endif
@@ -0,0 +1,90 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/Renderer/PushConstant.hpp"
+#include "Molten/Math/Vector.hpp"
+
+namespace Molten
+{
+
+    TEST(Renderer, PushConstantBuffer)
+    {
+        PushConstantBuffer buffer;
+        EXPECT_EQ(buffer.GetSize(), uint32_t(0));
+        EXPECT_FALSE(buffer.IsDirty());
+
+        buffer.Resize(64);
+        EXPECT_EQ(buffer.GetSize(), uint32_t(64));
+        EXPECT_FALSE(buffer.IsDirty());
+
+        // Writes are merged into a single dirty range.
+        const float value = 2.0f;
+        const Vector4f32 color(1.0f, 2.0f, 3.0f, 4.0f);
+        EXPECT_TRUE(buffer.Write(32, &value, sizeof(value)));
+        EXPECT_TRUE(buffer.IsDirty());
+        EXPECT_EQ(buffer.GetDirtyOffset(), uint32_t(32));
+        EXPECT_EQ(buffer.GetDirtySize(), uint32_t(4));
+
+        EXPECT_TRUE(buffer.Write(0, &color, sizeof(color)));
+        EXPECT_EQ(buffer.GetDirtyOffset(), uint32_t(0));
+        EXPECT_EQ(buffer.GetDirtySize(), uint32_t(36));
+
+        EXPECT_TRUE(buffer.Write(8, &value, sizeof(value)));
+        EXPECT_EQ(buffer.GetDirtyOffset(), uint32_t(0));
+        EXPECT_EQ(buffer.GetDirtySize(), uint32_t(36));
+
+        const auto* data = reinterpret_cast<const float*>(buffer.GetData());
+        EXPECT_EQ(data[0], 1.0f);
+        EXPECT_EQ(data[1], 2.0f);
+        EXPECT_EQ(data[2], 2.0f);
+        EXPECT_EQ(data[3], 4.0f);
+        EXPECT_EQ(data[8], 2.0f);
+
+        buffer.ClearDirty();
+        EXPECT_FALSE(buffer.IsDirty());
+        EXPECT_EQ(data[0], 1.0f);
+
+        // Out of bounds writes are rejected.
+        EXPECT_FALSE(buffer.Write(62, &value, sizeof(value)));
+        EXPECT_FALSE(buffer.IsDirty());
+        EXPECT_TRUE(buffer.Write(60, &value, sizeof(value)));
+        EXPECT_EQ(buffer.GetDirtyOffset(), uint32_t(60));
+        EXPECT_EQ(buffer.GetDirtySize(), uint32_t(4));
+
+        // Shrinking clamps the dirty range.
+        buffer.Resize(62);
+        EXPECT_EQ(buffer.GetDirtyOffset(), uint32_t(60));
+        EXPECT_EQ(buffer.GetDirtySize(), uint32_t(2));
+        buffer.Resize(16);
+        EXPECT_FALSE(buffer.IsDirty());
+
+        buffer.Reset();
+        EXPECT_FALSE(buffer.IsDirty());
+        EXPECT_EQ(buffer.GetSize(), uint32_t(16));
+        EXPECT_EQ(reinterpret_cast<const float*>(buffer.GetData())[0], 0.0f);
+    }
+
+}
\ No newline at end of file
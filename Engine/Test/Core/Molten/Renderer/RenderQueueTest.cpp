@@ -0,0 +1,193 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/Renderer/RenderQueue.hpp"
+#include "Molten/Renderer/Null/NullRenderer.hpp"
+#include "Molten/System/ThreadPool.hpp"
+#include <algorithm>
+#include <random>
+
+namespace Molten
+{
+
+    static void TestRenderQueueSort(ThreadPool* threadPool, const size_t packetCount)
+    {
+        RenderQueue renderQueue(threadPool);
+
+        std::mt19937_64 random(1234);
+        std::vector<uint64_t> keys(packetCount);
+        for (size_t i = 0; i < packetCount; i++)
+        {
+            // Few distinct pipelines and materials, to produce equal keys.
+            keys[i] = RenderQueue::CreateSortKey(
+                static_cast<uint8_t>(random() % 3),
+                static_cast<uint16_t>(random() % 8),
+                static_cast<uint16_t>(random() % 16),
+                static_cast<uint32_t>(random() % 64));
+
+            DrawPacket packet;
+            packet.sortKey = keys[i];
+            packet.instanceCount = static_cast<uint32_t>(i);
+            renderQueue.Push(packet);
+        }
+
+        renderQueue.Sort();
+        ASSERT_EQ(renderQueue.GetPacketCount(), packetCount);
+
+        std::vector<size_t> expectedOrder(packetCount);
+        for (size_t i = 0; i < packetCount; i++)
+        {
+            expectedOrder[i] = i;
+        }
+        std::stable_sort(expectedOrder.begin(), expectedOrder.end(), [&](const size_t lhs, const size_t rhs)
+        {
+            return keys[lhs] < keys[rhs];
+        });
+
+        for (size_t i = 0; i < packetCount; i++)
+        {
+            ASSERT_EQ(renderQueue.GetPacket(i).instanceCount, static_cast<uint32_t>(expectedOrder[i]));
+        }
+    }
+
+    TEST(Renderer, RenderQueue_SortKey)
+    {
+        EXPECT_LT(RenderQueue::CreateSortKey(0, 5, 5, 5), RenderQueue::CreateSortKey(1, 0, 0, 0));
+        EXPECT_LT(RenderQueue::CreateSortKey(1, 0, 5, 5), RenderQueue::CreateSortKey(1, 1, 0, 0));
+        EXPECT_LT(RenderQueue::CreateSortKey(1, 1, 0, 5), RenderQueue::CreateSortKey(1, 1, 1, 0));
+        EXPECT_LT(RenderQueue::CreateSortKey(1, 1, 1, 0), RenderQueue::CreateSortKey(1, 1, 1, 1));
+        EXPECT_EQ(RenderQueue::CreateSortKey(0, 0, 0, 0x1FFFFFF), RenderQueue::CreateSortKey(0, 0, 0, 0xFFFFFF));
+
+        EXPECT_EQ(RenderQueue::QuantizeDepth(0.0f), uint32_t(0));
+        EXPECT_EQ(RenderQueue::QuantizeDepth(1.0f), uint32_t(0xFFFFFF));
+        EXPECT_EQ(RenderQueue::QuantizeDepth(2.0f), uint32_t(0xFFFFFF));
+        EXPECT_EQ(RenderQueue::QuantizeDepth(-1.0f), uint32_t(0));
+        EXPECT_EQ(RenderQueue::QuantizeDepth(0.0f, true), uint32_t(0xFFFFFF));
+        EXPECT_LT(RenderQueue::QuantizeDepth(0.25f), RenderQueue::QuantizeDepth(0.5f));
+        EXPECT_GT(RenderQueue::QuantizeDepth(0.25f, true), RenderQueue::QuantizeDepth(0.5f, true));
+    }
+
+    TEST(Renderer, RenderQueue_Sort)
+    {
+        {
+            RenderQueue renderQueue;
+            renderQueue.Sort();
+            EXPECT_EQ(renderQueue.GetPacketCount(), size_t(0));
+        }
+
+        TestRenderQueueSort(nullptr, 1);
+        TestRenderQueueSort(nullptr, 1000);
+        TestRenderQueueSort(nullptr, RenderQueue::ParallelSortThreshold * 4);
+
+        ThreadPool threadPool(4);
+        TestRenderQueueSort(&threadPool, 1000);
+        TestRenderQueueSort(&threadPool, RenderQueue::ParallelSortThreshold * 4 + 7);
+
+        {
+            Molten::Test::Benchmarker bench("Render queue - parallel sort of 100000 packets");
+            TestRenderQueueSort(&threadPool, 100000);
+        }
+    }
+
+    TEST(Renderer, RenderQueue_Clear)
+    {
+        RenderQueue renderQueue;
+
+        DrawPacket packet;
+        packet.sortKey = 2;
+        renderQueue.Push(packet);
+        packet.sortKey = 1;
+        renderQueue.Push(packet);
+
+        EXPECT_EQ(renderQueue.GetPacket(0).sortKey, uint64_t(2));
+        renderQueue.Sort();
+        EXPECT_EQ(renderQueue.GetPacket(0).sortKey, uint64_t(1));
+
+        // Pushing after sorting returns to push order until the next sort.
+        packet.sortKey = 0;
+        renderQueue.Push(packet);
+        EXPECT_EQ(renderQueue.GetPacket(0).sortKey, uint64_t(2));
+        EXPECT_EQ(renderQueue.GetPacket(2).sortKey, uint64_t(0));
+
+        renderQueue.Clear();
+        EXPECT_EQ(renderQueue.GetPacketCount(), size_t(0));
+    }
+
+    TEST(Renderer, RenderQueue_Submit)
+    {
+        NullRenderer renderer;
+        ASSERT_TRUE(renderer.OpenOffscreen({ 64, 32 }));
+
+        Pipeline* pipelines[2] = { renderer.CreatePipeline(PipelineDescriptor()), renderer.CreatePipeline(PipelineDescriptor()) };
+
+        VertexBufferDescriptor vertexBufferDesc;
+        vertexBufferDesc.vertexCount = 3;
+        vertexBufferDesc.vertexSize = 12;
+        vertexBufferDesc.data = nullptr;
+        VertexBuffer* vertexBuffer = renderer.CreateVertexBuffer(vertexBufferDesc);
+
+        // Interleaved pipelines are grouped by sorting, only one bind per pipeline is submitted.
+        RenderQueue renderQueue;
+        for (uint32_t i = 0; i < 100; i++)
+        {
+            DrawPacket packet;
+            packet.sortKey = RenderQueue::CreateSortKey(0, static_cast<uint16_t>(i % 2), 0, i);
+            packet.pipeline = pipelines[i % 2];
+            packet.vertexBuffer = vertexBuffer;
+            renderQueue.Push(packet);
+        }
+        renderQueue.Sort();
+
+        renderer.BeginDraw();
+        renderQueue.Submit(renderer);
+        renderer.EndDraw();
+
+        size_t pipelineBinds = 0;
+        size_t draws = 0;
+        size_t position = 0;
+        CommandStream::Command command;
+        while (renderer.GetFrameStream().Read(position, command))
+        {
+            pipelineBinds += command.opcode == CommandStream::Opcode::BindPipeline ? 1 : 0;
+            draws += command.opcode == CommandStream::Opcode::Draw ? 1 : 0;
+        }
+        EXPECT_EQ(pipelineBinds, size_t(2));
+        EXPECT_EQ(draws, size_t(100));
+        EXPECT_EQ(renderer.GetBindStatistics().pipelineBinds, uint32_t(2));
+
+        {
+            Molten::Test::Benchmarker bench("Render queue - submit of 100 packets to null renderer");
+            renderer.BeginDraw();
+            renderQueue.Submit(renderer);
+            renderer.EndDraw();
+        }
+
+        renderer.DestroyVertexBuffer(vertexBuffer);
+        renderer.DestroyPipeline(pipelines[0]);
+        renderer.DestroyPipeline(pipelines[1]);
+    }
+
+}
\ No newline at end of file
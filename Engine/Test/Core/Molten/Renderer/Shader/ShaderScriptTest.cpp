@@ -92,6 +92,92 @@ namespace Molten::Shader::Visual
         EXPECT_STREQ(sourceStr.c_str(), expectedSource.c_str());
     }
 
+    TEST(Shader, Script_GenerateGlsl_OpenGL)
+    {
+        FragmentScript script;
+
+        auto output = script.GetOutputInterface().AddMember<Vector4f32>();
+        auto uniforms = script.GetUniformInterfaces().AddInterface(3);
+        auto color = uniforms->AddMember<Vector4f32>();
+        script.GetPushConstantInterface().AddMember<Vector4f32>(123);
+
+        auto add = script.CreateOperator<Shader::Visual::Operators::AddVec4f32>();
+        add->GetInputPin(0)->Connect(*color->GetOutputPin());
+        output->GetInputPin()->Connect(*add->GetOutputPin());
+
+        VulkanGenerator::GlslTemplates glslTemplates;
+        EXPECT_TRUE(VulkanGenerator::GenerateGlslTemplate(glslTemplates, { &script }, nullptr));
+
+        VulkanGenerator::GlslStageTemplates stageTemplates;
+        stageTemplates.pushConstantTemplate.blockSource = &glslTemplates.pushConstantTemplate.blockSource;
+        stageTemplates.pushConstantTemplate.offsets = &glslTemplates.pushConstantTemplate.stageOffsets[0];
+
+        const auto source = VulkanGenerator::GenerateGlsl(script, &stageTemplates, nullptr, VulkanGenerator::TargetApi::OpenGL);
+        EXPECT_GT(source.size(), size_t(0));
+        const std::string sourceStr(source.begin(), source.end());
+
+        static const std::string expectedSource =
+            "#version 450\n"
+            "#extension GL_ARB_separate_shader_objects : enable\n"
+            "layout(std140, binding = 0) uniform s_ubo_0\n"
+            "{\n"
+            "vec4 var_0;\n"
+            "} ubo_0;\n"
+            "layout(std140, binding = 32) uniform s_fragment_pc\n"
+            "{\n"
+            "layout(offset = 0) vec4 mem0;\n"
+            "} pc;\n"
+            "layout(location = 0) out vec4 out_0;\n"
+            "void main(){\n"
+            "vec4 add_0 = ubo_0.var_0 + vec4(0, 0, 0, 0);\n"
+            "out_0 = add_0;\n"
+            "}\n";
+
+        EXPECT_STREQ(sourceStr.c_str(), expectedSource.c_str());
+    }
+
+    TEST(Shader, Script_GenerateGlsl_InstanceInput)
+    {
+        VertexScript script;
+
+        auto position = script.GetInputInterface().AddMember<Vector4f32>();
+        auto color = script.GetInputInterface().AddMember<Vector4f32>();
+        auto transform = script.GetInstanceInputInterface()->AddMember<Matrix4x4f32>();
+        auto tint = script.GetInstanceInputInterface()->AddMember<Vector4f32>();
+        auto output = script.GetOutputInterface().AddMember<Vector4f32>();
+        auto mult = script.CreateOperator<Shader::Visual::Operators::MultMat4Vec4f32>();
+        auto multColor = script.CreateOperator<Shader::Visual::Operators::MultVec4f32>();
+
+        mult->GetInputPin(0)->Connect(*transform->GetOutputPin());
+        mult->GetInputPin(1)->Connect(*position->GetOutputPin());
+        script.GetVertexOutputVariable()->GetInputPin()->Connect(*mult->GetOutputPin());
+
+        multColor->GetInputPin(0)->Connect(*color->GetOutputPin());
+        multColor->GetInputPin(1)->Connect(*tint->GetOutputPin());
+        output->GetInputPin()->Connect(*multColor->GetOutputPin());
+
+        const auto source = VulkanGenerator::GenerateGlsl(script, nullptr);
+        EXPECT_GT(source.size(), size_t(0));
+        const std::string sourceStr(source.begin(), source.end());
+
+        static const std::string expectedSource =
+            "#version 450\n"
+            "#extension GL_ARB_separate_shader_objects : enable\n"
+            "layout(location = 0) in vec4 in_0;\n"
+            "layout(location = 1) in vec4 in_1;\n"
+            "layout(location = 2) in mat4 in_2;\n"
+            "layout(location = 6) in vec4 in_3;\n"
+            "layout(location = 0) out vec4 out_0;\n"
+            "void main(){\n"
+            "vec4 mul_0 = in_1 * in_3;\n"
+            "out_0 = mul_0;\n"
+            "vec4 mul_1 = in_2 * in_0;\n"
+            "gl_Position = mul_1;\n"
+            "}\n";
+
+        EXPECT_STREQ(sourceStr.c_str(), expectedSource.c_str());
+    }
+
     TEST(Shader, Script_DefaultPinValue)
     {
         // Cos
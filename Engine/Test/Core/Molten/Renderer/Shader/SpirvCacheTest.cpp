@@ -0,0 +1,107 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/Renderer/Shader/SpirvCache.hpp"
+#include <filesystem>
+
+namespace Molten::Shader
+{
+
+    TEST(Shader, SpirvCache)
+    {
+        const std::vector<uint8_t> glslCode1 = { 'v', 'o', 'i', 'd', ' ', 'm', 'a', 'i', 'n', '(', ')', '{', '}' };
+        const std::vector<uint8_t> glslCode2 = { 'v', 'o', 'i', 'd', ' ', 'm', 'a', 'i', 'n', '(', ')', '{', ' ', '}' };
+
+        const uint64_t key1 = SpirvCache::CreateKey(glslCode1, Type::Vertex);
+        EXPECT_EQ(key1, SpirvCache::CreateKey(glslCode1, Type::Vertex));
+        EXPECT_NE(key1, SpirvCache::CreateKey(glslCode1, Type::Fragment));
+        EXPECT_NE(key1, SpirvCache::CreateKey(glslCode2, Type::Vertex));
+
+        const std::vector<uint8_t> spirvCode = {
+            0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+        const std::vector<uint8_t> invalidCode = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+        {
+            SpirvCache cache;
+            std::vector<uint8_t> code;
+            EXPECT_FALSE(cache.Load(key1, code));
+            EXPECT_FALSE(cache.Store(key1, invalidCode));
+            EXPECT_TRUE(cache.Store(key1, spirvCode));
+            EXPECT_EQ(cache.GetEntryCount(), size_t(1));
+            EXPECT_TRUE(cache.Load(key1, code));
+            EXPECT_EQ(code, spirvCode);
+
+            cache.Clear();
+            EXPECT_EQ(cache.GetEntryCount(), size_t(0));
+            EXPECT_FALSE(cache.Load(key1, code));
+        }
+        {
+            const auto directoryPath = std::filesystem::temp_directory_path() / "MoltenSpirvCacheTest";
+            std::filesystem::remove_all(directoryPath);
+            std::filesystem::create_directories(directoryPath);
+            const std::string directory = directoryPath.string();
+            {
+                SpirvCache cache(directory);
+                EXPECT_TRUE(cache.Store(key1, spirvCode));
+            }
+            {
+                SpirvCache cache(directory);
+                std::vector<uint8_t> code;
+                EXPECT_TRUE(cache.Load(key1, code));
+                EXPECT_EQ(code, spirvCode);
+                EXPECT_EQ(cache.GetEntryCount(), size_t(1));
+            }
+            {
+                const size_t loadCount = 1000;
+                std::vector<uint8_t> code;
+                {
+                    Molten::Test::Benchmarker bench("SPIR-V cache - 1000 cold loads from disk");
+                    for (size_t i = 0; i < loadCount; i++)
+                    {
+                        SpirvCache cache(directory);
+                        EXPECT_TRUE(cache.Load(key1, code));
+                    }
+                }
+
+                SpirvCache cache(directory);
+                EXPECT_TRUE(cache.Load(key1, code));
+                {
+                    Molten::Test::Benchmarker bench("SPIR-V cache - 1000 warm loads from memory");
+                    for (size_t i = 0; i < loadCount; i++)
+                    {
+                        EXPECT_TRUE(cache.Load(key1, code));
+                    }
+                }
+                EXPECT_EQ(code, spirvCode);
+            }
+
+            std::filesystem::remove_all(directoryPath);
+            EXPECT_FALSE(std::filesystem::exists(directoryPath));
+        }
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/Renderer/TextureStreamer.hpp"
+#include "Molten/System/Exception.hpp"
+
+namespace Molten
+{
+
+    namespace
+    {
+        class TestTexture : public Texture
+        {
+
+        public:
+
+            TestTexture() = default;
+            ~TestTexture() = default;
+
+        };
+    }
+
+    TEST(Renderer, Texture_MipLevels)
+    {
+        EXPECT_EQ(Texture::GetMipLevelCount({ 1, 1 }), uint32_t(1));
+        EXPECT_EQ(Texture::GetMipLevelCount({ 256, 128 }), uint32_t(9));
+        EXPECT_EQ(Texture::GetMipLevelCount({ 100, 3 }), uint32_t(7));
+
+        EXPECT_EQ(Texture::GetMipLevelDimensions({ 256, 128 }, 1), Vector2ui32(128, 64));
+        EXPECT_EQ(Texture::GetMipLevelDimensions({ 256, 128 }, 8), Vector2ui32(1, 1));
+        EXPECT_EQ(Texture::GetMipLevelDimensions({ 100, 3 }, 2), Vector2ui32(25, 1));
+
+        EXPECT_EQ(Texture::GetMipChainSize({ 4, 4 }, Texture::Format::Rgba8, 0, 3), size_t((16 + 4 + 1) * 4));
+        EXPECT_EQ(Texture::GetMipChainSize({ 4, 4 }, Texture::Format::Red8, 1, 2), size_t(4 + 1));
+    }
+
+    TEST(Renderer, TextureStreamer_CoarseFirst)
+    {
+        TestTexture largeTexture;
+        TestTexture smallTexture;
+        const size_t initialSize = Texture::GetMipChainSize({ 64, 64 }, Texture::Format::Rgba8, 0, 7);
+
+        TextureStreamer streamer;
+        streamer.Add(&largeTexture, { 1024, 1024 }, Texture::Format::Rgba8, 11);
+        streamer.Add(&smallTexture, { 256, 256 }, Texture::Format::Rgba8, 9);
+        EXPECT_THROW(streamer.Add(&smallTexture, { 256, 256 }, Texture::Format::Rgba8, 9), Exception);
+        EXPECT_EQ(streamer.GetResidentMipLevel(&largeTexture), uint32_t(11));
+
+        // First requests make the 64x64 chain resident.
+        std::vector<TextureStreamer::Request> requests;
+        streamer.Update(requests);
+        ASSERT_EQ(requests.size(), size_t(2));
+        EXPECT_EQ(requests[0].texture, &largeTexture);
+        EXPECT_EQ(requests[0].mipLevel, uint32_t(4));
+        EXPECT_EQ(requests[0].uploadSize, initialSize);
+        EXPECT_EQ(requests[1].texture, &smallTexture);
+        EXPECT_EQ(requests[1].mipLevel, uint32_t(2));
+        EXPECT_EQ(streamer.GetResidentSize(), initialSize * 2);
+
+        // Refined one level at a time, the small texture is complete before the large texture passes 256x256.
+        for (size_t i = 0; i < 2; i++)
+        {
+            streamer.Update(requests);
+            ASSERT_EQ(requests.size(), size_t(2));
+        }
+        EXPECT_TRUE(streamer.IsFullyResident(&smallTexture));
+        EXPECT_EQ(streamer.GetResidentMipLevel(&largeTexture), uint32_t(2));
+
+        for (size_t i = 0; i < 2; i++)
+        {
+            streamer.Update(requests);
+            ASSERT_EQ(requests.size(), size_t(1));
+            EXPECT_EQ(requests[0].texture, &largeTexture);
+        }
+        EXPECT_TRUE(streamer.IsFullyResident(&largeTexture));
+        EXPECT_EQ(streamer.GetResidentSize(),
+            Texture::GetMipChainSize({ 1024, 1024 }, Texture::Format::Rgba8, 0, 11) +
+            Texture::GetMipChainSize({ 256, 256 }, Texture::Format::Rgba8, 0, 9));
+
+        streamer.Update(requests);
+        EXPECT_TRUE(requests.empty());
+
+        streamer.Remove(&largeTexture);
+        EXPECT_EQ(streamer.GetTextureCount(), size_t(1));
+        EXPECT_EQ(streamer.GetResidentSize(), Texture::GetMipChainSize({ 256, 256 }, Texture::Format::Rgba8, 0, 9));
+        EXPECT_THROW(streamer.GetResidentMipLevel(&largeTexture), Exception);
+    }
+
+    TEST(Renderer, TextureStreamer_Reject)
+    {
+        TestTexture texture;
+        const size_t initialSize = Texture::GetMipChainSize({ 64, 64 }, Texture::Format::Rgba8, 0, 7);
+
+        TextureStreamer streamer;
+        streamer.Add(&texture, { 128, 128 }, Texture::Format::Rgba8, 8);
+
+        // Rejected initial request leaves the texture without any resident level.
+        std::vector<TextureStreamer::Request> requests;
+        streamer.Update(requests);
+        ASSERT_EQ(requests.size(), size_t(1));
+        streamer.Reject(&texture);
+        EXPECT_EQ(streamer.GetResidentMipLevel(&texture), uint32_t(8));
+        EXPECT_EQ(streamer.GetResidentSize(), size_t(0));
+
+        // Retried by the next update.
+        streamer.Update(requests);
+        ASSERT_EQ(requests.size(), size_t(1));
+        EXPECT_EQ(requests[0].mipLevel, uint32_t(1));
+        EXPECT_EQ(streamer.GetResidentSize(), initialSize);
+
+        // Rejected refinement restores the previous chain.
+        streamer.Update(requests);
+        ASSERT_EQ(requests.size(), size_t(1));
+        EXPECT_TRUE(streamer.IsFullyResident(&texture));
+        streamer.Reject(&texture);
+        EXPECT_EQ(streamer.GetResidentMipLevel(&texture), uint32_t(1));
+        EXPECT_EQ(streamer.GetResidentSize(), initialSize);
+
+        streamer.Update(requests);
+        ASSERT_EQ(requests.size(), size_t(1));
+        EXPECT_EQ(requests[0].mipLevel, uint32_t(0));
+        EXPECT_TRUE(streamer.IsFullyResident(&texture));
+        EXPECT_EQ(streamer.GetResidentSize(), Texture::GetMipChainSize({ 128, 128 }, Texture::Format::Rgba8, 0, 8));
+    }
+
+    TEST(Renderer, TextureStreamer_Budgets)
+    {
+        TestTexture textures[3];
+
+        TextureStreamer streamer(0, 1);
+        for (auto& texture : textures)
+        {
+            streamer.Add(&texture, { 512, 512 }, Texture::Format::Rgba8, 10);
+        }
+
+        // At least one request per update, and initial chains ignore the memory budget.
+        std::vector<TextureStreamer::Request> requests;
+        for (size_t i = 0; i < 3; i++)
+        {
+            streamer.Update(requests);
+            ASSERT_EQ(requests.size(), size_t(1));
+            EXPECT_EQ(requests[0].texture, &textures[i]);
+        }
+
+        streamer.Update(requests);
+        EXPECT_TRUE(requests.empty());
+
+        // Refinement is limited by the memory budget.
+        const size_t residentSize = streamer.GetResidentSize();
+        const size_t refinedSize = Texture::GetMipChainSize({ 512, 512 }, Texture::Format::Rgba8, 2, 8);
+        streamer.SetMemoryBudget(residentSize + refinedSize);
+        streamer.SetFrameUploadBudget(refinedSize * 3);
+
+        streamer.Update(requests);
+        ASSERT_EQ(requests.size(), size_t(1));
+        EXPECT_EQ(requests[0].mipLevel, uint32_t(2));
+        EXPECT_EQ(requests[0].uploadSize, refinedSize);
+        EXPECT_LE(streamer.GetResidentSize(), residentSize + refinedSize);
+    }
+
+}
\ No newline at end of file
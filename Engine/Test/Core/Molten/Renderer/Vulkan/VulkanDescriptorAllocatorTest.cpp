@@ -0,0 +1,299 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/Renderer/Vulkan/VulkanDescriptorAllocator.hpp"
+
+#if defined(MOLTEN_ENABLE_VULKAN)
+
+namespace Molten
+{
+
+    namespace
+    {
+        /** Minimal instance and logical device, without any surface or swapchain. */
+        struct TestDevice
+        {
+            TestDevice() :
+                instance(VK_NULL_HANDLE),
+                physicalDevice(VK_NULL_HANDLE),
+                device(VK_NULL_HANDLE)
+            {
+                VkApplicationInfo appInfo = {};
+                appInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+                appInfo.apiVersion = VK_API_VERSION_1_0;
+
+                VkInstanceCreateInfo instanceInfo = {};
+                instanceInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+                instanceInfo.pApplicationInfo = &appInfo;
+                if (vkCreateInstance(&instanceInfo, nullptr, &instance) != VK_SUCCESS)
+                {
+                    instance = VK_NULL_HANDLE;
+                    return;
+                }
+
+                uint32_t physicalDeviceCount = 1;
+                if (vkEnumeratePhysicalDevices(instance, &physicalDeviceCount, &physicalDevice) < VK_SUCCESS || !physicalDeviceCount)
+                {
+                    return;
+                }
+
+                const float queuePriority = 1.0f;
+                VkDeviceQueueCreateInfo queueInfo = {};
+                queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+                queueInfo.queueFamilyIndex = 0;
+                queueInfo.queueCount = 1;
+                queueInfo.pQueuePriorities = &queuePriority;
+
+                VkDeviceCreateInfo deviceInfo = {};
+                deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+                deviceInfo.queueCreateInfoCount = 1;
+                deviceInfo.pQueueCreateInfos = &queueInfo;
+                if (vkCreateDevice(physicalDevice, &deviceInfo, nullptr, &device) != VK_SUCCESS)
+                {
+                    device = VK_NULL_HANDLE;
+                }
+            }
+
+            ~TestDevice()
+            {
+                if (device != VK_NULL_HANDLE)
+                {
+                    vkDestroyDevice(device, nullptr);
+                }
+                if (instance != VK_NULL_HANDLE)
+                {
+                    vkDestroyInstance(instance, nullptr);
+                }
+            }
+
+            VkDescriptorSetLayout CreateLayout(const uint32_t uniformBufferCount)
+            {
+                VkDescriptorSetLayoutBinding binding = {};
+                binding.binding = 0;
+                binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+                binding.descriptorCount = uniformBufferCount;
+                binding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+                VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+                layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+                layoutInfo.bindingCount = 1;
+                layoutInfo.pBindings = &binding;
+
+                VkDescriptorSetLayout layout = VK_NULL_HANDLE;
+                vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &layout);
+                return layout;
+            }
+
+            bool CreateBuffer(const VkDeviceSize size, VkBuffer& buffer, VkDeviceMemory& memory)
+            {
+                VkBufferCreateInfo bufferInfo = {};
+                bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+                bufferInfo.size = size;
+                bufferInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+                bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+                if (vkCreateBuffer(device, &bufferInfo, nullptr, &buffer) != VK_SUCCESS)
+                {
+                    return false;
+                }
+
+                VkMemoryRequirements memoryRequirements;
+                vkGetBufferMemoryRequirements(device, buffer, &memoryRequirements);
+
+                VkPhysicalDeviceMemoryProperties memoryProperties;
+                vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+
+                uint32_t memoryTypeIndex = 0;
+                while (memoryTypeIndex < memoryProperties.memoryTypeCount && !(memoryRequirements.memoryTypeBits & (1u << memoryTypeIndex)))
+                {
+                    ++memoryTypeIndex;
+                }
+
+                VkMemoryAllocateInfo allocateInfo = {};
+                allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+                allocateInfo.allocationSize = memoryRequirements.size;
+                allocateInfo.memoryTypeIndex = memoryTypeIndex;
+                if (memoryTypeIndex == memoryProperties.memoryTypeCount ||
+                    vkAllocateMemory(device, &allocateInfo, nullptr, &memory) != VK_SUCCESS)
+                {
+                    vkDestroyBuffer(device, buffer, nullptr);
+                    return false;
+                }
+
+                vkBindBufferMemory(device, buffer, memory, 0);
+                return true;
+            }
+
+            void DestroyBuffer(VkBuffer buffer, VkDeviceMemory memory)
+            {
+                vkDestroyBuffer(device, buffer, nullptr);
+                vkFreeMemory(device, memory, nullptr);
+            }
+
+            VkInstance instance;
+            VkPhysicalDevice physicalDevice;
+            VkDevice device;
+        };
+    }
+
+    TEST(Renderer, VulkanDescriptorCounts)
+    {
+        const auto capacity = VulkanDescriptorCounts::CreatePoolCapacity(4);
+        EXPECT_EQ(capacity.uniformBufferDynamic, uint32_t(8));
+        EXPECT_EQ(capacity.uniformBuffer, uint32_t(8));
+        EXPECT_EQ(capacity.storageBuffer, uint32_t(4));
+        EXPECT_EQ(capacity.combinedImageSampler, uint32_t(16));
+
+        VulkanDescriptorCounts counts;
+        EXPECT_TRUE(capacity.Fits(counts));
+        EXPECT_TRUE(counts.Add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 8));
+        EXPECT_TRUE(capacity.Fits(counts));
+        EXPECT_TRUE(counts.Add(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 5));
+        EXPECT_FALSE(capacity.Fits(counts));
+        EXPECT_FALSE(counts.Add(VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 1));
+
+        auto remaining = capacity;
+        VulkanDescriptorCounts set;
+        set.Add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 3);
+        remaining -= set;
+        EXPECT_EQ(remaining.uniformBufferDynamic, uint32_t(5));
+        remaining -= set;
+        EXPECT_FALSE(remaining.Fits(set));
+        remaining += set;
+        EXPECT_TRUE(remaining.Fits(set));
+    }
+
+    TEST(Renderer, VulkanDescriptorArena)
+    {
+        TestDevice testDevice;
+        if (testDevice.device == VK_NULL_HANDLE)
+        {
+            GTEST_SKIP();
+        }
+
+        VkDescriptorSetLayout layout = testDevice.CreateLayout(1);
+        VkDescriptorSetLayout largeLayout = testDevice.CreateLayout(3);
+        ASSERT_NE(layout, VK_NULL_HANDLE);
+        ASSERT_NE(largeLayout, VK_NULL_HANDLE);
+
+        VulkanDescriptorCounts counts;
+        counts.Add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1);
+        VulkanDescriptorCounts largeCounts;
+        largeCounts.Add(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 3);
+
+        {
+            VulkanDescriptorArena arena;
+            ASSERT_TRUE(arena.Open(testDevice.device, nullptr, 2));
+
+            // Two sets per pool, five sets requires three pools.
+            VkDescriptorSet set = VK_NULL_HANDLE;
+            for (size_t i = 0; i < 5; i++)
+            {
+                ASSERT_TRUE(arena.Allocate(layout, counts, set));
+                EXPECT_NE(set, VK_NULL_HANDLE);
+            }
+            EXPECT_EQ(arena.GetPoolCount(), size_t(3));
+
+            // Pools are reused after reset.
+            arena.Reset();
+            for (size_t i = 0; i < 6; i++)
+            {
+                ASSERT_TRUE(arena.Allocate(layout, counts, set));
+            }
+            EXPECT_EQ(arena.GetPoolCount(), size_t(3));
+
+            // Pools of two sets provide four dynamic uniform buffers, one large set exhausts the descriptors before the sets.
+            arena.Reset();
+            ASSERT_TRUE(arena.Allocate(largeLayout, largeCounts, set));
+            ASSERT_TRUE(arena.Allocate(largeLayout, largeCounts, set));
+            EXPECT_EQ(arena.GetPoolCount(), size_t(2));
+
+            arena.Close();
+            ASSERT_TRUE(arena.Open(testDevice.device, nullptr, 1));
+            EXPECT_FALSE(arena.Allocate(largeLayout, largeCounts, set));
+            EXPECT_EQ(arena.GetPoolCount(), size_t(0));
+        }
+
+        vkDestroyDescriptorSetLayout(testDevice.device, largeLayout, nullptr);
+        vkDestroyDescriptorSetLayout(testDevice.device, layout, nullptr);
+    }
+
+    TEST(Renderer, VulkanDescriptorSetCache)
+    {
+        TestDevice testDevice;
+        if (testDevice.device == VK_NULL_HANDLE)
+        {
+            GTEST_SKIP();
+        }
+
+        VkDescriptorSetLayout layout = testDevice.CreateLayout(1);
+        ASSERT_NE(layout, VK_NULL_HANDLE);
+
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        ASSERT_TRUE(testDevice.CreateBuffer(1024, buffer, memory));
+
+        {
+            VulkanDescriptorSetCache cache;
+            ASSERT_TRUE(cache.Open(testDevice.device, nullptr, 1));
+
+            const VulkanDescriptorBufferBinding bindingA = { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, buffer, 0, 16 };
+            const VulkanDescriptorBufferBinding bindingB = { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, buffer, 512, 16 };
+            const VulkanDescriptorBufferBinding unsupported = { 0, VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, buffer, 0, 16 };
+
+            VkDescriptorSet setA1 = VK_NULL_HANDLE;
+            VkDescriptorSet setA2 = VK_NULL_HANDLE;
+            VkDescriptorSet setB = VK_NULL_HANDLE;
+            ASSERT_TRUE(cache.Acquire(layout, { bindingA }, setA1));
+            ASSERT_TRUE(cache.Acquire(layout, { bindingA }, setA2));
+            EXPECT_EQ(setA1, setA2);
+            EXPECT_EQ(cache.GetSetCount(), size_t(1));
+
+            ASSERT_TRUE(cache.Acquire(layout, { bindingB }, setB));
+            EXPECT_EQ(cache.GetSetCount(), size_t(2));
+            EXPECT_EQ(cache.GetPoolCount(), size_t(2));
+
+            VkDescriptorSet set = VK_NULL_HANDLE;
+            EXPECT_FALSE(cache.Acquire(layout, { unsupported }, set));
+
+            // Released set returns its descriptors, letting the next set reuse the first pool.
+            cache.Release(setA1);
+            cache.Release(setA2);
+            EXPECT_EQ(cache.GetSetCount(), size_t(1));
+            ASSERT_TRUE(cache.Acquire(layout, { bindingA }, setA1));
+            EXPECT_EQ(cache.GetPoolCount(), size_t(2));
+
+            cache.Release(setA1);
+            cache.Release(setB);
+            EXPECT_EQ(cache.GetSetCount(), size_t(0));
+        }
+
+        testDevice.DestroyBuffer(buffer, memory);
+        vkDestroyDescriptorSetLayout(testDevice.device, layout, nullptr);
+    }
+
+}
+
+#endif
@@ -39,6 +39,95 @@ namespace Molten
         EXPECT_NO_THROW(renderer->Open(*window));*/
     }
 
+    TEST(Renderer, VulkanRenderer_Offscreen)
+    {
+        VulkanRenderer renderer;
+        ASSERT_TRUE(renderer.OpenOffscreen({ 64, 32 }, Version(1, 1)));
+
+        std::vector<uint8_t> pixels;
+        EXPECT_FALSE(renderer.ReadRenderTarget(pixels));
+
+        for (size_t i = 0; i < 4; i++)
+        {
+            renderer.BeginDraw();
+            renderer.EndDraw();
+        }
+
+        ASSERT_TRUE(renderer.ReadRenderTarget(pixels));
+        ASSERT_EQ(pixels.size(), size_t(64 * 32 * 4));
+
+        // Cleared by the render pass.
+        EXPECT_NEAR(pixels[0], 77, 1);
+        EXPECT_EQ(pixels[1], 0);
+        EXPECT_EQ(pixels[2], 0);
+
+        renderer.Resize({ 16, 16 });
+        renderer.BeginDraw();
+        renderer.EndDraw();
+        ASSERT_TRUE(renderer.ReadRenderTarget(pixels));
+        EXPECT_EQ(pixels.size(), size_t(16 * 16 * 4));
+    }
+
+    TEST(Renderer, VulkanRenderer_FramesInFlightChange)
+    {
+        VulkanRenderer renderer;
+        ASSERT_TRUE(renderer.OpenOffscreen({ 16, 16 }, Version(1, 1)));
+        EXPECT_EQ(renderer.GetMaxFramesInFlight(), size_t(2));
+
+        // Per frame resources are created before the number of images changes.
+        UniformBufferDescriptor uniformBufferDesc;
+        uniformBufferDesc.size = 256;
+        UniformBuffer* uniformBuffer = renderer.CreateUniformBuffer(uniformBufferDesc);
+        ASSERT_NE(uniformBuffer, nullptr);
+
+        VertexBufferDescriptor vertexBufferDesc;
+        vertexBufferDesc.vertexCount = 4;
+        vertexBufferDesc.vertexSize = sizeof(float);
+        vertexBufferDesc.data = nullptr;
+        vertexBufferDesc.usage = VertexBuffer::Usage::Dynamic;
+        VertexBuffer* vertexBuffer = renderer.CreateVertexBuffer(vertexBufferDesc);
+        ASSERT_NE(vertexBuffer, nullptr);
+
+        IndirectBufferDescriptor indirectBufferDesc;
+        indirectBufferDesc.commandCount = 1;
+        indirectBufferDesc.commands = nullptr;
+        IndirectBuffer* indirectBuffer = renderer.CreateIndirectBuffer(indirectBufferDesc);
+        ASSERT_NE(indirectBuffer, nullptr);
+
+        auto drawFrames = [&]()
+        {
+            const float values[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+            for (size_t i = 0; i < 8; i++)
+            {
+                renderer.BeginDraw();
+                renderer.UpdateUniformBuffer(uniformBuffer, 0, sizeof(values), values);
+                EXPECT_TRUE(renderer.UpdateVertexBuffer(vertexBuffer, 4, values));
+                renderer.UpdateIndirectBufferDrawCount(indirectBuffer, 0);
+                renderer.EndDraw();
+            }
+        };
+
+        drawFrames();
+
+        // More images than at creation of the resources.
+        renderer.SetMaxFramesInFlight(3);
+        drawFrames();
+        EXPECT_EQ(renderer.GetMaxFramesInFlight(), size_t(3));
+
+        renderer.SetMaxFramesInFlight(1);
+        drawFrames();
+        EXPECT_EQ(renderer.GetMaxFramesInFlight(), size_t(1));
+
+        renderer.SetMaxFramesInFlight(VulkanRenderer::MaxFramesInFlight + 4);
+        drawFrames();
+        EXPECT_EQ(renderer.GetMaxFramesInFlight(), VulkanRenderer::MaxFramesInFlight);
+
+        renderer.WaitForDevice();
+        renderer.DestroyIndirectBuffer(indirectBuffer);
+        renderer.DestroyVertexBuffer(vertexBuffer);
+        renderer.DestroyUniformBuffer(uniformBuffer);
+    }
+
 }
 
 #endif
\ No newline at end of file
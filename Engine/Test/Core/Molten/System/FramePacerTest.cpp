@@ -0,0 +1,67 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/System/FramePacer.hpp"
+#include <thread>
+
+namespace Molten
+{
+
+    TEST(System, FramePacer)
+    {
+        {
+            FramePacer pacer;
+            EXPECT_EQ(pacer.GetFrameTime(), Time::Zero);
+            EXPECT_EQ(pacer.Wait(), Time::Zero);
+        }
+        {
+            FramePacer pacer;
+            pacer.SetFrameRate(200.0);
+            EXPECT_EQ(pacer.GetFrameTime(), Milliseconds(5));
+
+            Clock clock;
+            for (size_t i = 0; i < 10; i++)
+            {
+                pacer.Wait();
+            }
+            const Time time = clock.GetTime();
+            EXPECT_GE(time, Milliseconds(49));
+            EXPECT_LE(time, Milliseconds(500));
+        }
+        {
+            // Work longer than the frame time is not waited for.
+            FramePacer pacer(Milliseconds(5));
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            EXPECT_EQ(pacer.Wait(), Time::Zero);
+
+            // The schedule is restarted after a late frame.
+            const Time waitTime = pacer.Wait();
+            EXPECT_GE(waitTime, Milliseconds(4));
+            EXPECT_LE(waitTime, Milliseconds(100));
+        }
+    }
+
+}
\ No newline at end of file
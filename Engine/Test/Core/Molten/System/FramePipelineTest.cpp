@@ -0,0 +1,120 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/System/FramePipeline.hpp"
+#include "Molten/System/Exception.hpp"
+#include <atomic>
+
+namespace Molten
+{
+
+    TEST(System, FramePipeline)
+    {
+        struct FrameState
+        {
+            uint64_t frame;
+            uint64_t submittedFrameCount;
+        };
+
+        std::vector<uint64_t> renderedFrames;
+        std::atomic_bool renderedOnRenderThread = true;
+        std::atomic<uint64_t> maxFramesAhead = 0;
+
+        FramePipeline<FrameState>* pipelinePointer = nullptr;
+        {
+            FramePipeline<FrameState> pipeline([&](const FrameState& state)
+            {
+                renderedOnRenderThread = renderedOnRenderThread && pipelinePointer->IsRenderThread();
+
+                // Rendered frame count is incremented after this call, the simulation may be ahead by up to 2 frames.
+                const uint64_t framesAhead = pipelinePointer->GetSubmittedFrameCount() - state.frame;
+                maxFramesAhead = std::max(maxFramesAhead.load(), framesAhead);
+
+                renderedFrames.push_back(state.frame);
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }, 2);
+            pipelinePointer = &pipeline;
+
+            EXPECT_EQ(pipeline.GetMaxFramesInFlight(), size_t(2));
+            EXPECT_FALSE(pipeline.IsRenderThread());
+
+            for (uint64_t i = 0; i < 50; i++)
+            {
+                auto& state = pipeline.BeginFrame();
+                state.frame = i;
+                pipeline.EndFrame();
+
+                EXPECT_LE(pipeline.GetSubmittedFrameCount() - pipeline.GetRenderedFrameCount(), uint64_t(2));
+            }
+
+            pipeline.Wait();
+            EXPECT_EQ(pipeline.GetSubmittedFrameCount(), uint64_t(50));
+            EXPECT_EQ(pipeline.GetRenderedFrameCount(), uint64_t(50));
+
+            // Frames submitted before destruction are rendered.
+            for (uint64_t i = 50; i < 55; i++)
+            {
+                pipeline.BeginFrame().frame = i;
+                pipeline.EndFrame();
+            }
+        }
+
+        ASSERT_EQ(renderedFrames.size(), size_t(55));
+        for (size_t i = 0; i < renderedFrames.size(); i++)
+        {
+            EXPECT_EQ(renderedFrames[i], uint64_t(i));
+        }
+        EXPECT_TRUE(renderedOnRenderThread);
+        EXPECT_LE(maxFramesAhead.load(), uint64_t(2));
+    }
+
+    TEST(System, FramePipeline_Exception)
+    {
+        size_t renderCount = 0;
+        FramePipeline<int> pipeline([&](const int& value)
+        {
+            ++renderCount;
+            if (value == 1)
+            {
+                throw Exception("Render error.");
+            }
+        }, 0);
+        EXPECT_EQ(pipeline.GetMaxFramesInFlight(), size_t(1));
+
+        pipeline.BeginFrame() = 0;
+        pipeline.EndFrame();
+        pipeline.BeginFrame() = 1;
+        pipeline.EndFrame();
+        EXPECT_THROW(pipeline.Wait(), Exception);
+
+        // Rendering continues after the exception is rethrown.
+        pipeline.BeginFrame() = 2;
+        pipeline.EndFrame();
+        EXPECT_NO_THROW(pipeline.Wait());
+        EXPECT_EQ(renderCount, size_t(3));
+    }
+
+}
\ No newline at end of file
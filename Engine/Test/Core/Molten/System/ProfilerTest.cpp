@@ -0,0 +1,147 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/System/Profiler.hpp"
+#include <sstream>
+#include <thread>
+
+namespace Molten
+{
+
+    static size_t CountOccurrences(const std::string& string, const std::string& pattern)
+    {
+        size_t count = 0;
+        for (size_t position = string.find(pattern); position != std::string::npos; position = string.find(pattern, position + 1))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    TEST(System, Profiler)
+    {
+        Profiler::Clear();
+
+        Profiler::SetThreadName("Main \"thread\"");
+        {
+            Profiler::Zone outerZone("Outer");
+            Profiler::Zone innerZone("Inner");
+            Profiler::AddCounter("Entities", 42.0);
+        }
+
+        std::thread worker([]()
+        {
+            Profiler::SetThreadName("Worker");
+            Profiler::Zone zone("Work");
+        });
+        worker.join();
+
+        std::stringstream trace;
+        Profiler::WriteChromeTrace(trace);
+        const std::string json = trace.str();
+
+        EXPECT_EQ(json.find("{\"traceEvents\":["), size_t(0));
+        EXPECT_NE(json.find("\"args\":{\"name\":\"Main \\\"thread\\\"\"}"), std::string::npos);
+        EXPECT_NE(json.find("\"args\":{\"name\":\"Worker\"}"), std::string::npos);
+        EXPECT_NE(json.find("{\"name\":\"Outer\",\"ph\":\"B\""), std::string::npos);
+        EXPECT_NE(json.find("{\"name\":\"Inner\",\"ph\":\"B\""), std::string::npos);
+        EXPECT_NE(json.find("{\"name\":\"Work\",\"ph\":\"B\""), std::string::npos);
+        EXPECT_NE(json.find("{\"name\":\"Entities\",\"ph\":\"C\""), std::string::npos);
+        EXPECT_NE(json.find("\"args\":{\"value\":42}"), std::string::npos);
+        EXPECT_EQ(CountOccurrences(json, "\"ph\":\"B\""), size_t(3));
+        EXPECT_EQ(CountOccurrences(json, "\"ph\":\"E\""), size_t(3));
+        EXPECT_LT(json.find("\"Outer\""), json.find("\"Inner\""));
+
+        // Events are consumed by writing.
+        std::stringstream emptyTrace;
+        Profiler::WriteChromeTrace(emptyTrace);
+        EXPECT_EQ(CountOccurrences(emptyTrace.str(), "\"ph\":\"B\""), size_t(0));
+    }
+
+    TEST(System, Profiler_DroppedEvents)
+    {
+        Profiler::Clear();
+        EXPECT_EQ(Profiler::GetDroppedEventCount(), size_t(0));
+
+        for (size_t i = 0; i < Profiler::ThreadBufferCapacity + 10; i++)
+        {
+            Profiler::AddCounter("Counter", static_cast<double>(i));
+        }
+        EXPECT_EQ(Profiler::GetDroppedEventCount(), size_t(10));
+
+        Profiler::Clear();
+        EXPECT_EQ(Profiler::GetDroppedEventCount(), size_t(0));
+
+        Profiler::AddCounter("Counter", 1.0);
+        std::stringstream trace;
+        Profiler::WriteChromeTrace(trace);
+        EXPECT_EQ(CountOccurrences(trace.str(), "\"ph\":\"C\""), size_t(1));
+
+        // Zones not fitting in the ring are dropped with their nested zones, recorded zones keep their end event.
+        for (size_t i = 0; i < Profiler::ThreadBufferCapacity - 2; i++)
+        {
+            Profiler::AddCounter("Counter", static_cast<double>(i));
+        }
+        {
+            Profiler::Zone keptZone("Kept");
+            Profiler::Zone droppedZone("Dropped");
+            Profiler::Zone nestedZone("Nested");
+            Profiler::AddCounter("Counter", 1.0);
+        }
+        EXPECT_EQ(Profiler::GetDroppedEventCount(), size_t(5));
+
+        std::stringstream fullTrace;
+        Profiler::WriteChromeTrace(fullTrace);
+        const std::string json = fullTrace.str();
+        EXPECT_NE(json.find("{\"name\":\"Kept\",\"ph\":\"B\""), std::string::npos);
+        EXPECT_EQ(json.find("\"Dropped\""), std::string::npos);
+        EXPECT_EQ(json.find("\"Nested\""), std::string::npos);
+        EXPECT_EQ(CountOccurrences(json, "\"ph\":\"B\""), size_t(1));
+        EXPECT_EQ(CountOccurrences(json, "\"ph\":\"E\""), size_t(1));
+    }
+
+    TEST(System, Profiler_Macros)
+    {
+        Profiler::Clear();
+        {
+            MOLTEN_PROFILE_ZONE("MacroZone");
+            MOLTEN_PROFILE_COUNTER("MacroCounter", 3);
+        }
+
+        std::stringstream trace;
+        Profiler::WriteChromeTrace(trace);
+        const std::string json = trace.str();
+
+#if defined(MOLTEN_ENABLE_PROFILER)
+        EXPECT_NE(json.find("\"MacroZone\""), std::string::npos);
+        EXPECT_NE(json.find("\"MacroCounter\""), std::string::npos);
+#else
+        EXPECT_EQ(json.find("\"MacroZone\""), std::string::npos);
+        EXPECT_EQ(json.find("\"MacroCounter\""), std::string::npos);
+#endif
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+/*
+* MIT License
+*
+* Copyright (c) 2020 Jimmie Bergmann
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files(the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions :
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "Test.hpp"
+#include "Molten/System/ThreadPool.hpp"
+#include "Molten/System/Exception.hpp"
+#include <atomic>
+
+namespace Molten
+{
+
+    TEST(System, ThreadPool)
+    {
+        {
+            ThreadPool threadPool(4);
+            EXPECT_EQ(threadPool.GetThreadCount(), size_t(4));
+            EXPECT_FALSE(threadPool.IsWorkerThread());
+
+            std::vector<std::future<size_t>> futures;
+            for (size_t i = 0; i < 100; i++)
+            {
+                futures.push_back(threadPool.Execute([i]()
+                {
+                    return i * 2;
+                }));
+            }
+            for (size_t i = 0; i < futures.size(); i++)
+            {
+                EXPECT_EQ(futures[i].get(), i * 2);
+            }
+
+            auto workerFuture = threadPool.Execute([&threadPool]()
+            {
+                return threadPool.IsWorkerThread();
+            });
+            EXPECT_TRUE(workerFuture.get());
+
+            auto exceptionFuture = threadPool.Execute([]()
+            {
+                throw Exception("Task exception.");
+            });
+            EXPECT_THROW(exceptionFuture.get(), Exception);
+        }
+        {
+            std::atomic<size_t> counter(0);
+            {
+                ThreadPool threadPool(2);
+                for (size_t i = 0; i < 50; i++)
+                {
+                    threadPool.Execute([&counter]()
+                    {
+                        ++counter;
+                    });
+                }
+                threadPool.Wait();
+                EXPECT_EQ(counter.load(), size_t(50));
+
+                for (size_t i = 0; i < 50; i++)
+                {
+                    threadPool.Execute([&counter]()
+                    {
+                        ++counter;
+                    });
+                }
+            }
+            EXPECT_EQ(counter.load(), size_t(100));
+        }
+        {
+            ThreadPool threadPool;
+            EXPECT_GE(threadPool.GetThreadCount(), size_t(1));
+        }
+    }
+
+}
\ No newline at end of file